@@ -42,10 +42,12 @@ SOFTWARE.
 #include "stl/functional.h"
 
 #include <stdint.h>
+#include <string.h>
 
 #include "platform.h"
 #include "iterator.h"
 #include "type_traits.h"
+#include "binary.h"
 
 namespace etl
 {
@@ -1122,47 +1124,1252 @@ namespace etl
     return std::pair<TDestinationTrue, TDestinationFalse>(destination_true, destination_false);
   }
 
+  namespace private_sort
+  {
+    //*************************************************************************
+    /// Tuning constants for the sort algorithms.
+    //*************************************************************************
+    enum
+    {
+      INSERTION_SORT_THRESHOLD     = 24,  ///< Ranges smaller than this are insertion sorted.
+      NINTHER_THRESHOLD            = 128, ///< Ranges larger than this use the pseudo median of nine as the pivot.
+      PARTIAL_INSERTION_SORT_LIMIT = 8,   ///< The number of moves allowed when trying to finish an almost sorted range.
+      MERGE_SORT_THRESHOLD         = 16   ///< Merge sort runs smaller than this are insertion sorted.
+    };
+
+    //*************************************************************************
+    /// Returns floor(log2(n)).
+    //*************************************************************************
+    template <typename TDistance>
+    int log2(TDistance n)
+    {
+      int result = 0;
+
+      while (n > 1)
+      {
+        n >>= 1;
+        ++result;
+      }
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Rotates [first, last) so that 'middle' becomes the first element.
+    /// Works with forward iterators.
+    //*************************************************************************
+    template <typename TIterator>
+    void rotate(TIterator first, TIterator middle, TIterator last)
+    {
+      if ((first == middle) || (middle == last))
+      {
+        return;
+      }
+
+      TIterator next = middle;
+
+      while (first != next)
+      {
+        std::iter_swap(first++, next++);
+
+        if (next == last)
+        {
+          next = middle;
+        }
+        else if (first == middle)
+        {
+          middle = next;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Sorts two elements.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void sort2(TIterator a, TIterator b, TCompare compare)
+    {
+      if (compare(*b, *a))
+      {
+        std::iter_swap(a, b);
+      }
+    }
+
+    //*************************************************************************
+    /// Sorts three elements.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void sort3(TIterator a, TIterator b, TIterator c, TCompare compare)
+    {
+      sort2(a, b, compare);
+      sort2(b, c, compare);
+      sort2(a, b, compare);
+    }
+
+    //*************************************************************************
+    /// Insertion sort.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void insertion_sort(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename std::iterator_traits<TIterator>::value_type value_t;
+
+      if (first == last)
+      {
+        return;
+      }
+
+      for (TIterator current = first + 1; current != last; ++current)
+      {
+        TIterator hole     = current;
+        TIterator previous = current - 1;
+
+        if (compare(*hole, *previous))
+        {
+          value_t value = *hole;
+
+          do
+          {
+            *hole-- = *previous;
+          } while ((hole != first) && compare(value, *--previous));
+
+          *hole = value;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Insertion sort that assumes that the element before 'first' is not
+    /// greater than any element in the range.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void unguarded_insertion_sort(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename std::iterator_traits<TIterator>::value_type value_t;
+
+      if (first == last)
+      {
+        return;
+      }
+
+      for (TIterator current = first + 1; current != last; ++current)
+      {
+        TIterator hole     = current;
+        TIterator previous = current - 1;
+
+        if (compare(*hole, *previous))
+        {
+          value_t value = *hole;
+
+          do
+          {
+            *hole-- = *previous;
+          } while (compare(value, *--previous));
+
+          *hole = value;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Attempts an insertion sort, giving up after a limited number of moves.
+    /// Returns true if the range was sorted.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    bool partial_insertion_sort(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename std::iterator_traits<TIterator>::value_type      value_t;
+      typedef typename std::iterator_traits<TIterator>::difference_type difference_t;
+
+      if (first == last)
+      {
+        return true;
+      }
+
+      difference_t moves = 0;
+
+      for (TIterator current = first + 1; current != last; ++current)
+      {
+        TIterator hole     = current;
+        TIterator previous = current - 1;
+
+        if (compare(*hole, *previous))
+        {
+          value_t value = *hole;
+
+          do
+          {
+            *hole-- = *previous;
+          } while ((hole != first) && compare(value, *--previous));
+
+          *hole = value;
+          moves += current - hole;
+
+          if (moves > PARTIAL_INSERTION_SORT_LIMIT)
+          {
+            return (current + 1) == last;
+          }
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Restores the heap property below 'index'.
+    //*************************************************************************
+    template <typename TIterator, typename TDistance, typename TCompare>
+    void sift_down(TIterator first, TDistance index, TDistance length, TCompare compare)
+    {
+      typedef typename std::iterator_traits<TIterator>::value_type value_t;
+
+      value_t value = *(first + index);
+
+      for (;;)
+      {
+        TDistance child = (2 * index) + 1;
+
+        if (child >= length)
+        {
+          break;
+        }
+
+        if (((child + 1) < length) && compare(*(first + child), *(first + (child + 1))))
+        {
+          ++child;
+        }
+
+        if (!compare(value, *(first + child)))
+        {
+          break;
+        }
+
+        *(first + index) = *(first + child);
+        index = child;
+      }
+
+      *(first + index) = value;
+    }
+
+    //*************************************************************************
+    /// Makes a max heap of [first, first + length).
+    //*************************************************************************
+    template <typename TIterator, typename TDistance, typename TCompare>
+    void make_heap(TIterator first, TDistance length, TCompare compare)
+    {
+      for (TDistance index = length / 2; index > 0; --index)
+      {
+        sift_down(first, TDistance(index - 1), length, compare);
+      }
+    }
+
+    //*************************************************************************
+    /// Sorts a max heap of [first, first + length).
+    //*************************************************************************
+    template <typename TIterator, typename TDistance, typename TCompare>
+    void sort_heap(TIterator first, TDistance length, TCompare compare)
+    {
+      while (length > 1)
+      {
+        --length;
+        std::iter_swap(first, first + length);
+        sift_down(first, TDistance(0), length, compare);
+      }
+    }
+
+    //*************************************************************************
+    /// Heap sort. The fallback that guarantees O(N log N).
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void heap_sort(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename std::iterator_traits<TIterator>::difference_type difference_t;
+
+      difference_t length = last - first;
+
+      make_heap(first, length, compare);
+      sort_heap(first, length, compare);
+    }
+
+    //*************************************************************************
+    /// Partitions around the pivot at *first. Elements equal to the pivot go
+    /// to the right. Returns the position of the pivot, and whether the range
+    /// was already partitioned.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    std::pair<TIterator, bool> partition_right(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename std::iterator_traits<TIterator>::value_type value_t;
+
+      value_t pivot = *first;
+
+      TIterator begin = first;
+      TIterator end   = last;
+
+      // There is an element not less than the pivot at the end (median of three).
+      while (compare(*++begin, pivot))
+      {
+      }
+
+      if ((begin - 1) == first)
+      {
+        while ((begin < end) && !compare(*--end, pivot))
+        {
+        }
+      }
+      else
+      {
+        // There is an element less than the pivot on the left.
+        while (!compare(*--end, pivot))
+        {
+        }
+      }
+
+      const bool already_partitioned = (begin >= end);
+
+      while (begin < end)
+      {
+        std::iter_swap(begin, end);
+
+        while (compare(*++begin, pivot))
+        {
+        }
+
+        while (!compare(*--end, pivot))
+        {
+        }
+      }
+
+      TIterator pivot_position = begin - 1;
+      *first = *pivot_position;
+      *pivot_position = pivot;
+
+      return std::pair<TIterator, bool>(pivot_position, already_partitioned);
+    }
+
+    //*************************************************************************
+    /// Partitions around the pivot at *first. Elements equal to the pivot go
+    /// to the left. Used when the pivot equals the element before the range,
+    /// so that runs of equal elements are dealt with in linear time.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    TIterator partition_left(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename std::iterator_traits<TIterator>::value_type value_t;
+
+      value_t pivot = *first;
+
+      TIterator begin = first;
+      TIterator end   = last;
+
+      while (compare(pivot, *--end))
+      {
+      }
+
+      if ((end + 1) == last)
+      {
+        while ((begin < end) && !compare(pivot, *++begin))
+        {
+        }
+      }
+      else
+      {
+        while (!compare(pivot, *++begin))
+        {
+        }
+      }
+
+      while (begin < end)
+      {
+        std::iter_swap(begin, end);
+
+        while (compare(pivot, *--end))
+        {
+        }
+
+        while (!compare(pivot, *++begin))
+        {
+        }
+      }
+
+      TIterator pivot_position = end;
+      *first = *pivot_position;
+      *pivot_position = pivot;
+
+      return pivot_position;
+    }
+
+    //*************************************************************************
+    /// Moves the median of three, or the pseudo median of nine, to *first.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void choose_pivot(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename std::iterator_traits<TIterator>::difference_type difference_t;
+
+      difference_t size = last - first;
+      difference_t half = size / 2;
+
+      if (size > NINTHER_THRESHOLD)
+      {
+        sort3(first, first + half, last - 1, compare);
+        sort3(first + 1, first + (half - 1), last - 2, compare);
+        sort3(first + 2, first + (half + 1), last - 3, compare);
+        sort3(first + (half - 1), first + half, first + (half + 1), compare);
+        std::iter_swap(first, first + half);
+      }
+      else
+      {
+        sort3(first + half, first, last - 1, compare);
+      }
+    }
+
+    //*************************************************************************
+    /// Swaps some elements to break up patterns after a badly unbalanced partition.
+    //*************************************************************************
+    template <typename TIterator, typename TDistance>
+    void break_patterns(TIterator first, TIterator last, TDistance size)
+    {
+      if (size >= INSERTION_SORT_THRESHOLD)
+      {
+        std::iter_swap(first, first + (size / 4));
+        std::iter_swap(last - 1, last - (size / 4));
+
+        if (size > NINTHER_THRESHOLD)
+        {
+          std::iter_swap(first + 1, first + ((size / 4) + 1));
+          std::iter_swap(first + 2, first + ((size / 4) + 2));
+          std::iter_swap(last - 2, last - ((size / 4) + 1));
+          std::iter_swap(last - 3, last - ((size / 4) + 2));
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Pattern defeating quicksort.
+    /// Recurses on the smaller partition so the stack depth is O(log N).
+    ///\param bad_allowed The number of unbalanced partitions before switching to heap sort.
+    ///\param leftmost    Is this the leftmost part of the whole range?
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void pdqsort(TIterator first, TIterator last, TCompare compare, int bad_allowed, bool leftmost)
+    {
+      typedef typename std::iterator_traits<TIterator>::difference_type difference_t;
+
+      for (;;)
+      {
+        difference_t size = last - first;
+
+        if (size < INSERTION_SORT_THRESHOLD)
+        {
+          if (leftmost)
+          {
+            insertion_sort(first, last, compare);
+          }
+          else
+          {
+            unguarded_insertion_sort(first, last, compare);
+          }
+
+          return;
+        }
+
+        choose_pivot(first, last, compare);
+
+        // If the pivot equals the element before the range then everything
+        // equal to the pivot can be skipped.
+        if (!leftmost && !compare(*(first - 1), *first))
+        {
+          first = partition_left(first, last, compare) + 1;
+          continue;
+        }
+
+        std::pair<TIterator, bool> result = partition_right(first, last, compare);
+        TIterator pivot_position = result.first;
+
+        difference_t left_size  = pivot_position - first;
+        difference_t right_size = last - (pivot_position + 1);
+
+        if ((left_size < (size / 8)) || (right_size < (size / 8)))
+        {
+          if (--bad_allowed == 0)
+          {
+            heap_sort(first, last, compare);
+            return;
+          }
+
+          break_patterns(first, pivot_position, left_size);
+          break_patterns(pivot_position + 1, last, right_size);
+        }
+        else if (result.second &&
+                 partial_insertion_sort(first, pivot_position, compare) &&
+                 partial_insertion_sort(pivot_position + 1, last, compare))
+        {
+          // The range was already, or nearly, sorted.
+          return;
+        }
+
+        if (left_size < right_size)
+        {
+          pdqsort(first, pivot_position, compare, bad_allowed, leftmost);
+          first    = pivot_position + 1;
+          leftmost = false;
+        }
+        else
+        {
+          pdqsort(pivot_position + 1, last, compare, bad_allowed, false);
+          last = pivot_position;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Stable binary insertion sort for forward iterators.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void stable_insertion_sort(TIterator first, TIterator last, TCompare compare)
+    {
+      if (first == last)
+      {
+        return;
+      }
+
+      TIterator current = first;
+      ++current;
+
+      while (current != last)
+      {
+        TIterator next = current;
+        ++next;
+
+        TIterator position = std::upper_bound(first, current, *current, compare);
+        private_sort::rotate(position, current, next);
+
+        current = next;
+      }
+    }
+
+    //*************************************************************************
+    /// Moves the second run to the buffer and merges backwards.
+    /// Only possible for bidirectional iterators.
+    //*************************************************************************
+    template <typename TIterator, typename TBuffer, typename TCompare>
+    bool merge_backward(TIterator first, TIterator middle, TIterator last, TBuffer buffer, TCompare compare, std::bidirectional_iterator_tag)
+    {
+      TBuffer buffer_end = std::copy(middle, last, buffer);
+
+      while (buffer != buffer_end)
+      {
+        if (middle == first)
+        {
+          std::copy_backward(buffer, buffer_end, last);
+          break;
+        }
+
+        TIterator left  = middle;
+        TBuffer   right = buffer_end;
+        --left;
+        --right;
+
+        if (compare(*right, *left))
+        {
+          *--last = *left;
+          middle  = left;
+        }
+        else
+        {
+          *--last    = *right;
+          buffer_end = right;
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Forward iterators cannot merge backwards.
+    //*************************************************************************
+    template <typename TIterator, typename TBuffer, typename TCompare>
+    bool merge_backward(TIterator, TIterator, TIterator, TBuffer, TCompare, std::forward_iterator_tag)
+    {
+      return false;
+    }
+
+    //*************************************************************************
+    /// Stable merge of [first, middle) and [middle, last).
+    /// If either run fits in the buffer it is merged in one pass, otherwise
+    /// the runs are split and rotated until the pieces fit, or are merged with
+    /// no buffer at all.
+    //*************************************************************************
+    template <typename TIterator, typename TDistance, typename TBuffer, typename TCompare>
+    void merge_adaptive(TIterator first, TIterator middle, TIterator last,
+                        TDistance length1, TDistance length2,
+                        TBuffer buffer, TDistance buffer_length,
+                        TCompare compare)
+    {
+      if ((length1 == 0) || (length2 == 0))
+      {
+        return;
+      }
+
+      if ((length1 + length2) == 2)
+      {
+        sort2(first, middle, compare);
+        return;
+      }
+
+      if (length1 <= buffer_length)
+      {
+        // Move the first run to the buffer and merge forwards.
+        TBuffer buffer_end = std::copy(first, middle, buffer);
+
+        while ((buffer != buffer_end) && (middle != last))
+        {
+          if (compare(*middle, *buffer))
+          {
+            *first++ = *middle++;
+          }
+          else
+          {
+            *first++ = *buffer++;
+          }
+        }
+
+        std::copy(buffer, buffer_end, first);
+        return;
+      }
+
+      if (length2 <= buffer_length)
+      {
+        typedef typename std::iterator_traits<TIterator>::iterator_category iterator_category;
+
+        if (merge_backward(first, middle, last, buffer, compare, iterator_category()))
+        {
+          return;
+        }
+      }
+
+      TIterator first_cut  = first;
+      TIterator second_cut = middle;
+      TDistance length11;
+      TDistance length22;
+
+      if (length1 > length2)
+      {
+        length11 = length1 / 2;
+        std::advance(first_cut, length11);
+        second_cut = std::lower_bound(middle, last, *first_cut, compare);
+        length22   = TDistance(std::distance(middle, second_cut));
+      }
+      else
+      {
+        length22 = length2 / 2;
+        std::advance(second_cut, length22);
+        first_cut = std::upper_bound(first, middle, *second_cut, compare);
+        length11  = TDistance(std::distance(first, first_cut));
+      }
+
+      private_sort::rotate(first_cut, middle, second_cut);
+
+      TIterator new_middle = first_cut;
+      std::advance(new_middle, length22);
+
+      merge_adaptive(first, first_cut, new_middle, length11, length22, buffer, buffer_length, compare);
+      merge_adaptive(new_middle, second_cut, last, TDistance(length1 - length11), TDistance(length2 - length22), buffer, buffer_length, compare);
+    }
+
+    //*************************************************************************
+    /// Stable merge sort using a buffer of up to 'buffer_length' elements.
+    //*************************************************************************
+    template <typename TIterator, typename TDistance, typename TBuffer, typename TCompare>
+    void merge_sort(TIterator first, TIterator last, TDistance length,
+                    TBuffer buffer, TDistance buffer_length,
+                    TCompare compare)
+    {
+      if (length < MERGE_SORT_THRESHOLD)
+      {
+        stable_insertion_sort(first, last, compare);
+        return;
+      }
+
+      TDistance half   = length / 2;
+      TIterator middle = first;
+      std::advance(middle, half);
+
+      merge_sort(first, middle, half, buffer, buffer_length, compare);
+      merge_sort(middle, last, TDistance(length - half), buffer, buffer_length, compare);
+      merge_adaptive(first, middle, last, half, TDistance(length - half), buffer, buffer_length, compare);
+    }
+
+    //*************************************************************************
+    /// Sort for random access iterators.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void sort(TIterator first, TIterator last, TCompare compare, std::random_access_iterator_tag)
+    {
+      if ((last - first) > 1)
+      {
+        pdqsort(first, last, compare, private_sort::log2(last - first), true);
+      }
+    }
+
+    //*************************************************************************
+    /// Sort for forward and bidirectional iterators.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void sort(TIterator first, TIterator last, TCompare compare, std::forward_iterator_tag)
+    {
+      typedef typename std::iterator_traits<TIterator>::difference_type difference_t;
+
+      merge_sort(first, last, difference_t(std::distance(first, last)), first, difference_t(0), compare);
+    }
+  }
+
   //***************************************************************************
-  /// Sorts the elements using shell sort.
+  /// Sorts the elements.
+  /// Random access ranges use a pattern defeating quicksort that falls back to
+  /// heap sort, so the worst case is O(N log N). Other ranges use an in-place
+  /// merge sort. Does not allocate.
   /// Uses users defined comparison.
   ///\ingroup algorithm
   //***************************************************************************
   template <typename TIterator, typename TCompare>
   void sort(TIterator first, TIterator last, TCompare compare)
+  {
+    typedef typename std::iterator_traits<TIterator>::iterator_category iterator_category;
+
+    private_sort::sort(first, last, compare, iterator_category());
+  }
+
+  //***************************************************************************
+  /// Sorts the elements.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator>
+  void sort(TIterator first, TIterator last)
+  {
+    etl::sort(first, last, std::less<typename std::iterator_traits<TIterator>::value_type>());
+  }
+
+  //***************************************************************************
+  /// Sorts the elements, preserving the order of equal elements.
+  /// Uses an in-place merge sort. O(N log^2 N). Does not allocate.
+  /// Uses users defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  void stable_sort(TIterator first, TIterator last, TCompare compare)
+  {
+    typedef typename std::iterator_traits<TIterator>::difference_type difference_t;
+
+    private_sort::merge_sort(first, last, difference_t(std::distance(first, last)), first, difference_t(0), compare);
+  }
+
+  //***************************************************************************
+  /// Sorts the elements, preserving the order of equal elements.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator>
+  void stable_sort(TIterator first, TIterator last)
+  {
+    etl::stable_sort(first, last, std::less<typename std::iterator_traits<TIterator>::value_type>());
+  }
+
+  //***************************************************************************
+  /// Sorts the elements, preserving the order of equal elements.
+  /// Merges are done through the caller supplied buffer where they fit, so a
+  /// buffer of half the range gives O(N log N).
+  ///\param buffer_first The start of the buffer of assignable elements.
+  ///\param buffer_last  The end of the buffer.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TBuffer, typename TCompare>
+  void stable_sort(TIterator first, TIterator last, TBuffer buffer_first, TBuffer buffer_last, TCompare compare)
+  {
+    typedef typename std::iterator_traits<TIterator>::difference_type difference_t;
+
+    private_sort::merge_sort(first, last,
+                             difference_t(std::distance(first, last)),
+                             buffer_first,
+                             difference_t(std::distance(buffer_first, buffer_last)),
+                             compare);
+  }
+
+  //***************************************************************************
+  /// Sorts the elements, preserving the order of equal elements, using a
+  /// caller supplied buffer.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TBuffer>
+  void stable_sort(TIterator first, TIterator last, TBuffer buffer_first, TBuffer buffer_last)
+  {
+    etl::stable_sort(first, last, buffer_first, buffer_last, std::less<typename std::iterator_traits<TIterator>::value_type>());
+  }
+
+  //***************************************************************************
+  /// Sorts the smallest (middle - first) elements into [first, middle).
+  /// The order of the remaining elements is unspecified.
+  /// Uses a heap. O(N log M). Requires random access iterators.
+  /// Uses users defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  void partial_sort(TIterator first, TIterator middle, TIterator last, TCompare compare)
   {
     typedef typename std::iterator_traits<TIterator>::difference_type difference_t;
-  
-    difference_t n = std::distance(first, last);
 
-    for (difference_t i = n / 2; i > 0; i /= 2) 
+    difference_t length = middle - first;
+
+    if (length == 0)
+    {
+      return;
+    }
+
+    private_sort::make_heap(first, length, compare);
+
+    for (TIterator itr = middle; itr != last; ++itr)
+    {
+      if (compare(*itr, *first))
+      {
+        std::iter_swap(itr, first);
+        private_sort::sift_down(first, difference_t(0), length, compare);
+      }
+    }
+
+    private_sort::sort_heap(first, length, compare);
+  }
+
+  //***************************************************************************
+  /// Sorts the smallest (middle - first) elements into [first, middle).
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator>
+  void partial_sort(TIterator first, TIterator middle, TIterator last)
+  {
+    etl::partial_sort(first, middle, last, std::less<typename std::iterator_traits<TIterator>::value_type>());
+  }
+
+  //***************************************************************************
+  /// Places the element that would be at 'nth' in a sorted range at 'nth'.
+  /// No element before 'nth' is greater and no element after is less.
+  /// Uses quickselect, falling back to a heap select, so the worst case is
+  /// O(N log N). Requires random access iterators.
+  /// Uses users defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  void nth_element(TIterator first, TIterator nth, TIterator last, TCompare compare)
+  {
+    if (nth == last)
+    {
+      return;
+    }
+
+    int depth_limit = 2 * private_sort::log2(last - first);
+
+    while ((last - first) >= private_sort::INSERTION_SORT_THRESHOLD)
+    {
+      if (depth_limit-- == 0)
+      {
+        etl::partial_sort(first, nth + 1, last, compare);
+        return;
+      }
+
+      private_sort::choose_pivot(first, last, compare);
+      TIterator pivot_position = private_sort::partition_right(first, last, compare).first;
+
+      if (pivot_position == nth)
+      {
+        return;
+      }
+      else if (nth < pivot_position)
+      {
+        last = pivot_position;
+      }
+      else
+      {
+        first = pivot_position + 1;
+      }
+    }
+
+    private_sort::insertion_sort(first, last, compare);
+  }
+
+  //***************************************************************************
+  /// Places the element that would be at 'nth' in a sorted range at 'nth'.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator>
+  void nth_element(TIterator first, TIterator nth, TIterator last)
+  {
+    etl::nth_element(first, nth, last, std::less<typename std::iterator_traits<TIterator>::value_type>());
+  }
+
+  namespace private_radix_sort
+  {
+    //*************************************************************************
+    /// Returns the element as its own key.
+    //*************************************************************************
+    template <typename T>
+    struct identity
+    {
+      const T& operator ()(const T& value) const
+      {
+        return value;
+      }
+    };
+
+    //*************************************************************************
+    /// Transforms a key into an unsigned integral whose natural order matches
+    /// the order of the key.
+    //*************************************************************************
+    template <typename TKey,
+              const bool IS_FLOAT  = etl::is_floating_point<TKey>::value,
+              const bool IS_SIGNED = etl::is_signed<TKey>::value>
+    struct radix_key;
+
+    /// Unsigned integrals are used as they are.
+    template <typename TKey>
+    struct radix_key<TKey, false, false>
+    {
+      typedef typename etl::make_unsigned<TKey>::type type;
+
+      static type transform(TKey key)
+      {
+        return type(key);
+      }
+    };
+
+    /// Signed integrals have the sign bit flipped.
+    template <typename TKey>
+    struct radix_key<TKey, false, true>
+    {
+      typedef typename etl::make_unsigned<TKey>::type type;
+
+      static type transform(TKey key)
+      {
+        return type(key) ^ type(type(1) << (etl::integral_limits<type>::bits - 1));
+      }
+    };
+
+    /// Floating point values have all bits flipped if negative, or the sign bit flipped if positive.
+    template <typename TKey>
+    struct radix_key<TKey, true, true>
+    {
+      ETL_STATIC_ASSERT((sizeof(TKey) == sizeof(uint32_t)) || (sizeof(TKey) == sizeof(uint64_t)), "Unsupported floating point type");
+
+      typedef typename etl::conditional<sizeof(TKey) == sizeof(uint32_t), uint32_t, uint64_t>::type type;
+
+      static type transform(TKey key)
+      {
+        type bits;
+        memcpy(&bits, &key, sizeof(type));
+
+        const type SIGN_BIT = type(type(1) << (etl::integral_limits<type>::bits - 1));
+
+        return (bits & SIGN_BIT) ? type(~bits) : type(bits ^ SIGN_BIT);
+      }
+    };
+
+    //*************************************************************************
+    /// One least significant digit pass for arithmetic keys.
+    /// Returns false if every key had the same digit and nothing was moved.
+    //*************************************************************************
+    template <const size_t RADIX_BITS, typename TKeyType, typename TSource, typename TDestination, typename TDistance, typename TKeyExtractor>
+    bool arithmetic_pass(TSource first, TSource last, TDestination destination, TDistance length, TKeyExtractor key, size_t shift)
+    {
+      typedef typename etl::max_value_for_nbits<RADIX_BITS>::value_type mask_t;
+
+      const size_t BUCKETS = size_t(1) << RADIX_BITS;
+      const mask_t MASK    = etl::max_value_for_nbits<RADIX_BITS>::value;
+
+      TDistance counts[BUCKETS];
+      std::fill(counts, counts + BUCKETS, TDistance(0));
+
+      for (TSource itr = first; itr != last; ++itr)
+      {
+        ++counts[size_t((radix_key<TKeyType>::transform(key(*itr)) >> shift) & MASK)];
+      }
+
+      if (counts[size_t((radix_key<TKeyType>::transform(key(*first)) >> shift) & MASK)] == length)
+      {
+        return false;
+      }
+
+      TDistance offset = 0;
+
+      for (size_t i = 0; i < BUCKETS; ++i)
+      {
+        TDistance count = counts[i];
+        counts[i] = offset;
+        offset += count;
+      }
+
+      for (TSource itr = first; itr != last; ++itr)
+      {
+        destination[counts[size_t((radix_key<TKeyType>::transform(key(*itr)) >> shift) & MASK)]++] = *itr;
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Returns the radix sort bucket for a character position in a string key.
+    /// Bucket 0 is used for positions past the end of the key.
+    /// Single byte characters are sorted in one pass, bucket = character + 1.
+    /// Wider characters are sorted one byte at a time, least significant first,
+    /// followed by a pass that puts the keys that end before the position first.
+    //*************************************************************************
+    template <typename TString>
+    size_t string_bucket(const TString& key, size_t position, size_t byte)
+    {
+      typedef typename etl::make_unsigned<typename TString::value_type>::type uchar_t;
+
+      if (position >= key.size())
+      {
+        return 0;
+      }
+
+      const uchar_t c = uchar_t(key[position]);
+
+      if (sizeof(uchar_t) == 1)
+      {
+        return size_t(c) + 1;
+      }
+      else if (byte == sizeof(uchar_t))
+      {
+        return 1;
+      }
+      else
+      {
+        return size_t((c >> (8 * byte)) & 0xFF);
+      }
+    }
+
+    //*************************************************************************
+    /// One least significant digit pass for string keys.
+    /// Returns false if every key had the same character and nothing was moved.
+    //*************************************************************************
+    template <typename TSource, typename TDestination, typename TDistance, typename TKeyExtractor>
+    bool string_pass(TSource first, TSource last, TDestination destination, TDistance length, TKeyExtractor key, size_t position, size_t byte)
+    {
+      const size_t BUCKETS = 257;
+
+      TDistance counts[BUCKETS];
+      std::fill(counts, counts + BUCKETS, TDistance(0));
+
+      for (TSource itr = first; itr != last; ++itr)
+      {
+        ++counts[string_bucket(key(*itr), position, byte)];
+      }
+
+      if (counts[string_bucket(key(*first), position, byte)] == length)
+      {
+        return false;
+      }
+
+      TDistance offset = 0;
+
+      for (size_t i = 0; i < BUCKETS; ++i)
+      {
+        TDistance count = counts[i];
+        counts[i] = offset;
+        offset += count;
+      }
+
+      for (TSource itr = first; itr != last; ++itr)
+      {
+        destination[counts[string_bucket(key(*itr), position, byte)]++] = *itr;
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Compares elements by key.
+    //*************************************************************************
+    template <typename TKeyExtractor>
+    struct key_compare
+    {
+      explicit key_compare(TKeyExtractor key_)
+        : key(key_)
+      {
+      }
+
+      template <typename T>
+      bool operator ()(const T& lhs, const T& rhs) const
+      {
+        return key(lhs) < key(rhs);
+      }
+
+      TKeyExtractor key;
+    };
+
+    //*************************************************************************
+    /// Radix sort for arithmetic keys.
+    //*************************************************************************
+    template <const size_t RADIX_BITS, typename TIterator, typename TBuffer, typename TDistance, typename TKeyExtractor, typename TKey>
+    void sort(TIterator first, TIterator last, TBuffer buffer, TDistance length, TKeyExtractor key, const TKey&, etl::true_type)
+    {
+      typedef typename radix_key<TKey>::type key_t;
+
+      const size_t KEY_BITS = etl::integral_limits<key_t>::bits;
+
+      bool in_buffer = false;
+
+      for (size_t shift = 0; shift < KEY_BITS; shift += RADIX_BITS)
+      {
+        if (in_buffer)
+        {
+          if (arithmetic_pass<RADIX_BITS, TKey>(buffer, buffer + length, first, length, key, shift))
+          {
+            in_buffer = false;
+          }
+        }
+        else
+        {
+          if (arithmetic_pass<RADIX_BITS, TKey>(first, last, buffer, length, key, shift))
+          {
+            in_buffer = true;
+          }
+        }
+      }
+
+      if (in_buffer)
+      {
+        std::copy(buffer, buffer + length, first);
+      }
+    }
+
+    //*************************************************************************
+    /// Radix sort for string keys.
+    //*************************************************************************
+    template <const size_t RADIX_BITS, typename TIterator, typename TBuffer, typename TDistance, typename TKeyExtractor, typename TKey>
+    void sort(TIterator first, TIterator last, TBuffer buffer, TDistance length, TKeyExtractor key, const TKey&, etl::false_type)
     {
-      for (difference_t j = i; j < n; ++j) 
+      const size_t CHAR_BYTES = sizeof(typename TKey::value_type);
+      const size_t PASSES     = (CHAR_BYTES == 1) ? 1 : CHAR_BYTES + 1;
+
+      size_t max_length = 0;
+
+      for (TIterator itr = first; itr != last; ++itr)
+      {
+        size_t key_length = key(*itr).size();
+        max_length = (key_length > max_length) ? key_length : max_length;
+      }
+
+      bool in_buffer = false;
+
+      for (size_t position = max_length; position > 0; --position)
       {
-        for (difference_t k = j - i; k >= 0; k -= i)
+        for (size_t byte = 0; byte < PASSES; ++byte)
         {
-          TIterator itr1 = first; 
-          TIterator itr2 = first;
-          
-          std::advance(itr1, k);
-          std::advance(itr2, k + i);
-          
-          if (compare(*itr2, *itr1))
+          if (in_buffer)
+          {
+            if (string_pass(buffer, buffer + length, first, length, key, position - 1, byte))
+            {
+              in_buffer = false;
+            }
+          }
+          else
           {
-            std::iter_swap(itr1, itr2);
+            if (string_pass(first, last, buffer, length, key, position - 1, byte))
+            {
+              in_buffer = true;
+            }
           }
         }
       }
+
+      if (in_buffer)
+      {
+        std::copy(buffer, buffer + length, first);
+      }
+    }
+
+    //*************************************************************************
+    /// Selects the arithmetic or string sort from the type of the key.
+    //*************************************************************************
+    template <const size_t RADIX_BITS, typename TIterator, typename TBuffer, typename TDistance, typename TKeyExtractor, typename TKey>
+    void sort(TIterator first, TIterator last, TBuffer buffer, TDistance length, TKeyExtractor key, const TKey& sample)
+    {
+      private_radix_sort::sort<RADIX_BITS>(first, last, buffer, length, key, sample,
+                                           etl::integral_constant<bool, etl::is_arithmetic<TKey>::value>());
     }
   }
 
   //***************************************************************************
-  /// Sorts the elements using shell sort.
+  /// Sorts the elements by key using a stable least significant digit radix
+  /// sort. O(N) for a fixed key size. Does not allocate.
+  /// Integral and floating point keys are sorted RADIX_BITS at a time.
+  /// String keys (anything with value_type, size() and operator[]) are sorted
+  /// one character at a time, in lexicographical order. Characters wider than
+  /// a byte take one pass per byte.
+  /// Each pass keeps a histogram of 2^RADIX_BITS counts on the stack.
+  /// Passes where every key has the same digit are skipped.
+  /// If the buffer is smaller than the range then falls back to etl::stable_sort.
+  ///\tparam RADIX_BITS   The number of bits sorted per pass, 1 to 11. 8 or 11 are good choices.
+  ///\param first         The start of the range. Must be random access.
+  ///\param last          The end of the range.
+  ///\param buffer_first  The start of the scratch buffer. Must be random access.
+  ///\param buffer_last   The end of the scratch buffer.
+  ///\param key           Returns the key for an element.
   ///\ingroup algorithm
   //***************************************************************************
-  template <typename TIterator>
-  void sort(TIterator first, TIterator last)
+  template <const size_t RADIX_BITS, typename TIterator, typename TBuffer, typename TKeyExtractor>
+  void radix_sort(TIterator first, TIterator last, TBuffer buffer_first, TBuffer buffer_last, TKeyExtractor key)
   {
-    etl::sort(first, last, std::less<typename std::iterator_traits<TIterator>::value_type>());
+    ETL_STATIC_ASSERT((RADIX_BITS > 0) && (RADIX_BITS <= 11), "RADIX_BITS must be 1 to 11");
+
+    typedef typename std::iterator_traits<TIterator>::difference_type difference_t;
+
+    difference_t length = std::distance(first, last);
+
+    if (length < 2)
+    {
+      return;
+    }
+
+    if (std::distance(buffer_first, buffer_last) < length)
+    {
+      etl::stable_sort(first, last, private_radix_sort::key_compare<TKeyExtractor>(key));
+    }
+    else
+    {
+      private_radix_sort::sort<RADIX_BITS>(first, last, buffer_first, length, key, key(*first));
+    }
+  }
+
+  //***************************************************************************
+  /// Sorts the elements by key using a radix sort with 8 bit digits.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TBuffer, typename TKeyExtractor>
+  void radix_sort(TIterator first, TIterator last, TBuffer buffer_first, TBuffer buffer_last, TKeyExtractor key)
+  {
+    etl::radix_sort<8>(first, last, buffer_first, buffer_last, key);
+  }
+
+  //***************************************************************************
+  /// Sorts the elements, using each element as its own key.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <const size_t RADIX_BITS, typename TIterator, typename TBuffer>
+  void radix_sort(TIterator first, TIterator last, TBuffer buffer_first, TBuffer buffer_last)
+  {
+    typedef typename std::iterator_traits<TIterator>::value_type value_t;
+
+    etl::radix_sort<RADIX_BITS>(first, last, buffer_first, buffer_last, private_radix_sort::identity<value_t>());
+  }
+
+  //***************************************************************************
+  /// Sorts the elements, using each element as its own key, with 8 bit digits.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TBuffer>
+  void radix_sort(TIterator first, TIterator last, TBuffer buffer_first, TBuffer buffer_last)
+  {
+    etl::radix_sort<8>(first, last, buffer_first, buffer_last);
   }
 }
 
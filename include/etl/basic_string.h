@@ -50,6 +50,7 @@ SOFTWARE.
 #include "error_handler.h"
 #include "integral_limits.h"
 #include "exception.h"
+#include "private/string_search.h"
 
 #undef ETL_FILE
 #define ETL_FILE "27"
@@ -1099,21 +1100,7 @@ namespace etl
     //*********************************************************************
     size_t find(const ibasic_string<T>& str, size_t pos = 0) const
     {
-      if ((pos + str.size()) > size())
-      {
-        return npos;
-      }
-
-      const_iterator iposition = std::search(begin() + pos, end(), str.begin(), str.end());
-
-      if (iposition == end())
-      {
-        return npos;
-      }
-      else
-      {
-        return std::distance(begin(), iposition);
-      }
+      return find_substring(pos, str.p_buffer, str.size());
     }
 
     //*********************************************************************
@@ -1123,23 +1110,7 @@ namespace etl
     //*********************************************************************
     size_t find(const_pointer s, size_t pos = 0) const
     {
-#if defined(ETL_DEBUG)
-      if ((pos + etl::strlen(s)) > size())
-      {
-        return npos;
-      }
-#endif
-
-      const_iterator iposition = std::search(begin() + pos, end(), s, s + etl::strlen(s));
-
-      if (iposition == end())
-      {
-        return npos;
-      }
-      else
-      {
-        return std::distance(begin(), iposition);
-      }
+      return find_substring(pos, s, etl::strlen(s));
     }
 
     //*********************************************************************
@@ -1150,23 +1121,7 @@ namespace etl
     //*********************************************************************
     size_t find(const_pointer s, size_t pos, size_t n) const
     {
-#if defined(ETL_DEBUG)
-      if ((pos + etl::strlen(s) - n) > size())
-      {
-        return npos;
-      }
-#endif
-
-      const_iterator iposition = std::search(begin() + pos, end(), s, s + n);
-
-      if (iposition == end())
-      {
-        return npos;
-      }
-      else
-      {
-        return std::distance(begin(), iposition);
-      }
+      return find_substring(pos, s, n);
     }
 
     //*********************************************************************
@@ -1176,16 +1131,14 @@ namespace etl
     //*********************************************************************
     size_t find(T c, size_t position = 0) const
     {
-      const_iterator i = std::find(begin() + position, end(), c);
-
-      if (i != end())
-      {
-        return std::distance(begin(), i);
-      }
-      else
+      if (position >= size())
       {
         return npos;
       }
+
+      const_pointer p = etl::private_string_search::find_char(p_buffer + position, p_buffer + size(), c);
+
+      return (p == (p_buffer + size())) ? npos : size_t(p - p_buffer);
     }
 
     //*********************************************************************
@@ -1195,28 +1148,7 @@ namespace etl
     //*********************************************************************
     size_t rfind(const ibasic_string<T>& str, size_t position = npos) const
     {
-      if ((str.size()) > size())
-      {
-        return npos;
-      }
-
-      if (position >= size())
-      {
-        position = size();
-      }
-
-      position = size() - position;
-
-      const_reverse_iterator iposition = std::search(rbegin() + position, rend(), str.rbegin(), str.rend());
-
-      if (iposition == rend())
-      {
-        return npos;
-      }
-      else
-      {
-        return size() - str.size() - std::distance(rbegin(), iposition);
-      }
+      return rfind_substring(position, str.p_buffer, str.size());
     }
 
     //*********************************************************************
@@ -1226,33 +1158,7 @@ namespace etl
     //*********************************************************************
     size_t rfind(const_pointer s, size_t position = npos) const
     {
-      size_t len = etl::strlen(s);
-
-      if (len > size())
-      {
-        return npos;
-      }
-
-      if (position >= size())
-      {
-        position = size();
-      }
-
-      position = size() - position;
-
-      const_reverse_iterator srbegin(s + len);
-      const_reverse_iterator srend(s);
-
-      const_reverse_iterator iposition = std::search(rbegin() + position, rend(), srbegin, srend);
-
-      if (iposition == rend())
-      {
-        return npos;
-      }
-      else
-      {
-        return size() - len - std::distance(rbegin(), iposition);
-      }
+      return rfind_substring(position, s, etl::strlen(s));
     }
 
     //*********************************************************************
@@ -1262,31 +1168,7 @@ namespace etl
     //*********************************************************************
     size_t rfind(const_pointer s, size_t position, size_t length_) const
     {
-      if (length_ > size())
-      {
-        return npos;
-      }
-
-      if (position >= size())
-      {
-        position = size();
-      }
-
-      position = size() - position;
-
-      const_reverse_iterator srbegin(s + length_);
-      const_reverse_iterator srend(s);
-
-      const_reverse_iterator iposition = std::search(rbegin() + position, rend(), srbegin, srend);
-
-      if (iposition == rend())
-      {
-        return npos;
-      }
-      else
-      {
-        return size() - length_ - std::distance(rbegin(), iposition);
-      }
+      return rfind_substring(position, s, length_);
     }
 
     //*********************************************************************
@@ -1296,23 +1178,9 @@ namespace etl
     //*********************************************************************
     size_t rfind(T c, size_t position = npos) const
     {
-      if (position >= size())
-      {
-        position = size();
-      }
-
-      position = size() - position;
+      position = std::min(position, size());
 
-      const_reverse_iterator i = std::find(rbegin() + position, rend(), c);
-
-      if (i != rend())
-      {
-        return size() - std::distance(rbegin(), i) - 1;
-      }
-      else
-      {
-        return npos;
-      }
+      return to_position(etl::private_string_search::rfind_char(p_buffer, p_buffer + position, c));
     }
 
     //*********************************************************************
@@ -1620,21 +1488,7 @@ namespace etl
     //*********************************************************************
     size_t find_first_of(const_pointer s, size_t position, size_t n) const
     {
-      if (position < size())
-      {
-        for (size_t i = position; i < size(); ++i)
-        {
-          for (size_t j = 0; j < n; ++j)
-          {
-            if (p_buffer[i] == s[j])
-            {
-              return i;
-            }
-          }
-        }
-      }
-
-      return npos;
+      return find_first_in_set(position, s, n, true);
     }
 
     //*********************************************************************
@@ -1644,18 +1498,7 @@ namespace etl
     //*********************************************************************
     size_t find_first_of(value_type c, size_t position = 0) const
     {
-      if (position < size())
-      {
-        for (size_t i = position; i < size(); ++i)
-        {
-          if (p_buffer[i] == c)
-          {
-            return i;
-          }
-        }
-      }
-
-      return npos;
+      return find(c, position);
     }
 
     //*********************************************************************
@@ -1686,30 +1529,7 @@ namespace etl
     //*********************************************************************
     size_t find_last_of(const_pointer s, size_t position, size_t n) const
     {
-      if (empty())
-      {
-        return npos;
-      }
-
-      position = std::min(position, size() - 1);
-
-      const_reverse_iterator it = rbegin() + size() - position - 1;
-
-      while (it != rend())
-      {
-        for (size_t j = 0; j < n; ++j)
-        {
-          if (p_buffer[position] == s[j])
-          {
-            return position;
-          }
-        }
-
-        ++it;
-        --position;
-      }
-
-      return npos;
+      return find_last_in_set(position, s, n, true);
     }
 
     //*********************************************************************
@@ -1726,20 +1546,7 @@ namespace etl
 
       position = std::min(position, size() - 1);
 
-      const_reverse_iterator it = rbegin() + size() - position - 1;
-
-      while (it != rend())
-      {
-        if (p_buffer[position] == c)
-        {
-          return position;
-        }
-
-        ++it;
-        --position;
-      }
-
-      return npos;
+      return to_position(etl::private_string_search::rfind_char(p_buffer, p_buffer + position + 1, c));
     }
 
     //*********************************************************************
@@ -1770,28 +1577,7 @@ namespace etl
     //*********************************************************************
     size_t find_first_not_of(const_pointer s, size_t position, size_t n) const
     {
-      if (position < size())
-      {
-        for (size_t i = position; i < size(); ++i)
-        {
-          bool found = false;
-
-          for (size_t j = 0; j < n; ++j)
-          {
-            if (p_buffer[i] == s[j])
-            {
-              found = true;
-            }
-          }
-
-          if (!found)
-          {
-            return i;
-          }
-        }
-      }
-
-      return npos;
+      return find_first_in_set(position, s, n, false);
     }
 
     //*********************************************************************
@@ -1801,18 +1587,7 @@ namespace etl
     //*********************************************************************
     size_t find_first_not_of(value_type c, size_t position = 0) const
     {
-      if (position < size())
-      {
-        for (size_t i = position; i < size(); ++i)
-        {
-          if (p_buffer[i] != c)
-          {
-            return i;
-          }
-        }
-      }
-
-      return npos;
+      return find_first_in_set(position, &c, 1, false);
     }
 
     //*********************************************************************
@@ -1843,37 +1618,7 @@ namespace etl
     //*********************************************************************
     size_t find_last_not_of(const_pointer s, size_t position, size_t n) const
     {
-      if (empty())
-      {
-        return npos;
-      }
-
-      position = std::min(position, size() - 1);
-
-      const_reverse_iterator it = rbegin() + size() - position - 1;
-
-      while (it != rend())
-      {
-        bool found = false;
-
-        for (size_t j = 0; j < n; ++j)
-        {
-          if (p_buffer[position] == s[j])
-          {
-            found = true;
-          }
-        }
-
-        if (!found)
-        {
-          return position;
-        }
-
-        ++it;
-        --position;
-      }
-
-      return npos;
+      return find_last_in_set(position, s, n, false);
     }
 
     //*********************************************************************
@@ -1881,27 +1626,7 @@ namespace etl
     //*********************************************************************
     size_t find_last_not_of(value_type c, size_t position = npos) const
     {
-      if (empty())
-      {
-        return npos;
-      }
-
-      position = std::min(position, size() - 1);
-
-      const_reverse_iterator it = rbegin() + size() - position - 1;
-
-      while (it != rend())
-      {
-        if (p_buffer[position] != c)
-        {
-          return position;
-        }
-
-        ++it;
-        --position;
-      }
-
-      return npos;
+      return find_last_in_set(position, &c, 1, false);
     }
 
     //*************************************************************************
@@ -1996,43 +1721,70 @@ namespace etl
   private:
 
     //*************************************************************************
-    /// Compare helper function
+    /// Converts a pointer from a search to a position.
     //*************************************************************************
-    int compare(const_pointer first1, const_pointer last1, const_pointer first2, const_pointer last2) const
+    size_t to_position(const_pointer p) const
     {
-      while ((first1 != last1) && (first2 != last2))
-      {
-        if (*first1 < *first2)
-        {
-          // Compared character is lower.
-          return -1;
-        }
-        else if (*first1 > *first2)
-        {
-          // Compared character is higher.
-          return 1;
-        }
-
-        ++first1;
-        ++first2;
-      }
+      return (p == nullptr) ? npos : size_t(p - p_buffer);
+    }
 
-      // We reached the end of one or both of the strings.
-      if ((first1 == last1) && (first2 == last2))
+    //*************************************************************************
+    /// Finds the first occurrence of [s, s + n) at or after 'position'.
+    //*************************************************************************
+    size_t find_substring(size_t position, const_pointer s, size_t n) const
+    {
+      if (position > size())
       {
-        // Same length.
-        return 0;
+        return npos;
       }
-      else if (first1 == last1)
+
+      return to_position(etl::private_string_search::find_substring(p_buffer + position, p_buffer + size(), s, n));
+    }
+
+    //*************************************************************************
+    /// Finds the last occurrence of [s, s + n) that ends at or before 'position'.
+    //*************************************************************************
+    size_t rfind_substring(size_t position, const_pointer s, size_t n) const
+    {
+      position = std::min(position, size());
+
+      return to_position(etl::private_string_search::rfind_substring(p_buffer, p_buffer + position, s, n));
+    }
+
+    //*************************************************************************
+    /// Finds the first character at or after 'position' that is, or is not, in [s, s + n).
+    //*************************************************************************
+    size_t find_first_in_set(size_t position, const_pointer s, size_t n, bool in_set) const
+    {
+      if (position >= size())
       {
-        // Compared string is shorter.
-        return -1;
+        return npos;
       }
-      else
+
+      return to_position(etl::private_string_search::find_first_of(p_buffer + position, p_buffer + size(), s, n, in_set));
+    }
+
+    //*************************************************************************
+    /// Finds the last character at or before 'position' that is, or is not, in [s, s + n).
+    //*************************************************************************
+    size_t find_last_in_set(size_t position, const_pointer s, size_t n, bool in_set) const
+    {
+      if (empty())
       {
-        // Compared string is longer.
-        return 1;
+        return npos;
       }
+
+      position = std::min(position, size() - 1);
+
+      return to_position(etl::private_string_search::find_last_of(p_buffer, p_buffer + position + 1, s, n, in_set));
+    }
+
+    //*************************************************************************
+    /// Compare helper function
+    //*************************************************************************
+    int compare(const_pointer first1, const_pointer last1, const_pointer first2, const_pointer last2) const
+    {
+      return etl::private_string_search::compare(first1, size_t(last1 - first1), first2, size_t(last2 - first2));
     }
 
     // Disable copy construction.
@@ -28,6 +28,7 @@ SOFTWARE.
 
 #include <stdint.h>
 #include <limits.h>
+#include <string.h>
 
 #include "etl/platform.h"
 #include "etl/type_traits.h"
@@ -547,6 +548,626 @@ namespace etl
     size_t        byte_index;     ///< The index of the char in the bitstream buffer.
     size_t        bits_remaining; ///< The number of bits still available in the bitstream buffer.
   };
+
+  namespace private_bit_stream
+  {
+    //*************************************************************************
+    /// A mask of the lowest 'width' bits. 1 <= width <= 64
+    //*************************************************************************
+    inline uint64_t low_mask(uint_least8_t width)
+    {
+      return ~uint64_t(0) >> (64U - width);
+    }
+
+    //*************************************************************************
+    /// Stores a word in network order.
+    //*************************************************************************
+    inline void store_word(unsigned char* p, uint64_t word)
+    {
+      if (etl::endianness::value() == etl::endian::little)
+      {
+        word = etl::reverse_bytes(word);
+      }
+
+      memcpy(p, &word, sizeof(word));
+    }
+
+    //*************************************************************************
+    /// Loads a word in network order.
+    //*************************************************************************
+    inline uint64_t load_word(const unsigned char* p)
+    {
+      uint64_t word;
+      memcpy(&word, p, sizeof(word));
+
+      if (etl::endianness::value() == etl::endian::little)
+      {
+        word = etl::reverse_bytes(word);
+      }
+
+      return word;
+    }
+  }
+
+  //***************************************************************************
+  /// Writes a bitstream in the same format as etl::bit_stream.
+  /// Bits are gathered in a 64 bit accumulator and stored to the buffer a
+  /// word at a time. flush() must be called before the contents of the
+  /// buffer are used.
+  /// The 'unchecked' functions do not check the space left in the buffer.
+  //***************************************************************************
+  class bit_stream_writer
+  {
+  public:
+
+    typedef const unsigned char* const_iterator;
+
+    //*************************************************************************
+    /// Construct from begin and length.
+    //*************************************************************************
+    bit_stream_writer(char* begin_, size_t length_)
+      : pdata(reinterpret_cast<unsigned char*>(begin_)),
+        length(length_)
+    {
+      restart();
+    }
+
+    //*************************************************************************
+    /// Construct from begin and length.
+    //*************************************************************************
+    bit_stream_writer(unsigned char* begin_, size_t length_)
+      : pdata(begin_),
+        length(length_)
+    {
+      restart();
+    }
+
+    //*************************************************************************
+    /// Construct from range.
+    //*************************************************************************
+    bit_stream_writer(char* begin_, char* end_)
+      : pdata(reinterpret_cast<unsigned char*>(begin_)),
+        length(std::distance(begin_, end_))
+    {
+      restart();
+    }
+
+    //*************************************************************************
+    /// Construct from range.
+    //*************************************************************************
+    bit_stream_writer(unsigned char* begin_, unsigned char* end_)
+      : pdata(begin_),
+        length(std::distance(begin_, end_))
+    {
+      restart();
+    }
+
+    //*************************************************************************
+    /// Sets the indexes back to the beginning of the stream.
+    //*************************************************************************
+    void restart()
+    {
+      accumulator      = 0U;
+      accumulator_bits = 0U;
+      word_index       = 0U;
+      bits_remaining   = CHAR_BIT * length;
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if the stream is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return (bits_remaining == 0U);
+    }
+
+    //*************************************************************************
+    /// Puts a boolean to the stream.
+    //*************************************************************************
+    bool put(bool value)
+    {
+      if (bits_remaining < 1U)
+      {
+        return false;
+      }
+
+      put_bits(value ? 1U : 0U, 1U);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// For integral types.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value, bool>::type
+      put(T value, uint_least8_t width = CHAR_BIT * sizeof(T))
+    {
+      if (bits_remaining < width)
+      {
+        return false;
+      }
+
+      put_unchecked(value, width);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// For floating point types.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_floating_point<T>::value, bool>::type
+      put(T value)
+    {
+      if (bits_remaining < (CHAR_BIT * sizeof(T)))
+      {
+        return false;
+      }
+
+      put_unchecked(value);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// For arrays of integral types, each of 'width' bits.
+    /// Nothing is written if there is not space for all of them.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value, bool>::type
+      put(const T* values, size_t count, uint_least8_t width = CHAR_BIT * sizeof(T))
+    {
+      if ((width != 0U) && ((bits_remaining / width) < count))
+      {
+        return false;
+      }
+
+      put_unchecked(values, count, width);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// For integral types. Does not check the space left.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value, void>::type
+      put_unchecked(T value, uint_least8_t width = CHAR_BIT * sizeof(T))
+    {
+      if (width != 0U)
+      {
+        put_bits(uint64_t(value) & private_bit_stream::low_mask(width), width);
+      }
+    }
+
+    //*************************************************************************
+    /// For floating point types. Does not check the space left.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_floating_point<T>::value, void>::type
+      put_unchecked(T value)
+    {
+      unsigned char data[sizeof(T)];
+      memcpy(data, &value, sizeof(T));
+
+      // Host to network.
+      if (etl::endianness::value() == etl::endian::little)
+      {
+        std::reverse(data, data + sizeof(T));
+      }
+
+      for (size_t i = 0U; i < sizeof(T); ++i)
+      {
+        put_bits(data[i], CHAR_BIT);
+      }
+    }
+
+    //*************************************************************************
+    /// For arrays of integral types. Does not check the space left.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value, void>::type
+      put_unchecked(const T* values, size_t count, uint_least8_t width = CHAR_BIT * sizeof(T))
+    {
+      if (width != 0U)
+      {
+        const uint64_t mask = private_bit_stream::low_mask(width);
+
+        for (size_t i = 0U; i < count; ++i)
+        {
+          put_bits(uint64_t(values[i]) & mask, width);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Writes the bits held in the accumulator to the buffer.
+    /// The unused bits of the last byte are zero.
+    /// Writing may continue after a flush.
+    //*************************************************************************
+    void flush()
+    {
+      if (accumulator_bits != 0U)
+      {
+        // Left align the pending bits.
+        const uint64_t word = accumulator << (64U - accumulator_bits);
+        const size_t   bytes = (accumulator_bits + CHAR_BIT - 1U) / CHAR_BIT;
+
+        for (size_t i = 0U; i < bytes; ++i)
+        {
+          pdata[(word_index * 8U) + i] = static_cast<unsigned char>(word >> (56U - (i * CHAR_BIT)));
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Returns the number of bytes used in the stream.
+    //*************************************************************************
+    size_t size() const
+    {
+      return (bits() + CHAR_BIT - 1U) / CHAR_BIT;
+    }
+
+    //*************************************************************************
+    /// Returns the number of bits used in the stream.
+    //*************************************************************************
+    size_t bits() const
+    {
+      return (length * CHAR_BIT) - bits_remaining;
+    }
+
+    //*************************************************************************
+    /// Returns the number of bits still available in the stream.
+    //*************************************************************************
+    size_t available() const
+    {
+      return bits_remaining;
+    }
+
+    //*************************************************************************
+    /// Returns start of the stream.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return pdata;
+    }
+
+    //*************************************************************************
+    /// Returns end of the stream.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return pdata + size();
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Appends the bits. 'value' has no bits set above 'width'.
+    /// 1 <= width <= 64
+    //*************************************************************************
+    void put_bits(uint64_t value, uint_least8_t width)
+    {
+      const uint_least8_t free_bits = static_cast<uint_least8_t>(64U - accumulator_bits);
+
+      if (width < free_bits)
+      {
+        accumulator = (accumulator << width) | value;
+        accumulator_bits = static_cast<uint_least8_t>(accumulator_bits + width);
+      }
+      else
+      {
+        // Complete the word with the upper part of the value.
+        // The bits above 'accumulator_bits' are stale and are shifted out.
+        const uint_least8_t rest = static_cast<uint_least8_t>(width - free_bits);
+        const uint64_t      word = (free_bits == 64U) ? value : ((accumulator << free_bits) | (value >> rest));
+
+        private_bit_stream::store_word(pdata + (word_index * 8U), word);
+        ++word_index;
+
+        accumulator      = value;
+        accumulator_bits = rest;
+      }
+
+      bits_remaining -= width;
+    }
+
+    unsigned char* pdata;            ///< The start of the bitstream buffer.
+    size_t         length;           ///< The length, in unsigned char, of the bitstream buffer.
+    uint64_t       accumulator;      ///< The bits not yet stored, in the lowest 'accumulator_bits'.
+    uint_least8_t  accumulator_bits; ///< The number of bits in the accumulator.
+    size_t         word_index;       ///< The index of the next word to store.
+    size_t         bits_remaining;   ///< The number of bits still available in the bitstream buffer.
+  };
+
+  //***************************************************************************
+  /// Reads a bitstream in the same format as etl::bit_stream.
+  /// Bits are loaded from the buffer a word at a time into a 64 bit cache.
+  /// The 'unchecked' functions do not check the bits left in the buffer.
+  //***************************************************************************
+  class bit_stream_reader
+  {
+  public:
+
+    //*************************************************************************
+    /// Construct from begin and length.
+    //*************************************************************************
+    bit_stream_reader(const char* begin_, size_t length_)
+      : pdata(reinterpret_cast<const unsigned char*>(begin_)),
+        length(length_)
+    {
+      restart();
+    }
+
+    //*************************************************************************
+    /// Construct from begin and length.
+    //*************************************************************************
+    bit_stream_reader(const unsigned char* begin_, size_t length_)
+      : pdata(begin_),
+        length(length_)
+    {
+      restart();
+    }
+
+    //*************************************************************************
+    /// Construct from range.
+    //*************************************************************************
+    bit_stream_reader(const char* begin_, const char* end_)
+      : pdata(reinterpret_cast<const unsigned char*>(begin_)),
+        length(std::distance(begin_, end_))
+    {
+      restart();
+    }
+
+    //*************************************************************************
+    /// Construct from range.
+    //*************************************************************************
+    bit_stream_reader(const unsigned char* begin_, const unsigned char* end_)
+      : pdata(begin_),
+        length(std::distance(begin_, end_))
+    {
+      restart();
+    }
+
+    //*************************************************************************
+    /// Sets the indexes back to the beginning of the stream.
+    //*************************************************************************
+    void restart()
+    {
+      cache          = 0U;
+      cache_bits     = 0U;
+      byte_index     = 0U;
+      bits_remaining = CHAR_BIT * length;
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if the stream indexes have reached the end.
+    //*************************************************************************
+    bool at_end() const
+    {
+      return (bits_remaining == 0U);
+    }
+
+    //*************************************************************************
+    /// For bool types.
+    //*************************************************************************
+    bool get(bool& value)
+    {
+      if (bits_remaining < 1U)
+      {
+        return false;
+      }
+
+      value = (get_bits(1U) != 0U);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// For integral types.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value, bool>::type
+      get(T& value, uint_least8_t width = CHAR_BIT * sizeof(T))
+    {
+      if (bits_remaining < width)
+      {
+        return false;
+      }
+
+      get_unchecked(value, width);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// For floating point types.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_floating_point<T>::value, bool>::type
+      get(T& value)
+    {
+      if (bits_remaining < (CHAR_BIT * sizeof(T)))
+      {
+        return false;
+      }
+
+      get_unchecked(value);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// For arrays of integral types, each of 'width' bits.
+    /// Nothing is read if there are not enough bits for all of them.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value, bool>::type
+      get(T* values, size_t count, uint_least8_t width = CHAR_BIT * sizeof(T))
+    {
+      if ((width != 0U) && ((bits_remaining / width) < count))
+      {
+        return false;
+      }
+
+      get_unchecked(values, count, width);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// For integral types. Does not check the bits left.
+    /// Signed types are sign extended from 'width' bits.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value, void>::type
+      get_unchecked(T& value, uint_least8_t width = CHAR_BIT * sizeof(T))
+    {
+      value = (width == 0U) ? T(0) : to_integral<T>(get_bits(width), width);
+    }
+
+    //*************************************************************************
+    /// For floating point types. Does not check the bits left.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_floating_point<T>::value, void>::type
+      get_unchecked(T& value)
+    {
+      unsigned char data[sizeof(T)];
+
+      for (size_t i = 0U; i < sizeof(T); ++i)
+      {
+        data[i] = static_cast<unsigned char>(get_bits(CHAR_BIT));
+      }
+
+      // Network to host.
+      if (etl::endianness::value() == etl::endian::little)
+      {
+        std::reverse(data, data + sizeof(T));
+      }
+
+      memcpy(&value, data, sizeof(T));
+    }
+
+    //*************************************************************************
+    /// For arrays of integral types. Does not check the bits left.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value, void>::type
+      get_unchecked(T* values, size_t count, uint_least8_t width = CHAR_BIT * sizeof(T))
+    {
+      if (width == 0U)
+      {
+        std::fill_n(values, count, T(0));
+        return;
+      }
+
+      for (size_t i = 0U; i < count; ++i)
+      {
+        values[i] = to_integral<T>(get_bits(width), width);
+      }
+    }
+
+    //*************************************************************************
+    /// Returns the number of bits read from the stream.
+    //*************************************************************************
+    size_t bits() const
+    {
+      return (length * CHAR_BIT) - bits_remaining;
+    }
+
+    //*************************************************************************
+    /// Returns the number of bits still available in the stream.
+    //*************************************************************************
+    size_t available() const
+    {
+      return bits_remaining;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Converts the bits to the integral type.
+    //*************************************************************************
+    template <typename T>
+    static T to_integral(uint64_t bits, uint_least8_t width)
+    {
+      typedef typename etl::make_unsigned<T>::type UT;
+
+      UT value = static_cast<UT>(bits);
+
+      // Sign extend if signed type and not already full bit width.
+      if (etl::is_signed<T>::value && (width < (CHAR_BIT * sizeof(T))))
+      {
+        const UT sign = UT(UT(1) << (width - 1U));
+        value = UT((value ^ sign) - sign);
+      }
+
+      return static_cast<T>(value);
+    }
+
+    //*************************************************************************
+    /// Loads the next word, or the last few bytes, into the cache.
+    //*************************************************************************
+    void refill()
+    {
+      if ((length - byte_index) >= 8U)
+      {
+        cache      = private_bit_stream::load_word(pdata + byte_index);
+        cache_bits = 64U;
+        byte_index += 8U;
+      }
+      else
+      {
+        cache      = 0U;
+        cache_bits = 0U;
+
+        while (byte_index < length)
+        {
+          cache |= uint64_t(pdata[byte_index++]) << (56U - cache_bits);
+          cache_bits = static_cast<uint_least8_t>(cache_bits + CHAR_BIT);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Takes the next bits. 1 <= width <= 64
+    //*************************************************************************
+    uint64_t get_bits(uint_least8_t width)
+    {
+      bits_remaining -= width;
+
+      uint64_t value = 0U;
+
+      if (width > cache_bits)
+      {
+        // Take what is left in the cache, then refill it.
+        const uint_least8_t high_bits = cache_bits;
+
+        value = (high_bits == 0U) ? 0U : (cache >> (64U - high_bits));
+        width = static_cast<uint_least8_t>(width - high_bits);
+
+        refill();
+
+        value = (high_bits == 0U) ? 0U : (value << width);
+      }
+
+      // The cache is left aligned.
+      value |= cache >> (64U - width);
+      cache = (width == 64U) ? 0U : (cache << width);
+      cache_bits = static_cast<uint_least8_t>(cache_bits - width);
+
+      return value;
+    }
+
+    const unsigned char* pdata;          ///< The start of the bitstream buffer.
+    size_t               length;         ///< The length, in unsigned char, of the bitstream buffer.
+    uint64_t             cache;          ///< The next bits, left aligned.
+    uint_least8_t        cache_bits;     ///< The number of bits in the cache.
+    size_t               byte_index;     ///< The index of the next byte to load.
+    size_t               bits_remaining; ///< The number of bits still available in the bitstream buffer.
+  };
 }
 
 #include "private/minmax_pop.h"
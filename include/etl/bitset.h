@@ -47,6 +47,7 @@ SOFTWARE.
 #include "exception.h"
 #include "integral_limits.h"
 #include "binary.h"
+#include "type_traits.h"
 
 #include "private/minmax_push.h"
 
@@ -92,20 +93,31 @@ namespace etl
     }
   };
 
+  namespace private_bitset
+  {
+    // The default type used for each element in the array.
+#if !defined(ETL_BITSET_ELEMENT_TYPE)
+    typedef uint_least8_t default_element_t;
+#else
+    typedef ETL_BITSET_ELEMENT_TYPE default_element_t;
+#endif
+  }
+
   //*************************************************************************
   /// The base class for etl::bitset
+  ///\tparam TElement The unsigned type used for each element in the array.
   ///\ingroup bitset
   //*************************************************************************
-  class ibitset
+  template <typename TElement>
+  class ibasic_bitset
   {
   protected:
 
     // The type used for each element in the array.
-#if !defined(ETL_BITSET_ELEMENT_TYPE)
-    typedef uint_least8_t element_t;
-#else
-    typedef ETL_BITSET_ELEMENT_TYPE element_t;
-#endif
+    typedef TElement element_t;
+
+    // The type used for word operations on an element.
+    typedef typename etl::conditional<(sizeof(element_t) <= sizeof(uint32_t)), uint32_t, uint64_t>::type word_t;
 
   public:
 
@@ -126,7 +138,7 @@ namespace etl
     {
     public:
 
-      friend class ibitset;
+      friend class ibasic_bitset;
 
       //*******************************
       /// Conversion operator.
@@ -185,13 +197,13 @@ namespace etl
       //*******************************
       /// Constructor.
       //*******************************
-      bit_reference(ibitset& r_bitset, size_t position_)
+      bit_reference(ibasic_bitset& r_bitset, size_t position_)
         : p_bitset(&r_bitset),
         position(position_)
       {
       }
 
-      ibitset* p_bitset; ///< The bitset.
+      ibasic_bitset* p_bitset; ///< The bitset.
       size_t   position; ///< The position in the bitset.
     };
 
@@ -212,7 +224,7 @@ namespace etl
 
       for (size_t i = 0; i < SIZE; ++i)
       {
-        n += etl::count_bits(pdata[i]);
+        n += etl::count_bits(word_t(pdata[i]));
       }
 
       return n;
@@ -244,7 +256,7 @@ namespace etl
     //*************************************************************************
     /// Set the bit at the position.
     //*************************************************************************
-    ibitset& set()
+    ibasic_bitset& set()
     {
       for (size_t i = 0; i < SIZE; ++i)
       {
@@ -259,7 +271,7 @@ namespace etl
     //*************************************************************************
     /// Set the bit at the position.
     //*************************************************************************
-    ibitset& set(size_t position, bool value = true)
+    ibasic_bitset& set(size_t position, bool value = true)
     {
       size_t    index;
       element_t bit;
@@ -290,7 +302,7 @@ namespace etl
     //*************************************************************************
     /// Set from a string.
     //*************************************************************************
-    ibitset& set(const char* text)
+    ibasic_bitset& set(const char* text)
     {
       reset();
 
@@ -307,7 +319,7 @@ namespace etl
     //*************************************************************************
     /// Resets the bitset.
     //*************************************************************************
-    ibitset& reset()
+    ibasic_bitset& reset()
     {
       for (size_t i = 0; i < SIZE; ++i)
       {
@@ -320,7 +332,7 @@ namespace etl
     //*************************************************************************
     /// Reset the bit at the position.
     //*************************************************************************
-    ibitset& reset(size_t position)
+    ibasic_bitset& reset(size_t position)
     {
       size_t       index;
       element_t bit;
@@ -344,7 +356,7 @@ namespace etl
     //*************************************************************************
     /// Flip all of the bits.
     //*************************************************************************
-    ibitset& flip()
+    ibasic_bitset& flip()
     {
       for (size_t i = 0; i < SIZE; ++i)
       {
@@ -359,7 +371,7 @@ namespace etl
     //*************************************************************************
     /// Flip the bit at the position.
     //*************************************************************************
-    ibitset& flip(size_t position)
+    ibasic_bitset& flip(size_t position)
     {
       if (position < NBITS)
       {
@@ -448,60 +460,33 @@ namespace etl
     //*************************************************************************
     size_t find_next(bool state, size_t position) const
     {
-      // Where to start.
-      size_t index;
-      size_t bit;
-
-      if (SIZE == 1)
-      {
-        index = 0;
-        bit = position;
-      }
-      else
+      if (position >= NBITS)
       {
-        index = position >> log2<BITS_PER_ELEMENT>::value;
-        bit = position & (BITS_PER_ELEMENT - 1);
+        return npos;
       }
 
-      element_t mask = 1 << bit;
+      size_t    index = position >> etl::log2<BITS_PER_ELEMENT>::value;
+      element_t mask  = element_t(word_t(ALL_SET) << (position & (BITS_PER_ELEMENT - 1)));
 
       // For each element in the bitset...
       while (index < SIZE)
       {
-        element_t value = pdata[index];
+        // Look for set bits.
+        element_t value = element_t((state ? pdata[index] : ~pdata[index]) & mask);
 
-        // Needs checking?
-        if ((state && (value != ALL_CLEAR)) ||
-          (!state && (value != ALL_SET)))
+        if (value != 0)
         {
-          // For each bit in the element...
-          while ((bit < BITS_PER_ELEMENT) && (position < NBITS))
-          {
-            // Equal to the required state?
-            if (((value & mask) != 0) == state)
-            {
-              return position;
-            }
-
-            // Move on to the next bit.
-            mask <<= 1;
-            ++position;
-            ++bit;
-          }
-        }
-        else
-        {
-          position += BITS_PER_ELEMENT;
+          position = (index << etl::log2<BITS_PER_ELEMENT>::value) + etl::count_trailing_zeros(word_t(value));
+
+          return (position < NBITS) ? position : size_t(npos);
         }
 
         // Start at the beginning for all other elements.
-        bit = 0;
-        mask = 1;
-
+        mask = ALL_SET;
         ++index;
       }
 
-      return ibitset::npos;
+      return npos;
     }
 
     //*************************************************************************
@@ -523,7 +508,7 @@ namespace etl
     //*************************************************************************
     /// operator &=
     //*************************************************************************
-    ibitset& operator &=(const ibitset& other)
+    ibasic_bitset& operator &=(const ibasic_bitset& other)
     {
       for (size_t i = 0; i < SIZE; ++i)
       {
@@ -536,7 +521,7 @@ namespace etl
     //*************************************************************************
     /// operator |=
     //*************************************************************************
-    ibitset& operator |=(const ibitset& other)
+    ibasic_bitset& operator |=(const ibasic_bitset& other)
     {
       for (size_t i = 0; i < SIZE; ++i)
       {
@@ -549,7 +534,7 @@ namespace etl
     //*************************************************************************
     /// operator ^=
     //*************************************************************************
-    ibitset& operator ^=(const ibitset& other)
+    ibasic_bitset& operator ^=(const ibasic_bitset& other)
     {
       for (size_t i = 0; i < SIZE; ++i)
       {
@@ -562,63 +547,88 @@ namespace etl
     //*************************************************************************
     /// operator <<=
     //*************************************************************************
-    ibitset& operator<<=(size_t shift)
+    ibasic_bitset& operator<<=(size_t shift)
     {
-      if (SIZE == 1)
+      if (shift >= NBITS)
       {
-        pdata[0] <<= shift;
+        return reset();
       }
-      else
-      {
-        size_t source = NBITS - shift - 1;
-        size_t destination = NBITS - 1;
 
-        for (size_t i = 0; i < (NBITS - shift); ++i)
+      const size_t element_shift = shift >> etl::log2<BITS_PER_ELEMENT>::value;
+      const size_t bit_shift     = shift & (BITS_PER_ELEMENT - 1);
+
+      if (bit_shift == 0)
+      {
+        for (size_t i = SIZE - 1; i >= element_shift + 1; --i)
         {
-          set(destination--, test(source--));
+          pdata[i] = pdata[i - element_shift];
         }
-
-        for (size_t i = 0; i < shift; ++i)
+      }
+      else
+      {
+        for (size_t i = SIZE - 1; i > element_shift; --i)
         {
-          reset(destination--);
+          pdata[i] = element_t((word_t(pdata[i - element_shift]) << bit_shift) |
+                               (word_t(pdata[i - element_shift - 1]) >> (BITS_PER_ELEMENT - bit_shift)));
         }
       }
 
+      pdata[element_shift] = element_t(word_t(pdata[0]) << bit_shift);
+
+      for (size_t i = 0; i < element_shift; ++i)
+      {
+        pdata[i] = ALL_CLEAR;
+      }
+
+      pdata[SIZE - 1] &= TOP_MASK;
+
       return *this;
     }
 
     //*************************************************************************
     /// operator >>=
     //*************************************************************************
-    ibitset& operator>>=(size_t shift)
+    ibasic_bitset& operator>>=(size_t shift)
     {
-      if (SIZE == 1)
+      if (shift >= NBITS)
       {
-        pdata[0] >>= shift;
+        return reset();
       }
-      else
-      {
-        size_t source = shift;
-        size_t destination = 0;
 
-        for (size_t i = 0; i < (NBITS - shift); ++i)
+      const size_t element_shift = shift >> etl::log2<BITS_PER_ELEMENT>::value;
+      const size_t bit_shift     = shift & (BITS_PER_ELEMENT - 1);
+      const size_t last          = SIZE - 1 - element_shift;
+
+      if (bit_shift == 0)
+      {
+        for (size_t i = 0; i < last; ++i)
         {
-          set(destination++, test(source++));
+          pdata[i] = pdata[i + element_shift];
         }
-
-        for (size_t i = 0; i < shift; ++i)
+      }
+      else
+      {
+        for (size_t i = 0; i < last; ++i)
         {
-          reset(destination++);
+          pdata[i] = element_t((word_t(pdata[i + element_shift]) >> bit_shift) |
+                               (word_t(pdata[i + element_shift + 1]) << (BITS_PER_ELEMENT - bit_shift)));
         }
       }
 
+      pdata[last] = element_t(pdata[SIZE - 1] >> bit_shift);
+
+      for (size_t i = last + 1; i < SIZE; ++i)
+      {
+        pdata[i] = ALL_CLEAR;
+      }
+
       return *this;
     }
 
     //*************************************************************************
     /// operator =
     //*************************************************************************
-    ibitset& operator =(const ibitset& other)
+    ibasic_bitset& operator =(const ibasic_bitset& other)
     {
       if (this != &other)
       {
@@ -631,7 +641,7 @@ namespace etl
     //*************************************************************************
     /// swap
     //*************************************************************************
-    void swap(ibitset& other)
+    void swap(ibasic_bitset& other)
     {
       std::swap_ranges(pdata, pdata + SIZE, other.pdata);
     }
@@ -641,7 +651,7 @@ namespace etl
     //*************************************************************************
     /// Initialise from an unsigned long long.
     //*************************************************************************
-    ibitset& initialise(unsigned long long value)
+    ibasic_bitset& initialise(unsigned long long value)
     {
       reset();
 
@@ -677,6 +687,8 @@ namespace etl
       {
         pdata[i] = ~pdata[i];
       }
+
+      pdata[SIZE - 1] &= TOP_MASK;
     }
 
     //*************************************************************************
@@ -690,20 +702,20 @@ namespace etl
     //*************************************************************************
     /// Constructor.
     //*************************************************************************
-    ibitset(size_t nbits_, size_t size_, element_t* pdata_)
+    ibasic_bitset(size_t nbits_, size_t size_, element_t* pdata_)
       : NBITS(nbits_),
         SIZE(size_),
         pdata(pdata_)
     {
       size_t allocated_bits = SIZE * BITS_PER_ELEMENT;
       size_t top_mask_shift = ((BITS_PER_ELEMENT - (allocated_bits - NBITS)) % BITS_PER_ELEMENT);
-      TOP_MASK = element_t(top_mask_shift == 0 ? ALL_SET : ~(ALL_SET << top_mask_shift));
+      TOP_MASK = element_t(top_mask_shift == 0 ? ALL_SET : ~(word_t(ALL_SET) << top_mask_shift));
     }
 
     //*************************************************************************
     /// Compare bitsets.
     //*************************************************************************
-    static bool is_equal(const ibitset& lhs, const ibitset&rhs)
+    static bool is_equal(const ibasic_bitset& lhs, const ibasic_bitset&rhs)
     {
       return std::equal(lhs.pdata, lhs.pdata + lhs.SIZE, rhs.pdata);
     }
@@ -713,7 +725,7 @@ namespace etl
   private:
 
     // Disable copy construction.
-    ibitset(const ibitset&);
+    ibasic_bitset(const ibasic_bitset&);
 
     const size_t NBITS;
     const size_t SIZE;
@@ -724,27 +736,43 @@ namespace etl
     //*************************************************************************
 #if defined(ETL_POLYMORPHIC_BITSET) || defined(ETL_POLYMORPHIC_CONTAINERS)
   public:
-    virtual ~ibitset()
+    virtual ~ibasic_bitset()
     {
     }
 #else
   protected:
-    ~ibitset()
+    ~ibasic_bitset()
     {
     }
 #endif
   };
 
+  //*************************************************************************
+  /// The base class for etl::bitset with the default element type.
+  ///\ingroup bitset
+  //*************************************************************************
+  typedef etl::ibasic_bitset<private_bitset::default_element_t> ibitset;
+
   //*************************************************************************
   /// The class emulates an array of bool elements, but optimized for space allocation.
   /// Will accommodate any number of bits.
   /// Does not use std::string.
-  ///\tparam N The number of bits.
+  ///\tparam N        The number of bits.
+  ///\tparam TElement The unsigned type used for each element in the array.
+  /// Wider elements make count, find and shift faster for large bitsets.
   ///\ingroup bitset
   //*************************************************************************
-  template <const size_t MAXN>
-  class bitset : public etl::ibitset
+  template <const size_t MAXN, typename TElement = private_bitset::default_element_t>
+  class bitset : public etl::ibasic_bitset<TElement>
   {
+    typedef etl::ibasic_bitset<TElement> base_t;
+    typedef typename base_t::element_t   element_t;
+
+  public:
+
+    static const size_t BITS_PER_ELEMENT = base_t::BITS_PER_ELEMENT;
+
+  private:
 
     static const size_t ARRAY_SIZE = (MAXN % BITS_PER_ELEMENT == 0) ? MAXN / BITS_PER_ELEMENT : MAXN / BITS_PER_ELEMENT + 1;
 
@@ -758,7 +786,7 @@ namespace etl
     /// Default constructor.
     //*************************************************************************
     bitset()
-      : etl::ibitset(MAXN, ARRAY_SIZE, data)
+      : base_t(MAXN, ARRAY_SIZE, data)
     {
       reset();
     }
@@ -766,8 +794,8 @@ namespace etl
     //*************************************************************************
     /// Copy constructor.
     //*************************************************************************
-    bitset(const bitset<MAXN>& other)
-      : etl::ibitset(MAXN, ARRAY_SIZE, data)
+    bitset(const bitset<MAXN, TElement>& other)
+      : base_t(MAXN, ARRAY_SIZE, data)
     {
       etl::copy_n(other.data, ARRAY_SIZE, data);
     }
@@ -776,16 +804,16 @@ namespace etl
     /// Construct from a value.
     //*************************************************************************
     bitset(unsigned long long value)
-      : etl::ibitset(MAXN, ARRAY_SIZE, data)
+      : base_t(MAXN, ARRAY_SIZE, data)
     {
-      initialise(value);
+      this->initialise(value);
     }
 
     //*************************************************************************
     /// Construct from a string.
     //*************************************************************************
     bitset(const char* text)
-      : etl::ibitset(MAXN, ARRAY_SIZE, data)
+      : base_t(MAXN, ARRAY_SIZE, data)
     {
       set(text);
     }
@@ -793,28 +821,28 @@ namespace etl
     //*************************************************************************
     /// Set all of the bits.
     //*************************************************************************
-    bitset<MAXN>& set()
+    bitset<MAXN, TElement>& set()
     {
-      etl::ibitset::set();
+      base_t::set();
       return *this;
     }
 
     //*************************************************************************
     /// Set the bit at the position.
     //*************************************************************************
-    bitset<MAXN>& set(size_t position, bool value = true)
+    bitset<MAXN, TElement>& set(size_t position, bool value = true)
     {
-      etl::ibitset::set(position, value);
+      base_t::set(position, value);
       return *this;
     }
 
     //*************************************************************************
     /// Set from a string.
     //*************************************************************************
-    bitset<MAXN>& set(const char* text)
+    bitset<MAXN, TElement>& set(const char* text)
     {
       ETL_ASSERT(text != 0, ETL_ERROR(bitset_nullptr));
-      etl::ibitset::set(text);
+      base_t::set(text);
 
       return *this;
     }
@@ -822,43 +850,43 @@ namespace etl
     //*************************************************************************
     /// Reset all of the bits.
     //*************************************************************************
-    bitset<MAXN>& reset()
+    bitset<MAXN, TElement>& reset()
     {
-      ibitset::reset();
+      base_t::reset();
       return *this;
     }
 
     //*************************************************************************
     /// Reset the bit at the position.
     //*************************************************************************
-    bitset<MAXN>& reset(size_t position)
+    bitset<MAXN, TElement>& reset(size_t position)
     {
-      etl::ibitset::reset(position);
+      base_t::reset(position);
       return *this;
     }
 
     //*************************************************************************
     /// Flip all of the bits.
     //*************************************************************************
-    bitset<MAXN>& flip()
+    bitset<MAXN, TElement>& flip()
     {
-      ibitset::flip();
+      base_t::flip();
       return *this;
     }
 
     //*************************************************************************
     /// Flip the bit at the position.
     //*************************************************************************
-    bitset<MAXN>& flip(size_t position)
+    bitset<MAXN, TElement>& flip(size_t position)
     {
-      etl::ibitset::flip(position);
+      base_t::flip(position);
       return *this;
     }
 
     //*************************************************************************
     /// operator =
     //*************************************************************************
-    bitset<MAXN>& operator =(const bitset<MAXN>& other)
+    bitset<MAXN, TElement>& operator =(const bitset<MAXN, TElement>& other)
     {
       if (this != &other)
       {
@@ -871,36 +899,36 @@ namespace etl
     //*************************************************************************
     /// operator &=
     //*************************************************************************
-    bitset<MAXN>& operator &=(const bitset<MAXN>& other)
+    bitset<MAXN, TElement>& operator &=(const bitset<MAXN, TElement>& other)
     {
-      etl::ibitset::operator &=(other);
+      base_t::operator &=(other);
       return *this;
     }
 
     //*************************************************************************
     /// operator |=
     //*************************************************************************
-    bitset<MAXN>& operator |=(const bitset<MAXN>& other)
+    bitset<MAXN, TElement>& operator |=(const bitset<MAXN, TElement>& other)
     {
-      etl::ibitset::operator |=(other);
+      base_t::operator |=(other);
       return *this;
     }
 
     //*************************************************************************
     /// operator ^=
     //*************************************************************************
-    bitset<MAXN>& operator ^=(const bitset<MAXN>& other)
+    bitset<MAXN, TElement>& operator ^=(const bitset<MAXN, TElement>& other)
     {
-      ibitset::operator ^=(other);
+      base_t::operator ^=(other);
       return *this;
     }
 
     //*************************************************************************
     /// operator ~
     //*************************************************************************
-    bitset<MAXN> operator ~() const
+    bitset<MAXN, TElement> operator ~() const
     {
-      etl::bitset<MAXN> temp(*this);
+      etl::bitset<MAXN, TElement> temp(*this);
 
       temp.invert();
 
@@ -910,9 +938,9 @@ namespace etl
     //*************************************************************************
     /// operator <<
     //*************************************************************************
-    bitset<MAXN> operator<<(size_t shift) const
+    bitset<MAXN, TElement> operator<<(size_t shift) const
     {
-      etl::bitset<MAXN> temp(*this);
+      etl::bitset<MAXN, TElement> temp(*this);
 
       temp <<= shift;
 
@@ -922,18 +950,18 @@ namespace etl
     //*************************************************************************
     /// operator <<=
     //*************************************************************************
-    bitset<MAXN>& operator<<=(size_t shift)
+    bitset<MAXN, TElement>& operator<<=(size_t shift)
     {
-      etl::ibitset::operator <<=(shift);
+      base_t::operator <<=(shift);
       return *this;
     }
 
     //*************************************************************************
     /// operator >>
     //*************************************************************************
-    bitset<MAXN> operator>>(size_t shift) const
+    bitset<MAXN, TElement> operator>>(size_t shift) const
     {
-      bitset<MAXN> temp(*this);
+      bitset<MAXN, TElement> temp(*this);
 
       temp >>= shift;
 
@@ -943,18 +971,18 @@ namespace etl
     //*************************************************************************
     /// operator >>=
     //*************************************************************************
-    bitset<MAXN>& operator>>=(size_t shift)
+    bitset<MAXN, TElement>& operator>>=(size_t shift)
     {
-      etl::ibitset::operator >>=(shift);
+      base_t::operator >>=(shift);
       return *this;
     }
 
     //*************************************************************************
     /// operator ==
     //*************************************************************************
-    friend bool operator == (const bitset<MAXN>& lhs, const bitset<MAXN>& rhs)
+    friend bool operator == (const bitset<MAXN, TElement>& lhs, const bitset<MAXN, TElement>& rhs)
     {
-      return etl::ibitset::is_equal(lhs, rhs);
+      return base_t::is_equal(lhs, rhs);
     }
 
   private:
@@ -966,10 +994,10 @@ namespace etl
   /// operator &
   ///\ingroup bitset
   //***************************************************************************
-  template <const size_t MAXN>
-  bitset<MAXN> operator & (const bitset<MAXN>& lhs, const bitset<MAXN>& rhs)
+  template <const size_t MAXN, typename TElement>
+  bitset<MAXN, TElement> operator & (const bitset<MAXN, TElement>& lhs, const bitset<MAXN, TElement>& rhs)
   {
-    bitset<MAXN> temp(lhs);
+    bitset<MAXN, TElement> temp(lhs);
     temp &= rhs;
     return temp;
   }
@@ -978,10 +1006,10 @@ namespace etl
   /// operator |
   ///\ingroup bitset
   //***************************************************************************
-  template<const size_t MAXN>
-  bitset<MAXN> operator | (const bitset<MAXN>& lhs, const bitset<MAXN>& rhs)
+  template <const size_t MAXN, typename TElement>
+  bitset<MAXN, TElement> operator | (const bitset<MAXN, TElement>& lhs, const bitset<MAXN, TElement>& rhs)
   {
-    bitset<MAXN> temp(lhs);
+    bitset<MAXN, TElement> temp(lhs);
     temp |= rhs;
     return temp;
   }
@@ -990,10 +1018,10 @@ namespace etl
   /// operator ^
   ///\ingroup bitset
   //***************************************************************************
-  template<const size_t MAXN>
-  bitset<MAXN> operator ^ (const bitset<MAXN>& lhs, const bitset<MAXN>& rhs)
+  template <const size_t MAXN, typename TElement>
+  bitset<MAXN, TElement> operator ^ (const bitset<MAXN, TElement>& lhs, const bitset<MAXN, TElement>& rhs)
   {
-    bitset<MAXN> temp(lhs);
+    bitset<MAXN, TElement> temp(lhs);
     temp ^= rhs;
     return temp;
   }
@@ -1002,8 +1030,8 @@ namespace etl
   /// operator !=
   ///\ingroup bitset
   //***************************************************************************
-  template<const size_t MAXN>
-  bool operator != (const bitset<MAXN>& lhs, const bitset<MAXN>& rhs)
+  template <const size_t MAXN, typename TElement>
+  bool operator != (const bitset<MAXN, TElement>& lhs, const bitset<MAXN, TElement>& rhs)
   {
     return !(lhs == rhs);
   }
@@ -1012,8 +1040,8 @@ namespace etl
 //*************************************************************************
 /// swap
 //*************************************************************************
-template <const size_t MAXN>
-void swap(etl::bitset<MAXN>& lhs, etl::bitset<MAXN>& rhs)
+template <const size_t MAXN, typename TElement>
+void swap(etl::bitset<MAXN, TElement>& lhs, etl::bitset<MAXN, TElement>& rhs)
 {
   lhs.swap(rhs);
 }
@@ -0,0 +1,831 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BTREE_SET_INCLUDED
+#define ETL_BTREE_SET_INCLUDED
+
+#include <stddef.h>
+
+#include "platform.h"
+
+#include "stl/algorithm.h"
+#include "stl/iterator.h"
+#include "stl/functional.h"
+#include "stl/utility.h"
+
+#include "pool.h"
+#include "type_traits.h"
+#include "parameter_type.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "private/btree.h"
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT) && !defined(ETL_NO_STL)
+  #include <initializer_list>
+#endif
+
+#undef ETL_FILE
+#define ETL_FILE "58"
+
+//*****************************************************************************
+///\defgroup btree_set btree_set
+/// A set with the capacity defined at compile time, held in a B+tree.
+/// Each node holds several keys in a few cache lines, so a search touches far
+/// fewer lines than the node per level of etl::set. The keys are held in the
+/// leaves, which are linked in key order, so iteration walks arrays.
+/// The nodes are taken from pools held in the derived class.
+/// Unlike etl::set, insert and erase move keys between and within nodes,
+/// and so invalidate all iterators, pointers and references.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the btree_set.
+  ///\ingroup btree_set
+  //***************************************************************************
+  class btree_set_exception : public etl::exception
+  {
+  public:
+
+    btree_set_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the btree_set.
+  ///\ingroup btree_set
+  //***************************************************************************
+  class btree_set_full : public etl::btree_set_exception
+  {
+  public:
+
+    btree_set_full(string_type file_name_, numeric_type line_number_)
+      : etl::btree_set_exception(ETL_ERROR_TEXT("btree_set:full", ETL_FILE"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for specifically sized btree_sets.
+  /// Can be used as a reference type for all btree_sets containing a specific type.
+  ///\ingroup btree_set
+  //***************************************************************************
+  template <typename TKey, typename TKeyCompare = std::less<TKey> >
+  class ibtree_set
+  {
+  public:
+
+    typedef TKey              value_type;
+    typedef TKey              key_type;
+    typedef TKeyCompare       key_compare;
+    typedef TKeyCompare       value_compare;
+    typedef value_type&       reference;
+    typedef const value_type& const_reference;
+    typedef value_type*       pointer;
+    typedef const value_type* const_pointer;
+    typedef size_t            size_type;
+    typedef ptrdiff_t         difference_type;
+
+  protected:
+
+    typedef etl::private_btree::tree<TKey, value_type, etl::private_btree::key_of_value<TKey>, TKeyCompare> tree_t;
+    typedef typename tree_t::position position_t;
+
+    typedef typename etl::parameter_type<TKey>::type key_parameter_t;
+
+  public:
+
+    //*************************************************************************
+    /// iterator.
+    //*************************************************************************
+    class iterator : public std::iterator<std::bidirectional_iterator_tag, const value_type>
+    {
+    public:
+
+      friend class ibtree_set;
+      friend class const_iterator;
+
+      iterator()
+      {
+      }
+
+      iterator(const iterator& other)
+        : position(other.position)
+      {
+      }
+
+      iterator& operator ++()
+      {
+        position.increment();
+        return *this;
+      }
+
+      iterator operator ++(int)
+      {
+        iterator temp(*this);
+        position.increment();
+        return temp;
+      }
+
+      iterator& operator --()
+      {
+        position.decrement();
+        return *this;
+      }
+
+      iterator operator --(int)
+      {
+        iterator temp(*this);
+        position.decrement();
+        return temp;
+      }
+
+      iterator& operator =(const iterator& other)
+      {
+        position = other.position;
+        return *this;
+      }
+
+      const_reference operator *() const
+      {
+        return position.value();
+      }
+
+      const_pointer operator &() const
+      {
+        return &position.value();
+      }
+
+      const_pointer operator ->() const
+      {
+        return &position.value();
+      }
+
+      friend bool operator ==(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.position == rhs.position;
+      }
+
+      friend bool operator !=(const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      explicit iterator(position_t position_)
+        : position(position_)
+      {
+      }
+
+      position_t position;
+    };
+
+    //*************************************************************************
+    /// const_iterator.
+    //*************************************************************************
+    class const_iterator : public std::iterator<std::bidirectional_iterator_tag, const value_type>
+    {
+    public:
+
+      friend class ibtree_set;
+
+      const_iterator()
+      {
+      }
+
+      const_iterator(const iterator& other)
+        : position(other.position)
+      {
+      }
+
+      const_iterator(const const_iterator& other)
+        : position(other.position)
+      {
+      }
+
+      const_iterator& operator ++()
+      {
+        position.increment();
+        return *this;
+      }
+
+      const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        position.increment();
+        return temp;
+      }
+
+      const_iterator& operator --()
+      {
+        position.decrement();
+        return *this;
+      }
+
+      const_iterator operator --(int)
+      {
+        const_iterator temp(*this);
+        position.decrement();
+        return temp;
+      }
+
+      const_iterator& operator =(const const_iterator& other)
+      {
+        position = other.position;
+        return *this;
+      }
+
+      const_reference operator *() const
+      {
+        return position.value();
+      }
+
+      const_pointer operator &() const
+      {
+        return &position.value();
+      }
+
+      const_pointer operator ->() const
+      {
+        return &position.value();
+      }
+
+      friend bool operator ==(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.position == rhs.position;
+      }
+
+      friend bool operator !=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      explicit const_iterator(position_t position_)
+        : position(position_)
+      {
+      }
+
+      position_t position;
+    };
+
+    typedef std::reverse_iterator<iterator>       reverse_iterator;
+    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    //*************************************************************************
+    /// Returns an iterator to the beginning of the btree_set.
+    //*************************************************************************
+    iterator begin()
+    {
+      return iterator(tree.begin());
+    }
+
+    //*************************************************************************
+    /// Returns a const_iterator to the beginning of the btree_set.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return const_iterator(tree.begin());
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the end of the btree_set.
+    //*************************************************************************
+    iterator end()
+    {
+      return iterator(tree.end());
+    }
+
+    //*************************************************************************
+    /// Returns a const_iterator to the end of the btree_set.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return const_iterator(tree.end());
+    }
+
+    //*************************************************************************
+    /// Returns a const_iterator to the beginning of the btree_set.
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return const_iterator(tree.begin());
+    }
+
+    //*************************************************************************
+    /// Returns a const_iterator to the end of the btree_set.
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return const_iterator(tree.end());
+    }
+
+    //*************************************************************************
+    /// Returns a reverse_iterator to the reverse beginning of the btree_set.
+    //*************************************************************************
+    reverse_iterator rbegin()
+    {
+      return reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Returns a const_reverse_iterator to the reverse beginning of the btree_set.
+    //*************************************************************************
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Returns a reverse_iterator to the reverse end of the btree_set.
+    //*************************************************************************
+    reverse_iterator rend()
+    {
+      return reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Returns a const_reverse_iterator to the reverse end of the btree_set.
+    //*************************************************************************
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Returns a const_reverse_iterator to the reverse beginning of the btree_set.
+    //*************************************************************************
+    const_reverse_iterator crbegin() const
+    {
+      return const_reverse_iterator(cend());
+    }
+
+    //*************************************************************************
+    /// Returns a const_reverse_iterator to the reverse end of the btree_set.
+    //*************************************************************************
+    const_reverse_iterator crend() const
+    {
+      return const_reverse_iterator(cbegin());
+    }
+
+    //*********************************************************************
+    /// Assigns values to the btree_set.
+    /// If asserts or exceptions are enabled, emits btree_set_full if the btree_set does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first, TIterator last)
+    {
+      clear();
+      insert(first, last);
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the btree_set.
+    /// If asserts or exceptions are enabled, emits btree_set_full if the
+    /// key is not present and the btree_set is already full.
+    ///\param value The value to insert.
+    ///\return An iterator to the value with the key and whether it was inserted.
+    //*********************************************************************
+    std::pair<iterator, bool> insert(const_reference value)
+    {
+      if (full())
+      {
+        iterator i_element = find(value);
+
+        if (i_element != end())
+        {
+          return std::pair<iterator, bool>(i_element, false);
+        }
+
+        ETL_ASSERT(false, ETL_ERROR(btree_set_full));
+
+        return std::pair<iterator, bool>(end(), false);
+      }
+
+      std::pair<position_t, bool> result = tree.insert_unique(value);
+
+      return std::pair<iterator, bool>(iterator(result.first), result.second);
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the btree_set.
+    /// If asserts or exceptions are enabled, emits btree_set_full if the
+    /// key is not present and the btree_set is already full.
+    ///\param position The position to insert at. Ignored.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(iterator /*position*/, const_reference value)
+    {
+      return insert(value).first;
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the btree_set.
+    /// If asserts or exceptions are enabled, emits btree_set_full if the
+    /// key is not present and the btree_set is already full.
+    ///\param position The position to insert at. Ignored.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator /*position*/, const_reference value)
+    {
+      return insert(value).first;
+    }
+
+    //*********************************************************************
+    /// Inserts a range of values to the btree_set.
+    /// If asserts or exceptions are enabled, emits btree_set_full if the btree_set does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        insert(*first);
+        ++first;
+      }
+    }
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param key The key to erase.
+    ///\return The number of elements erased. 0 or 1.
+    //*********************************************************************
+    size_t erase(key_parameter_t key)
+    {
+      return tree.erase(key);
+    }
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param i_element Iterator to the element.
+    ///\return An iterator to the element after the one erased.
+    //*********************************************************************
+    iterator erase(iterator i_element)
+    {
+      return iterator(tree.erase(i_element.position));
+    }
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param i_element Iterator to the element.
+    ///\return An iterator to the element after the one erased.
+    //*********************************************************************
+    iterator erase(const_iterator i_element)
+    {
+      return iterator(tree.erase(i_element.position));
+    }
+
+    //*********************************************************************
+    /// Erases a range of elements.
+    /// The range includes all the elements between first and last, including the
+    /// element pointed by first, but not the one pointed to by last.
+    ///\param first Iterator to the first element.
+    ///\param last  Iterator to the last element.
+    ///\return An iterator to the element after the last one erased.
+    //*********************************************************************
+    iterator erase(const_iterator first, const_iterator last)
+    {
+      // Erasing moves values between leaves, so 'last' may not stay valid.
+      size_t n = std::distance(first, last);
+      position_t i_element = first.position;
+
+      while (n-- != 0)
+      {
+        i_element = tree.erase(i_element);
+      }
+
+      return iterator(i_element);
+    }
+
+    //*************************************************************************
+    /// Clears the btree_set.
+    //*************************************************************************
+    void clear()
+    {
+      tree.clear();
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    iterator find(key_parameter_t key)
+    {
+      return iterator(tree.find(key));
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return A const_iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    const_iterator find(key_parameter_t key) const
+    {
+      return const_iterator(tree.find(key));
+    }
+
+    //*********************************************************************
+    /// Counts an element.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    size_t count(key_parameter_t key) const
+    {
+      return (tree.find(key) == tree.end()) ? 0 : 1;
+    }
+
+    //*********************************************************************
+    /// Finds the lower bound of a key
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    iterator lower_bound(key_parameter_t key)
+    {
+      return iterator(tree.lower_bound(key));
+    }
+
+    //*********************************************************************
+    /// Finds the lower bound of a key
+    ///\param key The key to search for.
+    ///\return A const_iterator.
+    //*********************************************************************
+    const_iterator lower_bound(key_parameter_t key) const
+    {
+      return const_iterator(tree.lower_bound(key));
+    }
+
+    //*********************************************************************
+    /// Finds the upper bound of a key
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    iterator upper_bound(key_parameter_t key)
+    {
+      return iterator(tree.upper_bound(key));
+    }
+
+    //*********************************************************************
+    /// Finds the upper bound of a key
+    ///\param key The key to search for.
+    ///\return A const_iterator.
+    //*********************************************************************
+    const_iterator upper_bound(key_parameter_t key) const
+    {
+      return const_iterator(tree.upper_bound(key));
+    }
+
+    //*********************************************************************
+    /// Finds the range of equal elements of a key
+    ///\param key The key to search for.
+    ///\return An iterator pair.
+    //*********************************************************************
+    std::pair<iterator, iterator> equal_range(key_parameter_t key)
+    {
+      return std::pair<iterator, iterator>(lower_bound(key), upper_bound(key));
+    }
+
+    //*********************************************************************
+    /// Finds the range of equal elements of a key
+    ///\param key The key to search for.
+    ///\return A const_iterator pair.
+    //*********************************************************************
+    std::pair<const_iterator, const_iterator> equal_range(key_parameter_t key) const
+    {
+      return std::pair<const_iterator, const_iterator>(lower_bound(key), upper_bound(key));
+    }
+
+    //*************************************************************************
+    /// Gets the current size of the btree_set.
+    //*************************************************************************
+    size_type size() const
+    {
+      return tree.size();
+    }
+
+    //*************************************************************************
+    /// Checks the 'empty' state of the btree_set.
+    //*************************************************************************
+    bool empty() const
+    {
+      return tree.size() == 0;
+    }
+
+    //*************************************************************************
+    /// Checks the 'full' state of the btree_set.
+    //*************************************************************************
+    bool full() const
+    {
+      return tree.size() == tree.max_size();
+    }
+
+    //*************************************************************************
+    /// Returns the capacity of the btree_set.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return tree.max_size();
+    }
+
+    //*************************************************************************
+    /// Returns the maximum possible size of the btree_set.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return tree.max_size();
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return tree.max_size() - tree.size();
+    }
+
+  protected:
+
+    //*********************************************************************
+    /// Constructor.
+    //*********************************************************************
+    ibtree_set(etl::ipool& leaf_pool, etl::ipool& internal_pool, size_t max_size_)
+      : tree(leaf_pool, internal_pool, max_size_)
+    {
+    }
+
+  private:
+
+    // Disable copy construction.
+    ibtree_set(const ibtree_set&);
+
+    tree_t tree;
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_BTREE_SET) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~ibtree_set()
+    {
+    }
+#else
+  protected:
+    ~ibtree_set()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\param lhs Reference to the first btree_set.
+  ///\param rhs Reference to the second btree_set.
+  ///\return <b>true</b> if the btree_sets are equal, otherwise <b>false</b>
+  ///\ingroup btree_set
+  //***************************************************************************
+  template <typename TKey, typename TKeyCompare>
+  bool operator ==(const etl::ibtree_set<TKey, TKeyCompare>& lhs, const etl::ibtree_set<TKey, TKeyCompare>& rhs)
+  {
+    return (lhs.size() == rhs.size()) && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first btree_set.
+  ///\param rhs Reference to the second btree_set.
+  ///\return <b>true</b> if the btree_sets are not equal, otherwise <b>false</b>
+  ///\ingroup btree_set
+  //***************************************************************************
+  template <typename TKey, typename TKeyCompare>
+  bool operator !=(const etl::ibtree_set<TKey, TKeyCompare>& lhs, const etl::ibtree_set<TKey, TKeyCompare>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //***************************************************************************
+  /// A btree_set implementation that uses fixed size pools.
+  ///\tparam TKey     The key type.
+  ///\tparam MAX_SIZE_ The maximum number of elements that can be stored.
+  ///\tparam TCompare The type to compare keys. Default = std::less<TKey>
+  ///\ingroup btree_set
+  //***************************************************************************
+  template <typename TKey, const size_t MAX_SIZE_, typename TCompare = std::less<TKey> >
+  class btree_set : public etl::ibtree_set<TKey, TCompare>
+  {
+  public:
+
+    static const size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    btree_set()
+      : etl::ibtree_set<TKey, TCompare>(leaf_pool, internal_pool, MAX_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    btree_set(const btree_set& other)
+      : etl::ibtree_set<TKey, TCompare>(leaf_pool, internal_pool, MAX_SIZE)
+    {
+      this->assign(other.cbegin(), other.cend());
+    }
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    btree_set(TIterator first, TIterator last)
+      : etl::ibtree_set<TKey, TCompare>(leaf_pool, internal_pool, MAX_SIZE)
+    {
+      this->assign(first, last);
+    }
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT) && !defined(ETL_NO_STL)
+    //*************************************************************************
+    /// Constructor, from an initializer_list.
+    //*************************************************************************
+    btree_set(std::initializer_list<typename etl::ibtree_set<TKey, TCompare>::value_type> init)
+      : etl::ibtree_set<TKey, TCompare>(leaf_pool, internal_pool, MAX_SIZE)
+    {
+      this->assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~btree_set()
+    {
+      this->clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    btree_set& operator = (const btree_set& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+  private:
+
+    typedef typename etl::ibtree_set<TKey, TCompare>::tree_t tree_t;
+    typedef etl::private_btree::node_count<TKey, typename etl::ibtree_set<TKey, TCompare>::value_type, MAX_SIZE> node_count_t;
+
+    /// The pools of leaf and internal nodes.
+    etl::pool<typename tree_t::leaf_node,     node_count_t::leaves>    leaf_pool;
+    etl::pool<typename tree_t::internal_node, node_count_t::internals> internal_pool;
+  };
+}
+
+#undef ETL_FILE
+
+#endif
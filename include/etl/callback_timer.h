@@ -39,6 +39,7 @@ SOFTWARE.
 #include "static_assert.h"
 #include "timer.h"
 #include "atomic.h"
+#include "private/timing_wheel.h"
 
 #undef ETL_FILE
 #define ETL_FILE "43"
@@ -684,6 +685,427 @@ namespace etl
 
     callback_timer_data timer_array[MAX_TIMERS_];
   };
+
+  //*************************************************************************
+  /// The configuration of a timing wheel timer.
+  struct callback_timer_wheel_data
+  {
+    //*******************************************
+    callback_timer_wheel_data()
+      : p_callback(nullptr),
+        period(0),
+        expires(0),
+        id(etl::timer::wheel_id::NO_TIMER),
+        previous(etl::timer::wheel_id::NO_TIMER),
+        next(etl::timer::wheel_id::NO_TIMER),
+        slot(etl::private_timing_wheel::wheel_base::NO_SLOT),
+        repeating(true),
+        has_c_callback(true)
+    {
+    }
+
+    //*******************************************
+    /// C function callback
+    //*******************************************
+    callback_timer_wheel_data(etl::timer::wheel_id::type id_,
+                              void                       (*p_callback_)(),
+                              uint32_t                   period_,
+                              bool                       repeating_)
+      : p_callback(reinterpret_cast<void*>(p_callback_)),
+        period(period_),
+        expires(0),
+        id(id_),
+        previous(etl::timer::wheel_id::NO_TIMER),
+        next(etl::timer::wheel_id::NO_TIMER),
+        slot(etl::private_timing_wheel::wheel_base::NO_SLOT),
+        repeating(repeating_),
+        has_c_callback(true)
+    {
+    }
+
+    //*******************************************
+    /// ETL function callback
+    //*******************************************
+    callback_timer_wheel_data(etl::timer::wheel_id::type id_,
+                              etl::ifunction<void>&      callback_,
+                              uint32_t                   period_,
+                              bool                       repeating_)
+      : p_callback(reinterpret_cast<void*>(&callback_)),
+        period(period_),
+        expires(0),
+        id(id_),
+        previous(etl::timer::wheel_id::NO_TIMER),
+        next(etl::timer::wheel_id::NO_TIMER),
+        slot(etl::private_timing_wheel::wheel_base::NO_SLOT),
+        repeating(repeating_),
+        has_c_callback(false)
+    {
+    }
+
+    //*******************************************
+    /// Returns true if the timer is active.
+    //*******************************************
+    bool is_active() const
+    {
+      return slot != etl::private_timing_wheel::wheel_base::NO_SLOT;
+    }
+
+    void*                      p_callback;
+    uint32_t                   period;
+    uint32_t                   expires;
+    etl::timer::wheel_id::type id;
+    etl::timer::wheel_id::type previous;
+    etl::timer::wheel_id::type next;
+    uint_least16_t             slot;
+    bool                       repeating;
+    bool                       has_c_callback;
+
+  private:
+
+    // Disabled.
+    callback_timer_wheel_data(const callback_timer_wheel_data& other);
+    callback_timer_wheel_data& operator =(const callback_timer_wheel_data& other);
+  };
+
+  //***************************************************************************
+  /// Interface for the timing wheel callback timer.
+  /// Has the same API as icallback_timer, but start, stop and expiry are O(1),
+  /// registration takes from a free list and up to 65534 timers are allowed.
+  //***************************************************************************
+  class icallback_timer_wheel
+  {
+  public:
+
+    //*******************************************
+    /// Register a timer.
+    //*******************************************
+    etl::timer::wheel_id::type register_timer(void     (*p_callback_)(),
+                                              uint32_t period_,
+                                              bool     repeating_)
+    {
+      etl::timer::wheel_id::type id = free_list;
+
+      if (id != etl::timer::wheel_id::NO_TIMER)
+      {
+        etl::callback_timer_wheel_data& timer = timer_array[id];
+        free_list = timer.next;
+
+        // Create in-place.
+        new (&timer) callback_timer_wheel_data(id, p_callback_, period_, repeating_);
+        ++registered_timers;
+      }
+
+      return id;
+    }
+
+    //*******************************************
+    /// Register a timer.
+    //*******************************************
+    etl::timer::wheel_id::type register_timer(etl::ifunction<void>& callback_,
+                                              uint32_t              period_,
+                                              bool                  repeating_)
+    {
+      etl::timer::wheel_id::type id = free_list;
+
+      if (id != etl::timer::wheel_id::NO_TIMER)
+      {
+        etl::callback_timer_wheel_data& timer = timer_array[id];
+        free_list = timer.next;
+
+        // Create in-place.
+        new (&timer) callback_timer_wheel_data(id, callback_, period_, repeating_);
+        ++registered_timers;
+      }
+
+      return id;
+    }
+
+    //*******************************************
+    /// Unregister a timer.
+    //*******************************************
+    bool unregister_timer(etl::timer::wheel_id::type id_)
+    {
+      bool result = false;
+
+      if (id_ < MAX_TIMERS)
+      {
+        etl::callback_timer_wheel_data& timer = timer_array[id_];
+
+        if (timer.id != etl::timer::wheel_id::NO_TIMER)
+        {
+          if (timer.is_active())
+          {
+            ETL_DISABLE_TIMER_UPDATES;
+            active_wheel.remove(timer.id);
+            ETL_ENABLE_TIMER_UPDATES;
+          }
+
+          // Reset in-place and return to the free list.
+          new (&timer) callback_timer_wheel_data();
+          timer.next = free_list;
+          free_list  = id_;
+          --registered_timers;
+
+          result = true;
+        }
+      }
+
+      return result;
+    }
+
+    //*******************************************
+    /// Enable/disable the timer.
+    //*******************************************
+    void enable(bool state_)
+    {
+      enabled = state_;
+    }
+
+    //*******************************************
+    /// Get the enable/disable state.
+    //*******************************************
+    bool is_running() const
+    {
+      return enabled;
+    }
+
+    //*******************************************
+    /// Clears the timer of data.
+    //*******************************************
+    void clear()
+    {
+      ETL_DISABLE_TIMER_UPDATES;
+      active_wheel.clear();
+      ETL_ENABLE_TIMER_UPDATES;
+
+      initialise();
+    }
+
+    //*******************************************
+    // Called by the timer service to indicate the
+    // amount of time that has elapsed since the last successful call to 'tick'.
+    // Returns true if the tick was processed,
+    // false if not.
+    //*******************************************
+    bool tick(uint32_t count)
+    {
+      if (enabled)
+      {
+        if (ETL_TIMER_UPDATES_ENABLED)
+        {
+          // Immediate timers are already in the expired list.
+          do
+          {
+            etl::timer::wheel_id::type id = active_wheel.pop_expired();
+
+            while (id != etl::timer::wheel_id::NO_TIMER)
+            {
+              etl::callback_timer_wheel_data& timer = timer_array[id];
+
+              if (timer.repeating)
+              {
+                // Reinsert the timer.
+                active_wheel.reinsert(id, timer.period);
+              }
+
+              if (timer.p_callback != nullptr)
+              {
+                if (timer.has_c_callback)
+                {
+                  // Call the C callback.
+                  reinterpret_cast<void(*)()>(timer.p_callback)();
+                }
+                else
+                {
+                  // Call the function wrapper callback.
+                  (*reinterpret_cast<etl::ifunction<void>*>(timer.p_callback))();
+                }
+              }
+
+              id = active_wheel.pop_expired();
+            }
+          } while (active_wheel.advance(count));
+
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    //*******************************************
+    /// Starts a timer.
+    //*******************************************
+    bool start(etl::timer::wheel_id::type id_, bool immediate_ = false)
+    {
+      bool result = false;
+
+      // Valid timer id?
+      if (id_ < MAX_TIMERS)
+      {
+        etl::callback_timer_wheel_data& timer = timer_array[id_];
+
+        // Registered timer?
+        if (timer.id != etl::timer::wheel_id::NO_TIMER)
+        {
+          // Has a valid period.
+          if (timer.period != etl::timer::state::INACTIVE)
+          {
+            ETL_DISABLE_TIMER_UPDATES;
+            if (timer.is_active())
+            {
+              active_wheel.remove(timer.id);
+            }
+
+            active_wheel.insert(timer.id, immediate_ ? 0 : timer.period);
+            ETL_ENABLE_TIMER_UPDATES;
+
+            result = true;
+          }
+        }
+      }
+
+      return result;
+    }
+
+    //*******************************************
+    /// Stops a timer.
+    //*******************************************
+    bool stop(etl::timer::wheel_id::type id_)
+    {
+      bool result = false;
+
+      // Valid timer id?
+      if (id_ < MAX_TIMERS)
+      {
+        etl::callback_timer_wheel_data& timer = timer_array[id_];
+
+        // Registered timer?
+        if (timer.id != etl::timer::wheel_id::NO_TIMER)
+        {
+          if (timer.is_active())
+          {
+            ETL_DISABLE_TIMER_UPDATES;
+            active_wheel.remove(timer.id);
+            ETL_ENABLE_TIMER_UPDATES;
+          }
+
+          result = true;
+        }
+      }
+
+      return result;
+    }
+
+    //*******************************************
+    /// Sets a timer's period.
+    //*******************************************
+    bool set_period(etl::timer::wheel_id::type id_, uint32_t period_)
+    {
+      if (stop(id_))
+      {
+        timer_array[id_].period = period_;
+        return true;
+      }
+
+      return false;
+    }
+
+    //*******************************************
+    /// Sets a timer's mode.
+    //*******************************************
+    bool set_mode(etl::timer::wheel_id::type id_, bool repeating_)
+    {
+      if (stop(id_))
+      {
+        timer_array[id_].repeating = repeating_;
+        return true;
+      }
+
+      return false;
+    }
+
+  protected:
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    icallback_timer_wheel(callback_timer_wheel_data* const timer_array_, const uint_least16_t MAX_TIMERS_)
+      : timer_array(timer_array_),
+        active_wheel(timer_array_),
+        free_list(etl::timer::wheel_id::NO_TIMER),
+        enabled(false),
+#if defined(ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK)
+        process_semaphore(0),
+#endif
+        registered_timers(0),
+        MAX_TIMERS(MAX_TIMERS_)
+    {
+    }
+
+    //*******************************************
+    /// Resets the timer data and links every timer into the free list.
+    //*******************************************
+    void initialise()
+    {
+      free_list = etl::timer::wheel_id::NO_TIMER;
+
+      for (uint_least16_t i = MAX_TIMERS; i != 0; --i)
+      {
+        etl::callback_timer_wheel_data& timer = timer_array[i - 1];
+        new (&timer) callback_timer_wheel_data();
+        timer.next = free_list;
+        free_list  = etl::timer::wheel_id::type(i - 1);
+      }
+
+      registered_timers = 0;
+    }
+
+  private:
+
+    // The array of timer data structures.
+    callback_timer_wheel_data* const timer_array;
+
+    // The wheel of active timers.
+    private_timing_wheel::wheel<etl::callback_timer_wheel_data> active_wheel;
+
+    // The head of the list of unregistered timers.
+    etl::timer::wheel_id::type free_list;
+
+    volatile bool enabled;
+#if defined(ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK)
+    volatile etl::timer_semaphore_t process_semaphore;
+#endif
+    volatile uint_least16_t registered_timers;
+
+  public:
+
+    const uint_least16_t MAX_TIMERS;
+  };
+
+  //***************************************************************************
+  /// The timing wheel callback timer
+  //***************************************************************************
+  template <const uint_least16_t MAX_TIMERS_>
+  class callback_timer_wheel : public etl::icallback_timer_wheel
+  {
+  public:
+
+    ETL_STATIC_ASSERT(MAX_TIMERS_ <= 65534, "No more than 65534 timers are allowed");
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    callback_timer_wheel()
+      : icallback_timer_wheel(timer_array, MAX_TIMERS_)
+    {
+      initialise();
+    }
+
+  private:
+
+    callback_timer_wheel_data timer_array[MAX_TIMERS_];
+  };
 }
 
 #undef ETL_DISABLE_TIMER_UPDATES
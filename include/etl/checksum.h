@@ -27,7 +27,9 @@ SOFTWARE.
 #ifndef ETL_CHECKSUM_INCLUDED
 #define ETL_CHECKSUM_INCLUDED
 
+#include <stddef.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "platform.h"
 #include "binary.h"
@@ -38,6 +40,69 @@ SOFTWARE.
 
 namespace etl
 {
+  namespace private_checksum
+  {
+    //*************************************************************************
+    /// Loads a 64 bit word from a possibly unaligned address.
+    //*************************************************************************
+    inline uint64_t load_word(const uint8_t* p)
+    {
+      uint64_t word;
+      memcpy(&word, p, sizeof(word));
+
+      return word;
+    }
+
+    //*************************************************************************
+    /// Adds all of the bytes in a block, eight at a time.
+    /// Bytes are accumulated in four 16 bit lanes, which are folded before
+    /// they can overflow.
+    //*************************************************************************
+    inline uint64_t sum_block(const uint8_t*& begin, const uint8_t* end)
+    {
+      // Each word adds at most 2 * 255 to a lane.
+      static const size_t MAX_WORDS_PER_FOLD = 128;
+      static const uint64_t LANE_MASK = 0x00FF00FF00FF00FFULL;
+
+      uint64_t total = 0;
+
+      while (size_t(end - begin) >= sizeof(uint64_t))
+      {
+        uint64_t lanes = 0;
+        size_t   words = 0;
+
+        while ((size_t(end - begin) >= sizeof(uint64_t)) && (words < MAX_WORDS_PER_FOLD))
+        {
+          const uint64_t word = load_word(begin);
+          lanes += (word & LANE_MASK) + ((word >> 8) & LANE_MASK);
+          begin += sizeof(uint64_t);
+          ++words;
+        }
+
+        total += (lanes & 0xFFFF) + ((lanes >> 16) & 0xFFFF) + ((lanes >> 32) & 0xFFFF) + (lanes >> 48);
+      }
+
+      return total;
+    }
+
+    //*************************************************************************
+    /// Exclusive ors all of the 64 bit words in a block.
+    /// The words of an 'n' word group are accumulated separately.
+    //*************************************************************************
+    template <const size_t N>
+    void xor_block(uint64_t (&accumulator)[N], const uint8_t*& begin, const uint8_t* end)
+    {
+      while (size_t(end - begin) >= (N * sizeof(uint64_t)))
+      {
+        for (size_t i = 0; i < N; ++i)
+        {
+          accumulator[i] ^= load_word(begin);
+          begin += sizeof(uint64_t);
+        }
+      }
+    }
+  }
+
   //***************************************************************************
   /// Standard addition checksum policy.
   //***************************************************************************
@@ -56,6 +121,18 @@ namespace etl
       return sum + value;
     }
 
+    inline T add(T sum, const uint8_t* begin, const uint8_t* end) const
+    {
+      sum += T(private_checksum::sum_block(begin, end));
+
+      while (begin != end)
+      {
+        sum += *begin++;
+      }
+
+      return sum;
+    }
+
     inline T final(T sum) const
     {
       return sum;
@@ -104,6 +181,28 @@ namespace etl
       return sum ^ value;
     }
 
+    inline T add(T sum, const uint8_t* begin, const uint8_t* end) const
+    {
+      uint64_t accumulator[1] = { 0 };
+
+      private_checksum::xor_block(accumulator, begin, end);
+
+      // Fold the word down to a byte.
+      uint64_t folded = accumulator[0];
+      folded ^= (folded >> 32);
+      folded ^= (folded >> 16);
+      folded ^= (folded >> 8);
+
+      sum ^= uint8_t(folded);
+
+      while (begin != end)
+      {
+        sum ^= *begin++;
+      }
+
+      return sum;
+    }
+
     inline T final(T sum) const
     {
       return sum;
@@ -128,6 +227,46 @@ namespace etl
       return etl::rotate_left(sum) ^ value;
     }
 
+    //*************************************************************************
+    /// Rotating by the bit width of T leaves a value unchanged, so bytes that
+    /// are the same distance from the end of a group of sizeof(T) * 8 bytes
+    /// are rotated by the same amount. The groups are exclusive ored together
+    /// first and the rotations applied once at the end.
+    //*************************************************************************
+    inline T add(T sum, const uint8_t* begin, const uint8_t* end) const
+    {
+      static const size_t GROUP_BYTES = sizeof(T) * CHAR_BIT;
+      static const size_t GROUP_WORDS = GROUP_BYTES / sizeof(uint64_t);
+
+      uint64_t accumulator[GROUP_WORDS] = { 0 };
+
+      const uint8_t* const block_begin = begin;
+
+      private_checksum::xor_block(accumulator, begin, end);
+
+      if (begin != block_begin)
+      {
+        uint8_t group[GROUP_BYTES];
+        memcpy(group, accumulator, GROUP_BYTES);
+
+        T folded = 0;
+
+        for (size_t i = 0; i < GROUP_BYTES; ++i)
+        {
+          folded = etl::rotate_left(folded) ^ group[i];
+        }
+
+        sum ^= folded;
+      }
+
+      while (begin != end)
+      {
+        sum = etl::rotate_left(sum) ^ *begin++;
+      }
+
+      return sum;
+    }
+
     inline T final(T sum) const
     {
       return sum;
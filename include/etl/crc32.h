@@ -31,10 +31,13 @@ SOFTWARE.
 #ifndef ETL_CRC32_INCLUDED
 #define ETL_CRC32_INCLUDED
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include "platform.h"
 #include "frame_check_sequence.h"
+#include "static_assert.h"
+#include "private/crc32_slicing.h"
 
 #include "stl/iterator.h"
 
@@ -134,6 +137,70 @@ namespace etl
       this->add(begin, end);
     }
   };
+
+  //***************************************************************************
+  /// CRC32 policy using 'slicing-by-N' tables.
+  /// Calculates CRC32 using polynomial 0x04C11DB7.
+  /// Contiguous blocks of bytes are processed SLICES bytes per step.
+  ///\tparam SLICES The number of bytes per step. Must be 4, 8 or 16.
+  /// Every SLICES value uses the same 16 x 256 entry constant table, 16K bytes.
+  //***************************************************************************
+  template <const size_t SLICES>
+  struct crc_policy_32_slicing
+  {
+    ETL_STATIC_ASSERT((SLICES == 4) || (SLICES == 8) || (SLICES == 16), "SLICES must be 4, 8 or 16");
+
+    typedef uint32_t value_type;
+
+    inline uint32_t initial() const
+    {
+      return 0xFFFFFFFF;
+    }
+
+    inline uint32_t add(uint32_t crc, uint8_t value) const
+    {
+      return  (crc >> 8) ^ private_crc32::crc32_slicing_table()[0][(crc ^ value) & 0xFF];
+    }
+
+    inline uint32_t add(uint32_t crc, const uint8_t* begin, const uint8_t* end) const
+    {
+      return private_crc32::add_sliced<SLICES>(crc, begin, end, private_crc32::crc32_slicing_table());
+    }
+
+    inline uint32_t final(uint32_t crc) const
+    {
+      return crc ^ 0xFFFFFFFF;
+    }
+  };
+
+  //*************************************************************************
+  /// CRC32, using 'slicing-by-N' tables.
+  //*************************************************************************
+  template <const size_t SLICES = 8>
+  class crc32_slicing : public etl::frame_check_sequence<etl::crc_policy_32_slicing<SLICES> >
+  {
+  public:
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    crc32_slicing()
+    {
+      this->reset();
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    //*************************************************************************
+    template<typename TIterator>
+    crc32_slicing(TIterator begin, const TIterator end)
+    {
+      this->reset();
+      this->add(begin, end);
+    }
+  };
 }
 
 #endif
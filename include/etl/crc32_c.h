@@ -31,13 +31,25 @@ SOFTWARE.
 #ifndef ETL_CRC32_C_INCLUDED
 #define ETL_CRC32_C_INCLUDED
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include "platform.h"
 #include "frame_check_sequence.h"
+#include "static_assert.h"
+#include "private/crc32_slicing.h"
 
 #include "stl/iterator.h"
 
+#if !defined(ETL_CRC32_C_NO_SSE42) && defined(ETL_TARGET_DEVICE_X86) && defined(__SSE4_2__)
+  #define ETL_CRC32_C_SSE42
+#endif
+
+#if defined(ETL_CRC32_C_SSE42)
+  #include <string.h>
+  #include <nmmintrin.h>
+#endif
+
 #if defined(ETL_COMPILER_KEIL)
 #pragma diag_suppress 1300
 #endif
@@ -134,6 +146,99 @@ namespace etl
       this->add(begin, end);
     }
   };
+
+  //***************************************************************************
+  /// CRC32_C policy using 'slicing-by-N' tables.
+  /// Calculates CRC32_C using polynomial 0x1EDC6F41.
+  /// Contiguous blocks of bytes are processed SLICES bytes per step.
+  /// If ETL_CRC32_C_SSE42 is defined then the SSE4.2 CRC32 instruction is
+  /// used for blocks instead of the tables.
+  ///\tparam SLICES The number of bytes per step. Must be 4, 8 or 16.
+  /// Every SLICES value uses the same 16 x 256 entry constant table, 16K bytes.
+  //***************************************************************************
+  template <const size_t SLICES>
+  struct crc_policy_32_c_slicing
+  {
+    ETL_STATIC_ASSERT((SLICES == 4) || (SLICES == 8) || (SLICES == 16), "SLICES must be 4, 8 or 16");
+
+    typedef uint32_t value_type;
+
+    inline uint32_t initial() const
+    {
+      return 0xFFFFFFFF;
+    }
+
+    inline uint32_t add(uint32_t crc, uint8_t value) const
+    {
+      return  (crc >> 8) ^ private_crc32::crc32_c_slicing_table()[0][(crc ^ value) & 0xFF];
+    }
+
+    inline uint32_t add(uint32_t crc, const uint8_t* begin, const uint8_t* end) const
+    {
+#if defined(ETL_CRC32_C_SSE42)
+  #if ETL_PLATFORM_64BIT
+      while ((end - begin) >= 8)
+      {
+        uint64_t block;
+        memcpy(&block, begin, sizeof(block));
+        crc = static_cast<uint32_t>(_mm_crc32_u64(crc, block));
+        begin += 8;
+      }
+  #endif
+
+      while ((end - begin) >= 4)
+      {
+        uint32_t block;
+        memcpy(&block, begin, sizeof(block));
+        crc = _mm_crc32_u32(crc, block);
+        begin += 4;
+      }
+
+      while (begin != end)
+      {
+        crc = _mm_crc32_u8(crc, *begin++);
+      }
+
+      return crc;
+#else
+      return private_crc32::add_sliced<SLICES>(crc, begin, end, private_crc32::crc32_c_slicing_table());
+#endif
+    }
+
+    inline uint32_t final(uint32_t crc) const
+    {
+      return crc ^ 0xFFFFFFFF;
+    }
+  };
+
+  //*************************************************************************
+  /// CRC32_C, using 'slicing-by-N' tables.
+  //*************************************************************************
+  template <const size_t SLICES = 8>
+  class crc32_c_slicing : public etl::frame_check_sequence<etl::crc_policy_32_c_slicing<SLICES> >
+  {
+  public:
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    crc32_c_slicing()
+    {
+      this->reset();
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    //*************************************************************************
+    template<typename TIterator>
+    crc32_c_slicing(TIterator begin, const TIterator end)
+    {
+      this->reset();
+      this->add(begin, end);
+    }
+  };
 }
 
 #endif
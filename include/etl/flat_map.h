@@ -271,11 +271,7 @@ namespace etl
 #endif
 
       clear();
-
-      while (first != last)
-      {
-        insert(*first++);
-      }
+      insert(first, last);
     }
 
     //*********************************************************************
@@ -316,18 +312,29 @@ namespace etl
 
     //*********************************************************************
     /// Inserts a range of values to the flat_map.
+    /// The range is sorted and merged with the existing elements in one pass.
+    /// Values whose keys already exist, or appear earlier in the range, are not inserted.
     /// If asserts or exceptions are enabled, emits flat_map_full if the flat_map does not have enough free space.
-    ///\param position The position to insert at.
     ///\param first    The first element to add.
     ///\param last     The last + 1 element to add.
     //*********************************************************************
     template <class TIterator>
     void insert(TIterator first, TIterator last)
     {
-      while (first != last)
-      {
-        insert(*first++);
-      }
+      insert_range(first, last, false);
+    }
+
+    //*********************************************************************
+    /// Inserts a range of values, already sorted by key, to the flat_map.
+    /// The range is merged with the existing elements in one pass.
+    /// If asserts or exceptions are enabled, emits flat_map_full if the flat_map does not have enough free space.
+    ///\param first    The first element to add.
+    ///\param last     The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_sorted(TIterator first, TIterator last)
+    {
+      insert_range(first, last, true);
     }
 
     //*************************************************************************
@@ -755,6 +762,66 @@ namespace etl
 
   private:
 
+    //*********************************************************************
+    /// Inserts a range of values, dispatching on the iterator category.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_range(TIterator first, TIterator last, bool is_sorted)
+    {
+      typedef typename std::iterator_traits<TIterator>::iterator_category iterator_category;
+
+      insert_range(first, last, is_sorted, iterator_category());
+    }
+
+    //*********************************************************************
+    /// Inserts a range of values from single pass input iterators.
+    /// The range cannot be counted without consuming it, so the values are
+    /// inserted one at a time.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_range(TIterator first, TIterator last, bool /*is_sorted*/, std::input_iterator_tag)
+    {
+      while (first != last)
+      {
+        insert(*first++);
+      }
+    }
+
+    //*********************************************************************
+    /// Inserts a range of values to the flat_map.
+    /// If the range is larger than the free space then the values are
+    /// inserted one at a time, as duplicates may still allow it to fit.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_range(TIterator first, TIterator last, bool is_sorted, std::forward_iterator_tag)
+    {
+      if (size_t(std::distance(first, last)) > available())
+      {
+        while (first != last)
+        {
+          insert(*first++);
+        }
+
+        return;
+      }
+
+      size_t n_sorted = size();
+
+      while (first != last)
+      {
+        value_type* pvalue = storage.allocate<value_type>();
+        ::new (pvalue) value_type(*first++);
+        ETL_INCREMENT_DEBUG_COUNT
+        refmap_t::append_unmerged(*pvalue);
+      }
+
+      size_t n_rejected = refmap_t::merge_appended(n_sorted, is_sorted);
+
+      iterator i_rejected = end();
+      std::advance(i_rejected, -difference_type(n_rejected));
+      erase(i_rejected, end());
+    }
+
     // Disable copy construction.
     iflat_map(const iflat_map&);
 
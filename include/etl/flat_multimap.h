@@ -240,11 +240,7 @@ namespace etl
 #endif
 
       clear();
-
-      while (first != last)
-      {
-        insert(*first++);
-      }
+      insert(first, last);
     }
 
     //*********************************************************************
@@ -281,18 +277,29 @@ namespace etl
 
     //*********************************************************************
     /// Inserts a range of values to the flat_multimap.
+    /// The range is sorted and merged with the existing elements in one pass.
+    /// Values equal to existing ones are placed after them, in the order of the range.
     /// If asserts or exceptions are enabled, emits flat_multimap_full if the flat_multimap does not have enough free space.
-    ///\param position The position to insert at.
     ///\param first    The first element to add.
     ///\param last     The last + 1 element to add.
     //*********************************************************************
     template <class TIterator>
     void insert(TIterator first, TIterator last)
     {
-      while (first != last)
-      {
-        insert(*first++);
-      }
+      insert_range(first, last, false);
+    }
+
+    //*********************************************************************
+    /// Inserts a range of values, already sorted by key, to the flat_multimap.
+    /// The range is merged with the existing elements in one pass.
+    /// If asserts or exceptions are enabled, emits flat_multimap_full if the flat_multimap does not have enough free space.
+    ///\param first    The first element to add.
+    ///\param last     The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_sorted(TIterator first, TIterator last)
+    {
+      insert_range(first, last, true);
     }
 
     //*************************************************************************
@@ -664,6 +671,62 @@ namespace etl
 
   private:
 
+    //*********************************************************************
+    /// Inserts a range of values, dispatching on the iterator category.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_range(TIterator first, TIterator last, bool is_sorted)
+    {
+      typedef typename std::iterator_traits<TIterator>::iterator_category iterator_category;
+
+      insert_range(first, last, is_sorted, iterator_category());
+    }
+
+    //*********************************************************************
+    /// Inserts a range of values from single pass input iterators.
+    /// The range cannot be counted without consuming it, so the values are
+    /// inserted one at a time.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_range(TIterator first, TIterator last, bool /*is_sorted*/, std::input_iterator_tag)
+    {
+      while (first != last)
+      {
+        insert(*first++);
+      }
+    }
+
+    //*********************************************************************
+    /// Inserts a range of values to the flat_multimap.
+    /// If the range is larger than the free space then the values are
+    /// inserted one at a time, filling the free space before reporting the error.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_range(TIterator first, TIterator last, bool is_sorted, std::forward_iterator_tag)
+    {
+      if (size_t(std::distance(first, last)) > available())
+      {
+        while (first != last)
+        {
+          insert(*first++);
+        }
+
+        return;
+      }
+
+      size_t n_sorted = size();
+
+      while (first != last)
+      {
+        value_type* pvalue = storage.allocate<value_type>();
+        ::new (pvalue) value_type(*first++);
+        ETL_INCREMENT_DEBUG_COUNT
+        refmap_t::append_unmerged(*pvalue);
+      }
+
+      refmap_t::merge_appended(n_sorted, is_sorted);
+    }
+
     // Disable copy construction.
     iflat_multimap(const iflat_multimap&);
 
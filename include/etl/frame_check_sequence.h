@@ -43,8 +43,45 @@ ETL_STATIC_ASSERT(ETL_8BIT_SUPPORT, "This file does not currently support target
 
 namespace etl
 {
+  namespace private_frame_check_sequence
+  {
+    //*************************************************************************
+    /// Detects whether a policy can add a contiguous block of bytes in one call.
+    /// A block capable policy defines
+    /// value_type add(value_type value, const uint8_t* begin, const uint8_t* end) const;
+    //*************************************************************************
+    template <typename TPolicy>
+    class has_block_add
+    {
+    private:
+
+      typedef typename TPolicy::value_type value_type;
+
+      typedef char yes;
+      struct no { char dummy[2]; };
+
+      template <typename U, value_type (U::*)(value_type, const uint8_t*, const uint8_t*) const>
+      struct check;
+
+      template <typename U>
+      static yes test(check<U, &U::add>*);
+
+      template <typename U>
+      static no test(...);
+
+    public:
+
+      static const bool value = (sizeof(test<TPolicy>(0)) == sizeof(yes));
+    };
+
+    template <typename TPolicy>
+    const bool has_block_add<TPolicy>::value;
+  }
+
   //***************************************************************************
   /// Calculates a frame check sequence according to the specified policy.
+  /// If the policy supplies a block 'add' then ranges defined by pointers
+  /// to bytes are passed to it in one call.
   ///\tparam TPolicy The type used to enact the policy.
   ///\ingroup frame_check_sequence
   //***************************************************************************
@@ -98,10 +135,10 @@ namespace etl
     {
       ETL_STATIC_ASSERT(sizeof(typename std::iterator_traits<TIterator>::value_type) == 1, "Type not supported");
 
-      while (begin != end)
-      {
-        frame_check = policy.add(frame_check, *begin++);
-      }
+      typedef etl::integral_constant<bool, etl::is_pointer<TIterator>::value &&
+                                           private_frame_check_sequence::has_block_add<policy_type>::value> use_block_add;
+
+      add_range(begin, end, use_block_add());
     }
 
     //*************************************************************************
@@ -130,6 +167,29 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    /// Adds a range, one byte at a time.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, etl::false_type)
+    {
+      while (begin != end)
+      {
+        frame_check = policy.add(frame_check, *begin++);
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a contiguous range of bytes as a block.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, etl::true_type)
+    {
+      frame_check = policy.add(frame_check,
+                               reinterpret_cast<const uint8_t*>(begin),
+                               reinterpret_cast<const uint8_t*>(end));
+    }
+
     value_type  frame_check;
     policy_type policy;
   };
@@ -0,0 +1,589 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FROZEN_FLAT_MAP_INCLUDED
+#define ETL_FROZEN_FLAT_MAP_INCLUDED
+
+#include <stddef.h>
+
+#include "platform.h"
+
+#include "stl/algorithm.h"
+#include "stl/iterator.h"
+#include "stl/functional.h"
+#include "stl/utility.h"
+
+#include "algorithm.h"
+#include "vector.h"
+#include "type_traits.h"
+#include "parameter_type.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "private/eytzinger.h"
+
+#undef ETL_FILE
+#define ETL_FILE "55"
+
+//*****************************************************************************
+///\defgroup frozen_flat_map frozen_flat_map
+/// A read only map with the capacity defined at compile time, for lookups
+/// that are made far more often than the contents change.
+/// The contents are replaced as a whole by assign, which is O(N log N).
+/// The key/value pairs are held in key order. A copy of the keys is held in
+/// Eytzinger (breadth first) order, so that a search walks down an implicit
+/// binary tree whose top levels share a few cache lines, with no pointer to
+/// follow and no data dependent branch.
+/// Duplicate keys are not allowed.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the frozen_flat_map.
+  ///\ingroup frozen_flat_map
+  //***************************************************************************
+  class frozen_flat_map_exception : public etl::exception
+  {
+  public:
+
+    frozen_flat_map_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the frozen_flat_map.
+  ///\ingroup frozen_flat_map
+  //***************************************************************************
+  class frozen_flat_map_full : public etl::frozen_flat_map_exception
+  {
+  public:
+
+    frozen_flat_map_full(string_type file_name_, numeric_type line_number_)
+      : etl::frozen_flat_map_exception(ETL_ERROR_TEXT("frozen_flat_map:full", ETL_FILE"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of bounds exception for the frozen_flat_map.
+  ///\ingroup frozen_flat_map
+  //***************************************************************************
+  class frozen_flat_map_out_of_bounds : public etl::frozen_flat_map_exception
+  {
+  public:
+
+    frozen_flat_map_out_of_bounds(string_type file_name_, numeric_type line_number_)
+      : etl::frozen_flat_map_exception(ETL_ERROR_TEXT("frozen_flat_map:bounds", ETL_FILE"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for specifically sized frozen_flat_maps.
+  /// Can be used as a reference type for all frozen_flat_maps containing a specific type.
+  ///\ingroup frozen_flat_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare = std::less<TKey> >
+  class ifrozen_flat_map
+  {
+  public:
+
+    typedef std::pair<TKey, TMapped> value_type;
+
+    typedef TKey              key_type;
+    typedef TMapped           mapped_type;
+    typedef TKeyCompare       key_compare;
+    typedef const value_type& const_reference;
+    typedef const value_type* const_pointer;
+    typedef size_t            size_type;
+
+    typedef const value_type*                     const_iterator;
+    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+    typedef ptrdiff_t                             difference_type;
+
+  protected:
+
+    typedef etl::ivector<value_type> values_t;
+
+    typedef typename etl::parameter_type<TKey>::type key_parameter_t;
+
+  private:
+
+    //*********************************************************************
+    /// How to compare elements.
+    //*********************************************************************
+    struct compare_elements
+    {
+      bool operator ()(const value_type& lhs, const value_type& rhs) const
+      {
+        return key_compare()(lhs.first, rhs.first);
+      }
+    };
+
+    //*********************************************************************
+    /// Gets the key of an element.
+    //*********************************************************************
+    struct key_of
+    {
+      const key_type& operator ()(const value_type& value) const
+      {
+        return value.first;
+      }
+    };
+
+  public:
+
+    //*********************************************************************
+    /// Returns a const_iterator to the beginning of the frozen_flat_map.
+    //*********************************************************************
+    const_iterator begin() const
+    {
+      return values.begin();
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the end of the frozen_flat_map.
+    //*********************************************************************
+    const_iterator end() const
+    {
+      return values.end();
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the beginning of the frozen_flat_map.
+    //*********************************************************************
+    const_iterator cbegin() const
+    {
+      return values.cbegin();
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the end of the frozen_flat_map.
+    //*********************************************************************
+    const_iterator cend() const
+    {
+      return values.cend();
+    }
+
+    //*********************************************************************
+    /// Returns a const reverse iterator to the reverse beginning of the frozen_flat_map.
+    //*********************************************************************
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*********************************************************************
+    /// Returns a const reverse iterator to the end + 1 of the frozen_flat_map.
+    //*********************************************************************
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an etl::frozen_flat_map_out_of_bounds if the key is not in the range.
+    ///\param key The key.
+    ///\return A const reference to the value at index 'key'
+    //*********************************************************************
+    const mapped_type& at(key_parameter_t key) const
+    {
+      const_iterator i_element = find(key);
+
+      ETL_ASSERT(i_element != end(), ETL_ERROR(frozen_flat_map_out_of_bounds));
+
+      return i_element->second;
+    }
+
+    //*********************************************************************
+    /// Replaces the contents of the frozen_flat_map and rebuilds the search order.
+    /// The range does not need to be sorted. For keys that appear more than
+    /// once, the first in the range is kept.
+    /// If the range does not fit, the frozen_flat_map is left empty.
+    /// If asserts or exceptions are enabled, emits frozen_flat_map_full if the frozen_flat_map does not have enough space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first, TIterator last)
+    {
+      clear();
+
+      while (first != last)
+      {
+        if (values.full())
+        {
+          // The search order still describes the old contents, so empty it.
+          clear();
+          ETL_ASSERT(false, ETL_ERROR(frozen_flat_map_full));
+          return;
+        }
+
+        values.push_back(value_type(first->first, first->second));
+        ++first;
+      }
+
+      if (!etl::is_sorted(values.begin(), values.end(), compare_elements()))
+      {
+        etl::stable_sort(values.begin(), values.end(), compare_elements());
+      }
+
+      remove_duplicates();
+
+      etl::private_eytzinger::build(p_keys, p_ranks, values.data(), values.size(), size_t(0), size_t(1), key_of());
+    }
+
+    //*********************************************************************
+    /// Clears the frozen_flat_map.
+    //*********************************************************************
+    void clear()
+    {
+      values.clear();
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    const_iterator find(key_parameter_t key) const
+    {
+      const_iterator i_element = lower_bound(key);
+
+      if ((i_element != end()) && !key_compare()(key, i_element->first))
+      {
+        return i_element;
+      }
+
+      return end();
+    }
+
+    //*********************************************************************
+    /// Counts an element.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    size_t count(key_parameter_t key) const
+    {
+      return (find(key) == end()) ? 0 : 1;
+    }
+
+    //*********************************************************************
+    /// Finds the lower bound of a key
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    const_iterator lower_bound(key_parameter_t key) const
+    {
+      return begin() + etl::private_eytzinger::lower_bound(p_keys, p_ranks, size(), key, key_compare());
+    }
+
+    //*********************************************************************
+    /// Finds the upper bound of a key
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    const_iterator upper_bound(key_parameter_t key) const
+    {
+      return begin() + etl::private_eytzinger::upper_bound(p_keys, p_ranks, size(), key, key_compare());
+    }
+
+    //*********************************************************************
+    /// Finds the range of equal elements of a key
+    ///\param key The key to search for.
+    ///\return An iterator pair.
+    //*********************************************************************
+    std::pair<const_iterator, const_iterator> equal_range(key_parameter_t key) const
+    {
+      const_iterator i_lower = lower_bound(key);
+      const_iterator i_upper = i_lower;
+
+      if ((i_upper != end()) && !key_compare()(key, i_upper->first))
+      {
+        ++i_upper;
+      }
+
+      return std::pair<const_iterator, const_iterator>(i_lower, i_upper);
+    }
+
+    //*************************************************************************
+    /// Gets the current size of the frozen_flat_map.
+    ///\return The current size of the frozen_flat_map.
+    //*************************************************************************
+    size_type size() const
+    {
+      return values.size();
+    }
+
+    //*************************************************************************
+    /// Checks the 'empty' state of the frozen_flat_map.
+    ///\return <b>true</b> if empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return values.empty();
+    }
+
+    //*************************************************************************
+    /// Checks the 'full' state of the frozen_flat_map.
+    ///\return <b>true</b> if full.
+    //*************************************************************************
+    bool full() const
+    {
+      return values.full();
+    }
+
+    //*************************************************************************
+    /// Returns the capacity of the frozen_flat_map.
+    ///\return The capacity of the frozen_flat_map.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return values.capacity();
+    }
+
+    //*************************************************************************
+    /// Returns the maximum possible size of the frozen_flat_map.
+    ///\return The maximum size of the frozen_flat_map.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return values.max_size();
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    ///\return The remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return values.available();
+    }
+
+  protected:
+
+    //*********************************************************************
+    /// Constructor.
+    //*********************************************************************
+    ifrozen_flat_map(values_t& values_, key_type* p_keys_, size_t* p_ranks_)
+      : values(values_),
+        p_keys(p_keys_),
+        p_ranks(p_ranks_)
+    {
+    }
+
+  private:
+
+    //*********************************************************************
+    /// Removes all but the first of each run of equal keys.
+    //*********************************************************************
+    void remove_duplicates()
+    {
+      if (values.size() < 2)
+      {
+        return;
+      }
+
+      typename values_t::iterator last_kept = values.begin();
+      typename values_t::iterator itr       = last_kept;
+
+      while (++itr != values.end())
+      {
+        if (key_compare()(last_kept->first, itr->first))
+        {
+          ++last_kept;
+
+          if (last_kept != itr)
+          {
+            *last_kept = *itr;
+          }
+        }
+      }
+
+      values.erase(last_kept + 1, values.end());
+    }
+
+    // Disable copy construction and assignment.
+    ifrozen_flat_map(const ifrozen_flat_map&);
+    ifrozen_flat_map& operator = (const ifrozen_flat_map&);
+
+    /// The key/value pairs in key order.
+    values_t& values;
+
+    /// The keys in Eytzinger order. 1 based.
+    key_type* p_keys;
+
+    /// The index in 'values' of each key in 'p_keys'. 1 based.
+    size_t* p_ranks;
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_FROZEN_FLAT_MAP) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~ifrozen_flat_map()
+    {
+    }
+#else
+  protected:
+    ~ifrozen_flat_map()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\param lhs Reference to the first frozen_flat_map.
+  ///\param rhs Reference to the second frozen_flat_map.
+  ///\return <b>true</b> if the maps are equal, otherwise <b>false</b>
+  ///\ingroup frozen_flat_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator ==(const etl::ifrozen_flat_map<TKey, TMapped, TKeyCompare>& lhs, const etl::ifrozen_flat_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return (lhs.size() == rhs.size()) && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first frozen_flat_map.
+  ///\param rhs Reference to the second frozen_flat_map.
+  ///\return <b>true</b> if the maps are not equal, otherwise <b>false</b>
+  ///\ingroup frozen_flat_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator !=(const etl::ifrozen_flat_map<TKey, TMapped, TKeyCompare>& lhs, const etl::ifrozen_flat_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //***************************************************************************
+  /// A frozen_flat_map implementation that uses a fixed size buffer.
+  /// The keys are stored twice; once with the values and once in search order.
+  ///\tparam TKey      The key type. Must be default constructible.
+  ///\tparam TValue    The value type.
+  ///\tparam MAX_SIZE_ The maximum number of elements that can be stored.
+  ///\tparam TCompare  The type to compare keys. Default = std::less<TKey>
+  ///\ingroup frozen_flat_map
+  //***************************************************************************
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename TCompare = std::less<TKey> >
+  class frozen_flat_map : public etl::ifrozen_flat_map<TKey, TValue, TCompare>
+  {
+  private:
+
+    typedef etl::ifrozen_flat_map<TKey, TValue, TCompare> base;
+
+  public:
+
+    static const size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    frozen_flat_map()
+      : base(values, keys, ranks),
+        keys(),
+        ranks()
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    frozen_flat_map(const frozen_flat_map& other)
+      : base(values, keys, ranks),
+        keys(),
+        ranks()
+    {
+      base::assign(other.cbegin(), other.cend());
+    }
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    frozen_flat_map(TIterator first, TIterator last)
+      : base(values, keys, ranks),
+        keys(),
+        ranks()
+    {
+      base::assign(first, last);
+    }
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT) && !defined(ETL_NO_STL)
+    //*************************************************************************
+    /// Construct from initializer_list.
+    //*************************************************************************
+    frozen_flat_map(std::initializer_list<typename base::value_type> init)
+      : base(values, keys, ranks),
+        keys(),
+        ranks()
+    {
+      base::assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    frozen_flat_map& operator = (const frozen_flat_map& rhs)
+    {
+      if (&rhs != this)
+      {
+        base::assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+  private:
+
+    /// The key/value pairs in key order.
+    etl::vector<typename base::value_type, MAX_SIZE> values;
+
+    /// The keys in search order. Element 0 is unused.
+    TKey keys[MAX_SIZE + 1];
+
+    /// The index in 'values' of each key.
+    size_t ranks[MAX_SIZE + 1];
+  };
+}
+
+#undef ETL_FILE
+
+#endif
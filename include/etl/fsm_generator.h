@@ -74,6 +74,7 @@ cog.outl("//********************************************************************
 #include "message_router.h"
 #include "integral_limits.h"
 #include "largest.h"
+#include "private/message_dispatch.h"
 
 #undef ETL_FILE
 #define ETL_FILE "34"
@@ -379,6 +380,80 @@ namespace etl
     etl::fsm_state_id_t number_of_states; ///< The number of states.
   };
 
+#if ETL_CPP11_SUPPORTED && !defined(ETL_FSM_FORCE_CPP03)
+  //***************************************************************************
+  /// The definition for any number of message types.
+  /// Events are dispatched with one lookup in a table indexed by message id.
+  //***************************************************************************
+  template <typename TContext, typename TDerived, const etl::fsm_state_id_t STATE_ID_, typename... TMessageTypes>
+  class fsm_state : public ifsm_state
+  {
+  public:
+
+    ETL_STATIC_ASSERT(!etl::private_message_dispatch::has_duplicate_ids<TMessageTypes...>::value, "Message ids must be unique");
+
+    enum
+    {
+      STATE_ID = STATE_ID_
+    };
+
+    fsm_state()
+      : ifsm_state(STATE_ID)
+    {
+    }
+
+  protected:
+
+    ~fsm_state()
+    {
+    }
+
+    inline TContext& get_fsm_context() const
+    {
+      return static_cast<TContext&>(ifsm_state::get_fsm_context());
+    }
+
+  private:
+
+    //*******************************************
+    struct event_handler
+    {
+      typedef etl::fsm_state_id_t (*type)(fsm_state&, etl::imessage_router&, const etl::imessage&);
+
+      template <typename TMessage>
+      static constexpr type get(TMessage*)
+      {
+        return &call<TMessage>;
+      }
+
+      static constexpr type get(void*)
+      {
+        return nullptr;
+      }
+
+      template <typename TMessage>
+      static etl::fsm_state_id_t call(fsm_state& state, etl::imessage_router& source, const etl::imessage& message)
+      {
+        return static_cast<TDerived&>(state).on_event(source, static_cast<const TMessage&>(message));
+      }
+    };
+
+    etl::fsm_state_id_t process_event(etl::imessage_router& source, const etl::imessage& message)
+    {
+      typename event_handler::type handler =
+        etl::private_message_dispatch::dispatcher<TMessageTypes...>::template find<event_handler>(message.message_id);
+
+      if (handler != nullptr)
+      {
+        return handler(*this, source, message);
+      }
+      else
+      {
+        return static_cast<TDerived*>(this)->on_event_unknown(source, message);
+      }
+    }
+  };
+#else
   /*[[[cog
   import cog
   ################################################
@@ -565,6 +640,7 @@ namespace etl
   cog.outl("};")
   ]]]*/
   /*[[[end]]]*/
+#endif
 }
 
 #undef ETL_FILE
@@ -82,6 +82,36 @@ namespace etl
     {
       return fnv_1a_64(begin, end);
     }
+
+    //*************************************************************************
+    /// Detects whether T declares a nested 'is_transparent' type.
+    //*************************************************************************
+    template <typename T>
+    struct is_transparent
+    {
+    private:
+
+      typedef char yes;
+      struct no { char dummy[2]; };
+
+      template <typename U> static yes test(typename U::is_transparent*);
+      template <typename U> static no  test(...);
+
+    public:
+
+      static const bool value = (sizeof(test<T>(0)) == sizeof(yes));
+    };
+
+    //*************************************************************************
+    /// Enables a heterogeneous lookup of key type TKey when both THash and
+    /// TKeyEqual are transparent. TKey keeps the condition dependent so that
+    /// it may be used to SFINAE member function templates.
+    //*************************************************************************
+    template <typename THash, typename TKeyEqual, typename TKey, typename TReturn>
+    struct transparent_lookup
+      : public etl::enable_if<is_transparent<THash>::value && is_transparent<TKeyEqual>::value, TReturn>
+    {
+    };
   }
 
   //***************************************************************************
@@ -36,6 +36,7 @@ SOFTWARE.
 #include "algorithm.h"
 #include "vector.h"
 #include "nullptr.h"
+#include "binary.h"
 #include "error_handler.h"
 #include "exception.h"
 #include "message_types.h"
@@ -105,6 +106,7 @@ namespace etl
           if (router.is_bus())
           {
             // Message busses get added to the end.
+            index_insert(router_list.size(), router);
             router_list.push_back(&router);
           }
           else
@@ -115,6 +117,7 @@ namespace etl
                                                                router.get_message_router_id(),
                                                                compare_router_id());
 
+            index_insert(std::distance(router_list.begin(), irouter), router);
             router_list.insert(irouter, &router);
           }
         }
@@ -139,6 +142,14 @@ namespace etl
                                                                                              id,
                                                                                              compare_router_id());
 
+        const size_t first = std::distance(router_list.begin(), range.first);
+        size_t       last  = std::distance(router_list.begin(), range.second);
+
+        while (last != first)
+        {
+          index_erase(--last);
+        }
+
         router_list.erase(range.first, range.second);
       }
     }
@@ -152,6 +163,7 @@ namespace etl
 
       if (irouter != router_list.end())
       {
+        index_erase(std::distance(router_list.begin(), irouter));
         router_list.erase(irouter);
       }
     }
@@ -196,6 +208,35 @@ namespace etl
         // Broadcast to all routers.
         case etl::imessage_router::ALL_MESSAGE_ROUTERS:
         {
+          if (is_indexed(message.message_id))
+          {
+            // Only visit the routers that accept the message.
+            const uint32_t* p_row = p_index + (size_t(message.message_id) * index_words);
+
+            for (size_t word = 0; word < index_words; ++word)
+            {
+              uint32_t bits = p_row[word];
+
+              while (bits != 0)
+              {
+                etl::imessage_router& router = *router_list[(word * 32U) + etl::count_trailing_zeros(bits)];
+                bits &= bits - 1U;
+
+                if (router.is_bus())
+                {
+                  // The router is actually a bus, so pass it on.
+                  static_cast<etl::imessage_bus&>(router).receive(source, destination_router_id, message);
+                }
+                else
+                {
+                  router.receive(source, message);
+                }
+              }
+            }
+
+            break;
+          }
+
           router_list_t::iterator irouter = router_list.begin();
 
           // Broadcast to everyone.
@@ -237,7 +278,7 @@ namespace etl
           // Call all of them.
           while (range.first != range.second)
           {
-            if ((*(range.first))->accepts(message.message_id))
+            if (router_accepts(std::distance(router_list.begin(), range.first), message.message_id))
             {
               (*(range.first))->receive(source, message);
             }
@@ -288,7 +329,12 @@ namespace etl
     //*******************************************
     void clear()
     {
-      return router_list.clear();
+      router_list.clear();
+
+      if (p_index != nullptr)
+      {
+        std::fill_n(p_index, index_ids * index_words, 0U);
+      }
     }
 
   protected:
@@ -298,10 +344,29 @@ namespace etl
     //*******************************************
     imessage_bus(router_list_t& list)
       : imessage_router(etl::imessage_router::MESSAGE_BUS),
-        router_list(list)
+        router_list(list),
+        p_index(nullptr),
+        index_words(0U),
+        index_ids(0U)
     {
     }
 
+    //*******************************************
+    /// Constructor, with a subscription index.
+    /// The index has a row of 'index_words_' words for each of the
+    /// message ids from 0 to 'index_ids_' - 1.
+    /// Bit n of a row is set if router_list[n] accepts the id.
+    //*******************************************
+    imessage_bus(router_list_t& list, uint32_t* p_index_, size_t index_words_, size_t index_ids_)
+      : imessage_router(etl::imessage_router::MESSAGE_BUS),
+        router_list(list),
+        p_index(p_index_),
+        index_words(index_words_),
+        index_ids(index_ids_)
+    {
+      std::fill_n(p_index, index_ids * index_words, 0U);
+    }
+
   private:
 
     //*******************************************
@@ -320,7 +385,97 @@ namespace etl
       }
     };
 
+    //*******************************************
+    /// Is the message id covered by the index?
+    //*******************************************
+    bool is_indexed(etl::message_id_t id) const
+    {
+      return (p_index != nullptr) && (size_t(id) < index_ids);
+    }
+
+    //*******************************************
+    /// Does the router at the position accept the message id?
+    //*******************************************
+    bool router_accepts(size_t position, etl::message_id_t id) const
+    {
+      if (is_indexed(id))
+      {
+        return (p_index[(size_t(id) * index_words) + (position / 32U)] & (uint32_t(1U) << (position % 32U))) != 0U;
+      }
+      else
+      {
+        return router_list[position]->accepts(id);
+      }
+    }
+
+    //*******************************************
+    /// Opens a column in the index for a router inserted at the position.
+    /// The accepted ids are sampled now.
+    //*******************************************
+    void index_insert(size_t position, const etl::imessage_router& router)
+    {
+      if (p_index == nullptr)
+      {
+        return;
+      }
+
+      const size_t   word     = position / 32U;
+      const uint32_t bit      = uint32_t(1U) << (position % 32U);
+      const uint32_t low_mask = bit - 1U;
+
+      for (size_t id = 0U; id < index_ids; ++id)
+      {
+        uint32_t* p_row = p_index + (id * index_words);
+
+        // Shift the bits at and above the position up by one.
+        for (size_t i = index_words - 1U; i > word; --i)
+        {
+          p_row[i] = (p_row[i] << 1U) | (p_row[i - 1U] >> 31U);
+        }
+
+        p_row[word] = (p_row[word] & low_mask) | ((p_row[word] & ~low_mask) << 1U);
+
+        if (router.accepts(etl::message_id_t(id)))
+        {
+          p_row[word] |= bit;
+        }
+      }
+    }
+
+    //*******************************************
+    /// Closes the column in the index for a router erased at the position.
+    //*******************************************
+    void index_erase(size_t position)
+    {
+      if (p_index == nullptr)
+      {
+        return;
+      }
+
+      const size_t   word      = position / 32U;
+      const uint32_t bit       = uint32_t(1U) << (position % 32U);
+      const uint32_t low_mask  = bit - 1U;
+      const uint32_t high_mask = ~(low_mask | bit);
+
+      for (size_t id = 0U; id < index_ids; ++id)
+      {
+        uint32_t* p_row = p_index + (id * index_words);
+
+        // Shift the bits above the position down by one.
+        p_row[word] = (p_row[word] & low_mask) | ((p_row[word] & high_mask) >> 1U);
+
+        for (size_t i = word + 1U; i < index_words; ++i)
+        {
+          p_row[i - 1U] |= p_row[i] << 31U;
+          p_row[i] >>= 1U;
+        }
+      }
+    }
+
     router_list_t& router_list;
+    uint32_t*      p_index;     ///< The subscription index, or nullptr.
+    size_t         index_words; ///< The number of words in each row of the index.
+    size_t         index_ids;   ///< The number of message ids in the index.
   };
 
   //***************************************************************************
@@ -344,6 +499,34 @@ namespace etl
     etl::vector<etl::imessage_router*, MAX_ROUTERS_> router_list;
   };
 
+  //***************************************************************************
+  /// A message bus that keeps an index of the routers that accept each
+  /// message id, so that a broadcast visits only those routers.
+  /// The ids that a router accepts are sampled when it subscribes.
+  /// Ids above MAX_MESSAGE_ID_ are not indexed and ask each router.
+  /// The index uses (MAX_MESSAGE_ID_ + 1) * ((MAX_ROUTERS_ + 31) / 32) words.
+  //***************************************************************************
+  template <uint_least8_t MAX_ROUTERS_, size_t MAX_MESSAGE_ID_ = 255U>
+  class indexed_message_bus : public etl::imessage_bus
+  {
+  public:
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    indexed_message_bus()
+      : imessage_bus(router_list, index, INDEX_WORDS, MAX_MESSAGE_ID_ + 1U)
+    {
+    }
+
+  private:
+
+    static const size_t INDEX_WORDS = (MAX_ROUTERS_ + 31U) / 32U;
+
+    etl::vector<etl::imessage_router*, MAX_ROUTERS_> router_list;
+    uint32_t index[(MAX_MESSAGE_ID_ + 1U) * INDEX_WORDS];
+  };
+
   //***************************************************************************
   /// Send a message to a bus.
   //***************************************************************************
@@ -62,6 +62,7 @@ SOFTWARE.
 #include "exception.h"
 #include "largest.h"
 #include "nullptr.h"
+#include "private/message_dispatch.h"
 
 #undef ETL_FILE
 #define ETL_FILE "35"
@@ -104,6 +105,18 @@ namespace etl
     virtual void receive(imessage_router& source, const etl::imessage& message) = 0;
     virtual bool accepts(etl::message_id_t id) const = 0;
 
+    //********************************************
+    /// Receives a batch of messages with one call.
+    /// The default passes each message to receive(source, message).
+    //********************************************
+    virtual void receive(imessage_router& source, const etl::imessage* const* messages, size_t n)
+    {
+      for (size_t i = 0; i < n; ++i)
+      {
+        receive(source, *messages[i]);
+      }
+    }
+
     //********************************************
     bool accepts(const etl::imessage& msg) const
     {
@@ -203,6 +216,11 @@ namespace etl
     {
     }
 
+    //********************************************
+    void receive(etl::imessage_router&, const etl::imessage* const*, size_t)
+    {
+    }
+
     //********************************************
     bool accepts(etl::message_id_t) const
     {
@@ -237,6 +255,393 @@ namespace etl
     destination.receive(source, message);
   }
 
+  //***************************************************************************
+  /// Send a batch of messages to a router.
+  //***************************************************************************
+  inline static void send_messages(etl::imessage_router&       source,
+                                   etl::imessage_router&       destination,
+                                   const etl::imessage* const* messages,
+                                   size_t                      n)
+  {
+    destination.receive(source, messages, n);
+  }
+
+  //***************************************************************************
+  /// A run of messages of the same type within a batch.
+  /// Passed to message_router::on_receive_batch.
+  //***************************************************************************
+  template <typename TMessage>
+  class message_batch
+  {
+  public:
+
+    //********************************************
+    message_batch(const etl::imessage* const* p_messages_, size_t n_)
+      : p_messages(p_messages_),
+        n(n_)
+    {
+    }
+
+    //********************************************
+    const TMessage& operator [](size_t i) const
+    {
+      return static_cast<const TMessage&>(*p_messages[i]);
+    }
+
+    //********************************************
+    size_t size() const
+    {
+      return n;
+    }
+
+    //********************************************
+    const etl::imessage* const* data() const
+    {
+      return p_messages;
+    }
+
+  private:
+
+    const etl::imessage* const* p_messages;
+    size_t                      n;
+  };
+
+  namespace private_message_router
+  {
+    //*************************************************************************
+    /// Returns the end of the run of messages with the same id as messages[first].
+    //*************************************************************************
+    inline size_t end_of_run(const etl::imessage* const* messages, size_t first, size_t n)
+    {
+      const etl::message_id_t id = messages[first]->message_id;
+
+      size_t last = first + 1;
+
+      while ((last != n) && (messages[last]->message_id == id))
+      {
+        ++last;
+      }
+
+      return last;
+    }
+  }
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_MESSAGE_ROUTER_FORCE_CPP03)
+  //***************************************************************************
+  /// The definition for any number of message types.
+  /// Messages are dispatched with one lookup in a table indexed by message id.
+  //***************************************************************************
+  template <typename TDerived, typename... TMessageTypes>
+  class message_router : public imessage_router
+  {
+  private:
+
+    typedef etl::private_message_dispatch::dispatcher<TMessageTypes...> dispatcher_t;
+
+  public:
+
+    ETL_STATIC_ASSERT(sizeof...(TMessageTypes) != 0U, "At least one message type is required");
+    ETL_STATIC_ASSERT(!etl::private_message_dispatch::has_duplicate_ids<TMessageTypes...>::value, "Message ids must be unique");
+
+    //**********************************************
+    class message_packet
+    {
+    public:
+
+      //********************************************
+      explicit message_packet(const etl::imessage& msg)
+      {
+        construct(msg);
+      }
+
+      //********************************************
+      template <typename T>
+      explicit message_packet(const T& msg)
+      {
+        ETL_STATIC_ASSERT((etl::private_message_dispatch::is_one_of<T, TMessageTypes...>::value), "Unsupported type for this message packet");
+
+        void* p = data;
+        ::new (p) T(static_cast<const T&>(msg));
+      }
+
+      //********************************************
+      message_packet(const message_packet& other)
+      {
+        construct(other.get());
+      }
+
+      //********************************************
+      message_packet& operator =(const message_packet& other)
+      {
+        if (&other != this)
+        {
+          destroy();
+          construct(other.get());
+        }
+
+        return *this;
+      }
+
+      //********************************************
+      ~message_packet()
+      {
+        destroy();
+      }
+
+      //********************************************
+      etl::imessage& get()
+      {
+        return *static_cast<etl::imessage*>(data);
+      }
+
+      //********************************************
+      const etl::imessage& get() const
+      {
+        return *static_cast<const etl::imessage*>(data);
+      }
+
+      enum
+      {
+        SIZE      = etl::private_message_dispatch::largest<TMessageTypes...>::size,
+        ALIGNMENT = etl::private_message_dispatch::largest<TMessageTypes...>::alignment
+      };
+
+    private:
+
+      //********************************************
+      struct copy_handler
+      {
+        typedef void (*type)(void*, const etl::imessage&);
+
+        template <typename TMessage>
+        static constexpr type get(TMessage*)
+        {
+          return &call<TMessage>;
+        }
+
+        static constexpr type get(void*)
+        {
+          return nullptr;
+        }
+
+        template <typename TMessage>
+        static void call(void* p, const etl::imessage& msg)
+        {
+          ::new (p) TMessage(static_cast<const TMessage&>(msg));
+        }
+      };
+
+      //********************************************
+      struct destroy_handler
+      {
+        typedef void (*type)(etl::imessage*);
+
+        template <typename TMessage>
+        static constexpr type get(TMessage*)
+        {
+          return &call<TMessage>;
+        }
+
+        static constexpr type get(void*)
+        {
+          return nullptr;
+        }
+
+        template <typename TMessage>
+        static void call(etl::imessage* pmsg)
+        {
+          static_cast<TMessage*>(pmsg)->~TMessage();
+        }
+      };
+
+      //********************************************
+      void construct(const etl::imessage& msg)
+      {
+        typename copy_handler::type copy = dispatcher_t::template find<copy_handler>(msg.message_id);
+
+        if (copy != nullptr)
+        {
+          copy(data, msg);
+        }
+        else
+        {
+          ETL_ASSERT(false, ETL_ERROR(unhandled_message_exception));
+        }
+      }
+
+      //********************************************
+      void destroy()
+      {
+        etl::imessage* pmsg = static_cast<etl::imessage*>(data);
+
+  #if defined(ETL_MESSAGES_ARE_VIRTUAL) || defined(ETL_POLYMORPHIC_MESSAGES)
+        pmsg->~imessage();
+  #else
+        typename destroy_handler::type destroy_message = dispatcher_t::template find<destroy_handler>(pmsg->message_id);
+
+        assert(destroy_message != nullptr);
+        destroy_message(pmsg);
+  #endif
+      }
+
+      typename etl::aligned_storage<SIZE, ALIGNMENT>::type data;
+    };
+
+    //**********************************************
+    message_router(etl::message_router_id_t id_)
+      : imessage_router(id_)
+    {
+      ETL_ASSERT(id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER, ETL_ERROR(etl::message_router_illegal_id));
+    }
+
+    //**********************************************
+    message_router(etl::message_router_id_t id_, etl::imessage_router& successor_)
+      : imessage_router(id_, successor_)
+    {
+      ETL_ASSERT(id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER, ETL_ERROR(etl::message_router_illegal_id));
+    }
+
+    //**********************************************
+    void receive(const etl::imessage& msg)
+    {
+      receive(etl::null_message_router::instance(), msg);
+    }
+
+    //**********************************************
+    void receive(etl::imessage_router& source, const etl::imessage& msg)
+    {
+      typename receive_handler::type handler = dispatcher_t::template find<receive_handler>(msg.message_id);
+
+      if (handler != nullptr)
+      {
+        handler(*this, source, msg);
+      }
+      else if (has_successor())
+      {
+        get_successor().receive(source, msg);
+      }
+      else
+      {
+        static_cast<TDerived*>(this)->on_receive_unknown(source, msg);
+      }
+    }
+
+    //**********************************************
+    /// Receives a batch of messages.
+    /// Each run of messages with the same id is passed to on_receive_batch
+    /// with one dispatch.
+    //**********************************************
+    void receive(etl::imessage_router& source, const etl::imessage* const* msgs, size_t n)
+    {
+      size_t first = 0;
+
+      while (first != n)
+      {
+        const size_t last = etl::private_message_router::end_of_run(msgs, first, n);
+
+        typename batch_handler::type handler = dispatcher_t::template find<batch_handler>(msgs[first]->message_id);
+
+        if (handler != nullptr)
+        {
+          handler(*this, source, msgs + first, last - first);
+        }
+        else if (has_successor())
+        {
+          get_successor().receive(source, msgs + first, last - first);
+        }
+        else
+        {
+          for (size_t i = first; i != last; ++i)
+          {
+            static_cast<TDerived*>(this)->on_receive_unknown(source, *msgs[i]);
+          }
+        }
+
+        first = last;
+      }
+    }
+
+    //**********************************************
+    /// Handles a run of messages of the same type.
+    /// Passes each one to on_receive. A derived router may overload this
+    /// for a message type to handle the run at once, and should add
+    /// 'using message_router::on_receive_batch;' for the other types.
+    //**********************************************
+    template <typename TMessage>
+    void on_receive_batch(etl::imessage_router& source, const etl::message_batch<TMessage>& batch)
+    {
+      for (size_t i = 0; i < batch.size(); ++i)
+      {
+        static_cast<TDerived*>(this)->on_receive(source, batch[i]);
+      }
+    }
+
+    using imessage_router::accepts;
+
+    //**********************************************
+    bool accepts(etl::message_id_t id) const
+    {
+      return accepts_id(id);
+    }
+
+    //**********************************************
+    /// Is the id one of the message ids?
+    /// A bitset test when the ids are dense.
+    //**********************************************
+    static constexpr bool accepts_id(etl::message_id_t id)
+    {
+      return dispatcher_t::contains(id);
+    }
+
+  private:
+
+    //**********************************************
+    struct receive_handler
+    {
+      typedef void (*type)(message_router&, etl::imessage_router&, const etl::imessage&);
+
+      template <typename TMessage>
+      static constexpr type get(TMessage*)
+      {
+        return &call<TMessage>;
+      }
+
+      static constexpr type get(void*)
+      {
+        return nullptr;
+      }
+
+      template <typename TMessage>
+      static void call(message_router& router, etl::imessage_router& source, const etl::imessage& msg)
+      {
+        static_cast<TDerived&>(router).on_receive(source, static_cast<const TMessage&>(msg));
+      }
+    };
+
+    //**********************************************
+    struct batch_handler
+    {
+      typedef void (*type)(message_router&, etl::imessage_router&, const etl::imessage* const*, size_t);
+
+      template <typename TMessage>
+      static constexpr type get(TMessage*)
+      {
+        return &call<TMessage>;
+      }
+
+      static constexpr type get(void*)
+      {
+        return nullptr;
+      }
+
+      template <typename TMessage>
+      static void call(message_router& router, etl::imessage_router& source, const etl::imessage* const* msgs, size_t n)
+      {
+        static_cast<TDerived&>(router).on_receive_batch(source, etl::message_batch<TMessage>(msgs, n));
+      }
+    };
+  };
+#else
   //***************************************************************************
   // The definition for all 16 message types.
   //***************************************************************************
@@ -407,6 +812,73 @@ namespace etl
       }
     }
 
+    //**********************************************
+    /// Receives a batch of messages.
+    /// Each run of messages with the same id is passed to on_receive_batch
+    /// with one dispatch.
+    //**********************************************
+    void receive(etl::imessage_router& source, const etl::imessage* const* msgs, size_t n)
+    {
+      size_t first = 0;
+
+      while (first != n)
+      {
+        const size_t last = etl::private_message_router::end_of_run(msgs, first, n);
+
+        switch (msgs[first]->message_id)
+        {
+          case T1::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T1>(msgs + first, last - first)); break;
+          case T2::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T2>(msgs + first, last - first)); break;
+          case T3::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T3>(msgs + first, last - first)); break;
+          case T4::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T4>(msgs + first, last - first)); break;
+          case T5::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T5>(msgs + first, last - first)); break;
+          case T6::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T6>(msgs + first, last - first)); break;
+          case T7::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T7>(msgs + first, last - first)); break;
+          case T8::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T8>(msgs + first, last - first)); break;
+          case T9::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T9>(msgs + first, last - first)); break;
+          case T10::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T10>(msgs + first, last - first)); break;
+          case T11::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T11>(msgs + first, last - first)); break;
+          case T12::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T12>(msgs + first, last - first)); break;
+          case T13::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T13>(msgs + first, last - first)); break;
+          case T14::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T14>(msgs + first, last - first)); break;
+          case T15::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T15>(msgs + first, last - first)); break;
+          case T16::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T16>(msgs + first, last - first)); break;
+          default:
+          {
+            if (has_successor())
+            {
+              get_successor().receive(source, msgs + first, last - first);
+            }
+            else
+            {
+              for (size_t i = first; i != last; ++i)
+              {
+                static_cast<TDerived*>(this)->on_receive_unknown(source, *msgs[i]);
+              }
+            }
+            break;
+          }
+        }
+
+        first = last;
+      }
+    }
+
+    //**********************************************
+    /// Handles a run of messages of the same type.
+    /// Passes each one to on_receive. A derived router may overload this
+    /// for a message type to handle the run at once, and should add
+    /// 'using message_router::on_receive_batch;' for the other types.
+    //**********************************************
+    template <typename TMessage>
+    void on_receive_batch(etl::imessage_router& source, const etl::message_batch<TMessage>& batch)
+    {
+      for (size_t i = 0; i < batch.size(); ++i)
+      {
+        static_cast<TDerived*>(this)->on_receive(source, batch[i]);
+      }
+    }
+
     using imessage_router::accepts;
 
     //**********************************************
@@ -591,6 +1063,72 @@ namespace etl
       }
     }
 
+    //**********************************************
+    /// Receives a batch of messages.
+    /// Each run of messages with the same id is passed to on_receive_batch
+    /// with one dispatch.
+    //**********************************************
+    void receive(etl::imessage_router& source, const etl::imessage* const* msgs, size_t n)
+    {
+      size_t first = 0;
+
+      while (first != n)
+      {
+        const size_t last = etl::private_message_router::end_of_run(msgs, first, n);
+
+        switch (msgs[first]->message_id)
+        {
+          case T1::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T1>(msgs + first, last - first)); break;
+          case T2::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T2>(msgs + first, last - first)); break;
+          case T3::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T3>(msgs + first, last - first)); break;
+          case T4::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T4>(msgs + first, last - first)); break;
+          case T5::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T5>(msgs + first, last - first)); break;
+          case T6::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T6>(msgs + first, last - first)); break;
+          case T7::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T7>(msgs + first, last - first)); break;
+          case T8::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T8>(msgs + first, last - first)); break;
+          case T9::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T9>(msgs + first, last - first)); break;
+          case T10::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T10>(msgs + first, last - first)); break;
+          case T11::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T11>(msgs + first, last - first)); break;
+          case T12::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T12>(msgs + first, last - first)); break;
+          case T13::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T13>(msgs + first, last - first)); break;
+          case T14::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T14>(msgs + first, last - first)); break;
+          case T15::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T15>(msgs + first, last - first)); break;
+          default:
+          {
+            if (has_successor())
+            {
+              get_successor().receive(source, msgs + first, last - first);
+            }
+            else
+            {
+              for (size_t i = first; i != last; ++i)
+              {
+                static_cast<TDerived*>(this)->on_receive_unknown(source, *msgs[i]);
+              }
+            }
+            break;
+          }
+        }
+
+        first = last;
+      }
+    }
+
+    //**********************************************
+    /// Handles a run of messages of the same type.
+    /// Passes each one to on_receive. A derived router may overload this
+    /// for a message type to handle the run at once, and should add
+    /// 'using message_router::on_receive_batch;' for the other types.
+    //**********************************************
+    template <typename TMessage>
+    void on_receive_batch(etl::imessage_router& source, const etl::message_batch<TMessage>& batch)
+    {
+      for (size_t i = 0; i < batch.size(); ++i)
+      {
+        static_cast<TDerived*>(this)->on_receive(source, batch[i]);
+      }
+    }
+
     using imessage_router::accepts;
 
     //**********************************************
@@ -772,6 +1310,71 @@ namespace etl
       }
     }
 
+    //**********************************************
+    /// Receives a batch of messages.
+    /// Each run of messages with the same id is passed to on_receive_batch
+    /// with one dispatch.
+    //**********************************************
+    void receive(etl::imessage_router& source, const etl::imessage* const* msgs, size_t n)
+    {
+      size_t first = 0;
+
+      while (first != n)
+      {
+        const size_t last = etl::private_message_router::end_of_run(msgs, first, n);
+
+        switch (msgs[first]->message_id)
+        {
+          case T1::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T1>(msgs + first, last - first)); break;
+          case T2::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T2>(msgs + first, last - first)); break;
+          case T3::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T3>(msgs + first, last - first)); break;
+          case T4::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T4>(msgs + first, last - first)); break;
+          case T5::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T5>(msgs + first, last - first)); break;
+          case T6::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T6>(msgs + first, last - first)); break;
+          case T7::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T7>(msgs + first, last - first)); break;
+          case T8::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T8>(msgs + first, last - first)); break;
+          case T9::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T9>(msgs + first, last - first)); break;
+          case T10::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T10>(msgs + first, last - first)); break;
+          case T11::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T11>(msgs + first, last - first)); break;
+          case T12::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T12>(msgs + first, last - first)); break;
+          case T13::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T13>(msgs + first, last - first)); break;
+          case T14::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T14>(msgs + first, last - first)); break;
+          default:
+          {
+            if (has_successor())
+            {
+              get_successor().receive(source, msgs + first, last - first);
+            }
+            else
+            {
+              for (size_t i = first; i != last; ++i)
+              {
+                static_cast<TDerived*>(this)->on_receive_unknown(source, *msgs[i]);
+              }
+            }
+            break;
+          }
+        }
+
+        first = last;
+      }
+    }
+
+    //**********************************************
+    /// Handles a run of messages of the same type.
+    /// Passes each one to on_receive. A derived router may overload this
+    /// for a message type to handle the run at once, and should add
+    /// 'using message_router::on_receive_batch;' for the other types.
+    //**********************************************
+    template <typename TMessage>
+    void on_receive_batch(etl::imessage_router& source, const etl::message_batch<TMessage>& batch)
+    {
+      for (size_t i = 0; i < batch.size(); ++i)
+      {
+        static_cast<TDerived*>(this)->on_receive(source, batch[i]);
+      }
+    }
+
     using imessage_router::accepts;
 
     //**********************************************
@@ -950,6 +1553,70 @@ namespace etl
       }
     }
 
+    //**********************************************
+    /// Receives a batch of messages.
+    /// Each run of messages with the same id is passed to on_receive_batch
+    /// with one dispatch.
+    //**********************************************
+    void receive(etl::imessage_router& source, const etl::imessage* const* msgs, size_t n)
+    {
+      size_t first = 0;
+
+      while (first != n)
+      {
+        const size_t last = etl::private_message_router::end_of_run(msgs, first, n);
+
+        switch (msgs[first]->message_id)
+        {
+          case T1::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T1>(msgs + first, last - first)); break;
+          case T2::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T2>(msgs + first, last - first)); break;
+          case T3::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T3>(msgs + first, last - first)); break;
+          case T4::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T4>(msgs + first, last - first)); break;
+          case T5::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T5>(msgs + first, last - first)); break;
+          case T6::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T6>(msgs + first, last - first)); break;
+          case T7::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T7>(msgs + first, last - first)); break;
+          case T8::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T8>(msgs + first, last - first)); break;
+          case T9::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T9>(msgs + first, last - first)); break;
+          case T10::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T10>(msgs + first, last - first)); break;
+          case T11::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T11>(msgs + first, last - first)); break;
+          case T12::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T12>(msgs + first, last - first)); break;
+          case T13::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T13>(msgs + first, last - first)); break;
+          default:
+          {
+            if (has_successor())
+            {
+              get_successor().receive(source, msgs + first, last - first);
+            }
+            else
+            {
+              for (size_t i = first; i != last; ++i)
+              {
+                static_cast<TDerived*>(this)->on_receive_unknown(source, *msgs[i]);
+              }
+            }
+            break;
+          }
+        }
+
+        first = last;
+      }
+    }
+
+    //**********************************************
+    /// Handles a run of messages of the same type.
+    /// Passes each one to on_receive. A derived router may overload this
+    /// for a message type to handle the run at once, and should add
+    /// 'using message_router::on_receive_batch;' for the other types.
+    //**********************************************
+    template <typename TMessage>
+    void on_receive_batch(etl::imessage_router& source, const etl::message_batch<TMessage>& batch)
+    {
+      for (size_t i = 0; i < batch.size(); ++i)
+      {
+        static_cast<TDerived*>(this)->on_receive(source, batch[i]);
+      }
+    }
+
     using imessage_router::accepts;
 
     //**********************************************
@@ -1124,6 +1791,69 @@ namespace etl
       }
     }
 
+    //**********************************************
+    /// Receives a batch of messages.
+    /// Each run of messages with the same id is passed to on_receive_batch
+    /// with one dispatch.
+    //**********************************************
+    void receive(etl::imessage_router& source, const etl::imessage* const* msgs, size_t n)
+    {
+      size_t first = 0;
+
+      while (first != n)
+      {
+        const size_t last = etl::private_message_router::end_of_run(msgs, first, n);
+
+        switch (msgs[first]->message_id)
+        {
+          case T1::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T1>(msgs + first, last - first)); break;
+          case T2::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T2>(msgs + first, last - first)); break;
+          case T3::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T3>(msgs + first, last - first)); break;
+          case T4::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T4>(msgs + first, last - first)); break;
+          case T5::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T5>(msgs + first, last - first)); break;
+          case T6::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T6>(msgs + first, last - first)); break;
+          case T7::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T7>(msgs + first, last - first)); break;
+          case T8::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T8>(msgs + first, last - first)); break;
+          case T9::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T9>(msgs + first, last - first)); break;
+          case T10::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T10>(msgs + first, last - first)); break;
+          case T11::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T11>(msgs + first, last - first)); break;
+          case T12::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T12>(msgs + first, last - first)); break;
+          default:
+          {
+            if (has_successor())
+            {
+              get_successor().receive(source, msgs + first, last - first);
+            }
+            else
+            {
+              for (size_t i = first; i != last; ++i)
+              {
+                static_cast<TDerived*>(this)->on_receive_unknown(source, *msgs[i]);
+              }
+            }
+            break;
+          }
+        }
+
+        first = last;
+      }
+    }
+
+    //**********************************************
+    /// Handles a run of messages of the same type.
+    /// Passes each one to on_receive. A derived router may overload this
+    /// for a message type to handle the run at once, and should add
+    /// 'using message_router::on_receive_batch;' for the other types.
+    //**********************************************
+    template <typename TMessage>
+    void on_receive_batch(etl::imessage_router& source, const etl::message_batch<TMessage>& batch)
+    {
+      for (size_t i = 0; i < batch.size(); ++i)
+      {
+        static_cast<TDerived*>(this)->on_receive(source, batch[i]);
+      }
+    }
+
     using imessage_router::accepts;
 
     //**********************************************
@@ -1295,6 +2025,68 @@ namespace etl
       }
     }
 
+    //**********************************************
+    /// Receives a batch of messages.
+    /// Each run of messages with the same id is passed to on_receive_batch
+    /// with one dispatch.
+    //**********************************************
+    void receive(etl::imessage_router& source, const etl::imessage* const* msgs, size_t n)
+    {
+      size_t first = 0;
+
+      while (first != n)
+      {
+        const size_t last = etl::private_message_router::end_of_run(msgs, first, n);
+
+        switch (msgs[first]->message_id)
+        {
+          case T1::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T1>(msgs + first, last - first)); break;
+          case T2::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T2>(msgs + first, last - first)); break;
+          case T3::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T3>(msgs + first, last - first)); break;
+          case T4::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T4>(msgs + first, last - first)); break;
+          case T5::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T5>(msgs + first, last - first)); break;
+          case T6::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T6>(msgs + first, last - first)); break;
+          case T7::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T7>(msgs + first, last - first)); break;
+          case T8::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T8>(msgs + first, last - first)); break;
+          case T9::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T9>(msgs + first, last - first)); break;
+          case T10::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T10>(msgs + first, last - first)); break;
+          case T11::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T11>(msgs + first, last - first)); break;
+          default:
+          {
+            if (has_successor())
+            {
+              get_successor().receive(source, msgs + first, last - first);
+            }
+            else
+            {
+              for (size_t i = first; i != last; ++i)
+              {
+                static_cast<TDerived*>(this)->on_receive_unknown(source, *msgs[i]);
+              }
+            }
+            break;
+          }
+        }
+
+        first = last;
+      }
+    }
+
+    //**********************************************
+    /// Handles a run of messages of the same type.
+    /// Passes each one to on_receive. A derived router may overload this
+    /// for a message type to handle the run at once, and should add
+    /// 'using message_router::on_receive_batch;' for the other types.
+    //**********************************************
+    template <typename TMessage>
+    void on_receive_batch(etl::imessage_router& source, const etl::message_batch<TMessage>& batch)
+    {
+      for (size_t i = 0; i < batch.size(); ++i)
+      {
+        static_cast<TDerived*>(this)->on_receive(source, batch[i]);
+      }
+    }
+
     using imessage_router::accepts;
 
     //**********************************************
@@ -1463,6 +2255,67 @@ namespace etl
       }
     }
 
+    //**********************************************
+    /// Receives a batch of messages.
+    /// Each run of messages with the same id is passed to on_receive_batch
+    /// with one dispatch.
+    //**********************************************
+    void receive(etl::imessage_router& source, const etl::imessage* const* msgs, size_t n)
+    {
+      size_t first = 0;
+
+      while (first != n)
+      {
+        const size_t last = etl::private_message_router::end_of_run(msgs, first, n);
+
+        switch (msgs[first]->message_id)
+        {
+          case T1::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T1>(msgs + first, last - first)); break;
+          case T2::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T2>(msgs + first, last - first)); break;
+          case T3::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T3>(msgs + first, last - first)); break;
+          case T4::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T4>(msgs + first, last - first)); break;
+          case T5::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T5>(msgs + first, last - first)); break;
+          case T6::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T6>(msgs + first, last - first)); break;
+          case T7::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T7>(msgs + first, last - first)); break;
+          case T8::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T8>(msgs + first, last - first)); break;
+          case T9::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T9>(msgs + first, last - first)); break;
+          case T10::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T10>(msgs + first, last - first)); break;
+          default:
+          {
+            if (has_successor())
+            {
+              get_successor().receive(source, msgs + first, last - first);
+            }
+            else
+            {
+              for (size_t i = first; i != last; ++i)
+              {
+                static_cast<TDerived*>(this)->on_receive_unknown(source, *msgs[i]);
+              }
+            }
+            break;
+          }
+        }
+
+        first = last;
+      }
+    }
+
+    //**********************************************
+    /// Handles a run of messages of the same type.
+    /// Passes each one to on_receive. A derived router may overload this
+    /// for a message type to handle the run at once, and should add
+    /// 'using message_router::on_receive_batch;' for the other types.
+    //**********************************************
+    template <typename TMessage>
+    void on_receive_batch(etl::imessage_router& source, const etl::message_batch<TMessage>& batch)
+    {
+      for (size_t i = 0; i < batch.size(); ++i)
+      {
+        static_cast<TDerived*>(this)->on_receive(source, batch[i]);
+      }
+    }
+
     using imessage_router::accepts;
 
     //**********************************************
@@ -1628,6 +2481,66 @@ namespace etl
       }
     }
 
+    //**********************************************
+    /// Receives a batch of messages.
+    /// Each run of messages with the same id is passed to on_receive_batch
+    /// with one dispatch.
+    //**********************************************
+    void receive(etl::imessage_router& source, const etl::imessage* const* msgs, size_t n)
+    {
+      size_t first = 0;
+
+      while (first != n)
+      {
+        const size_t last = etl::private_message_router::end_of_run(msgs, first, n);
+
+        switch (msgs[first]->message_id)
+        {
+          case T1::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T1>(msgs + first, last - first)); break;
+          case T2::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T2>(msgs + first, last - first)); break;
+          case T3::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T3>(msgs + first, last - first)); break;
+          case T4::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T4>(msgs + first, last - first)); break;
+          case T5::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T5>(msgs + first, last - first)); break;
+          case T6::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T6>(msgs + first, last - first)); break;
+          case T7::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T7>(msgs + first, last - first)); break;
+          case T8::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T8>(msgs + first, last - first)); break;
+          case T9::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T9>(msgs + first, last - first)); break;
+          default:
+          {
+            if (has_successor())
+            {
+              get_successor().receive(source, msgs + first, last - first);
+            }
+            else
+            {
+              for (size_t i = first; i != last; ++i)
+              {
+                static_cast<TDerived*>(this)->on_receive_unknown(source, *msgs[i]);
+              }
+            }
+            break;
+          }
+        }
+
+        first = last;
+      }
+    }
+
+    //**********************************************
+    /// Handles a run of messages of the same type.
+    /// Passes each one to on_receive. A derived router may overload this
+    /// for a message type to handle the run at once, and should add
+    /// 'using message_router::on_receive_batch;' for the other types.
+    //**********************************************
+    template <typename TMessage>
+    void on_receive_batch(etl::imessage_router& source, const etl::message_batch<TMessage>& batch)
+    {
+      for (size_t i = 0; i < batch.size(); ++i)
+      {
+        static_cast<TDerived*>(this)->on_receive(source, batch[i]);
+      }
+    }
+
     using imessage_router::accepts;
 
     //**********************************************
@@ -1789,6 +2702,65 @@ namespace etl
       }
     }
 
+    //**********************************************
+    /// Receives a batch of messages.
+    /// Each run of messages with the same id is passed to on_receive_batch
+    /// with one dispatch.
+    //**********************************************
+    void receive(etl::imessage_router& source, const etl::imessage* const* msgs, size_t n)
+    {
+      size_t first = 0;
+
+      while (first != n)
+      {
+        const size_t last = etl::private_message_router::end_of_run(msgs, first, n);
+
+        switch (msgs[first]->message_id)
+        {
+          case T1::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T1>(msgs + first, last - first)); break;
+          case T2::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T2>(msgs + first, last - first)); break;
+          case T3::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T3>(msgs + first, last - first)); break;
+          case T4::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T4>(msgs + first, last - first)); break;
+          case T5::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T5>(msgs + first, last - first)); break;
+          case T6::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T6>(msgs + first, last - first)); break;
+          case T7::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T7>(msgs + first, last - first)); break;
+          case T8::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T8>(msgs + first, last - first)); break;
+          default:
+          {
+            if (has_successor())
+            {
+              get_successor().receive(source, msgs + first, last - first);
+            }
+            else
+            {
+              for (size_t i = first; i != last; ++i)
+              {
+                static_cast<TDerived*>(this)->on_receive_unknown(source, *msgs[i]);
+              }
+            }
+            break;
+          }
+        }
+
+        first = last;
+      }
+    }
+
+    //**********************************************
+    /// Handles a run of messages of the same type.
+    /// Passes each one to on_receive. A derived router may overload this
+    /// for a message type to handle the run at once, and should add
+    /// 'using message_router::on_receive_batch;' for the other types.
+    //**********************************************
+    template <typename TMessage>
+    void on_receive_batch(etl::imessage_router& source, const etl::message_batch<TMessage>& batch)
+    {
+      for (size_t i = 0; i < batch.size(); ++i)
+      {
+        static_cast<TDerived*>(this)->on_receive(source, batch[i]);
+      }
+    }
+
     using imessage_router::accepts;
 
     //**********************************************
@@ -1947,6 +2919,64 @@ namespace etl
       }
     }
 
+    //**********************************************
+    /// Receives a batch of messages.
+    /// Each run of messages with the same id is passed to on_receive_batch
+    /// with one dispatch.
+    //**********************************************
+    void receive(etl::imessage_router& source, const etl::imessage* const* msgs, size_t n)
+    {
+      size_t first = 0;
+
+      while (first != n)
+      {
+        const size_t last = etl::private_message_router::end_of_run(msgs, first, n);
+
+        switch (msgs[first]->message_id)
+        {
+          case T1::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T1>(msgs + first, last - first)); break;
+          case T2::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T2>(msgs + first, last - first)); break;
+          case T3::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T3>(msgs + first, last - first)); break;
+          case T4::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T4>(msgs + first, last - first)); break;
+          case T5::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T5>(msgs + first, last - first)); break;
+          case T6::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T6>(msgs + first, last - first)); break;
+          case T7::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T7>(msgs + first, last - first)); break;
+          default:
+          {
+            if (has_successor())
+            {
+              get_successor().receive(source, msgs + first, last - first);
+            }
+            else
+            {
+              for (size_t i = first; i != last; ++i)
+              {
+                static_cast<TDerived*>(this)->on_receive_unknown(source, *msgs[i]);
+              }
+            }
+            break;
+          }
+        }
+
+        first = last;
+      }
+    }
+
+    //**********************************************
+    /// Handles a run of messages of the same type.
+    /// Passes each one to on_receive. A derived router may overload this
+    /// for a message type to handle the run at once, and should add
+    /// 'using message_router::on_receive_batch;' for the other types.
+    //**********************************************
+    template <typename TMessage>
+    void on_receive_batch(etl::imessage_router& source, const etl::message_batch<TMessage>& batch)
+    {
+      for (size_t i = 0; i < batch.size(); ++i)
+      {
+        static_cast<TDerived*>(this)->on_receive(source, batch[i]);
+      }
+    }
+
     using imessage_router::accepts;
 
     //**********************************************
@@ -2101,6 +3131,63 @@ namespace etl
       }
     }
 
+    //**********************************************
+    /// Receives a batch of messages.
+    /// Each run of messages with the same id is passed to on_receive_batch
+    /// with one dispatch.
+    //**********************************************
+    void receive(etl::imessage_router& source, const etl::imessage* const* msgs, size_t n)
+    {
+      size_t first = 0;
+
+      while (first != n)
+      {
+        const size_t last = etl::private_message_router::end_of_run(msgs, first, n);
+
+        switch (msgs[first]->message_id)
+        {
+          case T1::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T1>(msgs + first, last - first)); break;
+          case T2::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T2>(msgs + first, last - first)); break;
+          case T3::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T3>(msgs + first, last - first)); break;
+          case T4::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T4>(msgs + first, last - first)); break;
+          case T5::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T5>(msgs + first, last - first)); break;
+          case T6::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T6>(msgs + first, last - first)); break;
+          default:
+          {
+            if (has_successor())
+            {
+              get_successor().receive(source, msgs + first, last - first);
+            }
+            else
+            {
+              for (size_t i = first; i != last; ++i)
+              {
+                static_cast<TDerived*>(this)->on_receive_unknown(source, *msgs[i]);
+              }
+            }
+            break;
+          }
+        }
+
+        first = last;
+      }
+    }
+
+    //**********************************************
+    /// Handles a run of messages of the same type.
+    /// Passes each one to on_receive. A derived router may overload this
+    /// for a message type to handle the run at once, and should add
+    /// 'using message_router::on_receive_batch;' for the other types.
+    //**********************************************
+    template <typename TMessage>
+    void on_receive_batch(etl::imessage_router& source, const etl::message_batch<TMessage>& batch)
+    {
+      for (size_t i = 0; i < batch.size(); ++i)
+      {
+        static_cast<TDerived*>(this)->on_receive(source, batch[i]);
+      }
+    }
+
     using imessage_router::accepts;
 
     //**********************************************
@@ -2252,6 +3339,62 @@ namespace etl
       }
     }
 
+    //**********************************************
+    /// Receives a batch of messages.
+    /// Each run of messages with the same id is passed to on_receive_batch
+    /// with one dispatch.
+    //**********************************************
+    void receive(etl::imessage_router& source, const etl::imessage* const* msgs, size_t n)
+    {
+      size_t first = 0;
+
+      while (first != n)
+      {
+        const size_t last = etl::private_message_router::end_of_run(msgs, first, n);
+
+        switch (msgs[first]->message_id)
+        {
+          case T1::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T1>(msgs + first, last - first)); break;
+          case T2::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T2>(msgs + first, last - first)); break;
+          case T3::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T3>(msgs + first, last - first)); break;
+          case T4::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T4>(msgs + first, last - first)); break;
+          case T5::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T5>(msgs + first, last - first)); break;
+          default:
+          {
+            if (has_successor())
+            {
+              get_successor().receive(source, msgs + first, last - first);
+            }
+            else
+            {
+              for (size_t i = first; i != last; ++i)
+              {
+                static_cast<TDerived*>(this)->on_receive_unknown(source, *msgs[i]);
+              }
+            }
+            break;
+          }
+        }
+
+        first = last;
+      }
+    }
+
+    //**********************************************
+    /// Handles a run of messages of the same type.
+    /// Passes each one to on_receive. A derived router may overload this
+    /// for a message type to handle the run at once, and should add
+    /// 'using message_router::on_receive_batch;' for the other types.
+    //**********************************************
+    template <typename TMessage>
+    void on_receive_batch(etl::imessage_router& source, const etl::message_batch<TMessage>& batch)
+    {
+      for (size_t i = 0; i < batch.size(); ++i)
+      {
+        static_cast<TDerived*>(this)->on_receive(source, batch[i]);
+      }
+    }
+
     using imessage_router::accepts;
 
     //**********************************************
@@ -2399,6 +3542,61 @@ namespace etl
       }
     }
 
+    //**********************************************
+    /// Receives a batch of messages.
+    /// Each run of messages with the same id is passed to on_receive_batch
+    /// with one dispatch.
+    //**********************************************
+    void receive(etl::imessage_router& source, const etl::imessage* const* msgs, size_t n)
+    {
+      size_t first = 0;
+
+      while (first != n)
+      {
+        const size_t last = etl::private_message_router::end_of_run(msgs, first, n);
+
+        switch (msgs[first]->message_id)
+        {
+          case T1::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T1>(msgs + first, last - first)); break;
+          case T2::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T2>(msgs + first, last - first)); break;
+          case T3::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T3>(msgs + first, last - first)); break;
+          case T4::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T4>(msgs + first, last - first)); break;
+          default:
+          {
+            if (has_successor())
+            {
+              get_successor().receive(source, msgs + first, last - first);
+            }
+            else
+            {
+              for (size_t i = first; i != last; ++i)
+              {
+                static_cast<TDerived*>(this)->on_receive_unknown(source, *msgs[i]);
+              }
+            }
+            break;
+          }
+        }
+
+        first = last;
+      }
+    }
+
+    //**********************************************
+    /// Handles a run of messages of the same type.
+    /// Passes each one to on_receive. A derived router may overload this
+    /// for a message type to handle the run at once, and should add
+    /// 'using message_router::on_receive_batch;' for the other types.
+    //**********************************************
+    template <typename TMessage>
+    void on_receive_batch(etl::imessage_router& source, const etl::message_batch<TMessage>& batch)
+    {
+      for (size_t i = 0; i < batch.size(); ++i)
+      {
+        static_cast<TDerived*>(this)->on_receive(source, batch[i]);
+      }
+    }
+
     using imessage_router::accepts;
 
     //**********************************************
@@ -2543,6 +3741,60 @@ namespace etl
       }
     }
 
+    //**********************************************
+    /// Receives a batch of messages.
+    /// Each run of messages with the same id is passed to on_receive_batch
+    /// with one dispatch.
+    //**********************************************
+    void receive(etl::imessage_router& source, const etl::imessage* const* msgs, size_t n)
+    {
+      size_t first = 0;
+
+      while (first != n)
+      {
+        const size_t last = etl::private_message_router::end_of_run(msgs, first, n);
+
+        switch (msgs[first]->message_id)
+        {
+          case T1::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T1>(msgs + first, last - first)); break;
+          case T2::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T2>(msgs + first, last - first)); break;
+          case T3::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T3>(msgs + first, last - first)); break;
+          default:
+          {
+            if (has_successor())
+            {
+              get_successor().receive(source, msgs + first, last - first);
+            }
+            else
+            {
+              for (size_t i = first; i != last; ++i)
+              {
+                static_cast<TDerived*>(this)->on_receive_unknown(source, *msgs[i]);
+              }
+            }
+            break;
+          }
+        }
+
+        first = last;
+      }
+    }
+
+    //**********************************************
+    /// Handles a run of messages of the same type.
+    /// Passes each one to on_receive. A derived router may overload this
+    /// for a message type to handle the run at once, and should add
+    /// 'using message_router::on_receive_batch;' for the other types.
+    //**********************************************
+    template <typename TMessage>
+    void on_receive_batch(etl::imessage_router& source, const etl::message_batch<TMessage>& batch)
+    {
+      for (size_t i = 0; i < batch.size(); ++i)
+      {
+        static_cast<TDerived*>(this)->on_receive(source, batch[i]);
+      }
+    }
+
     using imessage_router::accepts;
 
     //**********************************************
@@ -2684,6 +3936,59 @@ namespace etl
       }
     }
 
+    //**********************************************
+    /// Receives a batch of messages.
+    /// Each run of messages with the same id is passed to on_receive_batch
+    /// with one dispatch.
+    //**********************************************
+    void receive(etl::imessage_router& source, const etl::imessage* const* msgs, size_t n)
+    {
+      size_t first = 0;
+
+      while (first != n)
+      {
+        const size_t last = etl::private_message_router::end_of_run(msgs, first, n);
+
+        switch (msgs[first]->message_id)
+        {
+          case T1::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T1>(msgs + first, last - first)); break;
+          case T2::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T2>(msgs + first, last - first)); break;
+          default:
+          {
+            if (has_successor())
+            {
+              get_successor().receive(source, msgs + first, last - first);
+            }
+            else
+            {
+              for (size_t i = first; i != last; ++i)
+              {
+                static_cast<TDerived*>(this)->on_receive_unknown(source, *msgs[i]);
+              }
+            }
+            break;
+          }
+        }
+
+        first = last;
+      }
+    }
+
+    //**********************************************
+    /// Handles a run of messages of the same type.
+    /// Passes each one to on_receive. A derived router may overload this
+    /// for a message type to handle the run at once, and should add
+    /// 'using message_router::on_receive_batch;' for the other types.
+    //**********************************************
+    template <typename TMessage>
+    void on_receive_batch(etl::imessage_router& source, const etl::message_batch<TMessage>& batch)
+    {
+      for (size_t i = 0; i < batch.size(); ++i)
+      {
+        static_cast<TDerived*>(this)->on_receive(source, batch[i]);
+      }
+    }
+
     using imessage_router::accepts;
 
     //**********************************************
@@ -2822,6 +4127,58 @@ namespace etl
       }
     }
 
+    //**********************************************
+    /// Receives a batch of messages.
+    /// Each run of messages with the same id is passed to on_receive_batch
+    /// with one dispatch.
+    //**********************************************
+    void receive(etl::imessage_router& source, const etl::imessage* const* msgs, size_t n)
+    {
+      size_t first = 0;
+
+      while (first != n)
+      {
+        const size_t last = etl::private_message_router::end_of_run(msgs, first, n);
+
+        switch (msgs[first]->message_id)
+        {
+          case T1::ID: static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T1>(msgs + first, last - first)); break;
+          default:
+          {
+            if (has_successor())
+            {
+              get_successor().receive(source, msgs + first, last - first);
+            }
+            else
+            {
+              for (size_t i = first; i != last; ++i)
+              {
+                static_cast<TDerived*>(this)->on_receive_unknown(source, *msgs[i]);
+              }
+            }
+            break;
+          }
+        }
+
+        first = last;
+      }
+    }
+
+    //**********************************************
+    /// Handles a run of messages of the same type.
+    /// Passes each one to on_receive. A derived router may overload this
+    /// for a message type to handle the run at once, and should add
+    /// 'using message_router::on_receive_batch;' for the other types.
+    //**********************************************
+    template <typename TMessage>
+    void on_receive_batch(etl::imessage_router& source, const etl::message_batch<TMessage>& batch)
+    {
+      for (size_t i = 0; i < batch.size(); ++i)
+      {
+        static_cast<TDerived*>(this)->on_receive(source, batch[i]);
+      }
+    }
+
     using imessage_router::accepts;
 
     //**********************************************
@@ -2836,6 +4193,7 @@ namespace etl
       }
     }
   };
+#endif
 }
 
 #undef ETL_FILE
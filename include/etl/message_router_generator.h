@@ -74,6 +74,7 @@ cog.outl("//********************************************************************
 #include "exception.h"
 #include "largest.h"
 #include "nullptr.h"
+#include "private/message_dispatch.h"
 
 #undef ETL_FILE
 #define ETL_FILE "35"
@@ -116,6 +117,18 @@ namespace etl
     virtual void receive(imessage_router& source, const etl::imessage& message) = 0;
     virtual bool accepts(etl::message_id_t id) const = 0;
 
+    //********************************************
+    /// Receives a batch of messages with one call.
+    /// The default passes each message to receive(source, message).
+    //********************************************
+    virtual void receive(imessage_router& source, const etl::imessage* const* messages, size_t n)
+    {
+      for (size_t i = 0; i < n; ++i)
+      {
+        receive(source, *messages[i]);
+      }
+    }
+
     //********************************************
     bool accepts(const etl::imessage& msg) const
     {
@@ -215,6 +228,11 @@ namespace etl
     {
     }
 
+    //********************************************
+    void receive(etl::imessage_router&, const etl::imessage* const*, size_t)
+    {
+    }
+
     //********************************************
     bool accepts(etl::message_id_t) const
     {
@@ -249,6 +267,393 @@ namespace etl
     destination.receive(source, message);
   }
 
+  //***************************************************************************
+  /// Send a batch of messages to a router.
+  //***************************************************************************
+  inline static void send_messages(etl::imessage_router&       source,
+                                   etl::imessage_router&       destination,
+                                   const etl::imessage* const* messages,
+                                   size_t                      n)
+  {
+    destination.receive(source, messages, n);
+  }
+
+  //***************************************************************************
+  /// A run of messages of the same type within a batch.
+  /// Passed to message_router::on_receive_batch.
+  //***************************************************************************
+  template <typename TMessage>
+  class message_batch
+  {
+  public:
+
+    //********************************************
+    message_batch(const etl::imessage* const* p_messages_, size_t n_)
+      : p_messages(p_messages_),
+        n(n_)
+    {
+    }
+
+    //********************************************
+    const TMessage& operator [](size_t i) const
+    {
+      return static_cast<const TMessage&>(*p_messages[i]);
+    }
+
+    //********************************************
+    size_t size() const
+    {
+      return n;
+    }
+
+    //********************************************
+    const etl::imessage* const* data() const
+    {
+      return p_messages;
+    }
+
+  private:
+
+    const etl::imessage* const* p_messages;
+    size_t                      n;
+  };
+
+  namespace private_message_router
+  {
+    //*************************************************************************
+    /// Returns the end of the run of messages with the same id as messages[first].
+    //*************************************************************************
+    inline size_t end_of_run(const etl::imessage* const* messages, size_t first, size_t n)
+    {
+      const etl::message_id_t id = messages[first]->message_id;
+
+      size_t last = first + 1;
+
+      while ((last != n) && (messages[last]->message_id == id))
+      {
+        ++last;
+      }
+
+      return last;
+    }
+  }
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_MESSAGE_ROUTER_FORCE_CPP03)
+  //***************************************************************************
+  /// The definition for any number of message types.
+  /// Messages are dispatched with one lookup in a table indexed by message id.
+  //***************************************************************************
+  template <typename TDerived, typename... TMessageTypes>
+  class message_router : public imessage_router
+  {
+  private:
+
+    typedef etl::private_message_dispatch::dispatcher<TMessageTypes...> dispatcher_t;
+
+  public:
+
+    ETL_STATIC_ASSERT(sizeof...(TMessageTypes) != 0U, "At least one message type is required");
+    ETL_STATIC_ASSERT(!etl::private_message_dispatch::has_duplicate_ids<TMessageTypes...>::value, "Message ids must be unique");
+
+    //**********************************************
+    class message_packet
+    {
+    public:
+
+      //********************************************
+      explicit message_packet(const etl::imessage& msg)
+      {
+        construct(msg);
+      }
+
+      //********************************************
+      template <typename T>
+      explicit message_packet(const T& msg)
+      {
+        ETL_STATIC_ASSERT((etl::private_message_dispatch::is_one_of<T, TMessageTypes...>::value), "Unsupported type for this message packet");
+
+        void* p = data;
+        ::new (p) T(static_cast<const T&>(msg));
+      }
+
+      //********************************************
+      message_packet(const message_packet& other)
+      {
+        construct(other.get());
+      }
+
+      //********************************************
+      message_packet& operator =(const message_packet& other)
+      {
+        if (&other != this)
+        {
+          destroy();
+          construct(other.get());
+        }
+
+        return *this;
+      }
+
+      //********************************************
+      ~message_packet()
+      {
+        destroy();
+      }
+
+      //********************************************
+      etl::imessage& get()
+      {
+        return *static_cast<etl::imessage*>(data);
+      }
+
+      //********************************************
+      const etl::imessage& get() const
+      {
+        return *static_cast<const etl::imessage*>(data);
+      }
+
+      enum
+      {
+        SIZE      = etl::private_message_dispatch::largest<TMessageTypes...>::size,
+        ALIGNMENT = etl::private_message_dispatch::largest<TMessageTypes...>::alignment
+      };
+
+    private:
+
+      //********************************************
+      struct copy_handler
+      {
+        typedef void (*type)(void*, const etl::imessage&);
+
+        template <typename TMessage>
+        static constexpr type get(TMessage*)
+        {
+          return &call<TMessage>;
+        }
+
+        static constexpr type get(void*)
+        {
+          return nullptr;
+        }
+
+        template <typename TMessage>
+        static void call(void* p, const etl::imessage& msg)
+        {
+          ::new (p) TMessage(static_cast<const TMessage&>(msg));
+        }
+      };
+
+      //********************************************
+      struct destroy_handler
+      {
+        typedef void (*type)(etl::imessage*);
+
+        template <typename TMessage>
+        static constexpr type get(TMessage*)
+        {
+          return &call<TMessage>;
+        }
+
+        static constexpr type get(void*)
+        {
+          return nullptr;
+        }
+
+        template <typename TMessage>
+        static void call(etl::imessage* pmsg)
+        {
+          static_cast<TMessage*>(pmsg)->~TMessage();
+        }
+      };
+
+      //********************************************
+      void construct(const etl::imessage& msg)
+      {
+        typename copy_handler::type copy = dispatcher_t::template find<copy_handler>(msg.message_id);
+
+        if (copy != nullptr)
+        {
+          copy(data, msg);
+        }
+        else
+        {
+          ETL_ASSERT(false, ETL_ERROR(unhandled_message_exception));
+        }
+      }
+
+      //********************************************
+      void destroy()
+      {
+        etl::imessage* pmsg = static_cast<etl::imessage*>(data);
+
+  #if defined(ETL_MESSAGES_ARE_VIRTUAL) || defined(ETL_POLYMORPHIC_MESSAGES)
+        pmsg->~imessage();
+  #else
+        typename destroy_handler::type destroy_message = dispatcher_t::template find<destroy_handler>(pmsg->message_id);
+
+        assert(destroy_message != nullptr);
+        destroy_message(pmsg);
+  #endif
+      }
+
+      typename etl::aligned_storage<SIZE, ALIGNMENT>::type data;
+    };
+
+    //**********************************************
+    message_router(etl::message_router_id_t id_)
+      : imessage_router(id_)
+    {
+      ETL_ASSERT(id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER, ETL_ERROR(etl::message_router_illegal_id));
+    }
+
+    //**********************************************
+    message_router(etl::message_router_id_t id_, etl::imessage_router& successor_)
+      : imessage_router(id_, successor_)
+    {
+      ETL_ASSERT(id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER, ETL_ERROR(etl::message_router_illegal_id));
+    }
+
+    //**********************************************
+    void receive(const etl::imessage& msg)
+    {
+      receive(etl::null_message_router::instance(), msg);
+    }
+
+    //**********************************************
+    void receive(etl::imessage_router& source, const etl::imessage& msg)
+    {
+      typename receive_handler::type handler = dispatcher_t::template find<receive_handler>(msg.message_id);
+
+      if (handler != nullptr)
+      {
+        handler(*this, source, msg);
+      }
+      else if (has_successor())
+      {
+        get_successor().receive(source, msg);
+      }
+      else
+      {
+        static_cast<TDerived*>(this)->on_receive_unknown(source, msg);
+      }
+    }
+
+    //**********************************************
+    /// Receives a batch of messages.
+    /// Each run of messages with the same id is passed to on_receive_batch
+    /// with one dispatch.
+    //**********************************************
+    void receive(etl::imessage_router& source, const etl::imessage* const* msgs, size_t n)
+    {
+      size_t first = 0;
+
+      while (first != n)
+      {
+        const size_t last = etl::private_message_router::end_of_run(msgs, first, n);
+
+        typename batch_handler::type handler = dispatcher_t::template find<batch_handler>(msgs[first]->message_id);
+
+        if (handler != nullptr)
+        {
+          handler(*this, source, msgs + first, last - first);
+        }
+        else if (has_successor())
+        {
+          get_successor().receive(source, msgs + first, last - first);
+        }
+        else
+        {
+          for (size_t i = first; i != last; ++i)
+          {
+            static_cast<TDerived*>(this)->on_receive_unknown(source, *msgs[i]);
+          }
+        }
+
+        first = last;
+      }
+    }
+
+    //**********************************************
+    /// Handles a run of messages of the same type.
+    /// Passes each one to on_receive. A derived router may overload this
+    /// for a message type to handle the run at once, and should add
+    /// 'using message_router::on_receive_batch;' for the other types.
+    //**********************************************
+    template <typename TMessage>
+    void on_receive_batch(etl::imessage_router& source, const etl::message_batch<TMessage>& batch)
+    {
+      for (size_t i = 0; i < batch.size(); ++i)
+      {
+        static_cast<TDerived*>(this)->on_receive(source, batch[i]);
+      }
+    }
+
+    using imessage_router::accepts;
+
+    //**********************************************
+    bool accepts(etl::message_id_t id) const
+    {
+      return accepts_id(id);
+    }
+
+    //**********************************************
+    /// Is the id one of the message ids?
+    /// A bitset test when the ids are dense.
+    //**********************************************
+    static constexpr bool accepts_id(etl::message_id_t id)
+    {
+      return dispatcher_t::contains(id);
+    }
+
+  private:
+
+    //**********************************************
+    struct receive_handler
+    {
+      typedef void (*type)(message_router&, etl::imessage_router&, const etl::imessage&);
+
+      template <typename TMessage>
+      static constexpr type get(TMessage*)
+      {
+        return &call<TMessage>;
+      }
+
+      static constexpr type get(void*)
+      {
+        return nullptr;
+      }
+
+      template <typename TMessage>
+      static void call(message_router& router, etl::imessage_router& source, const etl::imessage& msg)
+      {
+        static_cast<TDerived&>(router).on_receive(source, static_cast<const TMessage&>(msg));
+      }
+    };
+
+    //**********************************************
+    struct batch_handler
+    {
+      typedef void (*type)(message_router&, etl::imessage_router&, const etl::imessage* const*, size_t);
+
+      template <typename TMessage>
+      static constexpr type get(TMessage*)
+      {
+        return &call<TMessage>;
+      }
+
+      static constexpr type get(void*)
+      {
+        return nullptr;
+      }
+
+      template <typename TMessage>
+      static void call(message_router& router, etl::imessage_router& source, const etl::imessage* const* msgs, size_t n)
+      {
+        static_cast<TDerived&>(router).on_receive_batch(source, etl::message_batch<TMessage>(msgs, n));
+      }
+    };
+  };
+#else
   /*[[[cog
       import cog
       ################################################
@@ -401,6 +806,60 @@ namespace etl
       cog.outl("    }")
       cog.outl("  }")
       cog.outl("")
+      cog.outl("  //**********************************************")
+      cog.outl("  /// Receives a batch of messages.")
+      cog.outl("  /// Each run of messages with the same id is passed to on_receive_batch")
+      cog.outl("  /// with one dispatch.")
+      cog.outl("  //**********************************************")
+      cog.outl("  void receive(etl::imessage_router& source, const etl::imessage* const* msgs, size_t n)")
+      cog.outl("  {")
+      cog.outl("    size_t first = 0;")
+      cog.outl("")
+      cog.outl("    while (first != n)")
+      cog.outl("    {")
+      cog.outl("      const size_t last = etl::private_message_router::end_of_run(msgs, first, n);")
+      cog.outl("")
+      cog.outl("      switch (msgs[first]->message_id)")
+      cog.outl("      {")
+      for n in range(1, int(Handlers) + 1):
+          cog.out("        case T%d::ID:" % n)
+          cog.outl(" static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T%d>(msgs + first, last - first)); break;" % n)
+      cog.outl("        default:")
+      cog.outl("        {")
+      cog.outl("          if (has_successor())")
+      cog.outl("          {")
+      cog.outl("            get_successor().receive(source, msgs + first, last - first);")
+      cog.outl("          }")
+      cog.outl("          else")
+      cog.outl("          {")
+      cog.outl("            for (size_t i = first; i != last; ++i)")
+      cog.outl("            {")
+      cog.outl("              static_cast<TDerived*>(this)->on_receive_unknown(source, *msgs[i]);")
+      cog.outl("            }")
+      cog.outl("          }")
+      cog.outl("          break;")
+      cog.outl("        }")
+      cog.outl("      }")
+      cog.outl("")
+      cog.outl("      first = last;")
+      cog.outl("    }")
+      cog.outl("  }")
+      cog.outl("")
+      cog.outl("  //**********************************************")
+      cog.outl("  /// Handles a run of messages of the same type.")
+      cog.outl("  /// Passes each one to on_receive. A derived router may overload this")
+      cog.outl("  /// for a message type to handle the run at once, and should add")
+      cog.outl("  /// 'using message_router::on_receive_batch;' for the other types.")
+      cog.outl("  //**********************************************")
+      cog.outl("  template <typename TMessage>")
+      cog.outl("  void on_receive_batch(etl::imessage_router& source, const etl::message_batch<TMessage>& batch)")
+      cog.outl("  {")
+      cog.outl("    for (size_t i = 0; i < batch.size(); ++i)")
+      cog.outl("    {")
+      cog.outl("      static_cast<TDerived*>(this)->on_receive(source, batch[i]);")
+      cog.outl("    }")
+      cog.outl("  }")
+      cog.outl("")
       cog.outl("  using imessage_router::accepts;")
       cog.outl("")
       cog.outl("  //**********************************************")
@@ -586,6 +1045,60 @@ namespace etl
           cog.outl("    }")
           cog.outl("  }")
           cog.outl("")
+          cog.outl("  //**********************************************")
+          cog.outl("  /// Receives a batch of messages.")
+          cog.outl("  /// Each run of messages with the same id is passed to on_receive_batch")
+          cog.outl("  /// with one dispatch.")
+          cog.outl("  //**********************************************")
+          cog.outl("  void receive(etl::imessage_router& source, const etl::imessage* const* msgs, size_t n)")
+          cog.outl("  {")
+          cog.outl("    size_t first = 0;")
+          cog.outl("")
+          cog.outl("    while (first != n)")
+          cog.outl("    {")
+          cog.outl("      const size_t last = etl::private_message_router::end_of_run(msgs, first, n);")
+          cog.outl("")
+          cog.outl("      switch (msgs[first]->message_id)")
+          cog.outl("      {")
+          for t in range(1, n + 1):
+              cog.out("        case T%d::ID:" % t)
+              cog.outl(" static_cast<TDerived*>(this)->on_receive_batch(source, etl::message_batch<T%d>(msgs + first, last - first)); break;" % t)
+          cog.outl("        default:")
+          cog.outl("        {")
+          cog.outl("          if (has_successor())")
+          cog.outl("          {")
+          cog.outl("            get_successor().receive(source, msgs + first, last - first);")
+          cog.outl("          }")
+          cog.outl("          else")
+          cog.outl("          {")
+          cog.outl("            for (size_t i = first; i != last; ++i)")
+          cog.outl("            {")
+          cog.outl("              static_cast<TDerived*>(this)->on_receive_unknown(source, *msgs[i]);")
+          cog.outl("            }")
+          cog.outl("          }")
+          cog.outl("          break;")
+          cog.outl("        }")
+          cog.outl("      }")
+          cog.outl("")
+          cog.outl("      first = last;")
+          cog.outl("    }")
+          cog.outl("  }")
+          cog.outl("")
+          cog.outl("  //**********************************************")
+          cog.outl("  /// Handles a run of messages of the same type.")
+          cog.outl("  /// Passes each one to on_receive. A derived router may overload this")
+          cog.outl("  /// for a message type to handle the run at once, and should add")
+          cog.outl("  /// 'using message_router::on_receive_batch;' for the other types.")
+          cog.outl("  //**********************************************")
+          cog.outl("  template <typename TMessage>")
+          cog.outl("  void on_receive_batch(etl::imessage_router& source, const etl::message_batch<TMessage>& batch)")
+          cog.outl("  {")
+          cog.outl("    for (size_t i = 0; i < batch.size(); ++i)")
+          cog.outl("    {")
+          cog.outl("      static_cast<TDerived*>(this)->on_receive(source, batch[i]);")
+          cog.outl("    }")
+          cog.outl("  }")
+          cog.outl("")
           cog.outl("  using imessage_router::accepts;")
           cog.outl("")
           cog.outl("  //**********************************************")
@@ -608,6 +1121,7 @@ namespace etl
           cog.outl("};")
   ]]]*/
   /*[[[end]]]*/
+#endif
 }
 
 #undef ETL_FILE
@@ -41,6 +41,7 @@ SOFTWARE.
 #include "static_assert.h"
 #include "timer.h"
 #include "atomic.h"
+#include "private/timing_wheel.h"
 
 #undef ETL_FILE
 #define ETL_FILE "44"
@@ -448,7 +449,7 @@ namespace etl
     {
       if (enabled)
       {
-        if ETL_IF_CONSTEXPR(ETL_TIMER_UPDATES_ENABLED)
+        if (ETL_TIMER_UPDATES_ENABLED)
         {
           // We have something to do?
           bool has_active = !active_list.empty();
@@ -660,6 +661,409 @@ namespace etl
 
     message_timer_data timer_array[MAX_TIMERS_];
   };
+
+  //*************************************************************************
+  /// The configuration of a timing wheel timer.
+  struct message_timer_wheel_data
+  {
+    //*******************************************
+    message_timer_wheel_data()
+      : p_message(nullptr),
+        p_router(nullptr),
+        period(0),
+        expires(0),
+        destination_router_id(etl::imessage_bus::ALL_MESSAGE_ROUTERS),
+        id(etl::timer::wheel_id::NO_TIMER),
+        previous(etl::timer::wheel_id::NO_TIMER),
+        next(etl::timer::wheel_id::NO_TIMER),
+        slot(etl::private_timing_wheel::wheel_base::NO_SLOT),
+        repeating(true)
+    {
+    }
+
+    //*******************************************
+    message_timer_wheel_data(etl::timer::wheel_id::type id_,
+                             const etl::imessage&       message_,
+                             etl::imessage_router&      irouter_,
+                             uint32_t                   period_,
+                             bool                       repeating_,
+                             etl::message_router_id_t   destination_router_id_)
+      : p_message(&message_),
+        p_router(&irouter_),
+        period(period_),
+        expires(0),
+        id(id_),
+        previous(etl::timer::wheel_id::NO_TIMER),
+        next(etl::timer::wheel_id::NO_TIMER),
+        slot(etl::private_timing_wheel::wheel_base::NO_SLOT),
+        repeating(repeating_)
+    {
+      if (irouter_.is_bus())
+      {
+        destination_router_id = destination_router_id_;
+      }
+      else
+      {
+        destination_router_id = etl::imessage_bus::ALL_MESSAGE_ROUTERS;
+      }
+    }
+
+    //*******************************************
+    /// Returns true if the timer is active.
+    //*******************************************
+    bool is_active() const
+    {
+      return slot != etl::private_timing_wheel::wheel_base::NO_SLOT;
+    }
+
+    const etl::imessage*       p_message;
+    etl::imessage_router*      p_router;
+    uint32_t                   period;
+    uint32_t                   expires;
+    etl::message_router_id_t   destination_router_id;
+    etl::timer::wheel_id::type id;
+    etl::timer::wheel_id::type previous;
+    etl::timer::wheel_id::type next;
+    uint_least16_t             slot;
+    bool                       repeating;
+
+  private:
+
+    // Disabled.
+    message_timer_wheel_data(const message_timer_wheel_data& other);
+    message_timer_wheel_data& operator =(const message_timer_wheel_data& other);
+  };
+
+  //***************************************************************************
+  /// Interface for the timing wheel message timer.
+  /// Has the same API as imessage_timer, but start, stop and expiry are O(1),
+  /// registration takes from a free list and up to 65534 timers are allowed.
+  //***************************************************************************
+  class imessage_timer_wheel
+  {
+  public:
+
+    //*******************************************
+    /// Register a timer.
+    //*******************************************
+    etl::timer::wheel_id::type register_timer(const etl::imessage&     message_,
+                                              etl::imessage_router&    router_,
+                                              uint32_t                 period_,
+                                              bool                     repeating_,
+                                              etl::message_router_id_t destination_router_id_ = etl::imessage_router::ALL_MESSAGE_ROUTERS)
+    {
+      etl::timer::wheel_id::type id = etl::timer::wheel_id::NO_TIMER;
+
+      // There's no point adding null message routers.
+      if ((free_list != etl::timer::wheel_id::NO_TIMER) && !router_.is_null_router())
+      {
+        id = free_list;
+
+        etl::message_timer_wheel_data& timer = timer_array[id];
+        free_list = timer.next;
+
+        // Create in-place.
+        new (&timer) message_timer_wheel_data(id, message_, router_, period_, repeating_, destination_router_id_);
+        ++registered_timers;
+      }
+
+      return id;
+    }
+
+    //*******************************************
+    /// Unregister a timer.
+    //*******************************************
+    bool unregister_timer(etl::timer::wheel_id::type id_)
+    {
+      bool result = false;
+
+      if (id_ < MAX_TIMERS)
+      {
+        etl::message_timer_wheel_data& timer = timer_array[id_];
+
+        if (timer.id != etl::timer::wheel_id::NO_TIMER)
+        {
+          if (timer.is_active())
+          {
+            ETL_DISABLE_TIMER_UPDATES;
+            active_wheel.remove(timer.id);
+            ETL_ENABLE_TIMER_UPDATES;
+          }
+
+          // Reset in-place and return to the free list.
+          new (&timer) message_timer_wheel_data();
+          timer.next = free_list;
+          free_list  = id_;
+          --registered_timers;
+
+          result = true;
+        }
+      }
+
+      return result;
+    }
+
+    //*******************************************
+    /// Enable/disable the timer.
+    //*******************************************
+    void enable(bool state_)
+    {
+      enabled = state_;
+    }
+
+    //*******************************************
+    /// Get the enable/disable state.
+    //*******************************************
+    bool is_running() const
+    {
+      return enabled;
+    }
+
+    //*******************************************
+    /// Clears the timer of data.
+    //*******************************************
+    void clear()
+    {
+      ETL_DISABLE_TIMER_UPDATES;
+      active_wheel.clear();
+      ETL_ENABLE_TIMER_UPDATES;
+
+      initialise();
+    }
+
+    //*******************************************
+    // Called by the timer service to indicate the
+    // amount of time that has elapsed since the last successful call to 'tick'.
+    // Returns true if the tick was processed,
+    // false if not.
+    //*******************************************
+    bool tick(uint32_t count)
+    {
+      if (enabled)
+      {
+        if (ETL_TIMER_UPDATES_ENABLED)
+        {
+          // Immediate timers are already in the expired list.
+          do
+          {
+            etl::timer::wheel_id::type id = active_wheel.pop_expired();
+
+            while (id != etl::timer::wheel_id::NO_TIMER)
+            {
+              etl::message_timer_wheel_data& timer = timer_array[id];
+
+              if (timer.repeating)
+              {
+                active_wheel.reinsert(id, timer.period);
+              }
+
+              if (timer.p_router != nullptr)
+              {
+                if (timer.p_router->is_bus())
+                {
+                  // Send to a message bus.
+                  etl::imessage_bus& bus = static_cast<etl::imessage_bus&>(*(timer.p_router));
+                  bus.receive(timer.destination_router_id, *(timer.p_message));
+                }
+                else
+                {
+                  // Send to a router.
+                  timer.p_router->receive(*(timer.p_message));
+                }
+              }
+
+              id = active_wheel.pop_expired();
+            }
+          } while (active_wheel.advance(count));
+
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    //*******************************************
+    /// Starts a timer.
+    //*******************************************
+    bool start(etl::timer::wheel_id::type id_, bool immediate_ = false)
+    {
+      bool result = false;
+
+      // Valid timer id?
+      if (id_ < MAX_TIMERS)
+      {
+        etl::message_timer_wheel_data& timer = timer_array[id_];
+
+        // Registered timer?
+        if (timer.id != etl::timer::wheel_id::NO_TIMER)
+        {
+          // Has a valid period.
+          if (timer.period != etl::timer::state::INACTIVE)
+          {
+            ETL_DISABLE_TIMER_UPDATES;
+            if (timer.is_active())
+            {
+              active_wheel.remove(timer.id);
+            }
+
+            active_wheel.insert(timer.id, immediate_ ? 0 : timer.period);
+            ETL_ENABLE_TIMER_UPDATES;
+
+            result = true;
+          }
+        }
+      }
+
+      return result;
+    }
+
+    //*******************************************
+    /// Stops a timer.
+    //*******************************************
+    bool stop(etl::timer::wheel_id::type id_)
+    {
+      bool result = false;
+
+      // Valid timer id?
+      if (id_ < MAX_TIMERS)
+      {
+        etl::message_timer_wheel_data& timer = timer_array[id_];
+
+        // Registered timer?
+        if (timer.id != etl::timer::wheel_id::NO_TIMER)
+        {
+          if (timer.is_active())
+          {
+            ETL_DISABLE_TIMER_UPDATES;
+            active_wheel.remove(timer.id);
+            ETL_ENABLE_TIMER_UPDATES;
+          }
+
+          result = true;
+        }
+      }
+
+      return result;
+    }
+
+    //*******************************************
+    /// Sets a timer's period.
+    //*******************************************
+    bool set_period(etl::timer::wheel_id::type id_, uint32_t period_)
+    {
+      if (stop(id_))
+      {
+        timer_array[id_].period = period_;
+        return true;
+      }
+
+      return false;
+    }
+
+    //*******************************************
+    /// Sets a timer's mode.
+    //*******************************************
+    bool set_mode(etl::timer::wheel_id::type id_, bool repeating_)
+    {
+      if (stop(id_))
+      {
+        timer_array[id_].repeating = repeating_;
+        return true;
+      }
+
+      return false;
+    }
+
+  protected:
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    imessage_timer_wheel(message_timer_wheel_data* const timer_array_, const uint_least16_t MAX_TIMERS_)
+      : timer_array(timer_array_),
+        active_wheel(timer_array_),
+        free_list(etl::timer::wheel_id::NO_TIMER),
+        enabled(false),
+#if defined(ETL_MESSAGE_TIMER_USE_ATOMIC_LOCK)
+        process_semaphore(0),
+#endif
+        registered_timers(0),
+        MAX_TIMERS(MAX_TIMERS_)
+    {
+    }
+
+    //*******************************************
+    /// Destructor.
+    //*******************************************
+    ~imessage_timer_wheel()
+    {
+    }
+
+    //*******************************************
+    /// Resets the timer data and links every timer into the free list.
+    //*******************************************
+    void initialise()
+    {
+      free_list = etl::timer::wheel_id::NO_TIMER;
+
+      for (uint_least16_t i = MAX_TIMERS; i != 0; --i)
+      {
+        etl::message_timer_wheel_data& timer = timer_array[i - 1];
+        new (&timer) message_timer_wheel_data();
+        timer.next = free_list;
+        free_list  = etl::timer::wheel_id::type(i - 1);
+      }
+
+      registered_timers = 0;
+    }
+
+  private:
+
+    // The array of timer data structures.
+    message_timer_wheel_data* const timer_array;
+
+    // The wheel of active timers.
+    private_timing_wheel::wheel<etl::message_timer_wheel_data> active_wheel;
+
+    // The head of the list of unregistered timers.
+    etl::timer::wheel_id::type free_list;
+
+    volatile bool enabled;
+
+#if defined(ETL_MESSAGE_TIMER_USE_ATOMIC_LOCK)
+    volatile etl::timer_semaphore_t process_semaphore;
+#endif
+    volatile uint_least16_t registered_timers;
+
+  public:
+
+    const uint_least16_t MAX_TIMERS;
+  };
+
+  //***************************************************************************
+  /// The timing wheel message timer
+  //***************************************************************************
+  template <uint_least16_t MAX_TIMERS_>
+  class message_timer_wheel : public etl::imessage_timer_wheel
+  {
+  public:
+
+    ETL_STATIC_ASSERT(MAX_TIMERS_ <= 65534, "No more than 65534 timers are allowed");
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    message_timer_wheel()
+      : imessage_timer_wheel(timer_array, MAX_TIMERS_)
+    {
+      initialise();
+    }
+
+  private:
+
+    message_timer_wheel_data timer_array[MAX_TIMERS_];
+  };
 }
 
 #undef ETL_DISABLE_TIMER_UPDATES
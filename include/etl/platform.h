@@ -94,6 +94,12 @@ SOFTWARE.
   #define ETL_DELETE
 #endif
 
+// The size of the data cache line. Used to keep data that is written by
+// different cores apart. May be defined in the profile.
+#if !defined(ETL_CACHE_LINE_SIZE)
+  #define ETL_CACHE_LINE_SIZE 64
+#endif
+
 #if ETL_CPP11_SUPPORTED
   #define ETL_NOEXCEPT noexcept
   #define ETL_NOEXCEPT_EXPR(expression) noexcept(expression)
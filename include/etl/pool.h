@@ -257,6 +257,36 @@ namespace etl
       release_item((char*)p_object);
     }
 
+    //*************************************************************************
+    /// Allocate storage for up to 'n' objects from the pool.
+    /// The allocation counters are updated once for the whole batch.
+    /// If fewer than 'n' items are free then all that remain are allocated.
+    /// \param p_items Receives the addresses of the allocated items.
+    /// \return The number of items allocated.
+    //*************************************************************************
+    template <typename T>
+    size_t allocate_n(T** p_items, size_t n)
+    {
+      if (sizeof(T) > ITEM_SIZE)
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::pool_element_size));
+      }
+
+      return allocate_items(reinterpret_cast<char**>(p_items), n);
+    }
+
+    //*************************************************************************
+    /// Release 'n' objects in the pool.
+    /// The released items are linked into a run and spliced onto the free list.
+    /// If asserts or exceptions are enabled and an object does not belong to this
+    /// pool then an etl::pool_object_not_in_pool is thrown.
+    //*************************************************************************
+    template <typename T>
+    void release_n(T* const* p_items, size_t n)
+    {
+      release_items(reinterpret_cast<char* const*>(p_items), n);
+    }
+
     //*************************************************************************
     /// Release all objects in the pool.
     //*************************************************************************
@@ -320,6 +350,53 @@ namespace etl
       return items_allocated == MAX_SIZE;
     }
 
+#if defined(ETL_POOL_STATISTICS)
+    //*************************************************************************
+    /// The largest number of items that have been allocated at once.
+    //*************************************************************************
+    size_t high_water_mark() const
+    {
+      return statistics_high_water_mark;
+    }
+
+    //*************************************************************************
+    /// The number of allocation requests that could not be satisfied.
+    //*************************************************************************
+    size_t allocation_failures() const
+    {
+      return statistics_allocation_failures;
+    }
+
+    //*************************************************************************
+    /// The total number of items allocated.
+    /// Sample periodically to derive the allocation rate.
+    //*************************************************************************
+    size_t allocation_count() const
+    {
+      return statistics_allocation_count;
+    }
+
+    //*************************************************************************
+    /// The total number of items released.
+    //*************************************************************************
+    size_t release_count() const
+    {
+      return statistics_release_count;
+    }
+
+    //*************************************************************************
+    /// Resets the statistics.
+    /// The high water mark is reset to the current number of allocated items.
+    //*************************************************************************
+    void reset_statistics()
+    {
+      statistics_high_water_mark     = items_allocated;
+      statistics_allocation_failures = 0;
+      statistics_allocation_count    = 0;
+      statistics_release_count       = 0;
+    }
+#endif
+
   protected:
 
     //*************************************************************************
@@ -332,6 +409,12 @@ namespace etl
         items_initialised(0),
         ITEM_SIZE(item_size_),
         MAX_SIZE(max_size_)
+#if defined(ETL_POOL_STATISTICS)
+        , statistics_high_water_mark(0),
+        statistics_allocation_failures(0),
+        statistics_allocation_count(0),
+        statistics_release_count(0)
+#endif
     {
     }
 
@@ -369,15 +452,72 @@ namespace etl
           // No more left!
           p_next = nullptr;
         }
+
+#if defined(ETL_POOL_STATISTICS)
+        record_allocations(1);
+#endif
       }
       else
       {
+#if defined(ETL_POOL_STATISTICS)
+        ++statistics_allocation_failures;
+#endif
         ETL_ASSERT(false, ETL_ERROR(pool_no_allocation));
       }
 
       return p_value;
     }
 
+    //*************************************************************************
+    /// Allocate up to 'n' items from the pool.
+    //*************************************************************************
+    size_t allocate_items(char** p_values, size_t n)
+    {
+      size_t count = MAX_SIZE - items_allocated;
+
+      if (n > count)
+      {
+#if defined(ETL_POOL_STATISTICS)
+        ++statistics_allocation_failures;
+#endif
+      }
+      else
+      {
+        count = n;
+      }
+
+      if (count == 0)
+      {
+        return 0;
+      }
+
+      // Initialise as many as the run needs.
+      while ((items_initialised < MAX_SIZE) && (items_initialised < (items_allocated + count)))
+      {
+        uintptr_t p = reinterpret_cast<uintptr_t>(p_buffer + (items_initialised * ITEM_SIZE));
+        *reinterpret_cast<uintptr_t*>(p) = p + ITEM_SIZE;
+        ++items_initialised;
+      }
+
+      // Take the run from the front of the free list.
+      char* p_value = p_next;
+
+      for (size_t i = 0; i < count; ++i)
+      {
+        p_values[i] = p_value;
+        p_value     = *reinterpret_cast<char**>(p_value);
+      }
+
+      items_allocated += uint32_t(count);
+      p_next = (items_allocated != MAX_SIZE) ? p_value : nullptr;
+
+#if defined(ETL_POOL_STATISTICS)
+      record_allocations(count);
+#endif
+
+      return count;
+    }
+
     //*************************************************************************
     /// Release an item back to the pool.
     //*************************************************************************
@@ -400,7 +540,59 @@ namespace etl
       p_next = p_value;
 
       --items_allocated;
+
+#if defined(ETL_POOL_STATISTICS)
+      ++statistics_release_count;
+#endif
+    }
+
+    //*************************************************************************
+    /// Release 'n' items back to the pool.
+    //*************************************************************************
+    void release_items(char* const* p_values, size_t n)
+    {
+      if (n == 0)
+      {
+        return;
+      }
+
+      // Do they all belong to us?
+      for (size_t i = 0; i < n; ++i)
+      {
+        ETL_ASSERT(is_item_in_pool(p_values[i]), ETL_ERROR(pool_object_not_in_pool));
+      }
+
+      // Link the items into a run.
+      for (size_t i = 0; i < n; ++i)
+      {
+        char* p_link = ((i + 1) < n) ? p_values[i + 1] : p_next;
+        *reinterpret_cast<uintptr_t*>(p_values[i]) = reinterpret_cast<uintptr_t>(p_link);
+      }
+
+      // Splice the run onto the front of the free list.
+      p_next = p_values[0];
+
+      items_allocated -= uint32_t(n);
+
+#if defined(ETL_POOL_STATISTICS)
+      statistics_release_count += n;
+#endif
+    }
+
+#if defined(ETL_POOL_STATISTICS)
+    //*************************************************************************
+    /// Records successful allocations.
+    //*************************************************************************
+    void record_allocations(size_t n)
+    {
+      statistics_allocation_count += n;
+
+      if (items_allocated > statistics_high_water_mark)
+      {
+        statistics_high_water_mark = items_allocated;
+      }
     }
+#endif
 
     //*************************************************************************
     /// Check if the item belongs to this pool.
@@ -435,6 +627,13 @@ namespace etl
     const uint32_t ITEM_SIZE;    ///< The size of allocated items.
     const uint32_t MAX_SIZE;    ///< The maximum number of objects that can be allocated.
 
+#if defined(ETL_POOL_STATISTICS)
+    size_t statistics_high_water_mark;     ///< The largest number of items allocated at once.
+    size_t statistics_allocation_failures; ///< The number of failed allocation requests.
+    size_t statistics_allocation_count;    ///< The total number of items allocated.
+    size_t statistics_release_count;       ///< The total number of items released.
+#endif
+
     //*************************************************************************
     /// Destructor.
     //*************************************************************************
@@ -486,6 +685,19 @@ namespace etl
       return ipool::allocate<U>();
     }
 
+    //*************************************************************************
+    /// Allocate storage for up to 'n' objects from the pool.
+    /// Static asserts if the specified type is too large for the pool.
+    /// \return The number of items allocated.
+    //*************************************************************************
+    template <typename U>
+    size_t allocate_n(U** p_items, size_t n)
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= ALIGNMENT_, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= TYPE_SIZE, "Type too large for pool");
+      return ipool::allocate_n<U>(p_items, n);
+    }
+
 #if !ETL_CPP11_SUPPORTED || ETL_POOL_CPP03_CODE || defined(ETL_STLPORT) || defined(ETL_NO_STL)
     //*************************************************************************
     /// Allocate storage for an object from the pool and create with default.
@@ -0,0 +1,898 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_POOL_CONCURRENT_INCLUDED
+#define ETL_POOL_CONCURRENT_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "pool.h"
+#include "atomic.h"
+#include "alignment.h"
+#include "error_handler.h"
+#include "nullptr.h"
+#include "static_assert.h"
+
+#if ETL_HAS_ATOMIC
+
+#undef ETL_FILE
+#define ETL_FILE "54"
+
+//*****************************************************************************
+///\defgroup pool_concurrent pool_concurrent
+/// A fixed capacity pool that may be shared between threads.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup pool_concurrent
+  /// The base for pools that may be allocated from and released to by
+  /// several threads at once.
+  /// Free items are held in a lock free stack of item indexes. The head of the
+  /// stack is tagged with a modification count to defeat the ABA problem.
+  /// Use an etl::pool_magazine per thread to batch transfers to and from the
+  /// shared stack.
+  //***************************************************************************
+  class ipool_concurrent
+  {
+  public:
+
+    typedef size_t size_type;
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a nullptr is returned.
+    //*************************************************************************
+    template <typename T>
+    T* allocate()
+    {
+      if (sizeof(T) > ITEM_SIZE)
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::pool_element_size));
+      }
+
+      return reinterpret_cast<T*>(allocate_item());
+    }
+
+#if !ETL_CPP11_SUPPORTED || ETL_POOL_CPP03_CODE || defined(ETL_STLPORT) || defined(ETL_NO_STL)
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create default.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a nullptr is returned.
+    //*************************************************************************
+    template <typename T>
+    T* create()
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T();
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 1 parameter.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a nullptr is returned.
+    //*************************************************************************
+    template <typename T, typename T1>
+    T* create(const T1& value1)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1);
+      }
+
+      return p;
+    }
+
+    template <typename T, typename T1, typename T2>
+    T* create(const T1& value1, const T2& value2)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2);
+      }
+
+      return p;
+    }
+
+    template <typename T, typename T1, typename T2, typename T3>
+    T* create(const T1& value1, const T2& value2, const T3& value3)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2, value3);
+      }
+
+      return p;
+    }
+
+    template <typename T, typename T1, typename T2, typename T3, typename T4>
+    T* create(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2, value3, value4);
+      }
+
+      return p;
+    }
+#else
+    //*************************************************************************
+    /// Emplace with variadic constructor parameters.
+    //*************************************************************************
+    template <typename T, typename... Args>
+    T* create(Args&&... args)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(std::forward<Args>(args)...);
+      }
+
+      return p;
+    }
+#endif
+
+    //*************************************************************************
+    /// Destroys the object.
+    /// Undefined behaviour if the pool does not contain a 'T'.
+    /// \param p_object A pointer to the object to be destroyed.
+    //*************************************************************************
+    template <typename T>
+    void destroy(const void* const p_object)
+    {
+      if (sizeof(T) > ITEM_SIZE)
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::pool_element_size));
+      }
+
+      reinterpret_cast<T*>((const_cast<void*>(p_object)))->~T();
+      release(p_object);
+    }
+
+    //*************************************************************************
+    /// Release an object in the pool.
+    /// If asserts or exceptions are enabled and the object does not belong to this
+    /// pool then an etl::pool_object_not_in_pool is thrown.
+    /// \param p_object A pointer to the object to be released.
+    //*************************************************************************
+    void release(const void* const p_object)
+    {
+      release_n(&p_object, 1);
+    }
+
+    //*************************************************************************
+    /// Allocates up to 'n' items with a single update of the free stack.
+    /// \param p_items Receives the addresses of the allocated items.
+    /// \return The number of items allocated.
+    //*************************************************************************
+    size_t allocate_n(void** p_items, size_t n)
+    {
+      if (n == 0)
+      {
+        return 0;
+      }
+
+      uint64_t head = free_head.load(etl::memory_order_acquire);
+      size_t   count;
+
+      for (;;)
+      {
+        uint32_t index = get_index(head);
+
+        if (index == NONE)
+        {
+          return 0;
+        }
+
+        // Walk the chain to be removed.
+        // If another thread changes the stack meanwhile the links may be stale,
+        // but the compare/exchange will then fail and the walk is repeated.
+        count = 0;
+        uint32_t next;
+
+        for (;;)
+        {
+          p_items[count++] = p_buffer + (size_t(index) * ITEM_SIZE);
+          next = p_links[index].load(etl::memory_order_relaxed);
+
+          if ((count == n) || (next >= MAX_SIZE))
+          {
+            break;
+          }
+
+          index = next;
+        }
+
+        if (free_head.compare_exchange_weak(head, make_head(get_tag(head) + 1, next), etl::memory_order_acq_rel))
+        {
+          break;
+        }
+      }
+
+      free_count.fetch_sub(int32_t(count), etl::memory_order_relaxed);
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Releases 'n' items with a single update of the free stack.
+    /// If asserts or exceptions are enabled and an object does not belong to this
+    /// pool then an etl::pool_object_not_in_pool is thrown.
+    //*************************************************************************
+    void release_n(const void* const* p_items, size_t n)
+    {
+      if (n == 0)
+      {
+        return;
+      }
+
+      // Link the items into a chain.
+      uint32_t first = get_item_index(p_items[0]);
+      uint32_t last  = first;
+
+      for (size_t i = 1; i < n; ++i)
+      {
+        uint32_t index = get_item_index(p_items[i]);
+        p_links[last].store(index, etl::memory_order_relaxed);
+        last = index;
+      }
+
+      // Push the chain.
+      uint64_t head = free_head.load(etl::memory_order_relaxed);
+
+      do
+      {
+        p_links[last].store(get_index(head), etl::memory_order_relaxed);
+      } while (!free_head.compare_exchange_weak(head, make_head(get_tag(head) + 1, first), etl::memory_order_acq_rel));
+
+      free_count.fetch_add(int32_t(n), etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// Check to see if the object belongs to the pool.
+    /// \param p_object A pointer to the object to be checked.
+    /// \return <b>true<\b> if it does, otherwise <b>false</b>
+    //*************************************************************************
+    bool is_in_pool(const void* p_object) const
+    {
+      return is_item_in_pool(static_cast<const char*>(p_object));
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of items in the pool.
+    //*************************************************************************
+    size_t max_size() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// Returns the size of each item in the pool.
+    //*************************************************************************
+    size_t item_size() const
+    {
+      return ITEM_SIZE;
+    }
+
+    //*************************************************************************
+    /// Returns the number of items in the shared free stack.
+    /// Items cached by magazines are counted as allocated.
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_t available() const
+    {
+      // The count is updated after the stack, so may be briefly negative.
+      int32_t n = free_count.load(etl::memory_order_relaxed);
+
+      return (n < 0) ? 0 : size_t(n);
+    }
+
+    //*************************************************************************
+    /// Returns the number of allocated items in the pool.
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_t size() const
+    {
+      return MAX_SIZE - available();
+    }
+
+    //*************************************************************************
+    /// Checks to see if there are no allocated items in the pool.
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    bool empty() const
+    {
+      return available() == MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// Checks to see if there are no free items in the pool.
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    bool full() const
+    {
+      return available() == 0;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    ipool_concurrent(char* p_buffer_, etl::atomic<uint32_t>* p_links_, uint32_t item_size_, uint32_t max_size_)
+      : p_buffer(p_buffer_),
+        p_links(p_links_),
+        free_head(make_head(0, 0)),
+        free_count(int32_t(max_size_)),
+        ITEM_SIZE(item_size_),
+        MAX_SIZE(max_size_)
+    {
+    }
+
+    //*************************************************************************
+    /// Links every item into the free stack.
+    /// Called from the derived constructor, once the links have been constructed.
+    //*************************************************************************
+    void initialise()
+    {
+      for (uint32_t i = 0; i < (MAX_SIZE - 1); ++i)
+      {
+        p_links[i].store(i + 1, etl::memory_order_relaxed);
+      }
+
+      p_links[MAX_SIZE - 1].store(NONE, etl::memory_order_relaxed);
+
+      free_head.store(make_head(0, 0), etl::memory_order_release);
+    }
+
+  private:
+
+    static const uint32_t NONE = 0xFFFFFFFFUL; ///< The index that terminates the free stack.
+
+    //*************************************************************************
+    /// The head of the free stack is a modification tag and an item index.
+    //*************************************************************************
+    static uint64_t make_head(uint32_t tag, uint32_t index)
+    {
+      return (uint64_t(tag) << 32) | index;
+    }
+
+    static uint32_t get_tag(uint64_t head)
+    {
+      return uint32_t(head >> 32);
+    }
+
+    static uint32_t get_index(uint64_t head)
+    {
+      return uint32_t(head);
+    }
+
+    //*************************************************************************
+    /// Allocate an item from the pool.
+    //*************************************************************************
+    char* allocate_item()
+    {
+      void* p_value = nullptr;
+
+      if (allocate_n(&p_value, 1) == 0)
+      {
+        ETL_ASSERT(false, ETL_ERROR(pool_no_allocation));
+      }
+
+      return static_cast<char*>(p_value);
+    }
+
+    //*************************************************************************
+    /// Gets the index of an item, checking that it belongs to this pool.
+    //*************************************************************************
+    uint32_t get_item_index(const void* p_value) const
+    {
+      const char* p = static_cast<const char*>(p_value);
+
+      ETL_ASSERT(is_item_in_pool(p), ETL_ERROR(pool_object_not_in_pool));
+
+      return uint32_t(size_t(p - p_buffer) / ITEM_SIZE);
+    }
+
+    //*************************************************************************
+    /// Check if the item belongs to this pool.
+    //*************************************************************************
+    bool is_item_in_pool(const char* p) const
+    {
+      // Within the range of the buffer?
+      intptr_t distance = p - p_buffer;
+      bool is_within_range = (distance >= 0) && (distance <= intptr_t((ITEM_SIZE * MAX_SIZE) - ITEM_SIZE));
+
+      // Modulus and division can be slow on some architectures, so only do this in debug.
+#if defined(ETL_DEBUG)
+      // Is the address on a valid object boundary?
+      bool is_valid_address = ((distance % ITEM_SIZE) == 0);
+#else
+      bool is_valid_address = true;
+#endif
+
+      return is_within_range && is_valid_address;
+    }
+
+    // Disable copy construction and assignment.
+    ipool_concurrent(const ipool_concurrent&);
+    ipool_concurrent& operator =(const ipool_concurrent&);
+
+    char*                  p_buffer;   ///< The item storage.
+    etl::atomic<uint32_t>* p_links;    ///< The index of the next free item, for each item.
+    etl::atomic<uint64_t>  free_head;  ///< The tag and index of the top of the free stack.
+    etl::atomic<int32_t>   free_count; ///< The number of items in the free stack.
+
+    const uint32_t ITEM_SIZE; ///< The size of allocated items.
+    const uint32_t MAX_SIZE;  ///< The maximum number of objects that can be allocated.
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_POOL) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~ipool_concurrent()
+    {
+    }
+#else
+  protected:
+    ~ipool_concurrent()
+    {
+    }
+#endif
+  };
+
+  //*************************************************************************
+  /// A templated abstract pool implementation that uses a fixed size pool
+  /// and may be shared between threads.
+  ///\ingroup pool_concurrent
+  //*************************************************************************
+  template <const size_t TYPE_SIZE_, const size_t ALIGNMENT_, const size_t SIZE_>
+  class generic_pool_concurrent : public etl::ipool_concurrent
+  {
+  public:
+
+    static const size_t SIZE      = SIZE_;
+    static const size_t ALIGNMENT = ALIGNMENT_;
+    static const size_t TYPE_SIZE = TYPE_SIZE_;
+
+    ETL_STATIC_ASSERT((SIZE_ > 0) && (SIZE_ <= 0x7FFFFFFFUL), "Invalid pool size");
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    generic_pool_concurrent()
+      : etl::ipool_concurrent(reinterpret_cast<char*>(&buffer[0]), links, ELEMENT_SIZE, SIZE)
+    {
+      this->initialise();
+    }
+
+    //*************************************************************************
+    /// Allocate an object from the pool.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a nullptr is returned.
+    /// Static asserts if the specified type is too large for the pool.
+    //*************************************************************************
+    template <typename U>
+    U* allocate()
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= ALIGNMENT_, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= TYPE_SIZE, "Type too large for pool");
+      return ipool_concurrent::allocate<U>();
+    }
+
+#if !ETL_CPP11_SUPPORTED || ETL_POOL_CPP03_CODE || defined(ETL_STLPORT) || defined(ETL_NO_STL)
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with default.
+    //*************************************************************************
+    template <typename U>
+    U* create()
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= ALIGNMENT_, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= TYPE_SIZE, "Type too large for pool");
+      return ipool_concurrent::create<U>();
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 1 parameter.
+    //*************************************************************************
+    template <typename U, typename T1>
+    U* create(const T1& value1)
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= ALIGNMENT_, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= TYPE_SIZE, "Type too large for pool");
+      return ipool_concurrent::create<U>(value1);
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 2 parameters.
+    //*************************************************************************
+    template <typename U, typename T1, typename T2>
+    U* create(const T1& value1, const T2& value2)
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= ALIGNMENT_, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= TYPE_SIZE, "Type too large for pool");
+      return ipool_concurrent::create<U>(value1, value2);
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 3 parameters.
+    //*************************************************************************
+    template <typename U, typename T1, typename T2, typename T3>
+    U* create(const T1& value1, const T2& value2, const T3& value3)
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= ALIGNMENT_, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= TYPE_SIZE, "Type too large for pool");
+      return ipool_concurrent::create<U>(value1, value2, value3);
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 4 parameters.
+    //*************************************************************************
+    template <typename U, typename T1, typename T2, typename T3, typename T4>
+    U* create(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= ALIGNMENT_, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= TYPE_SIZE, "Type too large for pool");
+      return ipool_concurrent::create<U>(value1, value2, value3, value4);
+    }
+#else
+    //*************************************************************************
+    /// Emplace with variadic constructor parameters.
+    //*************************************************************************
+    template <typename U, typename... Args>
+    U* create(Args&&... args)
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= ALIGNMENT_, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= TYPE_SIZE, "Type too large for pool");
+      return ipool_concurrent::create<U>(std::forward<Args>(args)...);
+    }
+#endif
+
+    //*************************************************************************
+    /// Destroys the object.
+    /// Undefined behaviour if the pool does not contain a 'U'.
+    /// \param p_object A pointer to the object to be destroyed.
+    //*************************************************************************
+    template <typename U>
+    void destroy(const void* const p_object)
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= ALIGNMENT_, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= TYPE_SIZE, "Type too large for pool");
+      reinterpret_cast<U*>((const_cast<void*>(p_object)))->~U();
+      ipool_concurrent::release(p_object);
+    }
+
+  private:
+
+    // The pool element.
+    union Element
+    {
+      char     value[TYPE_SIZE_]; ///< Storage for value type.
+      typename etl::type_with_alignment<ALIGNMENT_>::type dummy; ///< Dummy item to get correct alignment.
+    };
+
+    ///< The memory for the pool of objects.
+    typename etl::aligned_storage<sizeof(Element), etl::alignment_of<Element>::value>::type buffer[SIZE];
+
+    ///< The free stack links.
+    etl::atomic<uint32_t> links[SIZE];
+
+    static const uint32_t ELEMENT_SIZE = sizeof(Element);
+
+    // Should not be copied.
+    generic_pool_concurrent(const generic_pool_concurrent&);
+    generic_pool_concurrent& operator =(const generic_pool_concurrent&);
+  };
+
+  //*************************************************************************
+  /// A templated pool implementation that uses a fixed size pool and may be
+  /// shared between threads.
+  ///\ingroup pool_concurrent
+  //*************************************************************************
+  template <typename T, const size_t SIZE_>
+  class pool_concurrent : public etl::generic_pool_concurrent<sizeof(T), etl::alignment_of<T>::value, SIZE_>
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    pool_concurrent()
+    {
+    }
+
+  private:
+
+    // Should not be copied.
+    pool_concurrent(const pool_concurrent&);
+    pool_concurrent& operator =(const pool_concurrent&);
+  };
+
+  //*************************************************************************
+  /// A per thread cache of items from an etl::ipool_concurrent.
+  /// Allocations and releases are served locally. When the magazine is empty
+  /// it is refilled with half its capacity in one operation on the shared
+  /// pool; when it is full, half is returned in one operation.
+  /// A magazine must only be used by one thread at a time.
+  /// All items are returned to the pool when the magazine is destroyed.
+  ///\tparam CAPACITY The number of items that may be cached.
+  ///\ingroup pool_concurrent
+  //*************************************************************************
+  template <const size_t CAPACITY>
+  class pool_magazine
+  {
+  public:
+
+    ETL_STATIC_ASSERT(CAPACITY >= 2, "Magazine capacity must be at least 2");
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    explicit pool_magazine(etl::ipool_concurrent& pool_)
+      : pool(pool_),
+        count(0)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    /// Returns all cached items to the pool.
+    //*************************************************************************
+    ~pool_magazine()
+    {
+      flush();
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a nullptr is returned.
+    //*************************************************************************
+    template <typename T>
+    T* allocate()
+    {
+      if (sizeof(T) > pool.item_size())
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::pool_element_size));
+      }
+
+      return static_cast<T*>(allocate_item());
+    }
+
+#if !ETL_CPP11_SUPPORTED || ETL_POOL_CPP03_CODE || defined(ETL_STLPORT) || defined(ETL_NO_STL)
+    //*************************************************************************
+    /// Allocate storage for an object and create default.
+    //*************************************************************************
+    template <typename T>
+    T* create()
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T();
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object and create with 1 parameter.
+    //*************************************************************************
+    template <typename T, typename T1>
+    T* create(const T1& value1)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1);
+      }
+
+      return p;
+    }
+
+    template <typename T, typename T1, typename T2>
+    T* create(const T1& value1, const T2& value2)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2);
+      }
+
+      return p;
+    }
+
+    template <typename T, typename T1, typename T2, typename T3>
+    T* create(const T1& value1, const T2& value2, const T3& value3)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2, value3);
+      }
+
+      return p;
+    }
+
+    template <typename T, typename T1, typename T2, typename T3, typename T4>
+    T* create(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2, value3, value4);
+      }
+
+      return p;
+    }
+#else
+    //*************************************************************************
+    /// Emplace with variadic constructor parameters.
+    //*************************************************************************
+    template <typename T, typename... Args>
+    T* create(Args&&... args)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(std::forward<Args>(args)...);
+      }
+
+      return p;
+    }
+#endif
+
+    //*************************************************************************
+    /// Destroys the object.
+    /// \param p_object A pointer to the object to be destroyed.
+    //*************************************************************************
+    template <typename T>
+    void destroy(const void* const p_object)
+    {
+      reinterpret_cast<T*>((const_cast<void*>(p_object)))->~T();
+      release(p_object);
+    }
+
+    //*************************************************************************
+    /// Release an object.
+    /// The object may have been allocated by any magazine of the same pool.
+    /// If asserts or exceptions are enabled and the object does not belong to the
+    /// pool then an etl::pool_object_not_in_pool is thrown.
+    //*************************************************************************
+    void release(const void* const p_object)
+    {
+      ETL_ASSERT(pool.is_in_pool(p_object), ETL_ERROR(pool_object_not_in_pool));
+
+      if (count == CAPACITY)
+      {
+        // Return the oldest half to the pool.
+        pool.release_n(items, HALF);
+
+        for (size_t i = HALF; i < CAPACITY; ++i)
+        {
+          items[i - HALF] = items[i];
+        }
+
+        count -= HALF;
+      }
+
+      items[count++] = const_cast<void*>(p_object);
+    }
+
+    //*************************************************************************
+    /// Returns all cached items to the pool.
+    //*************************************************************************
+    void flush()
+    {
+      pool.release_n(items, count);
+      count = 0;
+    }
+
+    //*************************************************************************
+    /// The number of items currently cached.
+    //*************************************************************************
+    size_t size() const
+    {
+      return count;
+    }
+
+    //*************************************************************************
+    /// The maximum number of items that may be cached.
+    //*************************************************************************
+    size_t capacity() const
+    {
+      return CAPACITY;
+    }
+
+  private:
+
+    static const size_t HALF = CAPACITY / 2;
+
+    //*************************************************************************
+    /// Allocate an item, refilling from the pool if necessary.
+    //*************************************************************************
+    void* allocate_item()
+    {
+      if (count == 0)
+      {
+        count = pool.allocate_n(items, HALF);
+
+        if (count == 0)
+        {
+          ETL_ASSERT(false, ETL_ERROR(pool_no_allocation));
+          return nullptr;
+        }
+      }
+
+      return items[--count];
+    }
+
+    // Should not be copied.
+    pool_magazine(const pool_magazine&);
+    pool_magazine& operator =(const pool_magazine&);
+
+    etl::ipool_concurrent& pool;
+    size_t                 count;
+    void*                  items[CAPACITY];
+  };
+}
+
+#undef ETL_FILE
+
+#endif
+
+#endif
@@ -0,0 +1,1021 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BTREE_INCLUDED
+#define ETL_BTREE_INCLUDED
+
+///\ingroup private
+
+#include <stddef.h>
+#include <stdint.h>
+#include <new>
+
+#include "../platform.h"
+#include "../alignment.h"
+#include "../pool.h"
+#include "../nullptr.h"
+
+#include "../stl/algorithm.h"
+#include "../stl/utility.h"
+
+namespace etl
+{
+  namespace private_btree
+  {
+    //*************************************************************************
+    /// The target size of a node in bytes.
+    //*************************************************************************
+    static const size_t NODE_BYTES = 256;
+
+    //*************************************************************************
+    /// Limits a node capacity to [MINIMUM, 64].
+    //*************************************************************************
+    template <size_t N, size_t MINIMUM>
+    struct clamp_capacity
+    {
+      static const size_t value = (N < MINIMUM) ? MINIMUM : ((N > 64) ? 64 : N);
+    };
+
+    //*************************************************************************
+    /// The maximum number of values in a leaf and the minimum in a leaf that
+    /// is not the root.
+    //*************************************************************************
+    template <typename TValue>
+    struct leaf_capacity
+    {
+      static const size_t value   = clamp_capacity<NODE_BYTES / sizeof(TValue), 4>::value;
+      static const size_t minimum = value / 2;
+    };
+
+    //*************************************************************************
+    /// The maximum number of keys in an internal node and the minimum in an
+    /// internal node that is not the root.
+    //*************************************************************************
+    template <typename TKey>
+    struct internal_capacity
+    {
+      static const size_t value   = clamp_capacity<NODE_BYTES / (sizeof(TKey) + sizeof(void*)), 8>::value;
+      static const size_t minimum = (value - 1) / 2;
+    };
+
+    //*************************************************************************
+    /// The maximum number of internal nodes above N nodes, when every node
+    /// that is not the root has at least MIN_CHILDREN children.
+    //*************************************************************************
+    template <size_t N, size_t MIN_CHILDREN>
+    struct internal_node_count
+    {
+      static const size_t parents = (N / MIN_CHILDREN) + 1;
+      static const size_t value   = parents + internal_node_count<parents, MIN_CHILDREN>::value;
+    };
+
+    template <size_t MIN_CHILDREN>
+    struct internal_node_count<1, MIN_CHILDREN>
+    {
+      static const size_t value = 0;
+    };
+
+    template <size_t MIN_CHILDREN>
+    struct internal_node_count<0, MIN_CHILDREN>
+    {
+      static const size_t value = 0;
+    };
+
+    //*************************************************************************
+    /// The number of nodes of each type needed for MAX_SIZE values.
+    /// One more internal node than needed is reserved, so that the pool is never empty.
+    //*************************************************************************
+    template <typename TKey, typename TValue, size_t MAX_SIZE>
+    struct node_count
+    {
+      static const size_t leaves    = (MAX_SIZE / leaf_capacity<TValue>::minimum) + 1;
+      static const size_t internals = etl::private_btree::internal_node_count<leaves, internal_capacity<TKey>::minimum + 1>::value + 1;
+    };
+
+    //*************************************************************************
+    /// The key of a key/value pair.
+    //*************************************************************************
+    template <typename TKey, typename TValue>
+    struct key_of_pair
+    {
+      static const TKey& get(const TValue& value)
+      {
+        return value.first;
+      }
+    };
+
+    //*************************************************************************
+    /// The value is the key.
+    //*************************************************************************
+    template <typename TKey>
+    struct key_of_value
+    {
+      static const TKey& get(const TKey& value)
+      {
+        return value;
+      }
+    };
+
+    //*************************************************************************
+    /// Moves an object to uninitialised storage and destroys the original.
+    //*************************************************************************
+    template <typename T>
+    void relocate(T* p_destination, T* p_source)
+    {
+      ::new (p_destination) T(*p_source);
+      p_source->~T();
+    }
+
+    //*************************************************************************
+    /// Opens a gap at 'index' in an array of 'count' objects.
+    //*************************************************************************
+    template <typename T>
+    void open_gap(T* p, size_t index, size_t count)
+    {
+      for (size_t i = count; i > index; --i)
+      {
+        relocate(p + i, p + i - 1);
+      }
+    }
+
+    //*************************************************************************
+    /// Closes the gap at 'index', whose object has been destroyed, in an
+    /// array that held 'count' objects.
+    //*************************************************************************
+    template <typename T>
+    void close_gap(T* p, size_t index, size_t count)
+    {
+      for (size_t i = index + 1; i < count; ++i)
+      {
+        relocate(p + i - 1, p + i);
+      }
+    }
+
+    //*************************************************************************
+    /// Moves 'n' objects to uninitialised storage.
+    //*************************************************************************
+    template <typename T>
+    void relocate_n(T* p_destination, T* p_source, size_t n)
+    {
+      for (size_t i = 0; i < n; ++i)
+      {
+        relocate(p_destination + i, p_source + i);
+      }
+    }
+
+    //*************************************************************************
+    /// A B+tree with a fixed capacity, whose nodes are taken from pools.
+    /// The values are held in the leaves, which are linked in order.
+    /// The internal nodes hold copies of keys that separate their children.
+    ///\tparam TKey     The key type.
+    ///\tparam TValue   The value type.
+    ///\tparam TKeyOf   Gets the key from a value with a static get().
+    ///\tparam TCompare Compares keys.
+    //*************************************************************************
+    template <typename TKey, typename TValue, typename TKeyOf, typename TCompare>
+    class tree
+    {
+    public:
+
+      static const size_t LEAF_CAPACITY     = leaf_capacity<TValue>::value;
+      static const size_t LEAF_MINIMUM      = leaf_capacity<TValue>::minimum;
+      static const size_t INTERNAL_CAPACITY = internal_capacity<TKey>::value;
+      static const size_t INTERNAL_MINIMUM  = internal_capacity<TKey>::minimum;
+
+      struct internal_node;
+
+      //***********************************
+      /// The common part of all nodes.
+      //***********************************
+      struct node
+      {
+        internal_node* parent;
+        size_t         count;
+        bool           is_leaf;
+      };
+
+      //***********************************
+      /// A leaf holds up to LEAF_CAPACITY values.
+      //***********************************
+      struct leaf_node : public node
+      {
+        TValue* values()
+        {
+          return reinterpret_cast<TValue*>(&storage);
+        }
+
+        const TValue* values() const
+        {
+          return reinterpret_cast<const TValue*>(&storage);
+        }
+
+        leaf_node* previous;
+        leaf_node* next;
+        typename etl::aligned_storage<sizeof(TValue) * LEAF_CAPACITY, etl::alignment_of<TValue>::value>::type storage;
+      };
+
+      //***********************************
+      /// An internal node holds up to INTERNAL_CAPACITY keys and one more child.
+      /// All values under children[i] are not less than keys[i - 1] and are less than keys[i].
+      //***********************************
+      struct internal_node : public node
+      {
+        TKey* keys()
+        {
+          return reinterpret_cast<TKey*>(&storage);
+        }
+
+        const TKey* keys() const
+        {
+          return reinterpret_cast<const TKey*>(&storage);
+        }
+
+        node* children[INTERNAL_CAPACITY + 1];
+        typename etl::aligned_storage<sizeof(TKey) * INTERNAL_CAPACITY, etl::alignment_of<TKey>::value>::type storage;
+      };
+
+      //***********************************
+      /// A position in the tree.
+      /// The end position is one past the last value of the last leaf.
+      //***********************************
+      struct position
+      {
+        position()
+          : p_leaf(nullptr),
+            index(0)
+        {
+        }
+
+        position(leaf_node* p_leaf_, size_t index_)
+          : p_leaf(p_leaf_),
+            index(index_)
+        {
+        }
+
+        void increment()
+        {
+          ++index;
+
+          if ((index == p_leaf->count) && (p_leaf->next != nullptr))
+          {
+            p_leaf = p_leaf->next;
+            index  = 0;
+          }
+        }
+
+        void decrement()
+        {
+          if (index == 0)
+          {
+            p_leaf = p_leaf->previous;
+            index  = p_leaf->count;
+          }
+
+          --index;
+        }
+
+        TValue& value() const
+        {
+          return p_leaf->values()[index];
+        }
+
+        friend bool operator ==(const position& lhs, const position& rhs)
+        {
+          return (lhs.p_leaf == rhs.p_leaf) && (lhs.index == rhs.index);
+        }
+
+        friend bool operator !=(const position& lhs, const position& rhs)
+        {
+          return !(lhs == rhs);
+        }
+
+        leaf_node* p_leaf;
+        size_t     index;
+      };
+
+      //***********************************
+      tree(etl::ipool& leaf_pool_, etl::ipool& internal_pool_, size_t max_size_)
+        : leaf_pool(leaf_pool_),
+          internal_pool(internal_pool_),
+          p_root(nullptr),
+          p_first(nullptr),
+          p_last(nullptr),
+          current_size(0),
+          maximum_size(max_size_)
+      {
+      }
+
+      //***********************************
+      size_t size() const
+      {
+        return current_size;
+      }
+
+      //***********************************
+      size_t max_size() const
+      {
+        return maximum_size;
+      }
+
+      //***********************************
+      position begin() const
+      {
+        return position(p_first, 0);
+      }
+
+      //***********************************
+      position end() const
+      {
+        return (p_last == nullptr) ? position() : position(p_last, p_last->count);
+      }
+
+      //***********************************
+      /// The position of the first value whose key is not less than 'key'.
+      //***********************************
+      position lower_bound(const TKey& key) const
+      {
+        if (p_root == nullptr)
+        {
+          return end();
+        }
+
+        leaf_node* p_leaf = find_leaf(key);
+
+        const TValue* p_values = p_leaf->values();
+        size_t index = std::lower_bound(p_values, p_values + p_leaf->count, key, value_key_compare()) - p_values;
+
+        return normalise(position(p_leaf, index));
+      }
+
+      //***********************************
+      /// The position of the first value whose key is greater than 'key'.
+      //***********************************
+      position upper_bound(const TKey& key) const
+      {
+        if (p_root == nullptr)
+        {
+          return end();
+        }
+
+        leaf_node* p_leaf = find_leaf(key);
+
+        const TValue* p_values = p_leaf->values();
+        size_t index = std::upper_bound(p_values, p_values + p_leaf->count, key, key_value_compare()) - p_values;
+
+        return normalise(position(p_leaf, index));
+      }
+
+      //***********************************
+      /// The position of the value with the key, or end().
+      //***********************************
+      position find(const TKey& key) const
+      {
+        position i_element = lower_bound(key);
+
+        if ((i_element != end()) && !compare(key, TKeyOf::get(i_element.value())))
+        {
+          return i_element;
+        }
+
+        return end();
+      }
+
+      //***********************************
+      /// Inserts a value if its key is not already in the tree.
+      /// The caller must have checked that there is room.
+      ///\return The position of the value with the key, and whether it was inserted.
+      //***********************************
+      std::pair<position, bool> insert_unique(const TValue& value)
+      {
+        const TKey& key = TKeyOf::get(value);
+
+        if (p_root == nullptr)
+        {
+          leaf_node* p_leaf = create_leaf();
+          p_root  = p_leaf;
+          p_first = p_leaf;
+          p_last  = p_leaf;
+        }
+
+        leaf_node* p_leaf = find_leaf(key);
+        TValue* p_values  = p_leaf->values();
+        size_t index      = std::lower_bound(p_values, p_values + p_leaf->count, key, value_key_compare()) - p_values;
+
+        if ((index != p_leaf->count) && !compare(key, TKeyOf::get(p_values[index])))
+        {
+          return std::pair<position, bool>(position(p_leaf, index), false);
+        }
+
+        if (p_leaf->count == LEAF_CAPACITY)
+        {
+          leaf_node* p_right = split_leaf(p_leaf);
+
+          if (index > p_leaf->count)
+          {
+            index -= p_leaf->count;
+            p_leaf = p_right;
+          }
+        }
+
+        open_gap(p_leaf->values(), index, p_leaf->count);
+        ::new (p_leaf->values() + index) TValue(value);
+        ++p_leaf->count;
+        ++current_size;
+
+        return std::pair<position, bool>(position(p_leaf, index), true);
+      }
+
+      //***********************************
+      /// Erases the value at the position.
+      ///\return The position of the next value.
+      //***********************************
+      position erase(position i_element)
+      {
+        // Remember the next key, as rebalancing may move values between leaves.
+        position i_next = i_element;
+        i_next.increment();
+
+        const bool is_last = (i_next == end());
+
+        typename etl::aligned_storage<sizeof(TKey), etl::alignment_of<TKey>::value>::type next_key_storage;
+        TKey* p_next_key = reinterpret_cast<TKey*>(&next_key_storage);
+
+        if (!is_last)
+        {
+          ::new (p_next_key) TKey(TKeyOf::get(i_next.value()));
+        }
+
+        erase_at(i_element.p_leaf, i_element.index);
+
+        if (is_last)
+        {
+          return end();
+        }
+
+        position result = lower_bound(*p_next_key);
+        p_next_key->~TKey();
+
+        return result;
+      }
+
+      //***********************************
+      /// Erases the value with the key.
+      ///\return 1 if erased, otherwise 0.
+      //***********************************
+      size_t erase(const TKey& key)
+      {
+        position i_element = find(key);
+
+        if (i_element == end())
+        {
+          return 0;
+        }
+
+        erase_at(i_element.p_leaf, i_element.index);
+
+        return 1;
+      }
+
+      //***********************************
+      /// Erases all values.
+      //***********************************
+      void clear()
+      {
+        if (p_root != nullptr)
+        {
+          destroy(p_root);
+        }
+
+        p_root       = nullptr;
+        p_first      = nullptr;
+        p_last       = nullptr;
+        current_size = 0;
+      }
+
+    private:
+
+      //***********************************
+      /// Compares a value with a key, for lower_bound.
+      //***********************************
+      struct value_key_compare
+      {
+        bool operator ()(const TValue& value, const TKey& key) const
+        {
+          return TCompare()(TKeyOf::get(value), key);
+        }
+      };
+
+      //***********************************
+      /// Compares a key with a value, for upper_bound.
+      //***********************************
+      struct key_value_compare
+      {
+        bool operator ()(const TKey& key, const TValue& value) const
+        {
+          return TCompare()(key, TKeyOf::get(value));
+        }
+      };
+
+      //***********************************
+      bool compare(const TKey& lhs, const TKey& rhs) const
+      {
+        return TCompare()(lhs, rhs);
+      }
+
+      //***********************************
+      /// Moves a position past the end of a leaf to the start of the next.
+      //***********************************
+      static position normalise(position i_element)
+      {
+        if ((i_element.index == i_element.p_leaf->count) && (i_element.p_leaf->next != nullptr))
+        {
+          i_element.p_leaf = i_element.p_leaf->next;
+          i_element.index  = 0;
+        }
+
+        return i_element;
+      }
+
+      //***********************************
+      /// Finds the leaf that would hold the key.
+      //***********************************
+      leaf_node* find_leaf(const TKey& key) const
+      {
+        node* p_node = p_root;
+
+        while (!p_node->is_leaf)
+        {
+          internal_node* p_internal = static_cast<internal_node*>(p_node);
+          const TKey*    p_keys     = p_internal->keys();
+
+          size_t index = std::upper_bound(p_keys, p_keys + p_internal->count, key, TCompare()) - p_keys;
+
+          p_node = p_internal->children[index];
+        }
+
+        return static_cast<leaf_node*>(p_node);
+      }
+
+      //***********************************
+      leaf_node* create_leaf()
+      {
+        leaf_node* p_leaf = leaf_pool.allocate<leaf_node>();
+        ::new (p_leaf) leaf_node();
+
+        p_leaf->parent   = nullptr;
+        p_leaf->count    = 0;
+        p_leaf->is_leaf  = true;
+        p_leaf->previous = nullptr;
+        p_leaf->next     = nullptr;
+
+        return p_leaf;
+      }
+
+      //***********************************
+      internal_node* create_internal()
+      {
+        internal_node* p_internal = internal_pool.allocate<internal_node>();
+        ::new (p_internal) internal_node();
+
+        p_internal->parent  = nullptr;
+        p_internal->count   = 0;
+        p_internal->is_leaf = false;
+
+        return p_internal;
+      }
+
+      //***********************************
+      /// Destroys a node, its children and their values.
+      //***********************************
+      void destroy(node* p_node)
+      {
+        if (p_node->is_leaf)
+        {
+          leaf_node* p_leaf = static_cast<leaf_node*>(p_node);
+
+          for (size_t i = 0; i < p_leaf->count; ++i)
+          {
+            p_leaf->values()[i].~TValue();
+          }
+
+          p_leaf->~leaf_node();
+          leaf_pool.release(p_leaf);
+        }
+        else
+        {
+          internal_node* p_internal = static_cast<internal_node*>(p_node);
+
+          for (size_t i = 0; i <= p_internal->count; ++i)
+          {
+            destroy(p_internal->children[i]);
+          }
+
+          for (size_t i = 0; i < p_internal->count; ++i)
+          {
+            p_internal->keys()[i].~TKey();
+          }
+
+          p_internal->~internal_node();
+          internal_pool.release(p_internal);
+        }
+      }
+
+      //***********************************
+      /// Returns the index of the child in its parent.
+      //***********************************
+      static size_t child_index(const node* p_child)
+      {
+        const internal_node* p_parent = p_child->parent;
+
+        size_t index = 0;
+
+        while (p_parent->children[index] != p_child)
+        {
+          ++index;
+        }
+
+        return index;
+      }
+
+      //***********************************
+      /// Inserts a key and child to an internal node that is not full.
+      /// The child goes to the right of the key.
+      //***********************************
+      static void insert_child(internal_node* p_internal, size_t index, const TKey& key, node* p_child)
+      {
+        open_gap(p_internal->keys(), index, p_internal->count);
+        ::new (p_internal->keys() + index) TKey(key);
+
+        for (size_t i = p_internal->count + 1; i > (index + 1); --i)
+        {
+          p_internal->children[i] = p_internal->children[i - 1];
+        }
+
+        p_internal->children[index + 1] = p_child;
+        p_child->parent = p_internal;
+        ++p_internal->count;
+      }
+
+      //***********************************
+      /// Removes the key at 'index' and the child to its right.
+      //***********************************
+      static void remove_child(internal_node* p_internal, size_t index)
+      {
+        p_internal->keys()[index].~TKey();
+        close_gap(p_internal->keys(), index, p_internal->count);
+
+        for (size_t i = index + 1; i < p_internal->count; ++i)
+        {
+          p_internal->children[i] = p_internal->children[i + 1];
+        }
+
+        --p_internal->count;
+      }
+
+      //***********************************
+      /// Moves the upper half of a full leaf to a new leaf on its right.
+      ///\return The new leaf.
+      //***********************************
+      leaf_node* split_leaf(leaf_node* p_leaf)
+      {
+        leaf_node* p_right = create_leaf();
+
+        const size_t n_right = LEAF_CAPACITY / 2;
+        const size_t n_left  = LEAF_CAPACITY - n_right;
+
+        relocate_n(p_right->values(), p_leaf->values() + n_left, n_right);
+        p_right->count = n_right;
+        p_leaf->count  = n_left;
+
+        p_right->previous = p_leaf;
+        p_right->next     = p_leaf->next;
+
+        if (p_leaf->next != nullptr)
+        {
+          p_leaf->next->previous = p_right;
+        }
+        else
+        {
+          p_last = p_right;
+        }
+
+        p_leaf->next = p_right;
+
+        insert_in_parent(p_leaf, TKeyOf::get(p_right->values()[0]), p_right);
+
+        return p_right;
+      }
+
+      //***********************************
+      /// Adds a new right sibling, and the key that separates it, to the parent.
+      /// Splits full parents on the way up.
+      //***********************************
+      void insert_in_parent(node* p_left, const TKey& key, node* p_right)
+      {
+        internal_node* p_parent = p_left->parent;
+
+        if (p_parent == nullptr)
+        {
+          // A new root.
+          internal_node* p_internal = create_internal();
+
+          ::new (p_internal->keys()) TKey(key);
+          p_internal->children[0] = p_left;
+          p_internal->children[1] = p_right;
+          p_internal->count       = 1;
+          p_left->parent          = p_internal;
+          p_right->parent         = p_internal;
+          p_root                  = p_internal;
+
+          return;
+        }
+
+        size_t index = child_index(p_left);
+
+        if (p_parent->count < INTERNAL_CAPACITY)
+        {
+          insert_child(p_parent, index, key, p_right);
+          return;
+        }
+
+        // Split the parent. The key at 'middle' moves up.
+        internal_node* p_sibling = create_internal();
+
+        const size_t middle = INTERNAL_CAPACITY / 2;
+        const size_t n_moved = INTERNAL_CAPACITY - middle - 1;
+
+        relocate_n(p_sibling->keys(), p_parent->keys() + middle + 1, n_moved);
+
+        for (size_t i = 0; i <= n_moved; ++i)
+        {
+          p_sibling->children[i] = p_parent->children[middle + 1 + i];
+          p_sibling->children[i]->parent = p_sibling;
+        }
+
+        p_sibling->count = n_moved;
+
+        typename etl::aligned_storage<sizeof(TKey), etl::alignment_of<TKey>::value>::type up_key_storage;
+        TKey* p_up_key = reinterpret_cast<TKey*>(&up_key_storage);
+        relocate(p_up_key, p_parent->keys() + middle);
+
+        p_parent->count = middle;
+
+        if (index <= middle)
+        {
+          insert_child(p_parent, index, key, p_right);
+        }
+        else
+        {
+          insert_child(p_sibling, index - middle - 1, key, p_right);
+        }
+
+        insert_in_parent(p_parent, *p_up_key, p_sibling);
+
+        p_up_key->~TKey();
+      }
+
+      //***********************************
+      /// Erases the value at the index in the leaf and rebalances.
+      //***********************************
+      void erase_at(leaf_node* p_leaf, size_t index)
+      {
+        p_leaf->values()[index].~TValue();
+        close_gap(p_leaf->values(), index, p_leaf->count);
+        --p_leaf->count;
+        --current_size;
+
+        if (p_leaf == p_root)
+        {
+          if (p_leaf->count == 0)
+          {
+            p_leaf->~leaf_node();
+            leaf_pool.release(p_leaf);
+            p_root  = nullptr;
+            p_first = nullptr;
+            p_last  = nullptr;
+          }
+        }
+        else if (p_leaf->count < LEAF_MINIMUM)
+        {
+          rebalance_leaf(p_leaf);
+        }
+      }
+
+      //***********************************
+      /// Refills a leaf that is below the minimum from a sibling, or merges them.
+      //***********************************
+      void rebalance_leaf(leaf_node* p_leaf)
+      {
+        internal_node* p_parent = p_leaf->parent;
+        size_t index = child_index(p_leaf);
+
+        leaf_node* p_left  = (index > 0)               ? static_cast<leaf_node*>(p_parent->children[index - 1]) : nullptr;
+        leaf_node* p_right = (index < p_parent->count) ? static_cast<leaf_node*>(p_parent->children[index + 1]) : nullptr;
+
+        if ((p_left != nullptr) && (p_left->count > LEAF_MINIMUM))
+        {
+          // Take the last value of the left sibling.
+          open_gap(p_leaf->values(), 0, p_leaf->count);
+          relocate(p_leaf->values(), p_left->values() + p_left->count - 1);
+          --p_left->count;
+          ++p_leaf->count;
+
+          p_parent->keys()[index - 1] = TKeyOf::get(p_leaf->values()[0]);
+        }
+        else if ((p_right != nullptr) && (p_right->count > LEAF_MINIMUM))
+        {
+          // Take the first value of the right sibling.
+          relocate(p_leaf->values() + p_leaf->count, p_right->values());
+          close_gap(p_right->values(), 0, p_right->count);
+          --p_right->count;
+          ++p_leaf->count;
+
+          p_parent->keys()[index] = TKeyOf::get(p_right->values()[0]);
+        }
+        else if (p_left != nullptr)
+        {
+          merge_leaves(p_left, p_leaf, index - 1);
+        }
+        else
+        {
+          merge_leaves(p_leaf, p_right, index);
+        }
+      }
+
+      //***********************************
+      /// Moves all of the values of the right leaf to the left and removes the right.
+      ///\param key_index The index of the key between them in the parent.
+      //***********************************
+      void merge_leaves(leaf_node* p_left, leaf_node* p_right, size_t key_index)
+      {
+        relocate_n(p_left->values() + p_left->count, p_right->values(), p_right->count);
+        p_left->count += p_right->count;
+
+        p_left->next = p_right->next;
+
+        if (p_right->next != nullptr)
+        {
+          p_right->next->previous = p_left;
+        }
+        else
+        {
+          p_last = p_left;
+        }
+
+        p_right->~leaf_node();
+        leaf_pool.release(p_right);
+
+        internal_node* p_parent = p_left->parent;
+        remove_child(p_parent, key_index);
+
+        rebalance_internal(p_parent);
+      }
+
+      //***********************************
+      /// Restores the minimum number of keys in an internal node.
+      //***********************************
+      void rebalance_internal(internal_node* p_internal)
+      {
+        if (p_internal == p_root)
+        {
+          if (p_internal->count == 0)
+          {
+            // The tree loses a level.
+            p_root = p_internal->children[0];
+            p_root->parent = nullptr;
+
+            p_internal->~internal_node();
+            internal_pool.release(p_internal);
+          }
+
+          return;
+        }
+
+        if (p_internal->count >= INTERNAL_MINIMUM)
+        {
+          return;
+        }
+
+        internal_node* p_parent = p_internal->parent;
+        size_t index = child_index(p_internal);
+
+        internal_node* p_left  = (index > 0)               ? static_cast<internal_node*>(p_parent->children[index - 1]) : nullptr;
+        internal_node* p_right = (index < p_parent->count) ? static_cast<internal_node*>(p_parent->children[index + 1]) : nullptr;
+
+        if ((p_left != nullptr) && (p_left->count > INTERNAL_MINIMUM))
+        {
+          // Rotate right through the parent.
+          open_gap(p_internal->keys(), 0, p_internal->count);
+          relocate(p_internal->keys(), p_parent->keys() + index - 1);
+          relocate(p_parent->keys() + index - 1, p_left->keys() + p_left->count - 1);
+
+          for (size_t i = p_internal->count + 1; i > 0; --i)
+          {
+            p_internal->children[i] = p_internal->children[i - 1];
+          }
+
+          p_internal->children[0] = p_left->children[p_left->count];
+          p_internal->children[0]->parent = p_internal;
+
+          --p_left->count;
+          ++p_internal->count;
+        }
+        else if ((p_right != nullptr) && (p_right->count > INTERNAL_MINIMUM))
+        {
+          // Rotate left through the parent.
+          relocate(p_internal->keys() + p_internal->count, p_parent->keys() + index);
+          relocate(p_parent->keys() + index, p_right->keys());
+          close_gap(p_right->keys(), 0, p_right->count);
+
+          p_internal->children[p_internal->count + 1] = p_right->children[0];
+          p_internal->children[p_internal->count + 1]->parent = p_internal;
+
+          for (size_t i = 0; i < p_right->count; ++i)
+          {
+            p_right->children[i] = p_right->children[i + 1];
+          }
+
+          --p_right->count;
+          ++p_internal->count;
+        }
+        else if (p_left != nullptr)
+        {
+          merge_internals(p_left, p_internal, index - 1);
+        }
+        else
+        {
+          merge_internals(p_internal, p_right, index);
+        }
+      }
+
+      //***********************************
+      /// Moves the separating key and all of the right node to the left node
+      /// and removes the right.
+      ///\param key_index The index of the key between them in the parent.
+      //***********************************
+      void merge_internals(internal_node* p_left, internal_node* p_right, size_t key_index)
+      {
+        internal_node* p_parent = p_left->parent;
+
+        ::new (p_left->keys() + p_left->count) TKey(p_parent->keys()[key_index]);
+        relocate_n(p_left->keys() + p_left->count + 1, p_right->keys(), p_right->count);
+
+        for (size_t i = 0; i <= p_right->count; ++i)
+        {
+          p_left->children[p_left->count + 1 + i] = p_right->children[i];
+          p_right->children[i]->parent = p_left;
+        }
+
+        p_left->count += p_right->count + 1;
+
+        p_right->~internal_node();
+        internal_pool.release(p_right);
+
+        remove_child(p_parent, key_index);
+
+        rebalance_internal(p_parent);
+      }
+
+      // Disable copy construction and assignment.
+      tree(const tree&);
+      tree& operator =(const tree&);
+
+      etl::ipool&    leaf_pool;
+      etl::ipool&    internal_pool;
+      node*          p_root;
+      leaf_node*     p_first;
+      leaf_node*     p_last;
+      size_t         current_size;
+      const size_t   maximum_size;
+    };
+  }
+}
+
+#endif
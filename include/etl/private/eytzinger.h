@@ -0,0 +1,147 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_EYTZINGER_INCLUDED
+#define ETL_EYTZINGER_INCLUDED
+
+///\ingroup private
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "../platform.h"
+#include "../binary.h"
+
+namespace etl
+{
+  namespace private_eytzinger
+  {
+    //*************************************************************************
+    /// Hints to the processor that the address will soon be read.
+    /// The address is formed with integer arithmetic as it may be past the
+    /// end of the keys. Prefetching an invalid address does not fault.
+    //*************************************************************************
+    inline void prefetch(const void* p_base, size_t offset)
+    {
+#if defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)
+      __builtin_prefetch(reinterpret_cast<const void*>(reinterpret_cast<uintptr_t>(p_base) + offset));
+#else
+      (void)p_base;
+      (void)offset;
+#endif
+    }
+
+    //*************************************************************************
+    /// The number of keys in a 64 byte cache line, for prefetching the
+    /// descendants four levels down.
+    //*************************************************************************
+    template <typename TKey>
+    struct keys_per_line
+    {
+      static const size_t value = (sizeof(TKey) >= 64) ? 1 : (64 / sizeof(TKey));
+    };
+
+    //*************************************************************************
+    /// Fills the Eytzinger (breadth first) ordered keys from the sorted values
+    /// by an in-order walk of the implicit tree.
+    /// The keys and ranks are 1 based. rank[k] is the sorted index of keys[k].
+    ///\return The next sorted index.
+    //*************************************************************************
+    template <typename TKey, typename TValue, typename TKeyOf>
+    size_t build(TKey* p_keys, size_t* p_ranks, const TValue* p_sorted, size_t n, size_t index, size_t k, TKeyOf key_of)
+    {
+      if (k <= n)
+      {
+        index = build(p_keys, p_ranks, p_sorted, n, index, 2 * k, key_of);
+
+        p_keys[k]  = key_of(p_sorted[index]);
+        p_ranks[k] = index;
+        ++index;
+
+        index = build(p_keys, p_ranks, p_sorted, n, index, (2 * k) + 1, key_of);
+      }
+
+      return index;
+    }
+
+    //*************************************************************************
+    /// Converts the final position of a descent into the sorted index.
+    /// The descent went right at every set bit after the last clear one, so
+    /// the answer is the node where it last went left.
+    //*************************************************************************
+    inline size_t to_rank(const size_t* p_ranks, size_t n, size_t k)
+    {
+      k >>= etl::count_trailing_zeros(uint64_t(~k)) + 1;
+
+      return (k == 0) ? n : p_ranks[k];
+    }
+
+    //*************************************************************************
+    /// Returns the sorted index of the first key not less than 'key'.
+    /// The only branch is the loop, which runs for the height of the tree.
+    //*************************************************************************
+    template <typename TKey, typename TCompare>
+    size_t lower_bound(const TKey* p_keys, const size_t* p_ranks, size_t n, const TKey& key, TCompare compare)
+    {
+      const size_t LINE = keys_per_line<TKey>::value;
+
+      size_t k = 1;
+
+      while (k <= n)
+      {
+        prefetch(p_keys, k * LINE * sizeof(TKey));
+        k = (2 * k) + size_t(compare(p_keys[k], key));
+      }
+
+      return to_rank(p_ranks, n, k);
+    }
+
+    //*************************************************************************
+    /// Returns the sorted index of the first key greater than 'key'.
+    //*************************************************************************
+    template <typename TKey, typename TCompare>
+    size_t upper_bound(const TKey* p_keys, const size_t* p_ranks, size_t n, const TKey& key, TCompare compare)
+    {
+      const size_t LINE = keys_per_line<TKey>::value;
+
+      size_t k = 1;
+
+      while (k <= n)
+      {
+        prefetch(p_keys, k * LINE * sizeof(TKey));
+        k = (2 * k) + size_t(!compare(key, p_keys[k]));
+      }
+
+      return to_rank(p_ranks, n, k);
+    }
+  }
+}
+
+#endif
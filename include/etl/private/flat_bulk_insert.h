@@ -0,0 +1,156 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FLAT_BULK_INSERT_INCLUDED
+#define ETL_FLAT_BULK_INSERT_INCLUDED
+
+///\ingroup private
+
+#include <stddef.h>
+
+#include "../platform.h"
+#include "../algorithm.h"
+
+namespace etl
+{
+  namespace private_flat
+  {
+    //*************************************************************************
+    /// Compares two pairs by their keys.
+    //*************************************************************************
+    template <typename TKeyCompare>
+    struct pair_key_compare
+    {
+      template <typename TPair>
+      bool operator ()(const TPair& lhs, const TPair& rhs) const
+      {
+        return compare(lhs.first, rhs.first);
+      }
+
+      TKeyCompare compare;
+    };
+
+    //*************************************************************************
+    /// Compares the values that two lookup entries point to.
+    //*************************************************************************
+    template <typename TValueCompare>
+    struct pointer_compare
+    {
+      explicit pointer_compare(TValueCompare compare_)
+        : compare(compare_)
+      {
+      }
+
+      template <typename TPointer>
+      bool operator ()(TPointer lhs, TPointer rhs) const
+      {
+        return compare(*lhs, *rhs);
+      }
+
+      TValueCompare compare;
+    };
+
+    //*************************************************************************
+    /// Merges the entries appended to a flat container's lookup into the
+    /// sorted entries before them, in one linear pass where possible.
+    /// The unused capacity of the lookup is the scratch buffer for the sort
+    /// and the merge, so nothing is allocated.
+    /// For unique containers, an appended entry whose key is already in the
+    /// container, or appeared earlier in the batch, is rejected and moved to
+    /// the end of the lookup.
+    ///\param lookup    The lookup vector.
+    ///\param n_sorted  The number of sorted entries before the appended ones.
+    ///\param is_sorted Are the appended entries already sorted?
+    ///\param is_unique Must keys be unique?
+    ///\param compare   Compares two values.
+    ///\return The number of rejected entries at the end of the lookup.
+    //*************************************************************************
+    template <typename TLookup, typename TValueCompare>
+    size_t merge_appended(TLookup& lookup, size_t n_sorted, bool is_sorted, bool is_unique, TValueCompare compare)
+    {
+      typedef typename TLookup::value_type pointer_t;
+      typedef typename TLookup::iterator   iterator;
+
+      pointer_compare<TValueCompare> pcompare(compare);
+
+      const size_t size = lookup.size();
+
+      // Use the free capacity as the buffer.
+      lookup.resize(lookup.capacity(), pointer_t());
+
+      iterator  first      = lookup.begin();
+      iterator  first_new  = first + n_sorted;
+      iterator  last_new   = first + size;
+      iterator  buffer     = last_new;
+      ptrdiff_t buffer_length = lookup.end() - buffer;
+
+      if (!is_sorted && !etl::is_sorted(first_new, last_new, pcompare))
+      {
+        etl::stable_sort(first_new, last_new, buffer, lookup.end(), pcompare);
+      }
+
+      iterator kept_end = last_new;
+
+      if (is_unique)
+      {
+        iterator existing = first;
+        kept_end = first_new;
+
+        for (iterator itr = first_new; itr != last_new; ++itr)
+        {
+          while ((existing != first_new) && pcompare(*existing, *itr))
+          {
+            ++existing;
+          }
+
+          bool is_duplicate = ((existing != first_new) && !pcompare(*itr, *existing)) ||
+                              ((kept_end != first_new) && !pcompare(*(kept_end - 1), *itr));
+
+          if (!is_duplicate)
+          {
+            std::iter_swap(kept_end, itr);
+            ++kept_end;
+          }
+        }
+      }
+
+      etl::private_sort::merge_adaptive(first, first_new, kept_end,
+                                        ptrdiff_t(n_sorted), ptrdiff_t(kept_end - first_new),
+                                        buffer, buffer_length,
+                                        pcompare);
+
+      lookup.resize(size);
+
+      return size_t(last_new - kept_end);
+    }
+  }
+}
+
+#endif
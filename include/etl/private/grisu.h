@@ -0,0 +1,593 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_GRISU_INCLUDED
+#define ETL_GRISU_INCLUDED
+
+///\ingroup private
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "../platform.h"
+
+namespace etl
+{
+  //***************************************************************************
+  /// Shortest round trip formatting of floating point values, using the
+  /// Grisu2 algorithm (Florian Loitsch, "Printing Floating-Point Numbers
+  /// Quickly and Accurately with Integers", PLDI 2010).
+  /// The digits produced always read back as the same value and are the
+  /// shortest such digits for the great majority of inputs.
+  //***************************************************************************
+  namespace private_grisu
+  {
+    //*************************************************************************
+    /// A 64 bit significand with a binary exponent. f * 2^e
+    //*************************************************************************
+    struct diy_fp
+    {
+      diy_fp(uint64_t f_, int e_)
+        : f(f_)
+        , e(e_)
+      {
+      }
+
+      uint64_t f;
+      int      e;
+    };
+
+    //*************************************************************************
+    /// x - y. The exponents must be equal and x.f >= y.f.
+    //*************************************************************************
+    inline diy_fp subtract(const diy_fp& x, const diy_fp& y)
+    {
+      return diy_fp(x.f - y.f, x.e);
+    }
+
+    //*************************************************************************
+    /// The upper 64 bits of x * y, rounded.
+    //*************************************************************************
+    inline diy_fp multiply(const diy_fp& x, const diy_fp& y)
+    {
+      const uint64_t x_lo = x.f & 0xFFFFFFFFULL;
+      const uint64_t x_hi = x.f >> 32;
+      const uint64_t y_lo = y.f & 0xFFFFFFFFULL;
+      const uint64_t y_hi = y.f >> 32;
+
+      const uint64_t p0 = x_lo * y_lo;
+      const uint64_t p1 = x_lo * y_hi;
+      const uint64_t p2 = x_hi * y_lo;
+      const uint64_t p3 = x_hi * y_hi;
+
+      uint64_t q = (p0 >> 32) + (p1 & 0xFFFFFFFFULL) + (p2 & 0xFFFFFFFFULL);
+      q += 1ULL << 31;
+
+      return diy_fp(p3 + (p1 >> 32) + (p2 >> 32) + (q >> 32), x.e + y.e + 64);
+    }
+
+    //*************************************************************************
+    /// Shifts the significand until the top bit is set.
+    //*************************************************************************
+    inline diy_fp normalise(diy_fp x)
+    {
+      while ((x.f >> 63) == 0)
+      {
+        x.f <<= 1;
+        --x.e;
+      }
+
+      return x;
+    }
+
+    //*************************************************************************
+    /// Shifts the significand to the supplied (smaller) exponent.
+    //*************************************************************************
+    inline diy_fp normalise_to(const diy_fp& x, int e)
+    {
+      return diy_fp(x.f << (x.e - e), e);
+    }
+
+    //*************************************************************************
+    /// The layout of the IEEE 754 types.
+    //*************************************************************************
+    template <typename T>
+    struct ieee_traits;
+
+    template <>
+    struct ieee_traits<float>
+    {
+      typedef uint32_t bits_type;
+      static const int Precision = 24; // Including the hidden bit.
+      static const int Bias      = 127 + (Precision - 1);
+    };
+
+    template <>
+    struct ieee_traits<double>
+    {
+      typedef uint64_t bits_type;
+      static const int Precision = 53; // Including the hidden bit.
+      static const int Bias      = 1023 + (Precision - 1);
+    };
+
+    //*************************************************************************
+    /// The decoded value and the boundaries of its rounding interval.
+    //*************************************************************************
+    struct boundaries
+    {
+      boundaries(const diy_fp& w_, const diy_fp& minus_, const diy_fp& plus_)
+        : w(w_)
+        , minus(minus_)
+        , plus(plus_)
+      {
+      }
+
+      diy_fp w;
+      diy_fp minus;
+      diy_fp plus;
+    };
+
+    //*************************************************************************
+    /// Decodes a finite, positive value.
+    /// All three results share the same exponent.
+    //*************************************************************************
+    template <typename T>
+    boundaries compute_boundaries(T value)
+    {
+      typedef ieee_traits<T> traits;
+      typedef typename traits::bits_type bits_type;
+
+      const bits_type hidden_bit = bits_type(1) << (traits::Precision - 1);
+
+      bits_type bits;
+      memcpy(&bits, &value, sizeof(bits));
+
+      const uint64_t e = bits >> (traits::Precision - 1);
+      const uint64_t f = bits & (hidden_bit - 1);
+
+      const diy_fp v = (e == 0) ? diy_fp(f, 1 - traits::Bias)
+                                : diy_fp(f + hidden_bit, int(e) - traits::Bias);
+
+      // The lower boundary is closer when the significand is a power of two.
+      const bool lower_is_closer = (f == 0) && (e > 1);
+
+      const diy_fp m_plus  = diy_fp((2 * v.f) + 1, v.e - 1);
+      const diy_fp m_minus = lower_is_closer ? diy_fp((4 * v.f) - 1, v.e - 2)
+                                             : diy_fp((2 * v.f) - 1, v.e - 1);
+
+      const diy_fp w_plus  = normalise(m_plus);
+      const diy_fp w_minus = normalise_to(m_minus, w_plus.e);
+
+      return boundaries(normalise(v), w_minus, w_plus);
+    }
+
+    //*************************************************************************
+    /// The range of binary exponents that the scaled value must land in.
+    //*************************************************************************
+    static const int Alpha = -60;
+    static const int Gamma = -32;
+
+    //*************************************************************************
+    /// A cached power of ten. 10^k ~= f * 2^e
+    //*************************************************************************
+    struct cached_power
+    {
+      uint64_t f;
+      int      e;
+      int      k;
+    };
+
+    //*************************************************************************
+    /// Returns the cached power of ten that scales a value with binary
+    /// exponent 'e' into the range [Alpha, Gamma].
+    //*************************************************************************
+    inline const cached_power& get_cached_power(int e)
+    {
+      static const int Min_Decimal_Exponent = -300;
+      static const int Decimal_Step         = 8;
+
+      static const cached_power powers[] =
+      {
+        { 0xAB70FE17C79AC6CAULL, -1060, -300 },
+        { 0xFF77B1FCBEBCDC4FULL, -1034, -292 },
+        { 0xBE5691EF416BD60CULL, -1007, -284 },
+        { 0x8DD01FAD907FFC3CULL,  -980, -276 },
+        { 0xD3515C2831559A83ULL,  -954, -268 },
+        { 0x9D71AC8FADA6C9B5ULL,  -927, -260 },
+        { 0xEA9C227723EE8BCBULL,  -901, -252 },
+        { 0xAECC49914078536DULL,  -874, -244 },
+        { 0x823C12795DB6CE57ULL,  -847, -236 },
+        { 0xC21094364DFB5637ULL,  -821, -228 },
+        { 0x9096EA6F3848984FULL,  -794, -220 },
+        { 0xD77485CB25823AC7ULL,  -768, -212 },
+        { 0xA086CFCD97BF97F4ULL,  -741, -204 },
+        { 0xEF340A98172AACE5ULL,  -715, -196 },
+        { 0xB23867FB2A35B28EULL,  -688, -188 },
+        { 0x84C8D4DFD2C63F3BULL,  -661, -180 },
+        { 0xC5DD44271AD3CDBAULL,  -635, -172 },
+        { 0x936B9FCEBB25C996ULL,  -608, -164 },
+        { 0xDBAC6C247D62A584ULL,  -582, -156 },
+        { 0xA3AB66580D5FDAF6ULL,  -555, -148 },
+        { 0xF3E2F893DEC3F126ULL,  -529, -140 },
+        { 0xB5B5ADA8AAFF80B8ULL,  -502, -132 },
+        { 0x87625F056C7C4A8BULL,  -475, -124 },
+        { 0xC9BCFF6034C13053ULL,  -449, -116 },
+        { 0x964E858C91BA2655ULL,  -422, -108 },
+        { 0xDFF9772470297EBDULL,  -396, -100 },
+        { 0xA6DFBD9FB8E5B88FULL,  -369,  -92 },
+        { 0xF8A95FCF88747D94ULL,  -343,  -84 },
+        { 0xB94470938FA89BCFULL,  -316,  -76 },
+        { 0x8A08F0F8BF0F156BULL,  -289,  -68 },
+        { 0xCDB02555653131B6ULL,  -263,  -60 },
+        { 0x993FE2C6D07B7FACULL,  -236,  -52 },
+        { 0xE45C10C42A2B3B06ULL,  -210,  -44 },
+        { 0xAA242499697392D3ULL,  -183,  -36 },
+        { 0xFD87B5F28300CA0EULL,  -157,  -28 },
+        { 0xBCE5086492111AEBULL,  -130,  -20 },
+        { 0x8CBCCC096F5088CCULL,  -103,  -12 },
+        { 0xD1B71758E219652CULL,   -77,   -4 },
+        { 0x9C40000000000000ULL,   -50,    4 },
+        { 0xE8D4A51000000000ULL,   -24,   12 },
+        { 0xAD78EBC5AC620000ULL,     3,   20 },
+        { 0x813F3978F8940984ULL,    30,   28 },
+        { 0xC097CE7BC90715B3ULL,    56,   36 },
+        { 0x8F7E32CE7BEA5C70ULL,    83,   44 },
+        { 0xD5D238A4ABE98068ULL,   109,   52 },
+        { 0x9F4F2726179A2245ULL,   136,   60 },
+        { 0xED63A231D4C4FB27ULL,   162,   68 },
+        { 0xB0DE65388CC8ADA8ULL,   189,   76 },
+        { 0x83C7088E1AAB65DBULL,   216,   84 },
+        { 0xC45D1DF942711D9AULL,   242,   92 },
+        { 0x924D692CA61BE758ULL,   269,  100 },
+        { 0xDA01EE641A708DEAULL,   295,  108 },
+        { 0xA26DA3999AEF774AULL,   322,  116 },
+        { 0xF209787BB47D6B85ULL,   348,  124 },
+        { 0xB454E4A179DD1877ULL,   375,  132 },
+        { 0x865B86925B9BC5C2ULL,   402,  140 },
+        { 0xC83553C5C8965D3DULL,   428,  148 },
+        { 0x952AB45CFA97A0B3ULL,   455,  156 },
+        { 0xDE469FBD99A05FE3ULL,   481,  164 },
+        { 0xA59BC234DB398C25ULL,   508,  172 },
+        { 0xF6C69A72A3989F5CULL,   534,  180 },
+        { 0xB7DCBF5354E9BECEULL,   561,  188 },
+        { 0x88FCF317F22241E2ULL,   588,  196 },
+        { 0xCC20CE9BD35C78A5ULL,   614,  204 },
+        { 0x98165AF37B2153DFULL,   641,  212 },
+        { 0xE2A0B5DC971F303AULL,   667,  220 },
+        { 0xA8D9D1535CE3B396ULL,   694,  228 },
+        { 0xFB9B7CD9A4A7443CULL,   720,  236 },
+        { 0xBB764C4CA7A44410ULL,   747,  244 },
+        { 0x8BAB8EEFB6409C1AULL,   774,  252 },
+        { 0xD01FEF10A657842CULL,   800,  260 },
+        { 0x9B10A4E5E9913129ULL,   827,  268 },
+        { 0xE7109BFBA19C0C9DULL,   853,  276 },
+        { 0xAC2820D9623BF429ULL,   880,  284 },
+        { 0x80444B5E7AA7CF85ULL,   907,  292 },
+        { 0xBF21E44003ACDD2DULL,   933,  300 },
+        { 0x8E679C2F5E44FF8FULL,   960,  308 },
+        { 0xD433179D9C8CB841ULL,   986,  316 },
+        { 0x9E19DB92B4E31BA9ULL,  1013,  324 },
+      };
+
+      // ceil((Alpha - e - 1) * log10(2))
+      const int f = Alpha - e - 1;
+      const int k = ((f * 78913) / (1 << 18)) + ((f > 0) ? 1 : 0);
+
+      const size_t index = size_t(-Min_Decimal_Exponent + k + (Decimal_Step - 1)) / Decimal_Step;
+
+      return powers[index];
+    }
+
+    //*************************************************************************
+    /// Finds the largest power of ten <= n.
+    ///\return The number of decimal digits in n.
+    //*************************************************************************
+    inline int find_largest_pow10(uint32_t n, uint32_t& pow10)
+    {
+      static const uint32_t powers[] =
+      {
+        1UL, 10UL, 100UL, 1000UL, 10000UL, 100000UL,
+        1000000UL, 10000000UL, 100000000UL, 1000000000UL
+      };
+
+      int digits = 10;
+
+      while ((digits > 1) && (n < powers[digits - 1]))
+      {
+        --digits;
+      }
+
+      pow10 = powers[digits - 1];
+
+      return digits;
+    }
+
+    //*************************************************************************
+    /// Moves the last digit towards the exact value while it stays within
+    /// the rounding interval.
+    //*************************************************************************
+    inline void round_weed(char* digits, int length, uint64_t dist, uint64_t delta, uint64_t rest, uint64_t ten_k)
+    {
+      while ((rest < dist) &&
+             ((delta - rest) >= ten_k) &&
+             (((rest + ten_k) < dist) || ((dist - rest) > (rest + ten_k - dist))))
+      {
+        --digits[length - 1];
+        rest += ten_k;
+      }
+    }
+
+    //*************************************************************************
+    /// Generates the digits of m_plus until they lie within the rounding
+    /// interval [m_minus, m_plus].
+    //*************************************************************************
+    inline void generate_digits(char* digits, int& length, int& exponent, const diy_fp& m_minus, const diy_fp& w, const diy_fp& m_plus)
+    {
+      diy_fp delta = subtract(m_plus, m_minus);
+      diy_fp dist  = subtract(m_plus, w);
+
+      const int      shift = -m_plus.e;
+      const uint64_t one   = 1ULL << shift;
+      const uint64_t mask  = one - 1;
+
+      uint32_t p1 = uint32_t(m_plus.f >> shift);
+      uint64_t p2 = m_plus.f & mask;
+
+      // The integral part.
+      uint32_t pow10;
+      int n = find_largest_pow10(p1, pow10);
+
+      while (n > 0)
+      {
+        const uint32_t d = p1 / pow10;
+        p1 %= pow10;
+        digits[length++] = char('0' + d);
+        --n;
+
+        const uint64_t rest = (uint64_t(p1) << shift) + p2;
+
+        if (rest <= delta.f)
+        {
+          exponent += n;
+          round_weed(digits, length, dist.f, delta.f, rest, uint64_t(pow10) << shift);
+          return;
+        }
+
+        pow10 /= 10;
+      }
+
+      // The fractional part.
+      int m = 0;
+
+      while (true)
+      {
+        p2 *= 10;
+        digits[length++] = char('0' + (p2 >> shift));
+        p2 &= mask;
+        ++m;
+
+        delta.f *= 10;
+        dist.f  *= 10;
+
+        if (p2 <= delta.f)
+        {
+          break;
+        }
+      }
+
+      exponent -= m;
+      round_weed(digits, length, dist.f, delta.f, p2, one);
+    }
+
+    //*************************************************************************
+    /// Generates the shortest digits for a finite, positive value.
+    /// value = digits * 10^exponent
+    /// 'digits' must have space for 17 characters.
+    //*************************************************************************
+    template <typename T>
+    void grisu2(T value, char* digits, int& length, int& exponent)
+    {
+      const boundaries b = compute_boundaries(value);
+
+      const cached_power& cached = get_cached_power(b.plus.e);
+      const diy_fp c(cached.f, cached.e);
+
+      const diy_fp w       = multiply(b.w, c);
+      const diy_fp w_minus = multiply(b.minus, c);
+      const diy_fp w_plus  = multiply(b.plus, c);
+
+      // Narrow the interval by one ulp to allow for the multiplication error.
+      const diy_fp m_minus(w_minus.f + 1, w_minus.e);
+      const diy_fp m_plus(w_plus.f - 1, w_plus.e);
+
+      length   = 0;
+      exponent = -cached.k;
+
+      generate_digits(digits, length, exponent, m_minus, w, m_plus);
+    }
+
+    //*************************************************************************
+    /// Writes a decimal exponent. e+XX
+    ///\return The number of characters written.
+    //*************************************************************************
+    inline int write_exponent(char* p, int exponent)
+    {
+      char* const start = p;
+
+      *p++ = 'e';
+
+      if (exponent < 0)
+      {
+        *p++ = '-';
+        exponent = -exponent;
+      }
+      else
+      {
+        *p++ = '+';
+      }
+
+      if (exponent >= 100)
+      {
+        *p++ = char('0' + (exponent / 100));
+        exponent %= 100;
+        *p++ = char('0' + (exponent / 10));
+        *p++ = char('0' + (exponent % 10));
+      }
+      else
+      {
+        *p++ = char('0' + (exponent / 10));
+        *p++ = char('0' + (exponent % 10));
+      }
+
+      return int(p - start);
+    }
+
+    //*************************************************************************
+    /// Lays out the digits in fixed or scientific notation.
+    /// Fixed notation is used for decimal points from 10^-4 to 10^max_fixed.
+    ///\return The number of characters written.
+    //*************************************************************************
+    inline int format_digits(char* p, const char* digits, int length, int exponent, int max_fixed)
+    {
+      // The position of the decimal point relative to the first digit.
+      const int point = length + exponent;
+
+      if ((exponent >= 0) && (point <= max_fixed))
+      {
+        // dddd000
+        memcpy(p, digits, size_t(length));
+        memset(p + length, '0', size_t(exponent));
+        return point;
+      }
+
+      if ((point > 0) && (point <= max_fixed))
+      {
+        // dd.dd
+        memcpy(p, digits, size_t(point));
+        p[point] = '.';
+        memcpy(p + point + 1, digits + point, size_t(length - point));
+        return length + 1;
+      }
+
+      if ((point > -4) && (point <= 0))
+      {
+        // 0.000dddd
+        p[0] = '0';
+        p[1] = '.';
+        memset(p + 2, '0', size_t(-point));
+        memcpy(p + 2 - point, digits, size_t(length));
+        return 2 - point + length;
+      }
+
+      // d.ddde+XX
+      int size = 1;
+      p[0] = digits[0];
+
+      if (length > 1)
+      {
+        p[1] = '.';
+        memcpy(p + 2, digits + 1, size_t(length - 1));
+        size = length + 1;
+      }
+
+      return size + write_exponent(p + size, point - 1);
+    }
+
+    //*************************************************************************
+    /// The number of characters needed for any formatted value.
+    //*************************************************************************
+    static const size_t Buffer_Size = 32;
+
+    //*************************************************************************
+    /// Formats the value as the shortest text that reads back as the same
+    /// value. Special values are written as 'nan', 'inf' and '-inf'.
+    /// 'buffer' must have space for Buffer_Size characters.
+    ///\return The number of characters written.
+    //*************************************************************************
+    template <typename T>
+    int format(T value, char* buffer)
+    {
+      typedef ieee_traits<T> traits;
+      typedef typename traits::bits_type bits_type;
+
+      // The largest value written without an exponent.
+      static const int Max_Fixed = (traits::Precision > 24) ? 16 : 8;
+
+      const bits_type sign_bit     = bits_type(1) << (sizeof(bits_type) * 8 - 1);
+      const bits_type exponent_all = (~bits_type(0) >> 1) & ~((bits_type(1) << (traits::Precision - 1)) - 1);
+
+      bits_type bits;
+      memcpy(&bits, &value, sizeof(bits));
+
+      char* p = buffer;
+
+      if ((bits & exponent_all) == exponent_all)
+      {
+        if ((bits & ~(sign_bit | exponent_all)) != 0)
+        {
+          memcpy(p, "nan", 3);
+          return 3;
+        }
+
+        if ((bits & sign_bit) != 0)
+        {
+          *p++ = '-';
+        }
+
+        memcpy(p, "inf", 3);
+        return int(p - buffer) + 3;
+      }
+
+      if ((bits & sign_bit) != 0)
+      {
+        *p++ = '-';
+        bits &= ~sign_bit;
+        memcpy(&value, &bits, sizeof(bits));
+      }
+
+      if (bits == 0)
+      {
+        *p++ = '0';
+        return int(p - buffer);
+      }
+
+      char digits[18];
+      int  length;
+      int  exponent;
+
+      grisu2(value, digits, length, exponent);
+
+      return int(p - buffer) + format_digits(p, digits, length, exponent, Max_Fixed);
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,325 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MESSAGE_DISPATCH_INCLUDED
+#define ETL_MESSAGE_DISPATCH_INCLUDED
+
+///\ingroup private
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "../platform.h"
+#include "../message_types.h"
+#include "../type_traits.h"
+#include "../alignment.h"
+#include "../nullptr.h"
+
+#if ETL_CPP11_SUPPORTED
+
+//*****************************************************************************
+/// The largest span of message ids, from the smallest to the largest, that is
+/// dispatched through a table. Wider spans compare against each id in turn.
+//*****************************************************************************
+#if !defined(ETL_MESSAGE_DISPATCH_MAX_TABLE_SIZE)
+  #define ETL_MESSAGE_DISPATCH_MAX_TABLE_SIZE 256
+#endif
+
+namespace etl
+{
+  namespace private_message_dispatch
+  {
+    //*************************************************************************
+    /// A compile time sequence of indexes.
+    //*************************************************************************
+    template <size_t... Indexes>
+    struct index_sequence
+    {
+    };
+
+    template <size_t N, size_t... Indexes>
+    struct make_index_sequence : make_index_sequence<N - 1U, N - 1U, Indexes...>
+    {
+    };
+
+    template <size_t... Indexes>
+    struct make_index_sequence<0U, Indexes...>
+    {
+      typedef index_sequence<Indexes...> type;
+    };
+
+    //*************************************************************************
+    /// The smallest and largest message ids.
+    /// An empty list has the single id 0.
+    //*************************************************************************
+    template <typename... TMessages>
+    struct id_range
+    {
+      static const size_t MIN_ID = 0U;
+      static const size_t MAX_ID = 0U;
+    };
+
+    template <typename TMessage>
+    struct id_range<TMessage>
+    {
+      static const size_t MIN_ID = size_t(TMessage::ID);
+      static const size_t MAX_ID = size_t(TMessage::ID);
+    };
+
+    template <typename TMessage, typename... TMessages>
+    struct id_range<TMessage, TMessages...>
+    {
+      static const size_t MIN_ID = (size_t(TMessage::ID) < id_range<TMessages...>::MIN_ID) ? size_t(TMessage::ID) : id_range<TMessages...>::MIN_ID;
+      static const size_t MAX_ID = (size_t(TMessage::ID) > id_range<TMessages...>::MAX_ID) ? size_t(TMessage::ID) : id_range<TMessages...>::MAX_ID;
+    };
+
+    //*************************************************************************
+    /// The first message type with the id, or void.
+    //*************************************************************************
+    template <size_t ID, typename... TMessages>
+    struct type_with_id
+    {
+      typedef void type;
+    };
+
+    template <size_t ID, typename TMessage, typename... TMessages>
+    struct type_with_id<ID, TMessage, TMessages...>
+    {
+      typedef typename etl::conditional<size_t(TMessage::ID) == ID,
+                                        TMessage,
+                                        typename type_with_id<ID, TMessages...>::type>::type type;
+    };
+
+    //*************************************************************************
+    /// Does more than one message type have the same id?
+    //*************************************************************************
+    template <typename... TMessages>
+    struct has_duplicate_ids : etl::false_type
+    {
+    };
+
+    template <typename TMessage, typename... TMessages>
+    struct has_duplicate_ids<TMessage, TMessages...>
+      : etl::integral_constant<bool, !etl::is_same<typename type_with_id<size_t(TMessage::ID), TMessages...>::type, void>::value ||
+                                     has_duplicate_ids<TMessages...>::value>
+    {
+    };
+
+    //*************************************************************************
+    /// Is T one of the message types?
+    //*************************************************************************
+    template <typename T, typename... TMessages>
+    struct is_one_of : etl::false_type
+    {
+    };
+
+    template <typename T, typename TMessage, typename... TMessages>
+    struct is_one_of<T, TMessage, TMessages...>
+      : etl::integral_constant<bool, etl::is_same<T, TMessage>::value || is_one_of<T, TMessages...>::value>
+    {
+    };
+
+    //*************************************************************************
+    /// The size and alignment of the largest message types.
+    //*************************************************************************
+    template <typename... TMessages>
+    struct largest
+    {
+      static const size_t size      = 1U;
+      static const size_t alignment = 1U;
+    };
+
+    template <typename TMessage, typename... TMessages>
+    struct largest<TMessage, TMessages...>
+    {
+      static const size_t size      = (sizeof(TMessage) > largest<TMessages...>::size) ? sizeof(TMessage) : largest<TMessages...>::size;
+      static const size_t alignment = (size_t(etl::alignment_of<TMessage>::value) > largest<TMessages...>::alignment) ? size_t(etl::alignment_of<TMessage>::value) : largest<TMessages...>::alignment;
+    };
+
+    //*************************************************************************
+    /// One word of the bitset of message ids, offset by MIN_ID.
+    //*************************************************************************
+    template <size_t MIN_ID, typename... TMessages>
+    struct id_bits
+    {
+      static constexpr uint32_t word(size_t)
+      {
+        return 0U;
+      }
+    };
+
+    template <size_t MIN_ID, typename TMessage, typename... TMessages>
+    struct id_bits<MIN_ID, TMessage, TMessages...>
+    {
+      static constexpr uint32_t word(size_t w)
+      {
+        return ((((size_t(TMessage::ID) - MIN_ID) / 32U) == w) ? (uint32_t(1U) << ((size_t(TMessage::ID) - MIN_ID) % 32U)) : 0U) |
+               id_bits<MIN_ID, TMessages...>::word(w);
+      }
+    };
+
+    //*************************************************************************
+    /// The bitset of message ids, offset by MIN_ID.
+    //*************************************************************************
+    template <typename TWords, size_t MIN_ID, typename... TMessages>
+    struct id_bitset;
+
+    template <size_t... Words, size_t MIN_ID, typename... TMessages>
+    struct id_bitset<index_sequence<Words...>, MIN_ID, TMessages...>
+    {
+      static constexpr uint32_t words[sizeof...(Words)] = { id_bits<MIN_ID, TMessages...>::word(Words)... };
+    };
+
+    template <size_t... Words, size_t MIN_ID, typename... TMessages>
+    constexpr uint32_t id_bitset<index_sequence<Words...>, MIN_ID, TMessages...>::words[sizeof...(Words)];
+
+    //*************************************************************************
+    /// Compares the id with each message id in turn.
+    //*************************************************************************
+    template <typename THandler, typename... TMessages>
+    struct linear_search
+    {
+      static constexpr bool contains(size_t)
+      {
+        return false;
+      }
+
+      static constexpr typename THandler::type find(size_t)
+      {
+        return THandler::get(static_cast<void*>(nullptr));
+      }
+    };
+
+    template <typename THandler, typename TMessage, typename... TMessages>
+    struct linear_search<THandler, TMessage, TMessages...>
+    {
+      static constexpr bool contains(size_t id)
+      {
+        return (id == size_t(TMessage::ID)) || linear_search<THandler, TMessages...>::contains(id);
+      }
+
+      static constexpr typename THandler::type find(size_t id)
+      {
+        return (id == size_t(TMessage::ID)) ? THandler::get(static_cast<TMessage*>(nullptr))
+                                            : linear_search<THandler, TMessages...>::find(id);
+      }
+    };
+
+    //*************************************************************************
+    /// The table of handlers, indexed by message id - MIN_ID.
+    //*************************************************************************
+    template <typename THandler, typename TIndexes, size_t MIN_ID, typename... TMessages>
+    struct dispatch_table;
+
+    template <typename THandler, size_t... Indexes, size_t MIN_ID, typename... TMessages>
+    struct dispatch_table<THandler, index_sequence<Indexes...>, MIN_ID, TMessages...>
+    {
+      static constexpr typename THandler::type entries[sizeof...(Indexes)] =
+      {
+        THandler::get(static_cast<typename type_with_id<MIN_ID + Indexes, TMessages...>::type*>(nullptr))...
+      };
+    };
+
+    template <typename THandler, size_t... Indexes, size_t MIN_ID, typename... TMessages>
+    constexpr typename THandler::type dispatch_table<THandler, index_sequence<Indexes...>, MIN_ID, TMessages...>::entries[sizeof...(Indexes)];
+
+    //*************************************************************************
+    /// Finds the handler for a message id at run time.
+    /// THandler::type is the handler type.
+    /// THandler::get(T*) returns the handler for message type T.
+    /// THandler::get(void*) returns the handler for an unknown id.
+    /// Ids within ETL_MESSAGE_DISPATCH_MAX_TABLE_SIZE of each other are found
+    /// with one table lookup and tested with one bitset lookup.
+    //*************************************************************************
+    template <typename... TMessages>
+    class dispatcher
+    {
+    public:
+
+      static const size_t MIN_ID = id_range<TMessages...>::MIN_ID;
+      static const size_t MAX_ID = id_range<TMessages...>::MAX_ID;
+      static const size_t SPAN   = MAX_ID - MIN_ID + 1U;
+      static const bool   DENSE  = (SPAN <= ETL_MESSAGE_DISPATCH_MAX_TABLE_SIZE);
+
+      //***********************************************************************
+      /// Is the id one of the message ids?
+      //***********************************************************************
+      static constexpr bool contains(etl::message_id_t id)
+      {
+        return contains(size_t(id) - MIN_ID, size_t(id), etl::integral_constant<bool, DENSE>());
+      }
+
+      //***********************************************************************
+      /// Gets the handler for the id.
+      //***********************************************************************
+      template <typename THandler>
+      static typename THandler::type find(etl::message_id_t id)
+      {
+        return find<THandler>(size_t(id) - MIN_ID, size_t(id), etl::integral_constant<bool, DENSE>());
+      }
+
+    private:
+
+      struct no_handler
+      {
+        typedef bool type;
+      };
+
+      // The index is id - MIN_ID. Ids below MIN_ID wrap to large indexes.
+      // The tables are only instantiated for dense ids.
+      static constexpr bool contains(size_t index, size_t, etl::true_type)
+      {
+        return (index < SPAN) && (((id_bitset<typename make_index_sequence<(SPAN + 31U) / 32U>::type, MIN_ID, TMessages...>::words[index / 32U] >> (index % 32U)) & 1U) != 0U);
+      }
+
+      static constexpr bool contains(size_t, size_t id, etl::false_type)
+      {
+        return linear_search<no_handler, TMessages...>::contains(id);
+      }
+
+      template <typename THandler>
+      static typename THandler::type find(size_t index, size_t, etl::true_type)
+      {
+        return (index < SPAN) ? dispatch_table<THandler, typename make_index_sequence<SPAN>::type, MIN_ID, TMessages...>::entries[index]
+                              : THandler::get(static_cast<void*>(nullptr));
+      }
+
+      template <typename THandler>
+      static typename THandler::type find(size_t, size_t id, etl::false_type)
+      {
+        return linear_search<THandler, TMessages...>::find(id);
+      }
+    };
+  }
+}
+
+#endif
+
+#endif
@@ -0,0 +1,226 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_QUEUE_SPSC_BATCH_INCLUDED
+#define ETL_QUEUE_SPSC_BATCH_INCLUDED
+
+///\ingroup private
+
+#include <stddef.h>
+#include <string.h>
+
+#include "../platform.h"
+#include "../type_traits.h"
+#include "../exception.h"
+#include "../error_handler.h"
+
+#undef ETL_FILE
+#define ETL_FILE "60"
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for spsc queue exceptions.
+  ///\ingroup queue_spsc
+  //***************************************************************************
+  class queue_spsc_exception : public exception
+  {
+  public:
+
+    queue_spsc_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The exception thrown when more values are committed than were reserved.
+  ///\ingroup queue_spsc
+  //***************************************************************************
+  class queue_spsc_full : public queue_spsc_exception
+  {
+  public:
+
+    queue_spsc_full(string_type file_name_, numeric_type line_number_)
+      : queue_spsc_exception(ETL_ERROR_TEXT("queue_spsc:full", ETL_FILE"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The exception thrown when more values are released than were peeked.
+  ///\ingroup queue_spsc
+  //***************************************************************************
+  class queue_spsc_empty : public queue_spsc_exception
+  {
+  public:
+
+    queue_spsc_empty(string_type file_name_, numeric_type line_number_)
+      : queue_spsc_exception(ETL_ERROR_TEXT("queue_spsc:empty", ETL_FILE"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_queue_spsc
+  {
+    //*************************************************************************
+    /// Can values be moved in and out of the buffer with memcpy?
+    //*************************************************************************
+    template <typename T>
+    struct is_memcpy_safe : public etl::integral_constant<bool, etl::is_trivially_copy_constructible<T>::value &&
+                                                                etl::is_trivially_destructible<T>::value>
+    {
+    };
+
+    //*************************************************************************
+    /// Constructs 'n' values in uninitialised storage.
+    //*************************************************************************
+    template <typename T>
+    void construct_n(T* p_destination, const T* p_source, size_t n, etl::true_type /*memcpy_safe*/)
+    {
+      memcpy(static_cast<void*>(p_destination), p_source, n * sizeof(T));
+    }
+
+    template <typename T>
+    void construct_n(T* p_destination, const T* p_source, size_t n, etl::false_type /*memcpy_safe*/)
+    {
+      for (size_t i = 0; i < n; ++i)
+      {
+        ::new (&p_destination[i]) T(p_source[i]);
+      }
+    }
+
+    //*************************************************************************
+    /// Assigns 'n' values from the buffer and destroys the originals.
+    //*************************************************************************
+    template <typename T>
+    void extract_n(T* p_destination, T* p_source, size_t n, etl::true_type /*memcpy_safe*/)
+    {
+      memcpy(static_cast<void*>(p_destination), p_source, n * sizeof(T));
+    }
+
+    template <typename T>
+    void extract_n(T* p_destination, T* p_source, size_t n, etl::false_type /*memcpy_safe*/)
+    {
+      for (size_t i = 0; i < n; ++i)
+      {
+        p_destination[i] = p_source[i];
+        p_source[i].~T();
+      }
+    }
+
+    //*************************************************************************
+    /// Copies 'n' values into a ring buffer of 'capacity' slots, starting at 'index'.
+    /// There must be 'n' free slots.
+    //*************************************************************************
+    template <typename T>
+    void copy_in(T* p_buffer, size_t capacity, size_t index, const T* p_values, size_t n)
+    {
+      typedef typename is_memcpy_safe<T>::type memcpy_safe;
+
+      size_t first = ((capacity - index) < n) ? (capacity - index) : n;
+
+      construct_n(p_buffer + index, p_values, first, memcpy_safe());
+      construct_n(p_buffer, p_values + first, n - first, memcpy_safe());
+    }
+
+    //*************************************************************************
+    /// Moves 'n' values out of a ring buffer of 'capacity' slots, starting at 'index'.
+    /// There must be 'n' filled slots.
+    //*************************************************************************
+    template <typename T>
+    void copy_out(T* p_buffer, size_t capacity, size_t index, T* p_values, size_t n)
+    {
+      typedef typename is_memcpy_safe<T>::type memcpy_safe;
+
+      size_t first = ((capacity - index) < n) ? (capacity - index) : n;
+
+      extract_n(p_values, p_buffer + index, first, memcpy_safe());
+      extract_n(p_values + first, p_buffer, n - first, memcpy_safe());
+    }
+
+    //*************************************************************************
+    /// Destroys 'n' values in the buffer.
+    //*************************************************************************
+    template <typename T>
+    void destroy_n(T* p_buffer, size_t n)
+    {
+      for (size_t i = 0; i < n; ++i)
+      {
+        p_buffer[i].~T();
+      }
+    }
+
+    //*************************************************************************
+    /// Index arithmetic for a ring buffer that keeps one slot empty to
+    /// distinguish 'full' from 'empty'.
+    //*************************************************************************
+    template <typename TSize>
+    TSize used_slots(TSize write_index, TSize read_index, size_t capacity)
+    {
+      return TSize((write_index >= read_index) ? write_index - read_index : capacity - read_index + write_index);
+    }
+
+    template <typename TSize>
+    TSize free_slots(TSize write_index, TSize read_index, size_t capacity)
+    {
+      return TSize(capacity - 1 - used_slots(write_index, read_index, capacity));
+    }
+
+    /// The number of filled slots that can be read without wrapping.
+    template <typename TSize>
+    TSize contiguous_used_slots(TSize write_index, TSize read_index, size_t capacity)
+    {
+      return TSize((write_index >= read_index) ? write_index - read_index : capacity - read_index);
+    }
+
+    /// The number of free slots that can be written without wrapping.
+    template <typename TSize>
+    TSize contiguous_free_slots(TSize write_index, TSize read_index, size_t capacity)
+    {
+      return TSize((read_index > write_index) ? read_index - write_index - 1 : capacity - write_index - ((read_index == 0) ? 1 : 0));
+    }
+
+    //*************************************************************************
+    /// Advances a ring buffer index by 'n', where 'n' is not more than 'capacity'.
+    //*************************************************************************
+    template <typename TSize>
+    TSize advance(TSize index, size_t n, size_t capacity)
+    {
+      size_t next = size_t(index) + n;
+
+      return TSize((next >= capacity) ? next - capacity : next);
+    }
+  }
+}
+
+#undef ETL_FILE
+
+#endif
@@ -0,0 +1,389 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_STRING_SEARCH_INCLUDED
+#define ETL_STRING_SEARCH_INCLUDED
+
+///\ingroup private
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "../platform.h"
+#include "../type_traits.h"
+#include "../nullptr.h"
+
+namespace etl
+{
+  namespace private_string_search
+  {
+    //*************************************************************************
+    /// Characters of one byte are searched and compared with the C library's
+    /// memchr and memcmp, which are vectorised on most targets.
+    /// Wider characters use simple loops that the compiler may vectorise.
+    //*************************************************************************
+    template <typename T>
+    struct is_byte : etl::integral_constant<bool, (sizeof(T) == 1)>
+    {
+    };
+
+    //*************************************************************************
+    /// Finds the first 'c' in [first, last).
+    //*************************************************************************
+    template <typename T>
+    const T* find_char(const T* first, const T* last, T c, etl::true_type /*is_byte*/)
+    {
+      if (first == last)
+      {
+        return last;
+      }
+
+      const void* p = memchr(first, static_cast<unsigned char>(c), last - first);
+
+      return (p == nullptr) ? last : static_cast<const T*>(p);
+    }
+
+    template <typename T>
+    const T* find_char(const T* first, const T* last, T c, etl::false_type /*is_byte*/)
+    {
+      while ((first != last) && (*first != c))
+      {
+        ++first;
+      }
+
+      return first;
+    }
+
+    //*************************************************************************
+    /// Finds the first 'c' in [first, last).
+    ///\return A pointer to the character, or last.
+    //*************************************************************************
+    template <typename T>
+    const T* find_char(const T* first, const T* last, T c)
+    {
+      return find_char(first, last, c, is_byte<T>());
+    }
+
+    //*************************************************************************
+    /// Finds the last 'c' in [first, last).
+    ///\return A pointer to the character, or nullptr.
+    //*************************************************************************
+    template <typename T>
+    const T* rfind_char(const T* first, const T* last, T c)
+    {
+      while (last != first)
+      {
+        --last;
+
+        if (*last == c)
+        {
+          return last;
+        }
+      }
+
+      return nullptr;
+    }
+
+    //*************************************************************************
+    /// Finds the first position in which the 'n' characters at 'p1' and 'p2' differ.
+    ///\return The index of the mismatch, or n.
+    //*************************************************************************
+    template <typename T>
+    size_t mismatch(const T* p1, const T* p2, size_t n, etl::true_type /*is_byte*/)
+    {
+      // Skip equal blocks with memcmp, then find the character in the block that differs.
+      static const size_t BLOCK = 32;
+
+      size_t i = 0;
+
+      while (((n - i) >= BLOCK) && (memcmp(p1 + i, p2 + i, BLOCK) == 0))
+      {
+        i += BLOCK;
+      }
+
+      while ((i < n) && (p1[i] == p2[i]))
+      {
+        ++i;
+      }
+
+      return i;
+    }
+
+    template <typename T>
+    size_t mismatch(const T* p1, const T* p2, size_t n, etl::false_type /*is_byte*/)
+    {
+      size_t i = 0;
+
+      while ((i < n) && (p1[i] == p2[i]))
+      {
+        ++i;
+      }
+
+      return i;
+    }
+
+    //*************************************************************************
+    /// Checks whether the 'n' characters at 'p1' and 'p2' are equal.
+    //*************************************************************************
+    template <typename T>
+    bool equal(const T* p1, const T* p2, size_t n, etl::true_type /*is_byte*/)
+    {
+      return (n == 0) || (memcmp(p1, p2, n) == 0);
+    }
+
+    template <typename T>
+    bool equal(const T* p1, const T* p2, size_t n, etl::false_type /*is_byte*/)
+    {
+      return mismatch(p1, p2, n, etl::false_type()) == n;
+    }
+
+    template <typename T>
+    bool equal(const T* p1, const T* p2, size_t n)
+    {
+      return equal(p1, p2, n, is_byte<T>());
+    }
+
+    //*************************************************************************
+    /// Lexicographically compares [p1, p1 + n1) with [p2, p2 + n2).
+    /// Characters are compared as values of T.
+    ///\return <0, 0 or >0.
+    //*************************************************************************
+    template <typename T>
+    int compare(const T* p1, size_t n1, const T* p2, size_t n2)
+    {
+      const size_t n = (n1 < n2) ? n1 : n2;
+      const size_t i = mismatch(p1, p2, n, is_byte<T>());
+
+      if (i != n)
+      {
+        return (p1[i] < p2[i]) ? -1 : 1;
+      }
+
+      return (n1 == n2) ? 0 : ((n1 < n2) ? -1 : 1);
+    }
+
+    //*************************************************************************
+    /// Finds the first occurrence of [s, s + n) in [first, last).
+    /// Candidates are found by scanning for the first character. The last
+    /// character is checked before the rest, to reject most of them cheaply.
+    ///\return A pointer to the start of the match, or nullptr.
+    //*************************************************************************
+    template <typename T>
+    const T* find_substring(const T* first, const T* last, const T* s, size_t n)
+    {
+      if (n == 0)
+      {
+        return first;
+      }
+
+      if (size_t(last - first) < n)
+      {
+        return nullptr;
+      }
+
+      const T* const limit = last - n + 1;
+      const T first_c = s[0];
+      const T last_c  = s[n - 1];
+
+      while (first != limit)
+      {
+        first = find_char(first, limit, first_c);
+
+        if (first == limit)
+        {
+          break;
+        }
+
+        if ((first[n - 1] == last_c) && equal(first + 1, s + 1, n - 1))
+        {
+          return first;
+        }
+
+        ++first;
+      }
+
+      return nullptr;
+    }
+
+    //*************************************************************************
+    /// Finds the last occurrence of [s, s + n) in [first, last).
+    ///\return A pointer to the start of the match, or nullptr.
+    //*************************************************************************
+    template <typename T>
+    const T* rfind_substring(const T* first, const T* last, const T* s, size_t n)
+    {
+      if (size_t(last - first) < n)
+      {
+        return nullptr;
+      }
+
+      if (n == 0)
+      {
+        return last;
+      }
+
+      const T* limit = last - n + 1;
+      const T first_c = s[0];
+      const T last_c  = s[n - 1];
+
+      while (limit != first)
+      {
+        const T* p = rfind_char(first, limit, first_c);
+
+        if (p == nullptr)
+        {
+          break;
+        }
+
+        if ((p[n - 1] == last_c) && equal(p + 1, s + 1, n - 1))
+        {
+          return p;
+        }
+
+        limit = p;
+      }
+
+      return nullptr;
+    }
+
+    //*************************************************************************
+    /// A set of characters.
+    /// Membership of characters below 256 is a bit test. Wider characters, if
+    /// there are any in the set, are found by a linear search.
+    //*************************************************************************
+    template <typename T>
+    class char_set
+    {
+    public:
+
+      char_set(const T* p_set_, size_t length_)
+        : p_set(p_set_),
+          length(length_),
+          has_wide(false)
+      {
+        memset(bits, 0, sizeof(bits));
+
+        for (size_t i = 0; i < length; ++i)
+        {
+          const unsigned_t c = unsigned_t(p_set[i]);
+
+          if (c < 256U)
+          {
+            bits[c >> 5] |= uint32_t(1U) << (c & 31U);
+          }
+          else
+          {
+            has_wide = true;
+          }
+        }
+      }
+
+      bool contains(T c) const
+      {
+        const unsigned_t u = unsigned_t(c);
+
+        if (u < 256U)
+        {
+          return (bits[u >> 5] & (uint32_t(1U) << (u & 31U))) != 0U;
+        }
+
+        return has_wide && (find_char(p_set, p_set + length, c, etl::false_type()) != (p_set + length));
+      }
+
+    private:
+
+      typedef typename etl::make_unsigned<T>::type unsigned_t;
+
+      const T* p_set;
+      size_t   length;
+      bool     has_wide;
+      uint32_t bits[8];
+    };
+
+    //*************************************************************************
+    /// Finds the first character in [first, last) that is, or is not, in [s, s + n).
+    ///\return A pointer to the character, or nullptr.
+    //*************************************************************************
+    template <typename T>
+    const T* find_first_of(const T* first, const T* last, const T* s, size_t n, bool in_set)
+    {
+      if (in_set && (n == 1))
+      {
+        const T* p = find_char(first, last, s[0]);
+
+        return (p == last) ? nullptr : p;
+      }
+
+      const char_set<T> set(s, n);
+
+      while (first != last)
+      {
+        if (set.contains(*first) == in_set)
+        {
+          return first;
+        }
+
+        ++first;
+      }
+
+      return nullptr;
+    }
+
+    //*************************************************************************
+    /// Finds the last character in [first, last) that is, or is not, in [s, s + n).
+    ///\return A pointer to the character, or nullptr.
+    //*************************************************************************
+    template <typename T>
+    const T* find_last_of(const T* first, const T* last, const T* s, size_t n, bool in_set)
+    {
+      if (in_set && (n == 1))
+      {
+        return rfind_char(first, last, s[0]);
+      }
+
+      const char_set<T> set(s, n);
+
+      while (last != first)
+      {
+        --last;
+
+        if (set.contains(*last) == in_set)
+        {
+          return last;
+        }
+      }
+
+      return nullptr;
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,428 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TIMING_WHEEL_INCLUDED
+#define ETL_TIMING_WHEEL_INCLUDED
+
+///\ingroup private
+
+#include <stdint.h>
+
+#include "../platform.h"
+#include "../binary.h"
+#include "../timer.h"
+
+namespace etl
+{
+  namespace private_timing_wheel
+  {
+    //*************************************************************************
+    /// Constants common to all timing wheels.
+    //*************************************************************************
+    struct wheel_base
+    {
+      enum
+      {
+        LEVEL0_BITS     = 8,
+        LEVEL0_SIZE     = 1 << LEVEL0_BITS,
+        LEVEL0_MASK     = LEVEL0_SIZE - 1,
+        LEVELN_BITS     = 6,
+        LEVELN_SIZE     = 1 << LEVELN_BITS,
+        LEVELN_MASK     = LEVELN_SIZE - 1,
+        UPPER_LEVELS    = 4,
+        EXPIRED_SLOT    = LEVEL0_SIZE + (UPPER_LEVELS * LEVELN_SIZE),
+        NUMBER_OF_SLOTS = EXPIRED_SLOT + 1,
+        NO_SLOT         = 0xFFFF,
+        BITMAP_WORDS    = LEVEL0_SIZE / 32
+      };
+    };
+
+    //*************************************************************************
+    /// A hierarchical timing wheel over an array of timer data.
+    /// Level 0 has 256 slots of one tick; levels 1 to 4 have 64 slots, each
+    /// slot spanning 64 times the slots of the level below, giving a range
+    /// of 2^32 ticks. Timers are held in intrusive circular lists, linked
+    /// through the 'next', 'previous', 'slot' and 'expires' members of TData.
+    /// Insert and remove are O(1). Timers in the upper levels are cascaded
+    /// down as the level 0 wheel wraps. Empty level 0 slots are skipped
+    /// using an occupancy bitmap.
+    //*************************************************************************
+    template <typename TData>
+    class wheel : public wheel_base
+    {
+    public:
+
+      typedef etl::timer::wheel_id::type id_type;
+      typedef uint_least16_t             slot_type;
+
+      //*******************************
+      wheel(TData* ptimers_)
+        : ptimers(ptimers_)
+      {
+        clear();
+      }
+
+      //*******************************
+      bool empty() const
+      {
+        return active == 0;
+      }
+
+      //*******************************
+      /// Inserts the timer to expire after 'delay' ticks.
+      /// A delay of zero is due now and goes straight to the expired list.
+      //*******************************
+      void insert(id_type id_, uint32_t delay)
+      {
+        if (delay == 0)
+        {
+          ptimers[id_].expires = now - 1;
+          link(id_, EXPIRED_SLOT);
+          ++active;
+        }
+        else
+        {
+          schedule(id_, now - 1, delay);
+        }
+      }
+
+      //*******************************
+      /// Reinserts an expired timer to expire 'period' ticks after its
+      /// last expiry time, so that repeating timers do not drift.
+      //*******************************
+      void reinsert(id_type id_, uint32_t period)
+      {
+        schedule(id_, ptimers[id_].expires, period);
+      }
+
+      //*******************************
+      void remove(id_type id_)
+      {
+        unlink(id_);
+        ptimers[id_].slot = NO_SLOT;
+        --active;
+      }
+
+      //*******************************
+      /// Advances the wheel by up to 'count' ticks, stopping after the first
+      /// tick that expires any timers. 'count' is reduced by the ticks used.
+      /// Returns true if there are expired timers to collect with 'pop_expired'.
+      /// The expired list must be empty before the call.
+      //*******************************
+      bool advance(uint32_t& count)
+      {
+        while (count != 0)
+        {
+          if (active == 0)
+          {
+            // Nothing to cascade or expire.
+            now  += count;
+            count = 0;
+          }
+          else
+          {
+            uint32_t index = now & LEVEL0_MASK;
+
+            if (index == 0)
+            {
+              cascade();
+            }
+
+            // Skip the empty slots up to the end of this rotation.
+            uint32_t next = next_occupied(index);
+            uint32_t skip = next - index;
+
+            if (skip >= count)
+            {
+              now  += count;
+              count = 0;
+            }
+            else
+            {
+              now   += skip;
+              count -= skip;
+
+              if (next != LEVEL0_SIZE)
+              {
+                ++now;
+                --count;
+                expire(slot_type(next));
+                return true;
+              }
+            }
+          }
+        }
+
+        return false;
+      }
+
+      //*******************************
+      /// Removes and returns the next expired timer, or NO_TIMER if none.
+      //*******************************
+      id_type pop_expired()
+      {
+        id_type id = heads[EXPIRED_SLOT];
+
+        if (id != etl::timer::wheel_id::NO_TIMER)
+        {
+          remove(id);
+        }
+
+        return id;
+      }
+
+      //*******************************
+      void clear()
+      {
+        for (uint_least16_t i = 0; i < NUMBER_OF_SLOTS; ++i)
+        {
+          heads[i] = etl::timer::wheel_id::NO_TIMER;
+        }
+
+        for (uint_least16_t i = 0; i < BITMAP_WORDS; ++i)
+        {
+          occupied[i] = 0;
+        }
+
+        now    = 0;
+        active = 0;
+      }
+
+    private:
+
+      //*******************************
+      /// Inserts the timer to expire 'delay' ticks after 'base'.
+      /// Timers that are already due go in the next slot to be processed.
+      //*******************************
+      void schedule(id_type id_, uint32_t base, uint32_t delay)
+      {
+        TData& timer = ptimers[id_];
+
+        timer.expires = base + delay;
+
+        if (delay < (now - base))
+        {
+          link(id_, slot_type(now & LEVEL0_MASK));
+        }
+        else
+        {
+          link(id_, select_slot(timer.expires));
+        }
+
+        ++active;
+      }
+
+      //*******************************
+      /// Selects the slot for the expiry time relative to now.
+      //*******************************
+      slot_type select_slot(uint32_t expires) const
+      {
+        uint32_t delta = expires - now;
+
+        if (delta < LEVEL0_SIZE)
+        {
+          return slot_type(expires & LEVEL0_MASK);
+        }
+
+        uint_least8_t shift = LEVEL0_BITS;
+        slot_type     base  = LEVEL0_SIZE;
+
+        for (uint_least8_t level = 1; level < UPPER_LEVELS; ++level)
+        {
+          if (delta < (uint32_t(1) << (shift + LEVELN_BITS)))
+          {
+            break;
+          }
+
+          shift += LEVELN_BITS;
+          base  += LEVELN_SIZE;
+        }
+
+        return slot_type(base + ((expires >> shift) & LEVELN_MASK));
+      }
+
+      //*******************************
+      /// Appends the timer to the slot's circular list.
+      //*******************************
+      void link(id_type id_, slot_type slot)
+      {
+        TData& timer = ptimers[id_];
+        timer.slot = slot;
+
+        id_type head = heads[slot];
+
+        if (head == etl::timer::wheel_id::NO_TIMER)
+        {
+          heads[slot]    = id_;
+          timer.previous = id_;
+          timer.next     = id_;
+
+          if (slot < LEVEL0_SIZE)
+          {
+            occupied[slot >> 5] |= (uint32_t(1) << (slot & 31));
+          }
+        }
+        else
+        {
+          TData& first = ptimers[head];
+          id_type tail = first.previous;
+
+          timer.previous       = tail;
+          timer.next           = head;
+          ptimers[tail].next   = id_;
+          first.previous       = id_;
+        }
+      }
+
+      //*******************************
+      /// Removes the timer from its slot's circular list.
+      //*******************************
+      void unlink(id_type id_)
+      {
+        TData& timer   = ptimers[id_];
+        slot_type slot = timer.slot;
+
+        if (timer.next == id_)
+        {
+          heads[slot] = etl::timer::wheel_id::NO_TIMER;
+
+          if (slot < LEVEL0_SIZE)
+          {
+            occupied[slot >> 5] &= ~(uint32_t(1) << (slot & 31));
+          }
+        }
+        else
+        {
+          ptimers[timer.previous].next = timer.next;
+          ptimers[timer.next].previous = timer.previous;
+
+          if (heads[slot] == id_)
+          {
+            heads[slot] = timer.next;
+          }
+        }
+
+        timer.previous = etl::timer::wheel_id::NO_TIMER;
+        timer.next     = etl::timer::wheel_id::NO_TIMER;
+      }
+
+      //*******************************
+      /// Re-files the timers in the current slot of each upper level that
+      /// has come round, stopping at the first level that has not wrapped.
+      //*******************************
+      void cascade()
+      {
+        uint_least8_t shift = LEVEL0_BITS;
+        slot_type     base  = LEVEL0_SIZE;
+
+        for (uint_least8_t level = 0; level < UPPER_LEVELS; ++level)
+        {
+          uint32_t index = (now >> shift) & LEVELN_MASK;
+          slot_type slot = slot_type(base + index);
+
+          id_type id = heads[slot];
+
+          if (id != etl::timer::wheel_id::NO_TIMER)
+          {
+            heads[slot] = etl::timer::wheel_id::NO_TIMER;
+
+            // Every timer in the slot moves to a lower level.
+            id_type last = ptimers[id].previous;
+            bool    done = false;
+
+            while (!done)
+            {
+              done = (id == last);
+              id_type next = ptimers[id].next;
+              link(id, select_slot(ptimers[id].expires));
+              id = next;
+            }
+          }
+
+          if (index != 0)
+          {
+            break;
+          }
+
+          shift += LEVELN_BITS;
+          base  += LEVELN_SIZE;
+        }
+      }
+
+      //*******************************
+      /// Moves the timers in the level 0 slot to the expired list.
+      //*******************************
+      void expire(slot_type slot)
+      {
+        id_type id = heads[slot];
+
+        heads[EXPIRED_SLOT] = id;
+        heads[slot]         = etl::timer::wheel_id::NO_TIMER;
+        occupied[slot >> 5] &= ~(uint32_t(1) << (slot & 31));
+
+        do
+        {
+          ptimers[id].slot = EXPIRED_SLOT;
+          id = ptimers[id].next;
+        } while (id != heads[EXPIRED_SLOT]);
+      }
+
+      //*******************************
+      /// Returns the first occupied level 0 slot at or after 'index',
+      /// or LEVEL0_SIZE if there are none before the end of the rotation.
+      //*******************************
+      uint32_t next_occupied(uint32_t index) const
+      {
+        uint32_t word = index >> 5;
+        uint32_t bits = occupied[word] & (~uint32_t(0) << (index & 31));
+
+        while (bits == 0)
+        {
+          if (++word == BITMAP_WORDS)
+          {
+            return LEVEL0_SIZE;
+          }
+
+          bits = occupied[word];
+        }
+
+        return (word << 5) + etl::count_trailing_zeros(bits);
+      }
+
+      TData* const ptimers;
+      uint32_t     now;
+      uint32_t     active;
+      id_type      heads[NUMBER_OF_SLOTS];
+      uint32_t     occupied[BITMAP_WORDS];
+    };
+  }
+}
+
+#endif
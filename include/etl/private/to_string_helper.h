@@ -34,18 +34,127 @@ SOFTWARE.
 ///\ingroup private
 
 #include "../platform.h"
-#include "../absolute.h"
 #include "../negative.h"
 #include "../basic_format_spec.h"
 #include "../type_traits.h"
-
-#include "../stl/algorithm.h"
-#include "../stl/iterator.h"
+#include "grisu.h"
 
 namespace etl
 {
+  namespace private_to_string
+  {
+    //*************************************************************************
+    /// The pairs of decimal digits "00" to "99".
+    //*************************************************************************
+    inline const char* digit_pairs()
+    {
+      static const char pairs[] =
+        "00010203040506070809"
+        "10111213141516171819"
+        "20212223242526272829"
+        "30313233343536373839"
+        "40414243444546474849"
+        "50515253545556575859"
+        "60616263646566676869"
+        "70717273747576777879"
+        "80818283848586878889"
+        "90919293949596979899";
+
+      return pairs;
+    }
+
+    //*************************************************************************
+    /// Writes the digits of 'value' backwards from 'p'.
+    ///\return A pointer to the first digit.
+    //*************************************************************************
+    template <typename TChar, typename TUnsigned>
+    TChar* write_digits(TChar* p, TUnsigned value, const uint32_t base, const bool upper_case)
+    {
+      if (base == 10)
+      {
+        const char* const pairs = digit_pairs();
+
+        // Two digits per division.
+        while (value >= 100U)
+        {
+          const size_t index = size_t(value % 100U) * 2;
+          value /= 100U;
+          *--p = TChar(pairs[index + 1]);
+          *--p = TChar(pairs[index]);
+        }
+
+        if (value >= 10U)
+        {
+          const size_t index = size_t(value) * 2;
+          *--p = TChar(pairs[index + 1]);
+          *--p = TChar(pairs[index]);
+        }
+        else
+        {
+          *--p = TChar('0' + value);
+        }
+      }
+      else
+      {
+        const char* const digits = upper_case ? "0123456789ABCDEF" : "0123456789abcdef";
+
+        if ((base == 2) || (base == 8) || (base == 16))
+        {
+          // Binary, octal and hex shift rather than divide.
+          const uint32_t shift = (base == 2) ? 1 : ((base == 8) ? 3 : 4);
+          const uint32_t mask  = base - 1;
+
+          do
+          {
+            *--p = TChar(digits[value & mask]);
+            value >>= shift;
+          } while (value != 0);
+        }
+        else
+        {
+          do
+          {
+            const uint32_t remainder = uint32_t(value % base);
+            value /= base;
+            *--p = TChar((remainder > 9) ? (upper_case ? ('A' + (remainder - 10)) : ('a' + (remainder - 10))) : ('0' + remainder));
+          } while (value != 0);
+        }
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Appends the characters to the string, padded to the format width.
+    //*************************************************************************
+    template <typename TIString>
+    void append_padded(TIString& str,
+                       const typename TIString::value_type* p,
+                       const uint32_t length,
+                       const etl::basic_format_spec<TIString>& format)
+    {
+      const uint32_t fill_length = (length < format.width()) ? (format.width() - length) : 0U;
+
+      if ((fill_length != 0) && !format.left_justified())
+      {
+        // Fill characters on the left.
+        str.append(fill_length, format.fill());
+      }
+
+      str.append(p, length);
+
+      if ((fill_length != 0) && format.left_justified())
+      {
+        // Fill characters on the right.
+        str.append(fill_length, format.fill());
+      }
+    }
+  }
+
   //***************************************************************************
   /// Helper function for integrals.
+  /// The digits are written backwards into a local buffer and appended once.
+  /// Negative values have a leading '-' in base 10 only.
   //***************************************************************************
   template <typename T, typename TIString>
   typename etl::enable_if<etl::is_integral<T>::value, TIString&>::type
@@ -54,65 +163,70 @@ namespace etl
                      const etl::basic_format_spec<TIString>& format,
                      const bool append)
   {
-    typedef typename TIString::value_type type;
-    typedef typename TIString::iterator   iterator;
+    typedef typename TIString::value_type        type;
+    typedef typename etl::make_unsigned<T>::type unsigned_type;
+
+    // Enough for a 64 bit value in binary, plus the sign.
+    type buffer[(sizeof(T) * 8U) + 1U];
+    type* const end = buffer + ((sizeof(T) * 8U) + 1U);
 
     const bool negative = etl::is_negative(value);
 
+    // Negate as unsigned, so that the minimum value is not an overflow.
+    const unsigned_type magnitude = negative ? unsigned_type(unsigned_type(0) - unsigned_type(value))
+                                             : unsigned_type(value);
+
+    type* p = private_to_string::write_digits(end, magnitude, format.base(), format.upper_case());
+
+    if ((format.base() == 10) && negative)
+    {
+      *--p = type('-');
+    }
+
     if (!append)
     {
       str.clear();
     }
 
-    iterator start = str.end();
+    private_to_string::append_padded(str, p, uint32_t(end - p), format);
 
-    if (value == 0)
-    {
-      str.push_back(type('0'));
-    }
-    else
-    {
-      // Extract the digits, in reverse order.
-      while (value != 0)
-      {
-        T remainder = etl::absolute(value % T(format.base()));
-        str.push_back((remainder > 9) ? (format.upper_case() ? type('A' + (remainder - 10)) : type('a' + (remainder - 10))) : type('0' + remainder));
-        value = value / T(format.base());
-      }
+    return str;
+  }
 
-      // If number is negative, append '-'
-      if ((format.base() == 10) && negative)
-      {
-        str.push_back(type('-'));
-      }
+  //***************************************************************************
+  /// Helper function for floating point.
+  /// Writes the shortest text that reads back as the same value, in fixed
+  /// notation or, for very large or small values, in scientific notation.
+  /// long double is formatted at double precision.
+  /// The base and case of the format are ignored.
+  //***************************************************************************
+  template <typename T, typename TIString>
+  typename etl::enable_if<etl::is_floating_point<T>::value, TIString&>::type
+    to_string_helper(T value,
+                     TIString& str,
+                     const etl::basic_format_spec<TIString>& format,
+                     const bool append)
+  {
+    typedef typename TIString::value_type type;
+    typedef typename etl::conditional<etl::is_same<T, float>::value, float, double>::type float_type;
 
-      // Reverse the string we appended.
-      std::reverse(start, str.end());
-    }
+    char text[private_grisu::Buffer_Size];
+    const int length = private_grisu::format(float_type(value), text);
 
-    // Do we have a width specification?
-    if (format.width() != 0)
-    {
-      uint32_t length = static_cast<uint32_t>(std::distance(start, str.end()));
+    type buffer[private_grisu::Buffer_Size];
 
-      // Is the length of the string less than the width?
-      if (length < format.width())
-      {
-        uint32_t fill_length = format.width() - length;
+    for (int i = 0; i < length; ++i)
+    {
+      buffer[i] = type(text[i]);
+    }
 
-        if (format.left_justified())
-        {
-          // Insert fill characters on the right.
-          str.insert(str.end(), fill_length, format.fill());
-        }
-        else
-        {
-          // Insert fill characters on the left.
-          str.insert(start, fill_length, format.fill());
-        }
-      }
+    if (!append)
+    {
+      str.clear();
     }
 
+    private_to_string::append_padded(str, buffer, uint32_t(length), format);
+
     return str;
   }
 }
@@ -0,0 +1,655 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_UNORDERED_FLAT_TABLE_INCLUDED
+#define ETL_UNORDERED_FLAT_TABLE_INCLUDED
+
+///\ingroup private
+
+#include <stddef.h>
+#include <stdint.h>
+#include <new>
+
+#include "../platform.h"
+#include "../alignment.h"
+#include "../binary.h"
+#include "../type_traits.h"
+#include "../debug_count.h"
+
+#include "../stl/iterator.h"
+#include "../stl/utility.h"
+
+#if !defined(ETL_UNORDERED_FLAT_NO_SSE2) && defined(ETL_TARGET_DEVICE_X86) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+  #define ETL_UNORDERED_FLAT_SSE2
+#endif
+
+#if defined(ETL_UNORDERED_FLAT_SSE2)
+  #include <emmintrin.h>
+#endif
+
+namespace etl
+{
+  namespace private_unordered_flat
+  {
+    //*************************************************************************
+    /// Each slot has a control byte.
+    /// Full slots hold the low 7 bits of the hash, so the top bit is clear.
+    //*************************************************************************
+    typedef uint8_t ctrl_t;
+
+    static const ctrl_t CTRL_EMPTY   = 0x80;
+    static const ctrl_t CTRL_DELETED = 0xFE;
+
+    /// The number of control bytes examined in each probe.
+    static const size_t GROUP_WIDTH = 16;
+
+    //*************************************************************************
+    inline bool is_full(ctrl_t ctrl)
+    {
+      return (ctrl & 0x80) == 0;
+    }
+
+    //*************************************************************************
+    /// Calculates the number of slots needed for MAX_SIZE elements.
+    /// A power of two, multiple of GROUP_WIDTH, at most 7/8 full.
+    //*************************************************************************
+    template <const size_t MAX_SIZE, const size_t SLOTS = GROUP_WIDTH, const bool LARGE_ENOUGH = ((SLOTS - (SLOTS / 8)) >= MAX_SIZE)>
+    struct slot_count
+    {
+      static const size_t value = slot_count<MAX_SIZE, SLOTS * 2>::value;
+    };
+
+    template <const size_t MAX_SIZE, const size_t SLOTS>
+    struct slot_count<MAX_SIZE, SLOTS, true>
+    {
+      static const size_t value = SLOTS;
+    };
+
+    //*************************************************************************
+    /// Spreads the bits of the hash.
+    /// Many etl::hash specialisations return the value itself, which would
+    /// otherwise crowd consecutive keys into the same group.
+    //*************************************************************************
+    inline size_t mix_hash(uint32_t hash)
+    {
+      hash *= 0x9E3779B1UL;
+
+      return size_t(hash ^ (hash >> 15));
+    }
+
+    inline size_t mix_hash(uint64_t hash)
+    {
+      hash *= 0x9E3779B97F4A7C15ULL;
+
+      return size_t(hash ^ (hash >> 32));
+    }
+
+    //*************************************************************************
+    /// A set of slots within a group, one bit per slot.
+    //*************************************************************************
+    class bitmask
+    {
+    public:
+
+      explicit bitmask(uint32_t mask_)
+        : mask(mask_)
+      {
+      }
+
+      bool any() const
+      {
+        return mask != 0;
+      }
+
+      size_t lowest() const
+      {
+        return etl::count_trailing_zeros(mask);
+      }
+
+      void clear_lowest()
+      {
+        mask &= (mask - 1);
+      }
+
+    private:
+
+      uint32_t mask;
+    };
+
+#if defined(ETL_UNORDERED_FLAT_SSE2)
+    //*************************************************************************
+    /// A group of control bytes, matched with SSE2.
+    //*************************************************************************
+    class group
+    {
+    public:
+
+      explicit group(const ctrl_t* pctrl)
+        : ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pctrl)))
+      {
+      }
+
+      bitmask match(ctrl_t h2) const
+      {
+        return bitmask(uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(char(h2)), ctrl))));
+      }
+
+      bitmask match_empty() const
+      {
+        return bitmask(uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(char(CTRL_EMPTY)), ctrl))));
+      }
+
+      bitmask match_empty_or_deleted() const
+      {
+        return bitmask(uint32_t(_mm_movemask_epi8(ctrl)));
+      }
+
+    private:
+
+      __m128i ctrl;
+    };
+#else
+    static const uint64_t LSBS = 0x0101010101010101ULL;
+    static const uint64_t MSBS = 0x8080808080808080ULL;
+
+    //*************************************************************************
+    /// A group of control bytes, matched eight at a time in 64 bit words.
+    //*************************************************************************
+    class group
+    {
+    public:
+
+      explicit group(const ctrl_t* pctrl)
+      {
+        low  = load(pctrl);
+        high = load(pctrl + 8);
+      }
+
+      bitmask match(ctrl_t h2) const
+      {
+        return bitmask(combine(match_word(low, h2), match_word(high, h2)));
+      }
+
+      bitmask match_empty() const
+      {
+        // Empty has the top bit set and the next bit clear.
+        return bitmask(combine(low & ~(low << 1) & MSBS, high & ~(high << 1) & MSBS));
+      }
+
+      bitmask match_empty_or_deleted() const
+      {
+        return bitmask(combine(low & MSBS, high & MSBS));
+      }
+
+    private:
+
+      //***********************************
+      static uint64_t load(const ctrl_t* pctrl)
+      {
+        uint64_t word = 0;
+
+        for (size_t i = 0; i < 8; ++i)
+        {
+          word |= uint64_t(pctrl[i]) << (i * 8);
+        }
+
+        return word;
+      }
+
+      //***********************************
+      /// May report false positives in bytes following a match.
+      /// These are always full slots, and the keys are compared anyway.
+      //***********************************
+      static uint64_t match_word(uint64_t word, ctrl_t h2)
+      {
+        const uint64_t x = word ^ (LSBS * h2);
+
+        return (x - LSBS) & ~x & MSBS;
+      }
+
+      //***********************************
+      /// Gathers the top bit of each byte into consecutive bits.
+      //***********************************
+      static uint32_t combine(uint64_t low_msbs, uint64_t high_msbs)
+      {
+        const uint64_t GATHER = 0x0102040810204080ULL;
+
+        return uint32_t(((low_msbs >> 7) * GATHER) >> 56) | (uint32_t(((high_msbs >> 7) * GATHER) >> 56) << 8);
+      }
+
+      uint64_t low;
+      uint64_t high;
+    };
+#endif
+
+    //*************************************************************************
+    /// The sequence of groups visited for a hash.
+    /// Triangular steps visit every group when the count is a power of two.
+    //*************************************************************************
+    class probe_sequence
+    {
+    public:
+
+      probe_sequence(size_t hash, size_t group_mask_)
+        : group_mask(group_mask_),
+          group_index(hash & group_mask_),
+          step(0)
+      {
+      }
+
+      size_t offset() const
+      {
+        return group_index * GROUP_WIDTH;
+      }
+
+      void next()
+      {
+        ++step;
+        group_index = (group_index + step) & group_mask;
+      }
+
+    private:
+
+      size_t group_mask;
+      size_t group_index;
+      size_t step;
+    };
+
+    //*************************************************************************
+    /// Extracts the key from a value stored in a set.
+    //*************************************************************************
+    template <typename TKey>
+    struct key_of_value
+    {
+      static const TKey& get(const TKey& value)
+      {
+        return value;
+      }
+    };
+
+    //*************************************************************************
+    /// Extracts the key from a value stored in a map.
+    //*************************************************************************
+    template <typename TKey, typename TMapped>
+    struct key_of_pair
+    {
+      static const TKey& get(const std::pair<const TKey, TMapped>& value)
+      {
+        return value.first;
+      }
+    };
+
+    //*************************************************************************
+    /// An open addressing hash table with values stored inline.
+    /// The storage is supplied by the owning container.
+    //*************************************************************************
+    template <typename TKey, typename TValue, typename TKeyOf, typename THash, typename TKeyEqual>
+    class table
+    {
+    public:
+
+      static const size_t npos = size_t(-1);
+
+      //***********************************
+      table(ctrl_t* pctrl_, TValue* pslots_, size_t number_of_slots_, size_t max_size_)
+        : pctrl(pctrl_),
+          pslots(pslots_),
+          number_of_slots(number_of_slots_),
+          maximum_size(max_size_),
+          growth_limit(number_of_slots_ - (number_of_slots_ / 8)),
+          current_size(0),
+          growth_left(growth_limit)
+      {
+        for (size_t i = 0; i < number_of_slots; ++i)
+        {
+          pctrl[i] = CTRL_EMPTY;
+        }
+      }
+
+      //***********************************
+      size_t hash(const TKey& key) const
+      {
+        return mix_hash(static_cast<typename etl::conditional<sizeof(size_t) == sizeof(uint64_t), uint64_t, uint32_t>::type>(key_hash_function(key)));
+      }
+
+      //***********************************
+      /// Finds the slot holding the key.
+      ///\return The slot index, or npos.
+      //***********************************
+      size_t find(const TKey& key) const
+      {
+        return find(key, hash(key));
+      }
+
+      //***********************************
+      size_t find(const TKey& key, size_t hash_value) const
+      {
+        const ctrl_t h2 = get_h2(hash_value);
+
+        probe_sequence sequence(get_h1(hash_value), group_mask());
+
+        // There is always at least one empty slot, so this terminates.
+        while (true)
+        {
+          const size_t offset = sequence.offset();
+          const group  g(pctrl + offset);
+
+          bitmask matches = g.match(h2);
+
+          while (matches.any())
+          {
+            const size_t index = offset + matches.lowest();
+
+            if ((pctrl[index] == h2) && key_equal_function(key, TKeyOf::get(pslots[index])))
+            {
+              return index;
+            }
+
+            matches.clear_lowest();
+          }
+
+          if (g.match_empty().any())
+          {
+            return npos;
+          }
+
+          sequence.next();
+        }
+      }
+
+      //***********************************
+      /// Inserts a value, if the key is not already present.
+      ///\return The slot index and whether it was inserted.
+      /// The index is npos if the table is full.
+      //***********************************
+      std::pair<size_t, bool> insert(const TValue& value)
+      {
+        const TKey&  key        = TKeyOf::get(value);
+        const size_t hash_value = hash(key);
+        const size_t found      = find(key, hash_value);
+
+        if (found != npos)
+        {
+          return std::pair<size_t, bool>(found, false);
+        }
+
+        if (current_size == maximum_size)
+        {
+          return std::pair<size_t, bool>(npos, false);
+        }
+
+        size_t index = find_first_non_full(hash_value);
+
+        // Out of empty slots? Reclaim the deleted ones.
+        if ((growth_left == 0) && (pctrl[index] == CTRL_EMPTY))
+        {
+          drop_deleted();
+          index = find_first_non_full(hash_value);
+        }
+
+        if (pctrl[index] == CTRL_EMPTY)
+        {
+          --growth_left;
+        }
+
+        ::new (pslots + index) TValue(value);
+        pctrl[index] = get_h2(hash_value);
+        ++current_size;
+        ETL_INCREMENT_DEBUG_COUNT
+
+        return std::pair<size_t, bool>(index, true);
+      }
+
+      //***********************************
+      /// Erases the value in a full slot.
+      //***********************************
+      void erase(size_t index)
+      {
+        pslots[index].~TValue();
+        --current_size;
+        ETL_DECREMENT_DEBUG_COUNT
+
+        // If the group has an empty slot then no probe has ever passed
+        // through it, so this slot can become empty too.
+        const group g(pctrl + (index - (index % GROUP_WIDTH)));
+
+        if (g.match_empty().any())
+        {
+          pctrl[index] = CTRL_EMPTY;
+          ++growth_left;
+        }
+        else
+        {
+          pctrl[index] = CTRL_DELETED;
+        }
+      }
+
+      //***********************************
+      /// Destroys all of the values.
+      //***********************************
+      void clear()
+      {
+        if (current_size != 0)
+        {
+          for (size_t i = 0; i < number_of_slots; ++i)
+          {
+            if (is_full(pctrl[i]))
+            {
+              pslots[i].~TValue();
+              ETL_DECREMENT_DEBUG_COUNT
+            }
+          }
+        }
+
+        for (size_t i = 0; i < number_of_slots; ++i)
+        {
+          pctrl[i] = CTRL_EMPTY;
+        }
+
+        current_size = 0;
+        growth_left  = growth_limit;
+      }
+
+      //***********************************
+      /// Finds the first full slot at or after 'index'.
+      ///\return The slot index, or the number of slots.
+      //***********************************
+      size_t next_full(size_t index) const
+      {
+        while ((index < number_of_slots) && !is_full(pctrl[index]))
+        {
+          ++index;
+        }
+
+        return index;
+      }
+
+      //***********************************
+      TValue& slot(size_t index)
+      {
+        return pslots[index];
+      }
+
+      //***********************************
+      const TValue& slot(size_t index) const
+      {
+        return pslots[index];
+      }
+
+      //***********************************
+      size_t size() const
+      {
+        return current_size;
+      }
+
+      //***********************************
+      size_t max_size() const
+      {
+        return maximum_size;
+      }
+
+      //***********************************
+      size_t slot_count() const
+      {
+        return number_of_slots;
+      }
+
+      //***********************************
+      THash hash_function() const
+      {
+        return key_hash_function;
+      }
+
+      //***********************************
+      TKeyEqual key_eq() const
+      {
+        return key_equal_function;
+      }
+
+    private:
+
+      //***********************************
+      static size_t get_h1(size_t hash_value)
+      {
+        return hash_value >> 7;
+      }
+
+      //***********************************
+      static ctrl_t get_h2(size_t hash_value)
+      {
+        return ctrl_t(hash_value & 0x7F);
+      }
+
+      //***********************************
+      size_t group_mask() const
+      {
+        return (number_of_slots / GROUP_WIDTH) - 1;
+      }
+
+      //***********************************
+      /// Finds the first empty or deleted slot in the probe sequence.
+      //***********************************
+      size_t find_first_non_full(size_t hash_value) const
+      {
+        probe_sequence sequence(get_h1(hash_value), group_mask());
+
+        while (true)
+        {
+          const bitmask available = group(pctrl + sequence.offset()).match_empty_or_deleted();
+
+          if (available.any())
+          {
+            return sequence.offset() + available.lowest();
+          }
+
+          sequence.next();
+        }
+      }
+
+      //***********************************
+      /// Rehashes in place, turning all deleted slots back into empty ones.
+      /// Every full slot is first marked as deleted, then each value is placed
+      /// at the first free slot in its probe sequence.
+      //***********************************
+      void drop_deleted()
+      {
+        for (size_t i = 0; i < number_of_slots; ++i)
+        {
+          pctrl[i] = is_full(pctrl[i]) ? CTRL_DELETED : CTRL_EMPTY;
+        }
+
+        for (size_t i = 0; i < number_of_slots; ++i)
+        {
+          if (pctrl[i] != CTRL_DELETED)
+          {
+            continue;
+          }
+
+          const size_t hash_value = hash(TKeyOf::get(pslots[i]));
+          const size_t target     = find_first_non_full(hash_value);
+
+          if ((target / GROUP_WIDTH) == (i / GROUP_WIDTH))
+          {
+            // Already in the best group.
+            pctrl[i] = get_h2(hash_value);
+          }
+          else if (pctrl[target] == CTRL_EMPTY)
+          {
+            ::new (pslots + target) TValue(pslots[i]);
+            pslots[i].~TValue();
+            pctrl[target] = get_h2(hash_value);
+            pctrl[i]      = CTRL_EMPTY;
+          }
+          else
+          {
+            // The target holds a value that has yet to be placed.
+            // Swap them and process this slot again.
+            typename etl::aligned_storage<sizeof(TValue), etl::alignment_of<TValue>::value>::type buffer;
+            TValue* ptemp = reinterpret_cast<TValue*>(&buffer);
+
+            ::new (ptemp) TValue(pslots[i]);
+            pslots[i].~TValue();
+            ::new (pslots + i) TValue(pslots[target]);
+            pslots[target].~TValue();
+            ::new (pslots + target) TValue(*ptemp);
+            ptemp->~TValue();
+
+            pctrl[target] = get_h2(hash_value);
+            --i;
+          }
+        }
+
+        growth_left = growth_limit - current_size;
+      }
+
+      // Disable copy construction and assignment.
+      table(const table&);
+      table& operator =(const table&);
+
+      ctrl_t*      pctrl;
+      TValue*      pslots;
+      const size_t number_of_slots;
+      const size_t maximum_size;
+      const size_t growth_limit;
+      size_t       current_size;
+      size_t       growth_left;
+
+      THash     key_hash_function;
+      TKeyEqual key_equal_function;
+
+      ETL_DECLARE_DEBUG_COUNT
+    };
+
+    template <typename TKey, typename TValue, typename TKeyOf, typename THash, typename TKeyEqual>
+    const size_t table<TKey, TValue, TKeyOf, THash, TKeyEqual>::npos;
+  }
+}
+
+#endif
@@ -0,0 +1,582 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MPMC_QUEUE_ATOMIC_INCLUDED
+#define ETL_MPMC_QUEUE_ATOMIC_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "alignment.h"
+#include "parameter_type.h"
+#include "atomic.h"
+#include "memory_model.h"
+#include "integral_limits.h"
+#include "nullptr.h"
+#include "static_assert.h"
+#include "type_traits.h"
+
+#undef ETL_FILE
+#define ETL_FILE "53"
+
+namespace etl
+{
+  template <const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
+  class queue_mpmc_atomic_base
+  {
+  public:
+
+    /// The type used for determining the size of queue.
+    typedef typename etl::size_type_lookup<MEMORY_MODEL>::type size_type;
+
+    /// The type used for positions and sequence numbers.
+    /// At least 32 bits, so that a thread preempted between reading a sequence
+    /// number and its compare and swap cannot see the counter wrap back to
+    /// the same value.
+    typedef typename etl::conditional<(sizeof(size_type) < sizeof(uint32_t)), uint32_t, size_type>::type position_type;
+
+    //*************************************************************************
+    /// How many items in the queue?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_type size() const
+    {
+      position_type read_position  = dequeue_position.load(etl::memory_order_acquire);
+      position_type write_position = enqueue_position.load(etl::memory_order_acquire);
+
+      position_type n = distance(read_position, write_position);
+
+      // The positions are not read at the same instant.
+      return (n > MAX_SIZE) ? MAX_SIZE : size_type(n);
+    }
+
+    //*************************************************************************
+    /// Is the queue empty?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    bool empty() const
+    {
+      return size() == 0;
+    }
+
+    //*************************************************************************
+    /// Is the queue full?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    bool full() const
+    {
+      return size() == MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// How much free space available in the queue.
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_type available() const
+    {
+      return MAX_SIZE - size();
+    }
+
+    //*************************************************************************
+    /// How many items can the queue hold.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// How many items can the queue hold.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return MAX_SIZE;
+    }
+
+  protected:
+
+    queue_mpmc_atomic_base(size_type max_size_, position_type wrap_)
+      : enqueue_position(0),
+        dequeue_position(0),
+        MAX_SIZE(max_size_),
+        WRAP(wrap_)
+    {
+    }
+
+    //*************************************************************************
+    /// Advances a position or sequence number, wrapping at WRAP.
+    //*************************************************************************
+    position_type advance(position_type position, position_type n) const
+    {
+      return (position >= (WRAP - n)) ? position_type(position - (WRAP - n)) : position_type(position + n);
+    }
+
+    //*************************************************************************
+    /// The distance from one position to a later one.
+    //*************************************************************************
+    position_type distance(position_type from, position_type to) const
+    {
+      return (to >= from) ? position_type(to - from) : position_type(WRAP - (from - to));
+    }
+
+    etl::atomic<position_type> enqueue_position; ///< The next position to be claimed by a producer.
+    etl::atomic<position_type> dequeue_position; ///< The next position to be claimed by a consumer.
+    const size_type            MAX_SIZE;         ///< The maximum number of items in the queue.
+    const position_type        WRAP;             ///< Positions count modulo this multiple of MAX_SIZE.
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_MPMC_QUEUE_ATOMIC) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~queue_mpmc_atomic_base()
+    {
+    }
+#else
+  protected:
+    ~queue_mpmc_atomic_base()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  ///\ingroup queue_mpmc
+  ///\brief This is the base for all queue_mpmc_atomics that contain a particular type.
+  ///\details Normally a reference to this type will be taken from a derived queue_mpmc_atomic.
+  ///\code
+  /// etl::queue_mpmc_atomic<int, 10> myQueue;
+  /// etl::iqueue_mpmc_atomic<int>& iQueue = myQueue;
+  ///\endcode
+  /// This queue supports concurrent access by multiple producers and multiple consumers
+  /// without locking. Each slot carries a sequence number that tells a producer
+  /// whether the slot is free for the current lap, and a consumer whether it has
+  /// been filled. Producers and consumers claim positions with a compare and swap
+  /// and then only contend again if they land on the same slot.
+  /// \tparam T The type of value that the queue_mpmc_atomic holds.
+  //***************************************************************************
+  template <typename T, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
+  class iqueue_mpmc_atomic : public queue_mpmc_atomic_base<MEMORY_MODEL>
+  {
+  private:
+
+    typedef typename etl::parameter_type<T>::type       parameter_t;
+    typedef etl::queue_mpmc_atomic_base<MEMORY_MODEL> base_t;
+
+  public:
+
+    typedef T                              value_type;      ///< The type stored in the queue.
+    typedef T&                             reference;       ///< A reference to the type used in the queue.
+    typedef const T&                       const_reference; ///< A const reference to the type used in the queue.
+    typedef typename base_t::size_type     size_type;       ///< The type used for determining the size of the queue.
+    typedef typename base_t::position_type position_type;   ///< The type used for positions and sequence numbers.
+
+    using base_t::enqueue_position;
+    using base_t::dequeue_position;
+    using base_t::MAX_SIZE;
+    using base_t::WRAP;
+    using base_t::advance;
+
+    //*************************************************************************
+    /// Push a value to the queue.
+    //*************************************************************************
+    bool push(parameter_t value)
+    {
+      position_type sequence;
+      cell_t* p_cell = claim_push_cell(sequence);
+
+      if (p_cell != nullptr)
+      {
+        ::new (&p_cell->value) T(value);
+
+        p_cell->sequence.store(sequence, etl::memory_order_release);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT) && !defined(ETL_QUEUE_ATOMIC_FORCE_CPP03)
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename ... Args>
+    bool emplace(Args&&... args)
+    {
+      position_type sequence;
+      cell_t* p_cell = claim_push_cell(sequence);
+
+      if (p_cell != nullptr)
+      {
+        ::new (&p_cell->value) T(std::forward<Args>(args)...);
+
+        p_cell->sequence.store(sequence, etl::memory_order_release);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+#else
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1>
+    bool emplace(const T1& value1)
+    {
+      position_type sequence;
+      cell_t* p_cell = claim_push_cell(sequence);
+
+      if (p_cell != nullptr)
+      {
+        ::new (&p_cell->value) T(value1);
+
+        p_cell->sequence.store(sequence, etl::memory_order_release);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    bool emplace(const T1& value1, const T2& value2)
+    {
+      position_type sequence;
+      cell_t* p_cell = claim_push_cell(sequence);
+
+      if (p_cell != nullptr)
+      {
+        ::new (&p_cell->value) T(value1, value2);
+
+        p_cell->sequence.store(sequence, etl::memory_order_release);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3>
+    bool emplace(const T1& value1, const T2& value2, const T3& value3)
+    {
+      position_type sequence;
+      cell_t* p_cell = claim_push_cell(sequence);
+
+      if (p_cell != nullptr)
+      {
+        ::new (&p_cell->value) T(value1, value2, value3);
+
+        p_cell->sequence.store(sequence, etl::memory_order_release);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3, typename T4>
+    bool emplace(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      position_type sequence;
+      cell_t* p_cell = claim_push_cell(sequence);
+
+      if (p_cell != nullptr)
+      {
+        ::new (&p_cell->value) T(value1, value2, value3, value4);
+
+        p_cell->sequence.store(sequence, etl::memory_order_release);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+#endif
+
+    //*************************************************************************
+    /// Pop a value from the queue.
+    //*************************************************************************
+    bool pop(reference value)
+    {
+      position_type sequence;
+      cell_t* p_cell = claim_pop_cell(sequence);
+
+      if (p_cell != nullptr)
+      {
+        T* p_value = reinterpret_cast<T*>(&p_cell->value);
+
+        value = *p_value;
+        p_value->~T();
+
+        p_cell->sequence.store(sequence, etl::memory_order_release);
+
+        return true;
+      }
+
+      // Queue is empty.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Pop a value from the queue and discard.
+    //*************************************************************************
+    bool pop()
+    {
+      position_type sequence;
+      cell_t* p_cell = claim_pop_cell(sequence);
+
+      if (p_cell != nullptr)
+      {
+        reinterpret_cast<T*>(&p_cell->value)->~T();
+
+        p_cell->sequence.store(sequence, etl::memory_order_release);
+
+        return true;
+      }
+
+      // Queue is empty.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Clear the queue.
+    //*************************************************************************
+    void clear()
+    {
+      while (pop())
+      {
+        // Do nothing.
+      }
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// A slot in the queue.
+    /// The sequence equals the slot's position when it is free for a producer,
+    /// and the position plus one when it holds a value for a consumer.
+    //*************************************************************************
+    struct cell_t
+    {
+      etl::atomic<position_type> sequence;
+      typename etl::aligned_storage<sizeof(T), etl::alignment_of<T>::value>::type value;
+    };
+
+    //*************************************************************************
+    /// The constructor that is called from derived classes.
+    //*************************************************************************
+    iqueue_mpmc_atomic(cell_t* p_cells_, size_type max_size_, position_type wrap_)
+      : base_t(max_size_, wrap_),
+        p_cells(p_cells_)
+    {
+    }
+
+    //*************************************************************************
+    /// Sets the initial sequence numbers.
+    /// Called from the derived class once the cells have been constructed.
+    //*************************************************************************
+    void initialise()
+    {
+      for (size_type i = 0; i < MAX_SIZE; ++i)
+      {
+        p_cells[i].sequence.store(position_type(i), etl::memory_order_relaxed);
+      }
+
+      enqueue_position.store(0, etl::memory_order_relaxed);
+      dequeue_position.store(0, etl::memory_order_release);
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Claims the next free slot for a producer.
+    /// Returns nullptr if the queue is full, otherwise the slot and the
+    /// sequence number that publishes it to the consumers.
+    //*************************************************************************
+    cell_t* claim_push_cell(position_type& sequence)
+    {
+      position_type position = enqueue_position.load(etl::memory_order_relaxed);
+
+      while (true)
+      {
+        cell_t& cell = p_cells[position % MAX_SIZE];
+
+        if (cell.sequence.load(etl::memory_order_acquire) == position)
+        {
+          // The slot is free. Try to claim it.
+          // On failure 'position' is updated to the current value.
+          if (enqueue_position.compare_exchange_weak(position, advance(position, 1), etl::memory_order_relaxed))
+          {
+            sequence = advance(position, 1);
+            return &cell;
+          }
+        }
+        else
+        {
+          position_type current = enqueue_position.load(etl::memory_order_relaxed);
+
+          // If no other producer has moved on, the slot is still waiting for a consumer.
+          if (current == position)
+          {
+            return nullptr;
+          }
+
+          position = current;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Claims the oldest filled slot for a consumer.
+    /// Returns nullptr if the queue is empty, otherwise the slot and the
+    /// sequence number that releases it to the producers for the next lap.
+    //*************************************************************************
+    cell_t* claim_pop_cell(position_type& sequence)
+    {
+      position_type position = dequeue_position.load(etl::memory_order_relaxed);
+
+      while (true)
+      {
+        cell_t& cell = p_cells[position % MAX_SIZE];
+
+        if (cell.sequence.load(etl::memory_order_acquire) == advance(position, 1))
+        {
+          // The slot is filled. Try to claim it.
+          // On failure 'position' is updated to the current value.
+          if (dequeue_position.compare_exchange_weak(position, advance(position, 1), etl::memory_order_relaxed))
+          {
+            sequence = advance(position, MAX_SIZE);
+            return &cell;
+          }
+        }
+        else
+        {
+          position_type current = dequeue_position.load(etl::memory_order_relaxed);
+
+          // If no other consumer has moved on, the slot is still waiting for a producer.
+          if (current == position)
+          {
+            return nullptr;
+          }
+
+          position = current;
+        }
+      }
+    }
+
+    // Disable copy construction and assignment.
+    iqueue_mpmc_atomic(const iqueue_mpmc_atomic&);
+    iqueue_mpmc_atomic& operator =(const iqueue_mpmc_atomic&);
+
+    cell_t* p_cells; ///< The internal buffer.
+  };
+
+  //***************************************************************************
+  ///\ingroup queue_mpmc
+  /// A fixed capacity lock free mpmc queue.
+  /// This queue supports concurrent access by multiple producers and multiple consumers.
+  /// \tparam T            The type this queue should support.
+  /// \tparam SIZE         The maximum capacity of the queue.
+  /// \tparam MEMORY_MODEL The memory model for the queue. Determines the type of the internal counter variables.
+  //***************************************************************************
+  template <typename T, size_t SIZE, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
+  class queue_mpmc_atomic : public etl::iqueue_mpmc_atomic<T, MEMORY_MODEL>
+  {
+  private:
+
+    typedef etl::iqueue_mpmc_atomic<T, MEMORY_MODEL> base_t;
+
+  public:
+
+    typedef typename base_t::size_type     size_type;
+    typedef typename base_t::position_type position_type;
+
+    // A 'filled' sequence number must not match the 'free' sequence number of the next lap.
+    ETL_STATIC_ASSERT((SIZE >= 2), "Size must be at least 2");
+
+    // The sequence numbers of consecutive laps must be distinct.
+    ETL_STATIC_ASSERT((SIZE <= (etl::integral_limits<size_type>::max / 2)), "Size too large for memory model");
+
+    static const size_type MAX_SIZE = size_type(SIZE);
+
+  private:
+
+    static const position_type WRAP = position_type((etl::integral_limits<position_type>::max / SIZE) * SIZE);
+
+  public:
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    queue_mpmc_atomic()
+      : base_t(cells, MAX_SIZE, WRAP)
+    {
+      base_t::initialise();
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~queue_mpmc_atomic()
+    {
+      base_t::clear();
+    }
+
+  private:
+
+    queue_mpmc_atomic(const queue_mpmc_atomic&);
+    queue_mpmc_atomic& operator = (const queue_mpmc_atomic&);
+
+    /// The slots used in the queue.
+    typename base_t::cell_t cells[MAX_SIZE];
+  };
+}
+
+#undef ETL_FILE
+
+#endif
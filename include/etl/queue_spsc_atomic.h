@@ -40,6 +40,8 @@ SOFTWARE.
 #include "atomic.h"
 #include "memory_model.h"
 #include "integral_limits.h"
+#include "array_view.h"
+#include "private/queue_spsc_batch.h"
 
 #undef ETL_FILE
 #define ETL_FILE "47"
@@ -93,7 +95,7 @@ namespace etl
       }
       else
       {
-        n = RESERVED - read_index + write_index - 1;
+        n = RESERVED - read_index + write_index;
       }
 
       return n;
@@ -129,7 +131,9 @@ namespace etl
     queue_spsc_atomic_base(size_type reserved_)
       : write(0),
         read(0),
-        RESERVED(reserved_)
+        RESERVED(reserved_),
+        reserved(0),
+        peeked(0)
     {
     }
 
@@ -151,6 +155,8 @@ namespace etl
     etl::atomic<size_type> write; ///< Where to input new data.
     etl::atomic<size_type> read;  ///< Where to get the oldest data.
     const size_type RESERVED;     ///< The maximum number of items in the queue.
+    size_type reserved;           ///< The slots left from the last write_reserve. Producer only.
+    size_type peeked;             ///< The values left from the last read_peek. Consumer only.
 
   private:
 
@@ -199,6 +205,8 @@ namespace etl
     using base_t::write;
     using base_t::read;
     using base_t::RESERVED;
+    using base_t::reserved;
+    using base_t::peeked;
     using base_t::get_next_index;
 
     //*************************************************************************
@@ -384,6 +392,123 @@ namespace etl
       return true;
     }
 
+    //*************************************************************************
+    /// Push up to 'n' values to the queue.
+    /// The write index is published once for the whole batch.
+    ///\return The number of values pushed.
+    //*************************************************************************
+    size_type push(const T* p_values, size_type n)
+    {
+      size_type write_index = write.load(etl::memory_order_relaxed);
+      size_type read_index  = read.load(etl::memory_order_acquire);
+      size_type space       = private_queue_spsc::free_slots(write_index, read_index, RESERVED);
+
+      if (n > space)
+      {
+        n = space;
+      }
+
+      if (n != 0)
+      {
+        private_queue_spsc::copy_in(p_buffer, RESERVED, write_index, p_values, n);
+
+        write.store(private_queue_spsc::advance(write_index, n, RESERVED), etl::memory_order_release);
+      }
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Pop up to 'n' values from the queue.
+    /// The read index is published once for the whole batch.
+    ///\return The number of values popped.
+    //*************************************************************************
+    size_type pop(T* p_values, size_type n)
+    {
+      size_type read_index  = read.load(etl::memory_order_relaxed);
+      size_type write_index = write.load(etl::memory_order_acquire);
+      size_type available   = private_queue_spsc::used_slots(write_index, read_index, RESERVED);
+
+      if (n > available)
+      {
+        n = available;
+      }
+
+      if (n != 0)
+      {
+        private_queue_spsc::copy_out(p_buffer, RESERVED, read_index, p_values, n);
+
+        read.store(private_queue_spsc::advance(read_index, n, RESERVED), etl::memory_order_release);
+      }
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Returns a view of the free slots that can be written without wrapping.
+    /// The slots are uninitialised; only for trivially copyable types.
+    /// Publish the written values with write_commit.
+    /// Call from the 'push' thread only.
+    //*************************************************************************
+    etl::array_view<T> write_reserve()
+    {
+      ETL_STATIC_ASSERT(etl::is_trivially_copyable<T>::value, "write_reserve requires a trivially copyable type");
+
+      size_type write_index = write.load(etl::memory_order_relaxed);
+      size_type read_index  = read.load(etl::memory_order_acquire);
+
+      reserved = private_queue_spsc::contiguous_free_slots(write_index, read_index, RESERVED);
+
+      return etl::array_view<T>(p_buffer + write_index, reserved);
+    }
+
+    //*************************************************************************
+    /// Publishes 'n' values written to the view returned by write_reserve.
+    /// 'n' must not be more than the size of that view.
+    //*************************************************************************
+    void write_commit(size_type n)
+    {
+      ETL_ASSERT(n <= reserved, ETL_ERROR(etl::queue_spsc_full));
+
+      reserved -= n;
+
+      size_type write_index = write.load(etl::memory_order_relaxed);
+
+      write.store(private_queue_spsc::advance(write_index, n, RESERVED), etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// Returns a view of the values that can be read without wrapping.
+    /// Release the values with read_release.
+    /// Call from the 'pop' thread only.
+    //*************************************************************************
+    etl::const_array_view<T> read_peek()
+    {
+      size_type read_index  = read.load(etl::memory_order_relaxed);
+      size_type write_index = write.load(etl::memory_order_acquire);
+
+      peeked = private_queue_spsc::contiguous_used_slots(write_index, read_index, RESERVED);
+
+      return etl::const_array_view<T>(p_buffer + read_index, peeked);
+    }
+
+    //*************************************************************************
+    /// Removes 'n' values from the front of the view returned by read_peek.
+    /// 'n' must not be more than the size of that view.
+    //*************************************************************************
+    void read_release(size_type n)
+    {
+      ETL_ASSERT(n <= peeked, ETL_ERROR(etl::queue_spsc_empty));
+
+      peeked -= n;
+
+      size_type read_index = read.load(etl::memory_order_relaxed);
+
+      private_queue_spsc::destroy_n(p_buffer + read_index, n);
+
+      read.store(private_queue_spsc::advance(read_index, n, RESERVED), etl::memory_order_release);
+    }
+
     //*************************************************************************
     /// Clear the queue.
     /// Must be called from thread that pops the queue or when there is no
@@ -467,6 +592,606 @@ namespace etl
     /// The uninitialised buffer of T used in the queue_spsc.
     typename etl::aligned_storage<sizeof(T), etl::alignment_of<T>::value>::type buffer[RESERVED_SIZE];
   };
+
+  //***************************************************************************
+  ///\ingroup queue_spsc_atomic
+  /// The base for the cache line padded single producer, single consumer queues.
+  /// The producer's and the consumer's indexes are kept on separate cache lines.
+  /// Each side also keeps a private copy of the other side's index and only
+  /// reloads it when the queue looks full (producer) or empty (consumer), so
+  /// the index cache lines only move between cores when they have to.
+  //***************************************************************************
+  template <const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
+  class queue_spsc_atomic_padded_base
+  {
+  public:
+
+    /// The type used for determining the size of queue.
+    typedef typename etl::size_type_lookup<MEMORY_MODEL>::type size_type;
+
+    //*************************************************************************
+    /// Is the queue empty?
+    /// Accurate from the 'pop' thread.
+    /// 'Not empty' is a guess from the 'push' thread.
+    //*************************************************************************
+    bool empty() const
+    {
+      return read.load(etl::memory_order_acquire) == write.load(etl::memory_order_acquire);
+    }
+
+    //*************************************************************************
+    /// Is the queue full?
+    /// Accurate from the 'push' thread.
+    /// 'Not full' is a guess from the 'pop' thread.
+    //*************************************************************************
+    bool full() const
+    {
+      size_type next_index = get_next_index(write.load(etl::memory_order_acquire), RESERVED);
+
+      return (next_index == read.load(etl::memory_order_acquire));
+    }
+
+    //*************************************************************************
+    /// How many items in the queue?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_type size() const
+    {
+      size_type write_index = write.load(etl::memory_order_acquire);
+      size_type read_index = read.load(etl::memory_order_acquire);
+
+      size_type n;
+
+      if (write_index >= read_index)
+      {
+        n = write_index - read_index;
+      }
+      else
+      {
+        n = RESERVED - read_index + write_index;
+      }
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// How much free space available in the queue.
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_type available() const
+    {
+      return RESERVED - size() - 1;
+    }
+
+    //*************************************************************************
+    /// How many items can the queue hold.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return RESERVED - 1;
+    }
+
+    //*************************************************************************
+    /// How many items can the queue hold.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return RESERVED - 1;
+    }
+
+  protected:
+
+    queue_spsc_atomic_padded_base(size_type reserved_)
+      : RESERVED(reserved_),
+        write(0),
+        cached_read(0),
+        reserved(0),
+        read(0),
+        cached_write(0),
+        peeked(0)
+    {
+    }
+
+    //*************************************************************************
+    /// Calculate the next index.
+    //*************************************************************************
+    static size_type get_next_index(size_type index, size_type maximum)
+    {
+      ++index;
+
+      if (index == maximum)
+      {
+        index = 0;
+      }
+
+      return index;
+    }
+
+    // Read only after construction. Shared by both sides.
+    const size_type RESERVED;                ///< The maximum number of items in the queue.
+    char padding_reserved[ETL_CACHE_LINE_SIZE];
+
+    // Written by the producer.
+    etl::atomic<size_type> write;            ///< Where to input new data.
+    size_type cached_read;                   ///< The producer's last known value of 'read'.
+    size_type reserved;                      ///< The slots left from the last write_reserve.
+    char padding_write[ETL_CACHE_LINE_SIZE];
+
+    // Written by the consumer.
+    etl::atomic<size_type> read;             ///< Where to get the oldest data.
+    size_type cached_write;                  ///< The consumer's last known value of 'write'.
+    size_type peeked;                        ///< The values left from the last read_peek.
+    char padding_read[ETL_CACHE_LINE_SIZE];
+
+  private:
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_SPSC_QUEUE_ATOMIC) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~queue_spsc_atomic_padded_base()
+    {
+    }
+#else
+  protected:
+    ~queue_spsc_atomic_padded_base()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  ///\ingroup queue_spsc_atomic
+  ///\brief This is the base for all queue_spsc_atomic_padded that contain a particular type.
+  ///\details Normally a reference to this type will be taken from a derived queue_spsc_atomic_padded.
+  ///\code
+  /// etl::queue_spsc_atomic_padded<int, 10> myQueue;
+  /// etl::iqueue_spsc_atomic_padded<int>& iQueue = myQueue;
+  ///\endcode
+  /// This queue supports concurrent access by one producer and one consumer.
+  /// \tparam T The type of value that the queue_spsc_atomic_padded holds.
+  //***************************************************************************
+  template <typename T, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
+  class iqueue_spsc_atomic_padded : public queue_spsc_atomic_padded_base<MEMORY_MODEL>
+  {
+  private:
+
+    typedef typename etl::parameter_type<T>::type                     parameter_t;
+    typedef typename etl::queue_spsc_atomic_padded_base<MEMORY_MODEL> base_t;
+
+  public:
+
+    typedef T                          value_type;      ///< The type stored in the queue.
+    typedef T&                         reference;       ///< A reference to the type used in the queue.
+    typedef const T&                   const_reference; ///< A const reference to the type used in the queue.
+    typedef typename base_t::size_type size_type;       ///< The type used for determining the size of the queue.
+
+    using base_t::write;
+    using base_t::read;
+    using base_t::cached_write;
+    using base_t::cached_read;
+    using base_t::reserved;
+    using base_t::peeked;
+    using base_t::RESERVED;
+    using base_t::get_next_index;
+
+    //*************************************************************************
+    /// Push a value to the queue.
+    //*************************************************************************
+    bool push(parameter_t value)
+    {
+      size_type write_index = write.load(etl::memory_order_relaxed);
+      size_type next_index  = get_next_index(write_index, RESERVED);
+
+      if (has_space(next_index))
+      {
+        ::new (&p_buffer[write_index]) T(value);
+
+        write.store(next_index, etl::memory_order_release);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT) && !defined(ETL_QUEUE_ATOMIC_FORCE_CPP03)
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename ... Args>
+    bool emplace(Args&&... args)
+    {
+      size_type write_index = write.load(etl::memory_order_relaxed);
+      size_type next_index  = get_next_index(write_index, RESERVED);
+
+      if (has_space(next_index))
+      {
+        ::new (&p_buffer[write_index]) T(std::forward<Args>(args)...);
+
+        write.store(next_index, etl::memory_order_release);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+#else
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1>
+    bool emplace(const T1& value1)
+    {
+      size_type write_index = write.load(etl::memory_order_relaxed);
+      size_type next_index  = get_next_index(write_index, RESERVED);
+
+      if (has_space(next_index))
+      {
+        ::new (&p_buffer[write_index]) T(value1);
+
+        write.store(next_index, etl::memory_order_release);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    bool emplace(const T1& value1, const T2& value2)
+    {
+      size_type write_index = write.load(etl::memory_order_relaxed);
+      size_type next_index  = get_next_index(write_index, RESERVED);
+
+      if (has_space(next_index))
+      {
+        ::new (&p_buffer[write_index]) T(value1, value2);
+
+        write.store(next_index, etl::memory_order_release);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3>
+    bool emplace(const T1& value1, const T2& value2, const T3& value3)
+    {
+      size_type write_index = write.load(etl::memory_order_relaxed);
+      size_type next_index  = get_next_index(write_index, RESERVED);
+
+      if (has_space(next_index))
+      {
+        ::new (&p_buffer[write_index]) T(value1, value2, value3);
+
+        write.store(next_index, etl::memory_order_release);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3, typename T4>
+    bool emplace(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      size_type write_index = write.load(etl::memory_order_relaxed);
+      size_type next_index  = get_next_index(write_index, RESERVED);
+
+      if (has_space(next_index))
+      {
+        ::new (&p_buffer[write_index]) T(value1, value2, value3, value4);
+
+        write.store(next_index, etl::memory_order_release);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+#endif
+
+    //*************************************************************************
+    /// Pop a value from the queue.
+    //*************************************************************************
+    bool pop(reference value)
+    {
+      size_type read_index = read.load(etl::memory_order_relaxed);
+
+      if (!has_data(read_index))
+      {
+        // Queue is empty
+        return false;
+      }
+
+      size_type next_index = get_next_index(read_index, RESERVED);
+
+      value = p_buffer[read_index];
+      p_buffer[read_index].~T();
+
+      read.store(next_index, etl::memory_order_release);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Pop a value from the queue and discard.
+    //*************************************************************************
+    bool pop()
+    {
+      size_type read_index = read.load(etl::memory_order_relaxed);
+
+      if (!has_data(read_index))
+      {
+        // Queue is empty
+        return false;
+      }
+
+      size_type next_index = get_next_index(read_index, RESERVED);
+
+      p_buffer[read_index].~T();
+
+      read.store(next_index, etl::memory_order_release);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Push up to 'n' values to the queue.
+    /// The write index is published once for the whole batch.
+    ///\return The number of values pushed.
+    //*************************************************************************
+    size_type push(const T* p_values, size_type n)
+    {
+      size_type write_index = write.load(etl::memory_order_relaxed);
+      size_type space       = private_queue_spsc::free_slots(write_index, cached_read, RESERVED);
+
+      if (n > space)
+      {
+        cached_read = read.load(etl::memory_order_acquire);
+        space       = private_queue_spsc::free_slots(write_index, cached_read, RESERVED);
+
+        if (n > space)
+        {
+          n = space;
+        }
+      }
+
+      if (n != 0)
+      {
+        private_queue_spsc::copy_in(p_buffer, RESERVED, write_index, p_values, n);
+
+        write.store(private_queue_spsc::advance(write_index, n, RESERVED), etl::memory_order_release);
+      }
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Pop up to 'n' values from the queue.
+    /// The read index is published once for the whole batch.
+    ///\return The number of values popped.
+    //*************************************************************************
+    size_type pop(T* p_values, size_type n)
+    {
+      size_type read_index = read.load(etl::memory_order_relaxed);
+      size_type available  = private_queue_spsc::used_slots(cached_write, read_index, RESERVED);
+
+      if (n > available)
+      {
+        cached_write = write.load(etl::memory_order_acquire);
+        available    = private_queue_spsc::used_slots(cached_write, read_index, RESERVED);
+
+        if (n > available)
+        {
+          n = available;
+        }
+      }
+
+      if (n != 0)
+      {
+        private_queue_spsc::copy_out(p_buffer, RESERVED, read_index, p_values, n);
+
+        read.store(private_queue_spsc::advance(read_index, n, RESERVED), etl::memory_order_release);
+      }
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Returns a view of the free slots that can be written without wrapping.
+    /// The slots are uninitialised; only for trivially copyable types.
+    /// Publish the written values with write_commit.
+    /// Call from the 'push' thread only.
+    //*************************************************************************
+    etl::array_view<T> write_reserve()
+    {
+      ETL_STATIC_ASSERT(etl::is_trivially_copyable<T>::value, "write_reserve requires a trivially copyable type");
+
+      size_type write_index = write.load(etl::memory_order_relaxed);
+
+      cached_read = read.load(etl::memory_order_acquire);
+      reserved    = private_queue_spsc::contiguous_free_slots(write_index, cached_read, RESERVED);
+
+      return etl::array_view<T>(p_buffer + write_index, reserved);
+    }
+
+    //*************************************************************************
+    /// Publishes 'n' values written to the view returned by write_reserve.
+    /// 'n' must not be more than the size of that view.
+    //*************************************************************************
+    void write_commit(size_type n)
+    {
+      ETL_ASSERT(n <= reserved, ETL_ERROR(etl::queue_spsc_full));
+
+      reserved -= n;
+
+      size_type write_index = write.load(etl::memory_order_relaxed);
+
+      write.store(private_queue_spsc::advance(write_index, n, RESERVED), etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// Returns a view of the values that can be read without wrapping.
+    /// Release the values with read_release.
+    /// Call from the 'pop' thread only.
+    //*************************************************************************
+    etl::const_array_view<T> read_peek()
+    {
+      size_type read_index = read.load(etl::memory_order_relaxed);
+
+      cached_write = write.load(etl::memory_order_acquire);
+      peeked       = private_queue_spsc::contiguous_used_slots(cached_write, read_index, RESERVED);
+
+      return etl::const_array_view<T>(p_buffer + read_index, peeked);
+    }
+
+    //*************************************************************************
+    /// Removes 'n' values from the front of the view returned by read_peek.
+    /// 'n' must not be more than the size of that view.
+    //*************************************************************************
+    void read_release(size_type n)
+    {
+      ETL_ASSERT(n <= peeked, ETL_ERROR(etl::queue_spsc_empty));
+
+      peeked -= n;
+
+      size_type read_index = read.load(etl::memory_order_relaxed);
+
+      private_queue_spsc::destroy_n(p_buffer + read_index, n);
+
+      read.store(private_queue_spsc::advance(read_index, n, RESERVED), etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// Clear the queue.
+    /// Must be called from thread that pops the queue or when there is no
+    /// possibility of concurrent access.
+    //*************************************************************************
+    void clear()
+    {
+      while (pop())
+      {
+        // Do nothing.
+      }
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// The constructor that is called from derived classes.
+    //*************************************************************************
+    iqueue_spsc_atomic_padded(T* p_buffer_, size_type reserved_)
+      : base_t(reserved_),
+        p_buffer(p_buffer_)
+    {
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Producer side. Is there space for an item that would move 'write' to next_index?
+    /// Only reloads 'read' if the cached copy says that the queue is full.
+    //*************************************************************************
+    bool has_space(size_type next_index)
+    {
+      if (next_index == cached_read)
+      {
+        cached_read = read.load(etl::memory_order_acquire);
+      }
+
+      return (next_index != cached_read);
+    }
+
+    //*************************************************************************
+    /// Consumer side. Is there an item at read_index?
+    /// Only reloads 'write' if the cached copy says that the queue is empty.
+    //*************************************************************************
+    bool has_data(size_type read_index)
+    {
+      if (read_index == cached_write)
+      {
+        cached_write = write.load(etl::memory_order_acquire);
+      }
+
+      return (read_index != cached_write);
+    }
+
+    // Disable copy construction and assignment.
+    iqueue_spsc_atomic_padded(const iqueue_spsc_atomic_padded&);
+    iqueue_spsc_atomic_padded& operator =(const iqueue_spsc_atomic_padded&);
+
+    T* p_buffer; ///< The internal buffer.
+  };
+
+  //***************************************************************************
+  ///\ingroup queue_spsc
+  /// A fixed capacity spsc queue with the indexes on separate cache lines.
+  /// This queue supports concurrent access by one producer and one consumer.
+  /// \tparam T            The type this queue should support.
+  /// \tparam SIZE         The maximum capacity of the queue.
+  /// \tparam MEMORY_MODEL The memory model for the queue. Determines the type of the internal counter variables.
+  //***************************************************************************
+  template <typename T, size_t SIZE, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
+  class queue_spsc_atomic_padded : public iqueue_spsc_atomic_padded<T, MEMORY_MODEL>
+  {
+  private:
+
+    typedef typename etl::iqueue_spsc_atomic_padded<T, MEMORY_MODEL> base_t;
+
+  public:
+
+    typedef typename base_t::size_type size_type;
+
+  private:
+
+    static const size_type RESERVED_SIZE = size_type(SIZE + 1);
+
+  public:
+
+    ETL_STATIC_ASSERT((SIZE <= (etl::integral_limits<size_type>::max - 1)), "Size too large for memory model");
+
+    static const size_type MAX_SIZE = size_type(SIZE);
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    queue_spsc_atomic_padded()
+      : base_t(reinterpret_cast<T*>(&buffer[0]), RESERVED_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~queue_spsc_atomic_padded()
+    {
+      base_t::clear();
+    }
+
+  private:
+
+    /// The uninitialised buffer of T used in the queue_spsc.
+    typename etl::aligned_storage<sizeof(T), etl::alignment_of<T>::value>::type buffer[RESERVED_SIZE];
+  };
 }
 
 #undef ETL_FILE
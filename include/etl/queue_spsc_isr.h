@@ -39,6 +39,8 @@ SOFTWARE.
 #include "parameter_type.h"
 #include "memory_model.h"
 #include "integral_limits.h"
+#include "array_view.h"
+#include "private/queue_spsc_batch.h"
 
 #undef ETL_FILE
 #define ETL_FILE "46"
@@ -98,6 +100,61 @@ namespace etl
       return pop_implementation();
     }
 
+    //*************************************************************************
+    /// Push up to 'n' values to the queue from an ISR.
+    ///\return The number of values pushed.
+    //*************************************************************************
+    size_type push_from_isr(const T* p_values, size_type n)
+    {
+      return push_implementation(p_values, n);
+    }
+
+    //*************************************************************************
+    /// Pop up to 'n' values from the queue from an ISR.
+    ///\return The number of values popped.
+    //*************************************************************************
+    size_type pop_from_isr(T* p_values, size_type n)
+    {
+      return pop_implementation(p_values, n);
+    }
+
+    //*************************************************************************
+    /// Returns a view of the free slots that can be written without wrapping, from an ISR.
+    /// The slots are uninitialised; only for trivially copyable types.
+    //*************************************************************************
+    etl::array_view<T> write_reserve_from_isr()
+    {
+      return write_reserve_implementation();
+    }
+
+    //*************************************************************************
+    /// Publishes 'n' values written to the view returned by write_reserve, from an ISR.
+    //*************************************************************************
+    void write_commit_from_isr(size_type n)
+    {
+      ETL_ASSERT(n <= this->reserved, ETL_ERROR(etl::queue_spsc_full));
+
+      write_commit_implementation(n);
+    }
+
+    //*************************************************************************
+    /// Returns a view of the values that can be read without wrapping, from an ISR.
+    //*************************************************************************
+    etl::const_array_view<T> read_peek_from_isr()
+    {
+      return read_peek_implementation();
+    }
+
+    //*************************************************************************
+    /// Removes 'n' values from the front of the view returned by read_peek, from an ISR.
+    //*************************************************************************
+    void read_release_from_isr(size_type n)
+    {
+      ETL_ASSERT(n <= this->peeked, ETL_ERROR(etl::queue_spsc_empty));
+
+      read_release_implementation(n);
+    }
+
     //*************************************************************************
     /// How much free space available in the queue.
     /// Called from ISR.
@@ -168,7 +225,9 @@ namespace etl
         write_index(0),
         read_index(0),
         current_size(0),
-        MAX_SIZE(max_size_)
+        MAX_SIZE(max_size_),
+        reserved(0),
+        peeked(0)
     {
     }
 
@@ -347,6 +406,95 @@ namespace etl
       return true;
     }
 
+    //*************************************************************************
+    /// Push up to 'n' values to the queue.
+    //*************************************************************************
+    size_type push_implementation(const T* p_values, size_type n)
+    {
+      size_type space = MAX_SIZE - current_size;
+
+      if (n > space)
+      {
+        n = space;
+      }
+
+      private_queue_spsc::copy_in(p_buffer, MAX_SIZE, write_index, p_values, n);
+
+      write_index   = private_queue_spsc::advance(write_index, n, MAX_SIZE);
+      current_size += n;
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Pop up to 'n' values from the queue.
+    //*************************************************************************
+    size_type pop_implementation(T* p_values, size_type n)
+    {
+      if (n > current_size)
+      {
+        n = current_size;
+      }
+
+      private_queue_spsc::copy_out(p_buffer, MAX_SIZE, read_index, p_values, n);
+
+      read_index    = private_queue_spsc::advance(read_index, n, MAX_SIZE);
+      current_size -= n;
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// The free slots that can be written without wrapping.
+    //*************************************************************************
+    etl::array_view<T> write_reserve_implementation()
+    {
+      ETL_STATIC_ASSERT(etl::is_trivially_copyable<T>::value, "write_reserve requires a trivially copyable type");
+
+      size_type space      = MAX_SIZE - current_size;
+      size_type contiguous = MAX_SIZE - write_index;
+
+      reserved = (space < contiguous) ? space : contiguous;
+
+      return etl::array_view<T>(p_buffer + write_index, reserved);
+    }
+
+    //*************************************************************************
+    /// Publishes 'n' reserved slots.
+    //*************************************************************************
+    void write_commit_implementation(size_type n)
+    {
+      reserved -= n;
+
+      write_index   = private_queue_spsc::advance(write_index, n, MAX_SIZE);
+      current_size += n;
+    }
+
+    //*************************************************************************
+    /// The values that can be read without wrapping.
+    //*************************************************************************
+    etl::const_array_view<T> read_peek_implementation()
+    {
+      size_type contiguous = MAX_SIZE - read_index;
+
+      peeked = (current_size < contiguous) ? current_size : contiguous;
+
+      return etl::const_array_view<T>(p_buffer + read_index, peeked);
+    }
+
+    //*************************************************************************
+    /// Destroys and removes 'n' values from the front of the queue.
+    //*************************************************************************
+    void read_release_implementation(size_type n)
+    {
+      peeked -= n;
+
+      private_queue_spsc::destroy_n(p_buffer + read_index, n);
+
+      read_index    = private_queue_spsc::advance(read_index, n, MAX_SIZE);
+      current_size -= n;
+    }
+
     //*************************************************************************
     /// Calculate the next index.
     //*************************************************************************
@@ -367,6 +515,8 @@ namespace etl
     size_type read_index;     ///< Where to get the oldest data.
     size_type current_size;   ///< The current size of the queue.
     const size_type MAX_SIZE; ///< The maximum number of items in the queue.
+    size_type reserved;       ///< The slots left from the last write_reserve.
+    size_type peeked;         ///< The values left from the last read_peek.
 
   private:
 
@@ -536,6 +686,103 @@ namespace etl
       return result;
     }
 
+    //*************************************************************************
+    /// Push up to 'n' values to the queue.
+    /// Interrupts are disabled once for the whole batch.
+    ///\return The number of values pushed.
+    //*************************************************************************
+    size_type push(const T* p_values, size_type n)
+    {
+      TAccess::lock();
+
+      size_type result = this->push_implementation(p_values, n);
+
+      TAccess::unlock();
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Pop up to 'n' values from the queue.
+    /// Interrupts are disabled once for the whole batch.
+    ///\return The number of values popped.
+    //*************************************************************************
+    size_type pop(T* p_values, size_type n)
+    {
+      TAccess::lock();
+
+      size_type result = this->pop_implementation(p_values, n);
+
+      TAccess::unlock();
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Returns a view of the free slots that can be written without wrapping.
+    /// The slots are uninitialised; only for trivially copyable types.
+    /// Publish the written values with write_commit.
+    /// Call from the 'push' side only.
+    //*************************************************************************
+    etl::array_view<T> write_reserve()
+    {
+      TAccess::lock();
+
+      etl::array_view<T> result = this->write_reserve_implementation();
+
+      TAccess::unlock();
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Publishes 'n' values written to the view returned by write_reserve.
+    /// 'n' must not be more than the size of that view.
+    //*************************************************************************
+    void write_commit(size_type n)
+    {
+      // Only the 'push' side changes 'reserved', so it can be checked before locking.
+      ETL_ASSERT(n <= this->reserved, ETL_ERROR(etl::queue_spsc_full));
+
+      TAccess::lock();
+
+      this->write_commit_implementation(n);
+
+      TAccess::unlock();
+    }
+
+    //*************************************************************************
+    /// Returns a view of the values that can be read without wrapping.
+    /// Release the values with read_release.
+    /// Call from the 'pop' side only.
+    //*************************************************************************
+    etl::const_array_view<T> read_peek()
+    {
+      TAccess::lock();
+
+      etl::const_array_view<T> result = this->read_peek_implementation();
+
+      TAccess::unlock();
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Removes 'n' values from the front of the view returned by read_peek.
+    /// 'n' must not be more than the size of that view.
+    //*************************************************************************
+    void read_release(size_type n)
+    {
+      // Only the 'pop' side changes 'peeked', so it can be checked before locking.
+      ETL_ASSERT(n <= this->peeked, ETL_ERROR(etl::queue_spsc_empty));
+
+      TAccess::lock();
+
+      this->read_release_implementation(n);
+
+      TAccess::unlock();
+    }
+
     //*************************************************************************
     /// Clear the queue.
     //*************************************************************************
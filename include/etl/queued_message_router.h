@@ -0,0 +1,330 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_QUEUED_MESSAGE_ROUTER_INCLUDED
+#define ETL_QUEUED_MESSAGE_ROUTER_INCLUDED
+
+#include <stddef.h>
+#include <new>
+
+#include "platform.h"
+#include "message.h"
+#include "message_router.h"
+#include "queue_mpmc_atomic.h"
+#include "memory_model.h"
+#include "alignment.h"
+#include "nullptr.h"
+#include "error_handler.h"
+#include "exception.h"
+
+#undef ETL_FILE
+#define ETL_FILE "59"
+
+//*****************************************************************************
+///\defgroup queued_message_router queued_message_router
+/// Asynchronous delivery to a message router.
+/// A queued_message_router stands in for a router. Messages that it receives
+/// are copied into the router's message_packet and pushed onto an inbox queue,
+/// so the sender returns as soon as the push completes. The router's handlers
+/// are called later, from whichever thread or task calls process_queue().
+///
+/// Subscribe the queued router to a message_bus in place of the router itself
+/// to make delivery through the bus asynchronous.
+///\code
+/// Router router(ROUTER_ID);
+/// etl::queued_message_router<Router, 16> queued_router(router);
+/// bus.subscribe(queued_router);
+///
+/// // On the router's worker thread.
+/// queued_router.process_queue();
+///\endcode
+///
+/// The inbox is a etl::queue_mpmc_atomic by default, so any number of senders
+/// may post concurrently without locking. etl::queue_spsc_atomic may be used
+/// instead when there is only one sender. Only one thread may call
+/// process_queue() for a router. Messages from each sender are then handled in
+/// the order that they were sent.
+///\ingroup messaging
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Base exception class for queued message router
+  //***************************************************************************
+  class queued_message_router_exception : public etl::exception
+  {
+  public:
+
+    queued_message_router_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The inbox is full.
+  //***************************************************************************
+  class queued_message_router_full : public etl::queued_message_router_exception
+  {
+  public:
+
+    queued_message_router_full(string_type file_name_, numeric_type line_number_)
+      : queued_message_router_exception(ETL_ERROR_TEXT("queued message router:full", ETL_FILE"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_queued_message_router
+  {
+    //*************************************************************************
+    /// An entry in the inbox.
+    /// Holds a copy of the message in a message_packet, and the sender.
+    /// The packet is only constructed, and so only destroyed, when there is a
+    /// sender. Messages are popped into a default constructed entry, so its
+    /// storage is value initialised and never read uninitialised.
+    //*************************************************************************
+    template <typename TPacket>
+    class queued_message
+    {
+    public:
+
+      //***********************************************************************
+      queued_message()
+        : p_source(nullptr),
+          packet()
+      {
+      }
+
+      //***********************************************************************
+      queued_message(etl::imessage_router* p_source_, const etl::imessage& message)
+        : p_source(p_source_)
+      {
+        ::new (static_cast<void*>(&packet)) TPacket(message);
+      }
+
+      //***********************************************************************
+      queued_message(const queued_message& other)
+        : p_source(other.p_source)
+      {
+        if (p_source != nullptr)
+        {
+          ::new (static_cast<void*>(&packet)) TPacket(other.get_message());
+        }
+      }
+
+      //***********************************************************************
+      queued_message& operator =(const queued_message& other)
+      {
+        if (&other != this)
+        {
+          destroy();
+
+          p_source = other.p_source;
+
+          if (p_source != nullptr)
+          {
+            ::new (static_cast<void*>(&packet)) TPacket(other.get_message());
+          }
+        }
+
+        return *this;
+      }
+
+      //***********************************************************************
+      ~queued_message()
+      {
+        destroy();
+      }
+
+      //***********************************************************************
+      etl::imessage_router& get_source() const
+      {
+        return *p_source;
+      }
+
+      //***********************************************************************
+      const etl::imessage& get_message() const
+      {
+        return reinterpret_cast<const TPacket*>(&packet)->get();
+      }
+
+    private:
+
+      //***********************************************************************
+      void destroy()
+      {
+        if (p_source != nullptr)
+        {
+          reinterpret_cast<TPacket*>(&packet)->~TPacket();
+          p_source = nullptr;
+        }
+      }
+
+      etl::imessage_router* p_source;
+      typename etl::aligned_storage<sizeof(TPacket), etl::alignment_of<TPacket>::value>::type packet;
+    };
+  }
+
+  //***************************************************************************
+  /// A message router that queues messages for a router.
+  /// \tparam TRouter    The router type. Must define message_packet.
+  /// \tparam QUEUE_SIZE The maximum number of messages in the inbox.
+  /// \tparam TQueue     The inbox queue template.
+  ///\ingroup queued_message_router
+  //***************************************************************************
+  template <typename TRouter,
+            const size_t QUEUE_SIZE,
+            template <typename, size_t, size_t> class TQueue = etl::queue_mpmc_atomic>
+  class queued_message_router : public etl::imessage_router
+  {
+  public:
+
+    typedef TRouter                                                                        router_type;
+    typedef typename TRouter::message_packet                                               message_packet;
+    typedef private_queued_message_router::queued_message<message_packet>                  queued_message_type;
+    typedef TQueue<queued_message_type, QUEUE_SIZE, etl::memory_model::MEMORY_MODEL_LARGE> queue_type;
+
+    //*******************************************
+    /// Constructor.
+    /// Takes the id of the router.
+    //*******************************************
+    explicit queued_message_router(TRouter& router_)
+      : imessage_router(router_.get_message_router_id()),
+        router(router_)
+    {
+    }
+
+    //*******************************************
+    /// Queue a message from the null router.
+    //*******************************************
+    void receive(const etl::imessage& message)
+    {
+      receive(etl::null_message_router::instance(), message);
+    }
+
+    //*******************************************
+    /// Queue a message.
+    /// Asserts if the inbox is full.
+    //*******************************************
+    void receive(etl::imessage_router& source, const etl::imessage& message)
+    {
+      if (!post(source, message))
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::queued_message_router_full));
+      }
+    }
+
+    //*******************************************
+    /// Queue a message.
+    /// Messages that the router does not accept are ignored, so that the
+    /// router's handlers are only ever called by process_queue().
+    /// Returns false if the inbox is full.
+    //*******************************************
+    bool post(etl::imessage_router& source, const etl::imessage& message)
+    {
+      if (!router.accepts(message.message_id))
+      {
+        return true;
+      }
+
+      return queue.emplace(&source, message);
+    }
+
+    using imessage_router::accepts;
+
+    //*******************************************
+    /// Does the router accept the message id?
+    //*******************************************
+    bool accepts(etl::message_id_t id) const
+    {
+      return router.accepts(id);
+    }
+
+    //*******************************************
+    /// Passes the oldest queued message to the router.
+    /// Returns false if the inbox was empty.
+    //*******************************************
+    bool process_one()
+    {
+      queued_message_type entry;
+
+      if (queue.pop(entry))
+      {
+        router.receive(entry.get_source(), entry.get_message());
+        return true;
+      }
+
+      return false;
+    }
+
+    //*******************************************
+    /// Passes queued messages to the router until the inbox is empty.
+    /// Returns the number of messages processed.
+    //*******************************************
+    size_t process_queue()
+    {
+      size_t count = 0U;
+
+      while (process_one())
+      {
+        ++count;
+      }
+
+      return count;
+    }
+
+    //*******************************************
+    /// Discards all queued messages.
+    /// Call from the thread that calls process_queue().
+    //*******************************************
+    void clear()
+    {
+      queue.clear();
+    }
+
+    //*******************************************
+    /// Gets the router.
+    //*******************************************
+    TRouter& get_router() const
+    {
+      return router;
+    }
+
+  private:
+
+    TRouter&   router;
+    queue_type queue;
+  };
+}
+
+#undef ETL_FILE
+
+#endif
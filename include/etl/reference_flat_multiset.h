@@ -45,6 +45,7 @@ SOFTWARE.
 #include "pool.h"
 #include "error_handler.h"
 #include "exception.h"
+#include "private/flat_bulk_insert.h"
 
 #undef ETL_FILE
 #define ETL_FILE "33"
@@ -444,11 +445,7 @@ namespace etl
 #endif
 
       clear();
-
-      while (first != last)
-      {
-        insert(*first++);
-      }
+      insert(first, last);
     }
 
     //*********************************************************************
@@ -495,18 +492,29 @@ namespace etl
 
     //*********************************************************************
     /// Inserts a range of values to the reference_flat_multiset.
+    /// The range is sorted and merged with the existing elements in one pass.
+    /// Values equal to existing ones are placed after them, in the order of the range.
     /// If asserts or exceptions are enabled, emits reference_flat_multiset_full if the reference_flat_multiset does not have enough free space.
-    ///\param position The position to insert at.
     ///\param first    The first element to add.
     ///\param last     The last + 1 element to add.
     //*********************************************************************
     template <class TIterator>
     void insert(TIterator first, TIterator last)
     {
-      while (first != last)
-      {
-        insert(*first++);
-      }
+      insert_range(first, last, false);
+    }
+
+    //*********************************************************************
+    /// Inserts a range of values, already sorted by key, to the reference_flat_multiset.
+    /// The range is merged with the existing elements in one pass.
+    /// If asserts or exceptions are enabled, emits reference_flat_multiset_full if the reference_flat_multiset does not have enough free space.
+    ///\param first    The first element to add.
+    ///\param last     The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_sorted(TIterator first, TIterator last)
+    {
+      insert_range(first, last, true);
     }
 
     //*********************************************************************
@@ -775,8 +783,83 @@ namespace etl
       return result;
     }
 
+    //*********************************************************************
+    /// Appends a value to the end of the lookup, ready for merge_appended.
+    ///\param value The value to append.
+    //*********************************************************************
+    void append_unmerged(value_type& value)
+    {
+      lookup.push_back(&value);
+    }
+
+    //*********************************************************************
+    /// Merges the values appended by append_unmerged.
+    ///\param n_sorted  The number of elements before the first appended one.
+    ///\param is_sorted Were the values appended in key order?
+    ///\return The number of duplicates at the end. Always 0.
+    //*********************************************************************
+    size_t merge_appended(size_t n_sorted, bool is_sorted)
+    {
+      return etl::private_flat::merge_appended(lookup, n_sorted, is_sorted, false, TKeyCompare());
+    }
+
   private:
 
+    //*********************************************************************
+    /// Inserts a range of values, dispatching on the iterator category.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_range(TIterator first, TIterator last, bool is_sorted)
+    {
+      typedef typename std::iterator_traits<TIterator>::iterator_category iterator_category;
+
+      insert_range(first, last, is_sorted, iterator_category());
+    }
+
+    //*********************************************************************
+    /// Inserts a range of values from single pass input iterators.
+    /// The range cannot be counted without consuming it, so the values are
+    /// inserted one at a time.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_range(TIterator first, TIterator last, bool /*is_sorted*/, std::input_iterator_tag)
+    {
+      while (first != last)
+      {
+        insert(*first++);
+      }
+    }
+
+    //*********************************************************************
+    /// Inserts a range of values to the reference_flat_multiset.
+    /// If the range is larger than the free space then the values are
+    /// inserted one at a time, filling the free space before reporting the error.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_range(TIterator first, TIterator last, bool is_sorted, std::forward_iterator_tag)
+    {
+      if (size_t(std::distance(first, last)) > available())
+      {
+        while (first != last)
+        {
+          insert(*first++);
+        }
+
+        return;
+      }
+
+      size_t n_sorted = size();
+
+      while (first != last)
+      {
+        append_unmerged(*first++);
+      }
+
+      size_t n_rejected = merge_appended(n_sorted, is_sorted);
+
+      lookup.resize(lookup.size() - n_rejected);
+    }
+
     // Disable copy construction.
     ireference_flat_multiset(const ireference_flat_multiset&);
     ireference_flat_multiset& operator =(const ireference_flat_multiset&);
@@ -45,6 +45,7 @@ SOFTWARE.
 #include "error_handler.h"
 #include "exception.h"
 #include "vector.h"
+#include "private/flat_bulk_insert.h"
 
 #undef ETL_FILE
 #define ETL_FILE "32"
@@ -444,11 +445,7 @@ namespace etl
 #endif
 
       clear();
-
-      while (first != last)
-      {
-        insert(*first++);
-      }
+      insert(first, last);
     }
 
     //*********************************************************************
@@ -476,18 +473,29 @@ namespace etl
 
     //*********************************************************************
     /// Inserts a range of values to the reference_flat_set.
+    /// The range is sorted and merged with the existing elements in one pass.
+    /// Values whose keys already exist, or appear earlier in the range, are not inserted.
     /// If asserts or exceptions are enabled, emits reference_flat_set_full if the reference_flat_set does not have enough free space.
-    ///\param position The position to insert at.
     ///\param first    The first element to add.
     ///\param last     The last + 1 element to add.
     //*********************************************************************
     template <class TIterator>
     void insert(TIterator first, TIterator last)
     {
-      while (first != last)
-      {
-        insert(*first++);
-      }
+      insert_range(first, last, false);
+    }
+
+    //*********************************************************************
+    /// Inserts a range of values, already sorted by key, to the reference_flat_set.
+    /// The range is merged with the existing elements in one pass.
+    /// If asserts or exceptions are enabled, emits reference_flat_set_full if the reference_flat_set does not have enough free space.
+    ///\param first    The first element to add.
+    ///\param last     The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_sorted(TIterator first, TIterator last)
+    {
+      insert_range(first, last, true);
     }
 
     //*********************************************************************
@@ -757,8 +765,84 @@ namespace etl
       return result;
     }
 
+    //*********************************************************************
+    /// Appends a value to the end of the lookup, ready for merge_appended.
+    ///\param value The value to append.
+    //*********************************************************************
+    void append_unmerged(value_type& value)
+    {
+      lookup.push_back(&value);
+    }
+
+    //*********************************************************************
+    /// Merges the values appended by append_unmerged.
+    /// Values with duplicate keys are moved to the end of the lookup.
+    ///\param n_sorted  The number of elements before the first appended one.
+    ///\param is_sorted Were the values appended in key order?
+    ///\return The number of duplicates at the end.
+    //*********************************************************************
+    size_t merge_appended(size_t n_sorted, bool is_sorted)
+    {
+      return etl::private_flat::merge_appended(lookup, n_sorted, is_sorted, true, TKeyCompare());
+    }
+
   private:
 
+    //*********************************************************************
+    /// Inserts a range of values, dispatching on the iterator category.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_range(TIterator first, TIterator last, bool is_sorted)
+    {
+      typedef typename std::iterator_traits<TIterator>::iterator_category iterator_category;
+
+      insert_range(first, last, is_sorted, iterator_category());
+    }
+
+    //*********************************************************************
+    /// Inserts a range of values from single pass input iterators.
+    /// The range cannot be counted without consuming it, so the values are
+    /// inserted one at a time.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_range(TIterator first, TIterator last, bool /*is_sorted*/, std::input_iterator_tag)
+    {
+      while (first != last)
+      {
+        insert(*first++);
+      }
+    }
+
+    //*********************************************************************
+    /// Inserts a range of values to the reference_flat_set.
+    /// If the range is larger than the free space then the values are
+    /// inserted one at a time, as duplicates may still allow it to fit.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_range(TIterator first, TIterator last, bool is_sorted, std::forward_iterator_tag)
+    {
+      if (size_t(std::distance(first, last)) > available())
+      {
+        while (first != last)
+        {
+          insert(*first++);
+        }
+
+        return;
+      }
+
+      size_t n_sorted = size();
+
+      while (first != last)
+      {
+        append_unmerged(*first++);
+      }
+
+      size_t n_rejected = merge_appended(n_sorted, is_sorted);
+
+      lookup.resize(lookup.size() - n_rejected);
+    }
+
     // Disable copy construction.
     ireference_flat_set(const ireference_flat_set&);
     ireference_flat_set& operator =(const ireference_flat_set&);
@@ -237,6 +237,105 @@ namespace etl
     {
     }
 
+    //*************************************************************************
+    /// Attach the provided node as the new rightmost node.
+    /// The caller must have checked that its key follows all of the others.
+    /// Only the right spine is walked and no keys are compared.
+    //*************************************************************************
+    void append_node(Node& node)
+    {
+      if (root_node == nullptr)
+      {
+        attach_node(root_node, node);
+        return;
+      }
+
+      // Find the critical node and its parent on the right spine, as insert_node does
+      Node* critical_parent_node = nullptr;
+      Node* critical_node = root_node;
+      Node* found = root_node;
+
+      while (found->children[kRight])
+      {
+        if (kNeither != found->weight)
+        {
+          critical_node = found;
+        }
+
+        found->dir = kRight;
+
+        if (kNeither != found->children[kRight]->weight)
+        {
+          critical_parent_node = found;
+        }
+
+        found = found->children[kRight];
+      }
+
+      if (kNeither != found->weight)
+      {
+        critical_node = found;
+      }
+
+      found->dir = kRight;
+      attach_node(found->children[kRight], node);
+
+      if (critical_parent_node == nullptr && critical_node == root_node)
+      {
+        balance_node(root_node);
+      }
+      else
+      {
+        balance_node(critical_parent_node->children[kRight]);
+      }
+    }
+
+    //*************************************************************************
+    /// Build a balanced tree from 'n' nodes chained in order through their
+    /// right children. Each node is visited once, so the build is O(N).
+    ///\param p_chain The start of the chain. Advanced past the nodes used.
+    ///\return The root of the tree built.
+    //*************************************************************************
+    Node* build_balanced(Node*& p_chain, size_type n)
+    {
+      if (n == 0)
+      {
+        return nullptr;
+      }
+
+      // The right subtree has the same number of nodes, or one more.
+      const size_type n_left  = (n - 1) / 2;
+      const size_type n_right = n - 1 - n_left;
+
+      Node* left = build_balanced(p_chain, n_left);
+
+      Node* node = p_chain;
+      p_chain = p_chain->children[kRight];
+
+      node->children[kLeft]  = left;
+      node->children[kRight] = build_balanced(p_chain, n_right);
+      node->dir              = uint_least8_t(kNeither);
+      node->weight           = (balanced_height(n_left) == balanced_height(n_right)) ? uint_least8_t(kNeither) : uint_least8_t(kRight);
+
+      return node;
+    }
+
+    //*************************************************************************
+    /// The height of a tree of 'n' nodes built by build_balanced.
+    //*************************************************************************
+    static size_type balanced_height(size_type n)
+    {
+      size_type height = 0;
+
+      while (n != 0)
+      {
+        ++height;
+        n >>= 1;
+      }
+
+      return height;
+    }
+
     //*************************************************************************
     /// Attach the provided node to the position provided
     //*************************************************************************
@@ -1033,11 +1132,13 @@ namespace etl
 
     //*********************************************************************
     /// Inserts a value to the set starting at the position recommended.
+    /// A hint of end() for a key that follows all of the others appends the
+    /// value without comparing it with the keys on the way down.
     /// If asserts or exceptions are enabled, emits set_full if the set is already full.
-    ///\param position The position that would precede the value to insert.
+    ///\param position The position that would follow the value to insert.
     ///\param value    The value to insert.
     //*********************************************************************
-    iterator insert(iterator, value_type& value)
+    iterator insert(iterator position, value_type& value)
     {
       // Default to no inserted node
       Node* inserted_node = nullptr;
@@ -1047,6 +1148,12 @@ namespace etl
       // Get next available free node
       Data_Node& node = allocate_data_node(value);
 
+      if (is_append(position.p_node, node))
+      {
+        append_node(node);
+        return iterator(*this, &node);
+      }
+
       // Obtain the inserted node (might be nullptr if node was a duplicate)
       inserted_node = insert_node(root_node, node);
 
@@ -1056,11 +1163,13 @@ namespace etl
 
     //*********************************************************************
     /// Inserts a value to the set starting at the position recommended.
+    /// A hint of end() for a key that follows all of the others appends the
+    /// value without comparing it with the keys on the way down.
     /// If asserts or exceptions are enabled, emits set_full if the set is already full.
-    ///\param position The position that would precede the value to insert.
+    ///\param position The position that would follow the value to insert.
     ///\param value    The value to insert.
     //*********************************************************************
-    iterator insert(const_iterator, value_type& value)
+    iterator insert(const_iterator position, value_type& value)
     {
       // Default to no inserted node
       Node* inserted_node = nullptr;
@@ -1070,6 +1179,12 @@ namespace etl
       // Get next available free node
       Data_Node& node = allocate_data_node(value);
 
+      if (is_append(position.p_node, node))
+      {
+        append_node(node);
+        return iterator(*this, &node);
+      }
+
       // Obtain the inserted node (might be nullptr if node was a duplicate)
       inserted_node = insert_node(root_node, node);
 
@@ -1087,6 +1202,12 @@ namespace etl
     template <class TIterator>
     void insert(TIterator first, TIterator last)
     {
+      if (empty())
+      {
+        // Values in ascending order are built directly in to a balanced tree.
+        first = build_sorted(first, last);
+      }
+
       while (first != last)
       {
         insert(*first++);
@@ -1185,6 +1306,83 @@ namespace etl
       return node;
     }
 
+    //*************************************************************************
+    /// Checks whether a hinted insert appends to the set.
+    ///\param p_hint The node of the hint. nullptr for end().
+    //*************************************************************************
+    bool is_append(const Node* p_hint, const Data_Node& node) const
+    {
+      if (p_hint != nullptr)
+      {
+        return false;
+      }
+
+      const Node* p_last = find_limit_node(root_node, kRight);
+
+      return (p_last == nullptr) || node_comp(iset::data_cast(*p_last), node);
+    }
+
+    //*************************************************************************
+    /// Builds a balanced tree in an empty set from the leading values of the
+    /// range that are in ascending order. Later duplicates are discarded.
+    /// Stops if the set becomes full.
+    ///\return The first value not used, or last.
+    //*************************************************************************
+    template <typename TIterator>
+    TIterator build_sorted(TIterator first, TIterator last)
+    {
+      // Chain the nodes in order through their right children.
+      Node* p_head = nullptr;
+      Node* p_tail = nullptr;
+
+      while (first != last)
+      {
+        if (p_tail != nullptr)
+        {
+          const Data_Node& tail = iset::data_cast(*p_tail);
+
+          if (!node_comp(tail, *first))
+          {
+            if (node_comp(*first, tail))
+            {
+              // Out of order.
+              break;
+            }
+
+            // A duplicate.
+            ++first;
+            continue;
+          }
+        }
+
+        if (full())
+        {
+          // The caller's insert will report it.
+          break;
+        }
+
+        Data_Node& node = allocate_data_node(*first);
+        node.mark_as_leaf();
+        ++current_size;
+
+        if (p_tail == nullptr)
+        {
+          p_head = &node;
+        }
+        else
+        {
+          p_tail->children[kRight] = &node;
+        }
+
+        p_tail = &node;
+        ++first;
+      }
+
+      root_node = build_balanced(p_head, current_size);
+
+      return first;
+    }
+
     //*************************************************************************
     /// Destroy a Data_Node.
     //*************************************************************************
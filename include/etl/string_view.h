@@ -40,6 +40,7 @@ SOFTWARE.
 #include "integral_limits.h"
 #include "hash.h"
 #include "basic_string.h"
+#include "private/string_search.h"
 
 #include "algorithm.h"
 
@@ -410,7 +411,7 @@ namespace etl
     //*************************************************************************
     int compare(basic_string_view<T, TTraits> view) const
     {
-      return (*this == view) ? 0 : ((*this > view) ? 1 : -1);
+      return etl::private_string_search::compare(mbegin, size(), view.mbegin, view.size());
     }
 
     int compare(size_type position, size_type count, basic_string_view view) const
@@ -490,26 +491,24 @@ namespace etl
     //*************************************************************************
     size_type find(etl::basic_string_view<T, TTraits> view, size_type position = 0) const
     {
-      if ((size() < view.size()))
+      if (position > size())
       {
         return npos;
       }
 
-      const_iterator iposition = std::search(begin() + position, end(), view.begin(), view.end());
+      return to_position(etl::private_string_search::find_substring(mbegin + position, mend, view.mbegin, view.size()));
+    }
 
-      if (iposition == end())
+    size_type find(T c, size_type position = 0) const
+    {
+      if (position >= size())
       {
         return npos;
       }
-      else
-      {
-        return std::distance(begin(), iposition);
-      }
-    }
 
-    size_type find(T c, size_type position = 0) const
-    {
-      return find(etl::basic_string_view<T, TTraits>(&c, 1), position);
+      const T* p = etl::private_string_search::find_char(mbegin + position, mend, c);
+
+      return (p == mend) ? npos : size_type(p - mbegin);
     }
 
     size_type find(const T* text, size_type position, size_type count) const
@@ -527,31 +526,16 @@ namespace etl
     //*************************************************************************
     size_type rfind(etl::basic_string_view<T, TTraits> view, size_type position = npos) const
     {
-      if ((size() < view.size()))
-      {
-        return npos;
-      }
-
       position = std::min(position, size());
 
-      const_iterator iposition = std::find_end(begin(),
-                                               begin() + position,
-                                               view.begin(),
-                                               view.end());
-
-      if (iposition == end())
-      {
-        return npos;
-      }
-      else
-      {
-        return std::distance(begin(), iposition);
-      }
+      return to_position(etl::private_string_search::rfind_substring(mbegin, mbegin + position, view.mbegin, view.size()));
     }
 
     size_type rfind(T c, size_type position = npos) const
     {
-      return rfind(etl::basic_string_view<T, TTraits>(&c, 1), position);
+      position = std::min(position, size());
+
+      return to_position(etl::private_string_search::rfind_char(mbegin, mbegin + position, c));
     }
 
     size_type rfind(const T* text, size_type position, size_type count) const
@@ -569,30 +553,12 @@ namespace etl
     //*************************************************************************
     size_type find_first_of(etl::basic_string_view<T, TTraits> view, size_type position = 0) const
     {
-      const size_t lengthtext = size();
-
-      if (position < lengthtext)
-      {
-        for (size_t i = position; i < lengthtext; ++i)
-        {
-          const size_t lengthview = view.size();
-
-          for (size_t j = 0; j < lengthview; ++j)
-          {
-            if (mbegin[i] == view[j])
-            {
-              return i;
-            }
-          }
-        }
-      }
-
-      return npos;
+      return find_first_in_set(position, view, true);
     }
 
     size_type find_first_of(T c, size_type position = 0) const
     {
-      return find_first_of(etl::basic_string_view<T, TTraits>(&c, 1), position);
+      return find(c, position);
     }
 
     size_type find_first_of(const T* text, size_type position, size_type count) const
@@ -610,32 +576,7 @@ namespace etl
     //*************************************************************************
     size_type find_last_of(etl::basic_string_view<T, TTraits> view, size_type position = npos) const
     {
-      if (empty())
-      {
-        return npos;
-      }
-
-      position = std::min(position, size() - 1);
-
-      const_reverse_iterator it = rbegin() + size() - position - 1;
-
-      while (it != rend())
-      {
-        const size_t viewlength = view.size();
-
-        for (size_t j = 0; j < viewlength; ++j)
-        {
-          if (mbegin[position] == view[j])
-          {
-            return position;
-          }
-        }
-
-        ++it;
-        --position;
-      }
-
-      return npos;
+      return find_last_in_set(position, view, true);
     }
 
     size_type find_last_of(T c, size_type position = npos) const
@@ -658,32 +599,7 @@ namespace etl
     //*************************************************************************
     size_type find_first_not_of(etl::basic_string_view<T, TTraits> view, size_type position = 0) const
     {
-      const size_t lengthtext = size();
-
-      if (position < lengthtext)
-      {
-        for (size_t i = position; i < lengthtext; ++i)
-        {
-          bool found = false;
-
-          const size_t viewlength = view.size();
-
-          for (size_t j = 0; j < viewlength; ++j)
-          {
-            if (mbegin[i] == view[j])
-            {
-              found = true;
-            }
-          }
-
-          if (!found)
-          {
-            return i;
-          }
-        }
-      }
-
-      return npos;
+      return find_first_in_set(position, view, false);
     }
 
     size_type find_first_not_of(T c, size_type position = 0) const
@@ -706,39 +622,7 @@ namespace etl
     //*************************************************************************
     size_type find_last_not_of(etl::basic_string_view<T, TTraits> view, size_type position = npos) const
     {
-      if (empty())
-      {
-        return npos;
-      }
-
-      position = std::min(position, size() - 1);
-
-      const_reverse_iterator it = rbegin() + size() - position - 1;
-
-      while (it != rend())
-      {
-        bool found = false;
-
-        const size_t viewlength = view.size();
-
-        for (size_t j = 0; j < viewlength; ++j)
-        {
-          if (mbegin[position] == view[j])
-          {
-            found = true;
-          }
-        }
-
-        if (!found)
-        {
-          return position;
-        }
-
-        ++it;
-        --position;
-      }
-
-      return npos;
+      return find_last_in_set(position, view, false);
     }
 
     size_type find_last_not_of(T c, size_type position = npos) const
@@ -762,7 +646,7 @@ namespace etl
     friend bool operator == (const etl::basic_string_view<T, TTraits>& lhs, const etl::basic_string_view<T, TTraits>& rhs)
     {
       return (lhs.size() == rhs.size()) &&
-        std::equal(lhs.begin(), lhs.end(), rhs.begin());
+             etl::private_string_search::equal(lhs.mbegin, rhs.mbegin, lhs.size());
     }
 
     //*************************************************************************
@@ -778,7 +662,7 @@ namespace etl
     //*************************************************************************
     friend bool operator < (const etl::basic_string_view<T, TTraits>& lhs, const etl::basic_string_view<T, TTraits>& rhs)
     {
-      return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+      return lhs.compare(rhs) < 0;
     }
 
     //*************************************************************************
@@ -807,6 +691,42 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    /// Converts a pointer from a search to a position.
+    //*************************************************************************
+    size_type to_position(const T* p) const
+    {
+      return (p == nullptr) ? npos : size_type(p - mbegin);
+    }
+
+    //*************************************************************************
+    /// Finds the first character at or after 'position' that is, or is not, in the view.
+    //*************************************************************************
+    size_type find_first_in_set(size_type position, etl::basic_string_view<T, TTraits> view, bool in_set) const
+    {
+      if (position >= size())
+      {
+        return npos;
+      }
+
+      return to_position(etl::private_string_search::find_first_of(mbegin + position, mend, view.mbegin, view.size(), in_set));
+    }
+
+    //*************************************************************************
+    /// Finds the last character at or before 'position' that is, or is not, in the view.
+    //*************************************************************************
+    size_type find_last_in_set(size_type position, etl::basic_string_view<T, TTraits> view, bool in_set) const
+    {
+      if (empty())
+      {
+        return npos;
+      }
+
+      position = std::min(position, size() - 1);
+
+      return to_position(etl::private_string_search::find_last_of(mbegin, mbegin + position + 1, view.mbegin, view.size(), in_set));
+    }
+
     const T* mbegin;
     const T* mend;
   };
@@ -859,6 +779,48 @@ namespace etl
                                                          reinterpret_cast<const uint8_t*>(&text[text.size()]));
     }
   };
+
+  //*************************************************************************
+  /// Transparent hash for string keys.
+  /// Hashes anything convertible to a string view, so that an unordered
+  /// container keyed on etl::string may be searched with a string view or a
+  /// C string without constructing a temporary key.
+  //*************************************************************************
+  template <typename T>
+  struct basic_string_hash
+  {
+    typedef void is_transparent;
+
+    size_t operator()(const etl::basic_string_view<T>& text) const
+    {
+      return etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(text.data()),
+                                                     reinterpret_cast<const uint8_t*>(text.data() + text.size()));
+    }
+  };
+
+  //*************************************************************************
+  /// Transparent equality for string keys.
+  //*************************************************************************
+  template <typename T>
+  struct basic_string_equal
+  {
+    typedef void is_transparent;
+
+    bool operator()(const etl::basic_string_view<T>& lhs, const etl::basic_string_view<T>& rhs) const
+    {
+      return lhs == rhs;
+    }
+  };
+
+  typedef etl::basic_string_hash<char>      string_hash;
+  typedef etl::basic_string_hash<wchar_t>   wstring_hash;
+  typedef etl::basic_string_hash<char16_t>  u16string_hash;
+  typedef etl::basic_string_hash<char32_t>  u32string_hash;
+
+  typedef etl::basic_string_equal<char>     string_equal;
+  typedef etl::basic_string_equal<wchar_t>  wstring_equal;
+  typedef etl::basic_string_equal<char16_t> u16string_equal;
+  typedef etl::basic_string_equal<char32_t> u32string_equal;
 #endif
 }
 
@@ -87,6 +87,17 @@ namespace etl
       typedef uint_least8_t type;
     };
 
+    // Timer id for the timing wheel timers.
+    struct wheel_id
+    {
+      enum
+      {
+        NO_TIMER = 0xFFFF
+      };
+
+      typedef uint_least16_t type;
+    };
+
     // Timer state.
     struct state
     {
@@ -0,0 +1,687 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TO_ARITHMETIC_INCLUDED
+#define ETL_TO_ARITHMETIC_INCLUDED
+
+///\ingroup string
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+#include "type_traits.h"
+#include "enum_type.h"
+#include "endianness.h"
+#include "basic_string.h"
+#include "string_view.h"
+#include "basic_format_spec.h"
+#include "private/parse_float.h"
+
+//*****************************************************************************
+///\defgroup to_arithmetic to_arithmetic
+/// Converts text to integral and floating point values, the reverse of
+/// etl::to_string. The text does not need to be terminated and is not
+/// affected by the locale.
+/// The whole of the text must be a number. There is no leading white space,
+/// '+' sign or radix prefix.
+/// Integrals accept a leading '-' if signed, and the digits and letters of
+/// the radix, in either case.
+/// Floating point values accept [-]digits[.digits][(e|E)[+|-]digits],
+/// 'inf', 'infinity' and 'nan' in any case, in radix 10 only. The result is
+/// the nearest value, with ties to even. long double is parsed at double
+/// precision.
+///\ingroup string
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// The result of a conversion.
+  ///\ingroup to_arithmetic
+  //***************************************************************************
+  struct to_arithmetic_status
+  {
+    enum enum_type
+    {
+      valid,
+      invalid_radix,
+      invalid_format,
+      signed_to_unsigned,
+      overflow
+    };
+
+    ETL_DECLARE_ENUM_TYPE(to_arithmetic_status, int)
+    ETL_ENUM_TYPE(valid,              "valid")
+    ETL_ENUM_TYPE(invalid_radix,      "invalid radix")
+    ETL_ENUM_TYPE(invalid_format,     "invalid format")
+    ETL_ENUM_TYPE(signed_to_unsigned, "signed to unsigned")
+    ETL_ENUM_TYPE(overflow,           "overflow")
+    ETL_END_ENUM_TYPE
+  };
+
+  //***************************************************************************
+  /// The value and status of a conversion.
+  /// The value is zero if the status is not 'valid'.
+  ///\ingroup to_arithmetic
+  //***************************************************************************
+  template <typename TValue>
+  class to_arithmetic_result
+  {
+  public:
+
+    typedef TValue value_type;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    to_arithmetic_result(TValue value__, etl::to_arithmetic_status status__)
+      : value_(value__)
+      , status_(status__)
+    {
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if the conversion succeeded.
+    //*************************************************************************
+    bool has_value() const
+    {
+      return status_ == etl::to_arithmetic_status::valid;
+    }
+
+    //*************************************************************************
+    /// Bool conversion operator.
+    //*************************************************************************
+    explicit operator bool() const
+    {
+      return has_value();
+    }
+
+    //*************************************************************************
+    /// The converted value.
+    //*************************************************************************
+    TValue value() const
+    {
+      return value_;
+    }
+
+    //*************************************************************************
+    /// The status of the conversion.
+    //*************************************************************************
+    etl::to_arithmetic_status status() const
+    {
+      return status_;
+    }
+
+  private:
+
+    TValue                    value_;
+    etl::to_arithmetic_status status_;
+  };
+
+  namespace private_to_arithmetic
+  {
+    //*************************************************************************
+    /// Returns the value of a digit or letter, or 255 if it is neither.
+    //*************************************************************************
+    template <typename TChar>
+    uint32_t digit_value(TChar c)
+    {
+      const uint32_t u = uint32_t(typename etl::make_unsigned<TChar>::type(c));
+
+      if ((u - '0') < 10U)
+      {
+        return u - '0';
+      }
+
+      // Fold to lower case.
+      const uint32_t lower = u | 0x20U;
+
+      if ((lower - 'a') < 26U)
+      {
+        return lower - 'a' + 10U;
+      }
+
+      return 255U;
+    }
+
+    //*************************************************************************
+    /// Converts eight decimal digits at once, held as bytes in a 64 bit word.
+    ///\return <b>false</b> if they are not all digits.
+    //*************************************************************************
+    template <typename TChar>
+    bool parse_eight_digits(const TChar* p, uint64_t& value)
+    {
+      uint64_t word = 0;
+
+      if ((sizeof(TChar) == 1) && (etl::endianness::value() == etl::endian::little))
+      {
+        memcpy(&word, p, sizeof(word));
+      }
+      else
+      {
+        for (int i = 0; i < 8; ++i)
+        {
+          const uint64_t c = uint64_t(typename etl::make_unsigned<TChar>::type(p[i]));
+
+          if (c > 0xFFU)
+          {
+            return false;
+          }
+
+          word |= c << (8 * i);
+        }
+      }
+
+      // Every byte must be 0x30 to 0x39.
+      if ((((word & 0xF0F0F0F0F0F0F0F0ULL) | (((word + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4))) != 0x3333333333333333ULL)
+      {
+        return false;
+      }
+
+      // Combine pairs, then quads, then the two halves.
+      word = ((word & 0x0F0F0F0F0F0F0F0FULL) * 2561U) >> 8;
+      word = ((word & 0x00FF00FF00FF00FFULL) * 6553601U) >> 16;
+      value = ((word & 0x0000FFFF0000FFFFULL) * 42949672960001ULL) >> 32;
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Accumulates the digits into an unsigned value no larger than 'limit'.
+    //*************************************************************************
+    template <typename TChar>
+    etl::to_arithmetic_status parse_unsigned(const TChar* p, const TChar* end, const uint32_t radix, const uint64_t limit, uint64_t& value)
+    {
+      if (p == end)
+      {
+        return etl::to_arithmetic_status::invalid_format;
+      }
+
+      value = 0;
+
+      if (radix == 10U)
+      {
+        uint64_t chunk;
+
+        while (((end - p) >= 8) && parse_eight_digits(p, chunk))
+        {
+          if ((chunk > limit) || (value > ((limit - chunk) / 100000000U)))
+          {
+            return etl::to_arithmetic_status::overflow;
+          }
+
+          value = (value * 100000000U) + chunk;
+          p += 8;
+        }
+      }
+
+      const uint64_t limit_div = limit / radix;
+      const uint64_t limit_mod = limit % radix;
+
+      while (p != end)
+      {
+        const uint32_t digit = digit_value(*p++);
+
+        if (digit >= radix)
+        {
+          return etl::to_arithmetic_status::invalid_format;
+        }
+
+        if ((value > limit_div) || ((value == limit_div) && (digit > limit_mod)))
+        {
+          return etl::to_arithmetic_status::overflow;
+        }
+
+        value = (value * radix) + digit;
+      }
+
+      return etl::to_arithmetic_status::valid;
+    }
+
+    //*************************************************************************
+    /// Integrals.
+    //*************************************************************************
+    template <typename TValue, typename TChar>
+    typename etl::enable_if<etl::is_integral<TValue>::value, etl::to_arithmetic_result<TValue> >::type
+      parse(const TChar* p, const TChar* end, const uint32_t radix)
+    {
+      typedef typename etl::make_unsigned<TValue>::type unsigned_type;
+      typedef etl::to_arithmetic_result<TValue>         result_type;
+
+      if ((radix < 2U) || (radix > 36U))
+      {
+        return result_type(TValue(0), etl::to_arithmetic_status::invalid_radix);
+      }
+
+      const bool negative = (p != end) && (*p == TChar('-'));
+
+      if (negative)
+      {
+        if (!etl::is_signed<TValue>::value)
+        {
+          return result_type(TValue(0), etl::to_arithmetic_status::signed_to_unsigned);
+        }
+
+        ++p;
+      }
+
+      // The magnitude of the most negative value is one more than the maximum.
+      const uint64_t maximum = uint64_t(unsigned_type(~unsigned_type(0)) >> (etl::is_signed<TValue>::value ? 1 : 0));
+      const uint64_t limit   = negative ? maximum + 1U : maximum;
+
+      uint64_t magnitude;
+      const etl::to_arithmetic_status status = parse_unsigned(p, end, radix, limit, magnitude);
+
+      if (status != etl::to_arithmetic_status::valid)
+      {
+        return result_type(TValue(0), status);
+      }
+
+      const unsigned_type u = negative ? unsigned_type(unsigned_type(0) - unsigned_type(magnitude))
+                                       : unsigned_type(magnitude);
+
+      return result_type(TValue(u), etl::to_arithmetic_status::valid);
+    }
+
+    //*************************************************************************
+    /// Case insensitive comparison of the whole of the text with a lower case
+    /// word.
+    //*************************************************************************
+    template <typename TChar>
+    bool matches(const TChar* p, const TChar* end, const char* word)
+    {
+      while (*word != 0)
+      {
+        if ((p == end) || ((uint32_t(typename etl::make_unsigned<TChar>::type(*p)) | 0x20U) != uint32_t(*word)))
+        {
+          return false;
+        }
+
+        ++p;
+        ++word;
+      }
+
+      return p == end;
+    }
+
+    //*************************************************************************
+    /// Fills a decimal with all of the significant digits, for the exact
+    /// conversion.
+    //*************************************************************************
+    template <typename TChar>
+    void parse_decimal(const TChar* p, const TChar* end, int64_t exponent, private_parse_float::decimal& d)
+    {
+      bool in_fraction = false;
+
+      for (; p != end; ++p)
+      {
+        if (*p == TChar('.'))
+        {
+          in_fraction = true;
+          continue;
+        }
+
+        const uint8_t digit = uint8_t(*p - TChar('0'));
+
+        if ((d.num_digits == 0) && !d.truncated && (digit == 0))
+        {
+          // Leading zero.
+          if (in_fraction)
+          {
+            --d.decimal_point;
+          }
+
+          continue;
+        }
+
+        d.push_back(digit);
+
+        if (!in_fraction)
+        {
+          ++d.decimal_point;
+        }
+      }
+
+      d.decimal_point += int32_t(exponent);
+      d.trim();
+    }
+
+    //*************************************************************************
+    /// Floating point.
+    //*************************************************************************
+    template <typename TValue, typename TChar>
+    typename etl::enable_if<etl::is_floating_point<TValue>::value, etl::to_arithmetic_result<TValue> >::type
+      parse(const TChar* p, const TChar* end, const uint32_t radix)
+    {
+      typedef typename etl::conditional<etl::is_same<TValue, float>::value, float, double>::type float_type;
+      typedef private_parse_float::float_traits<float_type>                                      traits;
+      typedef etl::to_arithmetic_result<TValue>                                                  result_type;
+
+      if (radix != 10U)
+      {
+        return result_type(TValue(0), etl::to_arithmetic_status::invalid_radix);
+      }
+
+      const bool negative = (p != end) && (*p == TChar('-'));
+
+      if (negative)
+      {
+        ++p;
+      }
+
+      private_parse_float::adjusted_mantissa am;
+
+      if (matches(p, end, "inf") || matches(p, end, "infinity"))
+      {
+        am.power2 = traits::Infinite_Power;
+        return result_type(TValue(private_parse_float::to_float<float_type>(am, negative)), etl::to_arithmetic_status::valid);
+      }
+
+      if (matches(p, end, "nan"))
+      {
+        am.power2   = traits::Infinite_Power;
+        am.mantissa = 1ULL << (traits::Mantissa_Bits - 1);
+        return result_type(TValue(private_parse_float::to_float<float_type>(am, negative)), etl::to_arithmetic_status::valid);
+      }
+
+      // The first 19 significant digits.
+      const TChar* const start = p;
+      uint64_t w           = 0;
+      int64_t  q           = 0;
+      int      significant = 0;
+      bool     truncated   = false;
+      bool     any_digits  = false;
+      bool     in_fraction = false;
+      uint64_t chunk;
+
+      while (p != end)
+      {
+        if (*p == TChar('.'))
+        {
+          if (in_fraction)
+          {
+            break;
+          }
+
+          in_fraction = true;
+          ++p;
+          continue;
+        }
+
+        // Eight at a time while they fit.
+        if ((significant != 0) && (significant <= 11) && ((end - p) >= 8) && parse_eight_digits(p, chunk))
+        {
+          w = (w * 100000000U) + chunk;
+          significant += 8;
+          q -= in_fraction ? 8 : 0;
+          p += 8;
+          continue;
+        }
+
+        const uint32_t digit = uint32_t(typename etl::make_unsigned<TChar>::type(*p)) - '0';
+
+        if (digit > 9U)
+        {
+          break;
+        }
+
+        any_digits = true;
+        ++p;
+
+        if ((significant == 0) && (digit == 0))
+        {
+          // Leading zero.
+          q -= in_fraction ? 1 : 0;
+        }
+        else if (significant < 19)
+        {
+          w = (w * 10U) + digit;
+          ++significant;
+          q -= in_fraction ? 1 : 0;
+        }
+        else
+        {
+          q += in_fraction ? 0 : 1;
+          truncated = truncated || (digit != 0);
+        }
+      }
+
+      if (!any_digits)
+      {
+        return result_type(TValue(0), etl::to_arithmetic_status::invalid_format);
+      }
+
+      const TChar* const mantissa_end = p;
+      int64_t exponent = 0;
+
+      if ((p != end) && ((*p == TChar('e')) || (*p == TChar('E'))))
+      {
+        ++p;
+
+        const bool negative_exponent = (p != end) && (*p == TChar('-'));
+
+        if ((p != end) && ((*p == TChar('-')) || (*p == TChar('+'))))
+        {
+          ++p;
+        }
+
+        if (p == end)
+        {
+          return result_type(TValue(0), etl::to_arithmetic_status::invalid_format);
+        }
+
+        while (p != end)
+        {
+          const uint32_t digit = uint32_t(typename etl::make_unsigned<TChar>::type(*p)) - '0';
+
+          if (digit > 9U)
+          {
+            break;
+          }
+
+          // Large enough for any value to be zero or infinity.
+          if (exponent < 100000)
+          {
+            exponent = (exponent * 10) + digit;
+          }
+
+          ++p;
+        }
+
+        exponent = negative_exponent ? -exponent : exponent;
+      }
+
+      if (p != end)
+      {
+        return result_type(TValue(0), etl::to_arithmetic_status::invalid_format);
+      }
+
+      q += exponent;
+
+      float_type value;
+
+      if (!truncated && private_parse_float::exact_fast_path(q, w, negative, value))
+      {
+        return result_type(TValue(value), etl::to_arithmetic_status::valid);
+      }
+
+      bool decided = private_parse_float::eisel_lemire<float_type>(q, w, am);
+
+      if (decided && truncated)
+      {
+        // The exact value lies between w and w + 1.
+        private_parse_float::adjusted_mantissa am_upper;
+
+        decided = private_parse_float::eisel_lemire<float_type>(q, w + 1, am_upper) &&
+                  (am.mantissa == am_upper.mantissa) &&
+                  (am.power2 == am_upper.power2);
+      }
+
+      if (!decided)
+      {
+        private_parse_float::decimal d;
+        parse_decimal(start, mantissa_end, exponent, d);
+        am = private_parse_float::convert_decimal<float_type>(d);
+      }
+
+      if (am.power2 == traits::Infinite_Power)
+      {
+        return result_type(TValue(0), etl::to_arithmetic_status::overflow);
+      }
+
+      return result_type(TValue(private_parse_float::to_float<float_type>(am, negative)), etl::to_arithmetic_status::valid);
+    }
+  }
+
+  //***************************************************************************
+  /// Converts the characters to an arithmetic value.
+  ///\ingroup to_arithmetic
+  //***************************************************************************
+  template <typename TValue, typename TChar>
+  typename etl::enable_if<etl::is_arithmetic<TValue>::value && !etl::is_same<TValue, bool>::value, etl::to_arithmetic_result<TValue> >::type
+    to_arithmetic(const TChar* str, size_t length, const uint32_t radix = 10U)
+  {
+    return private_to_arithmetic::parse<TValue>(str, str + length, radix);
+  }
+
+  //***************************************************************************
+  /// Converts a string view to an arithmetic value.
+  ///\ingroup to_arithmetic
+  //***************************************************************************
+  template <typename TValue, typename TChar, typename TTraits>
+  typename etl::enable_if<etl::is_arithmetic<TValue>::value && !etl::is_same<TValue, bool>::value, etl::to_arithmetic_result<TValue> >::type
+    to_arithmetic(const etl::basic_string_view<TChar, TTraits>& view, const uint32_t radix = 10U)
+  {
+    return private_to_arithmetic::parse<TValue>(view.data(), view.data() + view.size(), radix);
+  }
+
+  //***************************************************************************
+  /// Converts a string view to an arithmetic value, using the radix of the
+  /// format spec.
+  ///\ingroup to_arithmetic
+  //***************************************************************************
+  template <typename TValue, typename TChar, typename TTraits>
+  typename etl::enable_if<etl::is_arithmetic<TValue>::value && !etl::is_same<TValue, bool>::value, etl::to_arithmetic_result<TValue> >::type
+    to_arithmetic(const etl::basic_string_view<TChar, TTraits>& view, const etl::basic_format_spec<etl::ibasic_string<TChar> >& format)
+  {
+    return private_to_arithmetic::parse<TValue>(view.data(), view.data() + view.size(), format.base());
+  }
+
+  //***************************************************************************
+  /// Converts a string to an arithmetic value.
+  ///\ingroup to_arithmetic
+  //***************************************************************************
+  template <typename TValue, typename TChar>
+  typename etl::enable_if<etl::is_arithmetic<TValue>::value && !etl::is_same<TValue, bool>::value, etl::to_arithmetic_result<TValue> >::type
+    to_arithmetic(const etl::ibasic_string<TChar>& str, const uint32_t radix = 10U)
+  {
+    return private_to_arithmetic::parse<TValue>(str.data(), str.data() + str.size(), radix);
+  }
+
+  //***************************************************************************
+  /// Converts a string to an arithmetic value, using the radix of the format
+  /// spec.
+  ///\ingroup to_arithmetic
+  //***************************************************************************
+  template <typename TValue, typename TChar>
+  typename etl::enable_if<etl::is_arithmetic<TValue>::value && !etl::is_same<TValue, bool>::value, etl::to_arithmetic_result<TValue> >::type
+    to_arithmetic(const etl::ibasic_string<TChar>& str, const etl::basic_format_spec<etl::ibasic_string<TChar> >& format)
+  {
+    return private_to_arithmetic::parse<TValue>(str.data(), str.data() + str.size(), format.base());
+  }
+
+  //***************************************************************************
+  /// Converts a string view to an arithmetic value.
+  /// 'value' is only written if the conversion succeeds.
+  ///\ingroup to_arithmetic
+  //***************************************************************************
+  template <typename TValue, typename TChar, typename TTraits>
+  typename etl::enable_if<etl::is_arithmetic<TValue>::value && !etl::is_same<TValue, bool>::value, etl::to_arithmetic_status>::type
+    from_string(const etl::basic_string_view<TChar, TTraits>& view, TValue& value, const uint32_t radix = 10U)
+  {
+    const etl::to_arithmetic_result<TValue> result = etl::to_arithmetic<TValue>(view, radix);
+
+    if (result.has_value())
+    {
+      value = result.value();
+    }
+
+    return result.status();
+  }
+
+  //***************************************************************************
+  /// Converts a string view to an arithmetic value, using the radix of the
+  /// format spec.
+  /// 'value' is only written if the conversion succeeds.
+  ///\ingroup to_arithmetic
+  //***************************************************************************
+  template <typename TValue, typename TChar, typename TTraits>
+  typename etl::enable_if<etl::is_arithmetic<TValue>::value && !etl::is_same<TValue, bool>::value, etl::to_arithmetic_status>::type
+    from_string(const etl::basic_string_view<TChar, TTraits>& view, TValue& value, const etl::basic_format_spec<etl::ibasic_string<TChar> >& format)
+  {
+    return etl::from_string(view, value, format.base());
+  }
+
+  //***************************************************************************
+  /// Converts a string to an arithmetic value.
+  /// 'value' is only written if the conversion succeeds.
+  ///\ingroup to_arithmetic
+  //***************************************************************************
+  template <typename TValue, typename TChar>
+  typename etl::enable_if<etl::is_arithmetic<TValue>::value && !etl::is_same<TValue, bool>::value, etl::to_arithmetic_status>::type
+    from_string(const etl::ibasic_string<TChar>& str, TValue& value, const uint32_t radix = 10U)
+  {
+    const etl::to_arithmetic_result<TValue> result = etl::to_arithmetic<TValue>(str, radix);
+
+    if (result.has_value())
+    {
+      value = result.value();
+    }
+
+    return result.status();
+  }
+
+  //***************************************************************************
+  /// Converts a string to an arithmetic value, using the radix of the format
+  /// spec.
+  /// 'value' is only written if the conversion succeeds.
+  ///\ingroup to_arithmetic
+  //***************************************************************************
+  template <typename TValue, typename TChar>
+  typename etl::enable_if<etl::is_arithmetic<TValue>::value && !etl::is_same<TValue, bool>::value, etl::to_arithmetic_status>::type
+    from_string(const etl::ibasic_string<TChar>& str, TValue& value, const etl::basic_format_spec<etl::ibasic_string<TChar> >& format)
+  {
+    return etl::from_string(str, value, format.base());
+  }
+}
+
+#endif
@@ -144,6 +144,28 @@ namespace etl
   {
     return to_string_helper(uint64_t(value), str, format, append);
   }
+
+  //***************************************************************************
+  /// For floating point. Default format spec.
+  //***************************************************************************
+  template <typename T>
+  typename etl::enable_if<etl::is_floating_point<T>::value, const etl::istring&>::type
+    to_string(const T value, etl::istring& str, const bool append = false)
+  {
+    etl::format_spec format;
+
+    return to_string_helper(value, str, format, append);
+  }
+
+  //***************************************************************************
+  /// For floating point. Supplied format spec.
+  //***************************************************************************
+  template <typename T>
+  typename etl::enable_if<etl::is_floating_point<T>::value, const etl::istring&>::type
+    to_string(const T value, etl::istring& str, const etl::format_spec& format, const bool append = false)
+  {
+    return to_string_helper(value, str, format, append);
+  }
 }
 
 #endif
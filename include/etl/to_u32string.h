@@ -144,6 +144,28 @@ namespace etl
   {
     return to_string_helper(uint64_t(value), str, format, append);
   }
+
+  //***************************************************************************
+  /// For floating point. Default format spec.
+  //***************************************************************************
+  template <typename T>
+  typename etl::enable_if<etl::is_floating_point<T>::value, etl::iu32string&>::type
+    to_u32string(const T value, etl::iu32string& str, const bool append = false)
+  {
+    etl::u32format_spec format;
+
+    return to_string_helper(value, str, format, append);
+  }
+
+  //***************************************************************************
+  /// For floating point. Supplied format spec.
+  //***************************************************************************
+  template <typename T>
+  typename etl::enable_if<etl::is_floating_point<T>::value, etl::iu32string&>::type
+    to_u32string(const T value, etl::iu32string& str, const etl::u32format_spec& format, const bool append = false)
+  {
+    return to_string_helper(value, str, format, append);
+  }
 }
 
 #endif
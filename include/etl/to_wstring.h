@@ -144,6 +144,28 @@ namespace etl
   {
     return to_string_helper(uint64_t(value), str, format, append);
   }
+
+  //***************************************************************************
+  /// For floating point. Default format spec.
+  //***************************************************************************
+  template <typename T>
+  typename etl::enable_if<etl::is_floating_point<T>::value, etl::iwstring&>::type
+    to_wstring(const T value, etl::iwstring& str, const bool append = false)
+  {
+    etl::wformat_spec format;
+
+    return to_string_helper(value, str, format, append);
+  }
+
+  //***************************************************************************
+  /// For floating point. Supplied format spec.
+  //***************************************************************************
+  template <typename T>
+  typename etl::enable_if<etl::is_floating_point<T>::value, etl::iwstring&>::type
+    to_wstring(const T value, etl::iwstring& str, const etl::wformat_spec& format, const bool append = false)
+  {
+    return to_string_helper(value, str, format, append);
+  }
 }
 
 #endif
@@ -304,6 +304,10 @@ namespace etl
   /// is_trivially_copy_assignable
   ///\ingroup type_traits
   template <typename T> struct is_trivially_copy_assignable : std::is_trivially_copy_assignable<T> {};
+
+  /// is_trivially_copyable
+  ///\ingroup type_traits
+  template <typename T> struct is_trivially_copyable : std::is_trivially_copyable<T> {};
 #else
   /// is_trivially_constructible
   /// For C++03, only POD types are recognised.
@@ -324,6 +328,11 @@ namespace etl
   /// For C++03, only POD types are recognised.
   ///\ingroup type_traits
   template <typename T> struct is_trivially_copy_assignable : etl::is_pod<T> {};
+
+  /// is_trivially_copyable
+  /// For C++03, only POD types are recognised.
+  ///\ingroup type_traits
+  template <typename T> struct is_trivially_copyable : etl::is_pod<T> {};
 #endif
 
 #if ETL_CPP11_SUPPORTED
@@ -0,0 +1,843 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_UNORDERED_FLAT_SET_INCLUDED
+#define ETL_UNORDERED_FLAT_SET_INCLUDED
+
+#include <stddef.h>
+
+#include "platform.h"
+
+#include "stl/algorithm.h"
+#include "stl/iterator.h"
+#include "stl/functional.h"
+#include "stl/utility.h"
+
+#include "container.h"
+#include "alignment.h"
+#include "hash.h"
+#include "type_traits.h"
+#include "parameter_type.h"
+#include "nullptr.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "private/unordered_flat_table.h"
+
+#undef ETL_FILE
+#define ETL_FILE "52"
+
+//*****************************************************************************
+///\defgroup unordered_flat_set unordered_flat_set
+/// An unordered_set with the capacity defined at compile time.
+/// Uses open addressing. The keys are stored in a contiguous
+/// array of slots, with a parallel array of control bytes that are searched
+/// a group at a time.
+/// Iterators are invalidated by insertion, but not by erasure of other elements.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the unordered_flat_set.
+  ///\ingroup unordered_flat_set
+  //***************************************************************************
+  class unordered_flat_set_exception : public etl::exception
+  {
+  public:
+
+    unordered_flat_set_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the unordered_flat_set.
+  ///\ingroup unordered_flat_set
+  //***************************************************************************
+  class unordered_flat_set_full : public etl::unordered_flat_set_exception
+  {
+  public:
+
+    unordered_flat_set_full(string_type file_name_, numeric_type line_number_)
+      : etl::unordered_flat_set_exception(ETL_ERROR_TEXT("unordered_flat_set:full", ETL_FILE"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of range exception for the unordered_flat_set.
+  ///\ingroup unordered_flat_set
+  //***************************************************************************
+  class unordered_flat_set_out_of_range : public etl::unordered_flat_set_exception
+  {
+  public:
+
+    unordered_flat_set_out_of_range(string_type file_name_, numeric_type line_number_)
+      : etl::unordered_flat_set_exception(ETL_ERROR_TEXT("unordered_flat_set:range", ETL_FILE"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Iterator exception for the unordered_flat_set.
+  ///\ingroup unordered_flat_set
+  //***************************************************************************
+  class unordered_flat_set_iterator : public etl::unordered_flat_set_exception
+  {
+  public:
+
+    unordered_flat_set_iterator(string_type file_name_, numeric_type line_number_)
+      : etl::unordered_flat_set_exception(ETL_ERROR_TEXT("unordered_flat_set:iterator", ETL_FILE"C"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for specifically sized unordered_flat_set.
+  /// Can be used as a reference type for all unordered_flat_set containing a specific type.
+  ///\ingroup unordered_flat_set
+  //***************************************************************************
+  template <typename TKey, typename THash = etl::hash<TKey>, typename TKeyEqual = std::equal_to<TKey> >
+  class iunordered_flat_set
+  {
+  public:
+
+    typedef TKey              value_type;
+    typedef TKey              key_type;
+    typedef THash             hasher;
+    typedef TKeyEqual         key_equal;
+    typedef value_type&       reference;
+    typedef const value_type& const_reference;
+    typedef value_type*       pointer;
+    typedef const value_type* const_pointer;
+    typedef size_t            size_type;
+
+    typedef typename etl::parameter_type<TKey>::type key_parameter_t;
+
+  protected:
+
+    typedef etl::private_unordered_flat::ctrl_t ctrl_t;
+    typedef etl::private_unordered_flat::table<TKey, value_type, etl::private_unordered_flat::key_of_value<TKey>, THash, TKeyEqual> table_t;
+
+  public:
+
+    class const_iterator;
+
+    //*********************************************************************
+    class iterator : public std::iterator<std::forward_iterator_tag, value_type>
+    {
+    public:
+
+      friend class iunordered_flat_set;
+      friend class const_iterator;
+
+      //*********************************
+      iterator()
+        : ptable(nullptr),
+          index(0)
+      {
+      }
+
+      //*********************************
+      iterator(const iterator& other)
+        : ptable(other.ptable),
+          index(other.index)
+      {
+      }
+
+      //*********************************
+      iterator& operator ++()
+      {
+        index = ptable->next_full(index + 1);
+        return *this;
+      }
+
+      //*********************************
+      iterator operator ++(int)
+      {
+        iterator temp(*this);
+        operator++();
+        return temp;
+      }
+
+      //*********************************
+      iterator& operator =(const iterator& other)
+      {
+        ptable = other.ptable;
+        index  = other.index;
+        return *this;
+      }
+
+      //*********************************
+      const_reference operator *() const
+      {
+        return ptable->slot(index);
+      }
+
+      //*********************************
+      const_pointer operator ->() const
+      {
+        return &ptable->slot(index);
+      }
+
+      //*********************************
+      friend bool operator == (const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.index == rhs.index;
+      }
+
+      //*********************************
+      friend bool operator != (const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      //*********************************
+      iterator(table_t* ptable_, size_t index_)
+        : ptable(ptable_),
+          index(index_)
+      {
+      }
+
+      table_t* ptable;
+      size_t   index;
+    };
+
+    //*********************************************************************
+    class const_iterator : public std::iterator<std::forward_iterator_tag, const value_type>
+    {
+    public:
+
+      friend class iunordered_flat_set;
+
+      //*********************************
+      const_iterator()
+        : ptable(nullptr),
+          index(0)
+      {
+      }
+
+      //*********************************
+      const_iterator(const typename iunordered_flat_set::iterator& other)
+        : ptable(other.ptable),
+          index(other.index)
+      {
+      }
+
+      //*********************************
+      const_iterator(const const_iterator& other)
+        : ptable(other.ptable),
+          index(other.index)
+      {
+      }
+
+      //*********************************
+      const_iterator& operator ++()
+      {
+        index = ptable->next_full(index + 1);
+        return *this;
+      }
+
+      //*********************************
+      const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        operator++();
+        return temp;
+      }
+
+      //*********************************
+      const_iterator& operator =(const const_iterator& other)
+      {
+        ptable = other.ptable;
+        index  = other.index;
+        return *this;
+      }
+
+      //*********************************
+      const_reference operator *() const
+      {
+        return ptable->slot(index);
+      }
+
+      //*********************************
+      const_pointer operator ->() const
+      {
+        return &ptable->slot(index);
+      }
+
+      //*********************************
+      friend bool operator == (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.index == rhs.index;
+      }
+
+      //*********************************
+      friend bool operator != (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      //*********************************
+      const_iterator(const table_t* ptable_, size_t index_)
+        : ptable(ptable_),
+          index(index_)
+      {
+      }
+
+      const table_t* ptable;
+      size_t         index;
+    };
+
+    typedef typename std::iterator_traits<iterator>::difference_type difference_type;
+
+    //*********************************************************************
+    /// Returns an iterator to the beginning of the unordered_flat_set.
+    ///\return An iterator to the beginning of the unordered_flat_set.
+    //*********************************************************************
+    iterator begin()
+    {
+      return iterator(&table, table.next_full(0));
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the beginning of the unordered_flat_set.
+    ///\return A const iterator to the beginning of the unordered_flat_set.
+    //*********************************************************************
+    const_iterator begin() const
+    {
+      return const_iterator(&table, table.next_full(0));
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the beginning of the unordered_flat_set.
+    ///\return A const iterator to the beginning of the unordered_flat_set.
+    //*********************************************************************
+    const_iterator cbegin() const
+    {
+      return const_iterator(&table, table.next_full(0));
+    }
+
+    //*********************************************************************
+    /// Returns an iterator to the end of the unordered_flat_set.
+    ///\return An iterator to the end of the unordered_flat_set.
+    //*********************************************************************
+    iterator end()
+    {
+      return iterator(&table, table.slot_count());
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the end of the unordered_flat_set.
+    ///\return A const iterator to the end of the unordered_flat_set.
+    //*********************************************************************
+    const_iterator end() const
+    {
+      return const_iterator(&table, table.slot_count());
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the end of the unordered_flat_set.
+    ///\return A const iterator to the end of the unordered_flat_set.
+    //*********************************************************************
+    const_iterator cend() const
+    {
+      return const_iterator(&table, table.slot_count());
+    }
+
+    //*********************************************************************
+    /// Assigns values to the unordered_flat_set.
+    /// If asserts or exceptions are enabled, emits unordered_flat_set_full if the unordered_flat_set does not have enough free space.
+    /// If asserts or exceptions are enabled, emits unordered_flat_set_iterator if the iterators are reversed.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first_, TIterator last_)
+    {
+#if defined(ETL_DEBUG)
+      difference_type d = std::distance(first_, last_);
+      ETL_ASSERT(d >= 0, ETL_ERROR(unordered_flat_set_iterator));
+      ETL_ASSERT(size_t(d) <= max_size(), ETL_ERROR(unordered_flat_set_full));
+#endif
+
+      clear();
+
+      while (first_ != last_)
+      {
+        insert(*first_++);
+      }
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the unordered_flat_set.
+    /// If asserts or exceptions are enabled, emits unordered_flat_set_full if the unordered_flat_set is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    std::pair<iterator, bool> insert(const value_type& key)
+    {
+      std::pair<size_t, bool> result = table.insert(key);
+
+      ETL_ASSERT(result.first != table_t::npos, ETL_ERROR(unordered_flat_set_full));
+
+      if (result.first == table_t::npos)
+      {
+        return std::pair<iterator, bool>(end(), false);
+      }
+
+      return std::pair<iterator, bool>(iterator(&table, result.first), result.second);
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the unordered_flat_set.
+    /// If asserts or exceptions are enabled, emits unordered_flat_set_full if the unordered_flat_set is already full.
+    ///\param position The position to insert at.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator, const value_type& key)
+    {
+      return insert(key).first;
+    }
+
+    //*********************************************************************
+    /// Inserts a range of values to the unordered_flat_set.
+    /// If asserts or exceptions are enabled, emits unordered_flat_set_full if the unordered_flat_set does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first_, TIterator last_)
+    {
+      while (first_ != last_)
+      {
+        insert(*first_++);
+      }
+    }
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param key The key to erase.
+    ///\return The number of elements erased. 0 or 1.
+    //*********************************************************************
+    size_t erase(key_parameter_t key)
+    {
+      const size_t index = table.find(key);
+
+      if (index == table_t::npos)
+      {
+        return 0;
+      }
+
+      table.erase(index);
+
+      return 1;
+    }
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param ielement Iterator to the element.
+    //*********************************************************************
+    iterator erase(const_iterator ielement)
+    {
+      table.erase(ielement.index);
+
+      return iterator(&table, table.next_full(ielement.index + 1));
+    }
+
+    //*********************************************************************
+    /// Erases a range of elements.
+    /// The range includes all the elements between first and last, including the
+    /// element pointed by first, but not the one pointed to by last.
+    ///\param first Iterator to the first element.
+    ///\param last  Iterator to the last element.
+    //*********************************************************************
+    iterator erase(const_iterator first_, const_iterator last_)
+    {
+      size_t index = first_.index;
+
+      while (index != last_.index)
+      {
+        table.erase(index);
+        index = table.next_full(index + 1);
+      }
+
+      return iterator(&table, last_.index);
+    }
+
+    //*************************************************************************
+    /// Clears the unordered_flat_set.
+    //*************************************************************************
+    void clear()
+    {
+      table.clear();
+    }
+
+    //*********************************************************************
+    /// Counts an element.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    size_t count(key_parameter_t key) const
+    {
+      return (table.find(key) == table_t::npos) ? 0 : 1;
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    iterator find(key_parameter_t key)
+    {
+      const size_t index = table.find(key);
+
+      return (index == table_t::npos) ? end() : iterator(&table, index);
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    const_iterator find(key_parameter_t key) const
+    {
+      const size_t index = table.find(key);
+
+      return (index == table_t::npos) ? end() : const_iterator(&table, index);
+    }
+
+    //*********************************************************************
+    /// Returns a range containing all elements with key key in the container.
+    /// The range is defined by two iterators, the first pointing to the first
+    /// element of the wanted range and the second pointing past the last
+    /// element of the range.
+    ///\param key The key to search for.
+    ///\return An iterator pair to the range of elements if the key exists, otherwise end().
+    //*********************************************************************
+    std::pair<iterator, iterator> equal_range(key_parameter_t key)
+    {
+      iterator f = find(key);
+      iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return std::pair<iterator, iterator>(f, l);
+    }
+
+    //*********************************************************************
+    /// Returns a range containing all elements with key key in the container.
+    /// The range is defined by two iterators, the first pointing to the first
+    /// element of the wanted range and the second pointing past the last
+    /// element of the range.
+    ///\param key The key to search for.
+    ///\return A const iterator pair to the range of elements if the key exists, otherwise end().
+    //*********************************************************************
+    std::pair<const_iterator, const_iterator> equal_range(key_parameter_t key) const
+    {
+      const_iterator f = find(key);
+      const_iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return std::pair<const_iterator, const_iterator>(f, l);
+    }
+
+    //*************************************************************************
+    /// Gets the size of the unordered_flat_set.
+    //*************************************************************************
+    size_type size() const
+    {
+      return table.size();
+    }
+
+    //*************************************************************************
+    /// Gets the maximum possible size of the unordered_flat_set.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return table.max_size();
+    }
+
+    //*************************************************************************
+    /// Checks to see if the unordered_flat_set is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return table.size() == 0;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the unordered_flat_set is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return table.size() == table.max_size();
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    ///\return The remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return table.max_size() - table.size();
+    }
+
+    //*************************************************************************
+    /// Returns the number of slots.
+    ///\return The number of slots.
+    //*************************************************************************
+    size_t slot_count() const
+    {
+      return table.slot_count();
+    }
+
+    //*************************************************************************
+    /// Returns the load factor = size / slot_count.
+    ///\return The load factor = size / slot_count.
+    //*************************************************************************
+    float load_factor() const
+    {
+      return static_cast<float>(size()) / static_cast<float>(slot_count());
+    }
+
+    //*************************************************************************
+    /// Returns the function that hashes the keys.
+    ///\return The function that hashes the keys..
+    //*************************************************************************
+    hasher hash_function() const
+    {
+      return table.hash_function();
+    }
+
+    //*************************************************************************
+    /// Returns the function that compares the keys.
+    ///\return The function that compares the keys..
+    //*************************************************************************
+    key_equal key_eq() const
+    {
+      return table.key_eq();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    iunordered_flat_set& operator = (const iunordered_flat_set& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+  protected:
+
+    //*********************************************************************
+    /// Constructor.
+    //*********************************************************************
+    iunordered_flat_set(ctrl_t* pctrl_, value_type* pslots_, size_t number_of_slots_, size_t max_size_)
+      : table(pctrl_, pslots_, number_of_slots_, max_size_)
+    {
+    }
+
+    //*********************************************************************
+    /// Initialise the unordered_flat_set.
+    //*********************************************************************
+    void initialise()
+    {
+      table.clear();
+    }
+
+  private:
+
+    // Disable copy construction.
+    iunordered_flat_set(const iunordered_flat_set&);
+
+    /// The hash table.
+    table_t table;
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_UNORDERED_FLAT_SET) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~iunordered_flat_set()
+    {
+    }
+#else
+  protected:
+    ~iunordered_flat_set()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// Equal operator.
+  /// Elements are looked up by key, as the iteration orders may differ.
+  ///\param lhs Reference to the first unordered_flat_set.
+  ///\param rhs Reference to the second unordered_flat_set.
+  ///\return <b>true</b> if the sets are equal, otherwise <b>false</b>
+  ///\ingroup unordered_flat_set
+  //***************************************************************************
+  template <typename TKey, typename THash, typename TKeyEqual>
+  bool operator ==(const etl::iunordered_flat_set<TKey, THash, TKeyEqual>& lhs, const etl::iunordered_flat_set<TKey, THash, TKeyEqual>& rhs)
+  {
+    if (lhs.size() != rhs.size())
+    {
+      return false;
+    }
+
+    typename etl::iunordered_flat_set<TKey, THash, TKeyEqual>::const_iterator itr = lhs.begin();
+
+    while (itr != lhs.end())
+    {
+      if (rhs.find(*itr) == rhs.end())
+      {
+        return false;
+      }
+
+      ++itr;
+    }
+
+    return true;
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first unordered_flat_set.
+  ///\param rhs Reference to the second unordered_flat_set.
+  ///\return <b>true</b> if the sets are not equal, otherwise <b>false</b>
+  ///\ingroup unordered_flat_set
+  //***************************************************************************
+  template <typename TKey, typename THash, typename TKeyEqual>
+  bool operator !=(const etl::iunordered_flat_set<TKey, THash, TKeyEqual>& lhs, const etl::iunordered_flat_set<TKey, THash, TKeyEqual>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //*************************************************************************
+  /// A templated unordered_flat_set implementation that uses a fixed size buffer.
+  ///\tparam MAX_SIZE_ The maximum number of elements.
+  /// The number of slots is the smallest power of two, of at least 16, that
+  /// keeps the table no more than 7/8 full.
+  //*************************************************************************
+  template <typename TKey, const size_t MAX_SIZE_, typename THash = etl::hash<TKey>, typename TKeyEqual = std::equal_to<TKey> >
+  class unordered_flat_set : public etl::iunordered_flat_set<TKey, THash, TKeyEqual>
+  {
+  private:
+
+    typedef etl::iunordered_flat_set<TKey, THash, TKeyEqual> base;
+
+  public:
+
+    static const size_t MAX_SIZE   = MAX_SIZE_;
+    static const size_t SLOT_COUNT = etl::private_unordered_flat::slot_count<MAX_SIZE_>::value;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    unordered_flat_set()
+      : base(ctrl, reinterpret_cast<typename base::value_type*>(&slots), SLOT_COUNT, MAX_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    unordered_flat_set(const unordered_flat_set& other)
+      : base(ctrl, reinterpret_cast<typename base::value_type*>(&slots), SLOT_COUNT, MAX_SIZE)
+    {
+      base::assign(other.cbegin(), other.cend());
+    }
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    unordered_flat_set(TIterator first_, TIterator last_)
+      : base(ctrl, reinterpret_cast<typename base::value_type*>(&slots), SLOT_COUNT, MAX_SIZE)
+    {
+      base::assign(first_, last_);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~unordered_flat_set()
+    {
+      base::initialise();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    unordered_flat_set& operator = (const unordered_flat_set& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        base::assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+  private:
+
+    /// The control bytes.
+    typename base::ctrl_t ctrl[SLOT_COUNT];
+
+    /// The slots that hold the keys.
+    typename etl::aligned_storage<sizeof(typename base::value_type) * SLOT_COUNT, etl::alignment_of<typename base::value_type>::value>::type slots;
+  };
+}
+
+#undef ETL_FILE
+
+#endif
@@ -882,7 +882,46 @@ namespace etl
     //*********************************************************************
     size_t count(key_parameter_t key) const
     {
-      return (find(key) == end()) ? 0 : 1;
+      return count_hashed(key, key_hash_function(key));
+    }
+
+    //*********************************************************************
+    /// Counts an element, using a hash previously calculated by hash_function().
+    ///\param key  The key to search for.
+    ///\param hash The hash of the key.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    size_t count(key_parameter_t key, size_t hash) const
+    {
+      return count_hashed(key, hash);
+    }
+
+    //*********************************************************************
+    /// Counts an element, using a key of a type other than key_type.
+    /// Only available when both hasher and key_equal define 'is_transparent'.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    template <typename K>
+    typename etl::private_hash::transparent_lookup<hasher, key_equal, K, size_t>::type
+      count(const K& key) const
+    {
+      return count_hashed(key, key_hash_function(key));
+    }
+
+    //*********************************************************************
+    /// Counts an element, using a key of a type other than key_type and a hash
+    /// previously calculated by hash_function().
+    /// Only available when both hasher and key_equal define 'is_transparent'.
+    ///\param key  The key to search for.
+    ///\param hash The hash of the key.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    template <typename K>
+    typename etl::private_hash::transparent_lookup<hasher, key_equal, K, size_t>::type
+      count(const K& key, size_t hash) const
+    {
+      return count_hashed(key, hash);
     }
 
     //*********************************************************************
@@ -892,31 +931,46 @@ namespace etl
     //*********************************************************************
     iterator find(key_parameter_t key)
     {
-      size_t index = get_bucket_index(key);
-
-      bucket_t* pbucket = pbuckets + index;
-      bucket_t& bucket = *pbucket;
-
-      // Is the bucket not empty?
-      if (!bucket.empty())
-      {
-        // Step though the list until we find the end or an equivalent key.
-        local_iterator inode = bucket.begin();
-        local_iterator iend = bucket.end();
+      return find_hashed(key, key_hash_function(key));
+    }
 
-        while (inode != iend)
-        {
-          // Do we have this one?
-          if (key_equal_function(key, inode->key))
-          {
-            return iterator(pbuckets + number_of_buckets, pbucket, inode);
-          }
+    //*********************************************************************
+    /// Finds an element, using a hash previously calculated by hash_function().
+    ///\param key  The key to search for.
+    ///\param hash The hash of the key.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    iterator find(key_parameter_t key, size_t hash)
+    {
+      return find_hashed(key, hash);
+    }
 
-          ++inode;
-        }
-      }
+    //*********************************************************************
+    /// Finds an element, using a key of a type other than key_type.
+    /// Only available when both hasher and key_equal define 'is_transparent'.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename K>
+    typename etl::private_hash::transparent_lookup<hasher, key_equal, K, iterator>::type
+      find(const K& key)
+    {
+      return find_hashed(key, key_hash_function(key));
+    }
 
-      return end();
+    //*********************************************************************
+    /// Finds an element, using a key of a type other than key_type and a hash
+    /// previously calculated by hash_function().
+    /// Only available when both hasher and key_equal define 'is_transparent'.
+    ///\param key  The key to search for.
+    ///\param hash The hash of the key.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename K>
+    typename etl::private_hash::transparent_lookup<hasher, key_equal, K, iterator>::type
+      find(const K& key, size_t hash)
+    {
+      return find_hashed(key, hash);
     }
 
     //*********************************************************************
@@ -926,73 +980,144 @@ namespace etl
     //*********************************************************************
     const_iterator find(key_parameter_t key) const
     {
-      size_t index = get_bucket_index(key);
-
-      bucket_t* pbucket = pbuckets + index;
-      bucket_t& bucket = *pbucket;
-
-      // Is the bucket not empty?
-      if (!bucket.empty())
-      {
-        // Step though the list until we find the end or an equivalent key.
-        local_iterator inode = bucket.begin();
-        local_iterator iend = bucket.end();
+      return find_hashed(key, key_hash_function(key));
+    }
 
-        while (inode != iend)
-        {
-          // Do we have this one?
-          if (key_equal_function(key, inode->key))
-          {
-            return iterator(pbuckets + number_of_buckets, pbucket, inode);
-          }
+    //*********************************************************************
+    /// Finds an element, using a hash previously calculated by hash_function().
+    ///\param key  The key to search for.
+    ///\param hash The hash of the key.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    const_iterator find(key_parameter_t key, size_t hash) const
+    {
+      return find_hashed(key, hash);
+    }
 
-          ++inode;
-        }
-      }
+    //*********************************************************************
+    /// Finds an element, using a key of a type other than key_type.
+    /// Only available when both hasher and key_equal define 'is_transparent'.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename K>
+    typename etl::private_hash::transparent_lookup<hasher, key_equal, K, const_iterator>::type
+      find(const K& key) const
+    {
+      return find_hashed(key, key_hash_function(key));
+    }
 
-      return end();
+    //*********************************************************************
+    /// Finds an element, using a key of a type other than key_type and a hash
+    /// previously calculated by hash_function().
+    /// Only available when both hasher and key_equal define 'is_transparent'.
+    ///\param key  The key to search for.
+    ///\param hash The hash of the key.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename K>
+    typename etl::private_hash::transparent_lookup<hasher, key_equal, K, const_iterator>::type
+      find(const K& key, size_t hash) const
+    {
+      return find_hashed(key, hash);
     }
 
     //*********************************************************************
-    /// Returns a range containing all elements with key 'key' in the container.
-    /// The range is defined by two iterators, the first pointing to the first
-    /// element of the wanted range and the second pointing past the last
-    /// element of the range.
+    /// Returns a range containing all elements with the key.
     ///\param key The key to search for.
     ///\return An iterator pair to the range of elements if the key exists, otherwise end().
     //*********************************************************************
     std::pair<iterator, iterator> equal_range(key_parameter_t key)
     {
-      iterator f = find(key);
-      iterator l = f;
+      return equal_range_hashed(key, key_hash_function(key));
+    }
 
-      if (l != end())
-      {
-        ++l;
-      }
+    //*********************************************************************
+    /// Returns a range containing all elements with the key, using a hash previously calculated by hash_function().
+    ///\param key  The key to search for.
+    ///\param hash The hash of the key.
+    ///\return An iterator pair to the range of elements if the key exists, otherwise end().
+    //*********************************************************************
+    std::pair<iterator, iterator> equal_range(key_parameter_t key, size_t hash)
+    {
+      return equal_range_hashed(key, hash);
+    }
 
-      return std::pair<iterator, iterator>(f, l);
+    //*********************************************************************
+    /// Returns a range containing all elements with the key, using a key of a type other than key_type.
+    /// Only available when both hasher and key_equal define 'is_transparent'.
+    ///\param key The key to search for.
+    ///\return An iterator pair to the range of elements if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename K>
+    typename etl::private_hash::transparent_lookup<hasher, key_equal, K, std::pair<iterator, iterator> >::type
+      equal_range(const K& key)
+    {
+      return equal_range_hashed(key, key_hash_function(key));
+    }
+
+    //*********************************************************************
+    /// Returns a range containing all elements with the key, using a key of a type other than key_type and a hash
+    /// previously calculated by hash_function().
+    /// Only available when both hasher and key_equal define 'is_transparent'.
+    ///\param key  The key to search for.
+    ///\param hash The hash of the key.
+    ///\return An iterator pair to the range of elements if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename K>
+    typename etl::private_hash::transparent_lookup<hasher, key_equal, K, std::pair<iterator, iterator> >::type
+      equal_range(const K& key, size_t hash)
+    {
+      return equal_range_hashed(key, hash);
     }
 
     //*********************************************************************
-    /// Returns a range containing all elements with key 'key' in the container.
-    /// The range is defined by two iterators, the first pointing to the first
-    /// element of the wanted range and the second pointing past the last
-    /// element of the range.
+    /// Returns a range containing all elements with the key.
     ///\param key The key to search for.
     ///\return A const iterator pair to the range of elements if the key exists, otherwise end().
     //*********************************************************************
     std::pair<const_iterator, const_iterator> equal_range(key_parameter_t key) const
     {
-      const_iterator f = find(key);
-      const_iterator l = f;
+      return equal_range_hashed(key, key_hash_function(key));
+    }
 
-      if (l != end())
-      {
-        ++l;
-      }
+    //*********************************************************************
+    /// Returns a range containing all elements with the key, using a hash previously calculated by hash_function().
+    ///\param key  The key to search for.
+    ///\param hash The hash of the key.
+    ///\return A const iterator pair to the range of elements if the key exists, otherwise end().
+    //*********************************************************************
+    std::pair<const_iterator, const_iterator> equal_range(key_parameter_t key, size_t hash) const
+    {
+      return equal_range_hashed(key, hash);
+    }
 
-      return std::pair<const_iterator, const_iterator>(f, l);
+    //*********************************************************************
+    /// Returns a range containing all elements with the key, using a key of a type other than key_type.
+    /// Only available when both hasher and key_equal define 'is_transparent'.
+    ///\param key The key to search for.
+    ///\return A const iterator pair to the range of elements if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename K>
+    typename etl::private_hash::transparent_lookup<hasher, key_equal, K, std::pair<const_iterator, const_iterator> >::type
+      equal_range(const K& key) const
+    {
+      return equal_range_hashed(key, key_hash_function(key));
+    }
+
+    //*********************************************************************
+    /// Returns a range containing all elements with the key, using a key of a type other than key_type and a hash
+    /// previously calculated by hash_function().
+    /// Only available when both hasher and key_equal define 'is_transparent'.
+    ///\param key  The key to search for.
+    ///\param hash The hash of the key.
+    ///\return A const iterator pair to the range of elements if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename K>
+    typename etl::private_hash::transparent_lookup<hasher, key_equal, K, std::pair<const_iterator, const_iterator> >::type
+      equal_range(const K& key, size_t hash) const
+    {
+      return equal_range_hashed(key, hash);
     }
 
     //*************************************************************************
@@ -1129,6 +1254,67 @@ namespace etl
 
   private:
 
+    //*********************************************************************
+    /// Finds the first element with the key in the bucket selected by the hash.
+    //*********************************************************************
+    template <typename K>
+    iterator find_hashed(const K& key, size_t hash) const
+    {
+      bucket_t* pbucket = pbuckets + (hash % number_of_buckets);
+      bucket_t& bucket = *pbucket;
+
+      // Is the bucket not empty?
+      if (!bucket.empty())
+      {
+        // Step though the list until we find the end or an equivalent key.
+        local_iterator inode = bucket.begin();
+        local_iterator iend = bucket.end();
+
+        while (inode != iend)
+        {
+          // Do we have this one?
+          if (key_equal_function(key, inode->key))
+          {
+            return iterator((pbuckets + number_of_buckets), pbucket, inode);
+          }
+
+          ++inode;
+        }
+      }
+
+      return iterator((pbuckets + number_of_buckets), last, last->end());
+    }
+
+    //*********************************************************************
+    /// Finds the range of elements with the key in the bucket selected by the hash.
+    //*********************************************************************
+    template <typename K>
+    std::pair<iterator, iterator> equal_range_hashed(const K& key, size_t hash) const
+    {
+      const iterator iend((pbuckets + number_of_buckets), last, last->end());
+
+      iterator f = find_hashed(key, hash);
+      iterator l = f;
+
+      if (l != iend)
+      {
+        ++l;
+      }
+
+      return std::pair<iterator, iterator>(f, l);
+    }
+
+    //*********************************************************************
+    /// Counts the elements with the key in the bucket selected by the hash.
+    //*********************************************************************
+    template <typename K>
+    size_t count_hashed(const K& key, size_t hash) const
+    {
+      std::pair<iterator, iterator> range = equal_range_hashed(key, hash);
+
+      return std::distance(range.first, range.second);
+    }
+
     //*********************************************************************
     /// Adjust the first and last markers according to the new entry.
     //*********************************************************************
@@ -0,0 +1,103 @@
+// btree_map.cpp : Compares map and btree_map.
+//
+// Both maps are filled with the same random keys. The same sequence of
+// random keys, half of which are present, is looked up in each, then each is
+// iterated from end to end a number of times.
+//
+// Build with the ETL include directories and the test profile, e.g.
+// g++ -O2 -std=c++11 -I../../../include -I../.. btree_map.cpp
+
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <stdint.h>
+
+#include "etl/map.h"
+#include "etl/btree_map.h"
+
+const size_t SIZE    = 65536;
+const size_t LOOKUPS = 10000000;
+const size_t SCANS   = 500;
+
+std::chrono::high_resolution_clock::time_point begin;
+
+void StartTimer()
+{
+  begin = std::chrono::high_resolution_clock::now();
+}
+
+uint64_t StopTimer()
+{
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  return std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count();
+}
+
+template <typename TMap>
+void Run(const char* name, TMap& map, const std::vector<std::pair<uint32_t, uint32_t> >& values, const std::vector<uint32_t>& keys)
+{
+  StartTimer();
+  map.insert(values.begin(), values.end());
+  uint64_t insert_time = StopTimer();
+
+  uint64_t sum = 0;
+
+  StartTimer();
+
+  for (size_t i = 0; i < keys.size(); ++i)
+  {
+    typename TMap::const_iterator itr = map.find(keys[i]);
+
+    if (itr != map.end())
+    {
+      sum += itr->second;
+    }
+  }
+
+  uint64_t find_time = StopTimer();
+
+  StartTimer();
+
+  for (size_t i = 0; i < SCANS; ++i)
+  {
+    for (typename TMap::const_iterator itr = map.begin(); itr != map.end(); ++itr)
+    {
+      sum += itr->second;
+    }
+  }
+
+  uint64_t scan_time = StopTimer();
+
+  std::cout << name << " Insert = " << insert_time << "ms Find = " << find_time << "ms Scan = " << scan_time << "ms Result = " << sum << "\n";
+}
+
+int main()
+{
+  std::mt19937 generator(1);
+
+  std::vector<std::pair<uint32_t, uint32_t> > values;
+
+  for (uint32_t i = 0; i < SIZE; ++i)
+  {
+    values.push_back(std::make_pair(i * 2, i));
+  }
+
+  std::shuffle(values.begin(), values.end(), generator);
+
+  std::vector<uint32_t> keys(LOOKUPS);
+
+  for (size_t i = 0; i < LOOKUPS; ++i)
+  {
+    keys[i] = generator() % (2 * SIZE);
+  }
+
+  static etl::map<uint32_t, uint32_t, SIZE>       map;
+  static etl::btree_map<uint32_t, uint32_t, SIZE> btree;
+
+  Run("map       ", map, values, keys);
+  Run("btree_map ", btree, values, keys);
+
+  return 0;
+}
@@ -0,0 +1,110 @@
+// callback_timer.cpp : Compares callback_timer and callback_timer_wheel.
+//
+// Models protocol retransmit timers. Every timer is started with a random
+// timeout. On each tick a number of timers are restarted, as if a packet
+// had been acknowledged and the next one sent.
+//
+// Build with the ETL include directories and the test profile, e.g.
+// g++ -O2 -std=c++11 -I../../../include -I../.. callback_timer.cpp
+
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <stdint.h>
+
+#include "etl/callback_timer.h"
+
+const size_t   SMALL_TIMERS  = 254;
+const size_t   LARGE_TIMERS  = 10000;
+const uint32_t TICKS         = 100000;
+const size_t   RESTARTS      = 4;
+
+std::chrono::high_resolution_clock::time_point begin;
+
+void StartTimer()
+{
+  begin = std::chrono::high_resolution_clock::now();
+}
+
+uint64_t StopTimer()
+{
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  return std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count();
+}
+
+uint64_t expired = 0;
+
+void on_timeout()
+{
+  ++expired;
+}
+
+//*****************************************************************************
+// Runs the retransmit model over any timer type.
+//*****************************************************************************
+template <typename TController>
+uint64_t Run(TController& controller, size_t n_timers)
+{
+  std::mt19937 generator(1);
+  std::uniform_int_distribution<uint32_t> timeout(10, 1000);
+  std::uniform_int_distribution<size_t>   timer(0, n_timers - 1);
+
+  std::vector<size_t> ids;
+
+  for (size_t i = 0; i < n_timers; ++i)
+  {
+    ids.push_back(controller.register_timer(on_timeout, timeout(generator), etl::timer::mode::REPEATING));
+    controller.start(ids.back());
+  }
+
+  controller.enable(true);
+  expired = 0;
+
+  StartTimer();
+
+  for (uint32_t t = 0; t < TICKS; ++t)
+  {
+    for (size_t i = 0; i < RESTARTS; ++i)
+    {
+      controller.start(typename TController::id_type(ids[timer(generator)]));
+    }
+
+    controller.tick(1);
+  }
+
+  return StopTimer();
+}
+
+template <const uint_least8_t MAX_TIMERS>
+struct ListController : public etl::callback_timer<MAX_TIMERS>
+{
+  typedef etl::timer::id::type id_type;
+};
+
+template <const uint_least16_t MAX_TIMERS>
+struct WheelController : public etl::callback_timer_wheel<MAX_TIMERS>
+{
+  typedef etl::timer::wheel_id::type id_type;
+};
+
+int main()
+{
+  ListController<SMALL_TIMERS>* p_list = new ListController<SMALL_TIMERS>;
+  uint64_t list_time = Run(*p_list, SMALL_TIMERS);
+  std::cout << "callback_timer<"       << SMALL_TIMERS << ">       : " << list_time << "ms (" << expired << " expired)\n";
+  delete p_list;
+
+  WheelController<SMALL_TIMERS>* p_small = new WheelController<SMALL_TIMERS>;
+  uint64_t small_time = Run(*p_small, SMALL_TIMERS);
+  std::cout << "callback_timer_wheel<" << SMALL_TIMERS << ">   : " << small_time << "ms (" << expired << " expired)\n";
+  delete p_small;
+
+  WheelController<LARGE_TIMERS>* p_large = new WheelController<LARGE_TIMERS>;
+  uint64_t large_time = Run(*p_large, LARGE_TIMERS);
+  std::cout << "callback_timer_wheel<" << LARGE_TIMERS << "> : " << large_time << "ms (" << expired << " expired)\n";
+  delete p_large;
+
+  return 0;
+}
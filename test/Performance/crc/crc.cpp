@@ -0,0 +1,83 @@
+// crc.cpp : Compares the byte-wise and block CRC32 policies.
+//
+// Build with the ETL include directories and the test profile, e.g.
+// g++ -O2 -std=c++11 -I../../../include -I../.. crc.cpp
+// Add -msse4.2 to enable the hardware CRC32_C path on x86 profiles.
+
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <stdint.h>
+
+#include "etl/crc32.h"
+#include "etl/crc32_c.h"
+
+std::chrono::high_resolution_clock::time_point begin;
+
+void StartTimer()
+{
+  begin = std::chrono::high_resolution_clock::now();
+}
+
+uint64_t StopTimer()
+{
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  return std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count();
+}
+
+const size_t TESTSIZE = 16 * 1024 * 1024;
+const size_t TESTINTERATIONS = 16;
+
+std::vector<uint8_t> data(TESTSIZE);
+
+template <typename TCrc>
+void Run(const char* name)
+{
+  const uint8_t* pbegin = &data[0];
+  const uint8_t* pend   = pbegin + data.size();
+
+  uint32_t result = 0;
+
+  StartTimer();
+
+  for (size_t i = 0; i < TESTINTERATIONS; ++i)
+  {
+    // Change the data each pass so that the calculation cannot be hoisted.
+    data[i] = uint8_t(result);
+    result += TCrc(pbegin, pend).value();
+  }
+
+  uint64_t time = StopTimer();
+
+  double mbytes = double(TESTSIZE * TESTINTERATIONS) / (1024.0 * 1024.0);
+
+  std::cout << name << " Time = " << time << "ms";
+
+  if (time != 0)
+  {
+    std::cout << " (" << (mbytes * 1000.0) / double(time) << " MB/s)";
+  }
+
+  std::cout << " Result = " << std::hex << result << std::dec << "\n";
+}
+
+int main()
+{
+  for (size_t i = 0; i < data.size(); ++i)
+  {
+    data[i] = uint8_t(i * 2654435761U >> 24);
+  }
+
+  Run<etl::crc32>("crc32               ");
+  Run<etl::crc32_slicing<4> >("crc32_slicing<4>    ");
+  Run<etl::crc32_slicing<8> >("crc32_slicing<8>    ");
+  Run<etl::crc32_slicing<16> >("crc32_slicing<16>   ");
+
+  Run<etl::crc32_c>("crc32_c             ");
+  Run<etl::crc32_c_slicing<4> >("crc32_c_slicing<4>  ");
+  Run<etl::crc32_c_slicing<8> >("crc32_c_slicing<8>  ");
+  Run<etl::crc32_c_slicing<16> >("crc32_c_slicing<16> ");
+
+  return 0;
+}
@@ -0,0 +1,82 @@
+// frozen_flat_map.cpp : Compares lookups in flat_map and frozen_flat_map.
+//
+// Both maps hold the same keys. The same sequence of random keys, half of
+// which are present, is looked up in each.
+//
+// Build with the ETL include directories and the test profile, e.g.
+// g++ -O2 -std=c++11 -I../../../include -I../.. frozen_flat_map.cpp
+
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <stdint.h>
+
+#include "etl/flat_map.h"
+#include "etl/frozen_flat_map.h"
+
+const size_t SIZE    = 4096;
+const size_t LOOKUPS = 10000000;
+
+std::chrono::high_resolution_clock::time_point begin;
+
+void StartTimer()
+{
+  begin = std::chrono::high_resolution_clock::now();
+}
+
+uint64_t StopTimer()
+{
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  return std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count();
+}
+
+template <typename TMap>
+void Run(const char* name, const TMap& map, const std::vector<uint32_t>& keys)
+{
+  uint64_t sum = 0;
+
+  StartTimer();
+
+  for (size_t i = 0; i < keys.size(); ++i)
+  {
+    typename TMap::const_iterator itr = map.find(keys[i]);
+
+    if (itr != map.end())
+    {
+      sum += itr->second;
+    }
+  }
+
+  uint64_t time = StopTimer();
+
+  std::cout << name << " Time = " << time << "ms Result = " << sum << "\n";
+}
+
+int main()
+{
+  std::mt19937 generator(1);
+
+  std::vector<std::pair<uint32_t, uint32_t> > values;
+
+  for (uint32_t i = 0; i < SIZE; ++i)
+  {
+    values.push_back(std::make_pair(i * 2, i));
+  }
+
+  static etl::flat_map<uint32_t, uint32_t, SIZE>        flat(values.begin(), values.end());
+  static etl::frozen_flat_map<uint32_t, uint32_t, SIZE> frozen(values.begin(), values.end());
+
+  std::vector<uint32_t> keys(LOOKUPS);
+
+  for (size_t i = 0; i < LOOKUPS; ++i)
+  {
+    keys[i] = generator() % (2 * SIZE);
+  }
+
+  Run("flat_map        ", flat, keys);
+  Run("frozen_flat_map ", frozen, keys);
+
+  return 0;
+}
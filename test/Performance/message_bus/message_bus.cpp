@@ -0,0 +1,153 @@
+// message_bus.cpp : Compares message_bus and indexed_message_bus broadcasts.
+//
+// Each bus has the same set of routers subscribed. Each router accepts two
+// of the message types. The same sequence of random messages is broadcast
+// on each bus.
+//
+// Build with the ETL include directories and the test profile, e.g.
+// g++ -O2 -std=c++11 -I../../../include -I../.. message_bus.cpp
+
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <stdint.h>
+
+#include "etl/message_router.h"
+#include "etl/message_bus.h"
+
+const size_t ROUTERS    = 64;
+const size_t MESSAGES   = 16;
+const size_t BROADCASTS = 2000000;
+
+std::chrono::high_resolution_clock::time_point begin;
+
+void StartTimer()
+{
+  begin = std::chrono::high_resolution_clock::now();
+}
+
+uint64_t StopTimer()
+{
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  return std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count();
+}
+
+uint64_t received = 0;
+
+template <size_t ID>
+struct Message : public etl::message<ID>
+{
+};
+
+//*****************************************************************************
+// Accepts Message<ID> and Message<ID + MESSAGES / 2>.
+//*****************************************************************************
+template <size_t ID>
+class Router : public etl::message_router<Router<ID>, Message<ID>, Message<ID + (MESSAGES / 2)> >
+{
+public:
+
+  typedef etl::message_router<Router<ID>, Message<ID>, Message<ID + (MESSAGES / 2)> > base_t;
+
+  Router(etl::message_router_id_t id)
+    : base_t(id)
+  {
+  }
+
+  void on_receive(etl::imessage_router&, const Message<ID>&)
+  {
+    ++received;
+  }
+
+  void on_receive(etl::imessage_router&, const Message<ID + (MESSAGES / 2)>&)
+  {
+    ++received;
+  }
+
+  void on_receive_unknown(etl::imessage_router&, const etl::imessage&)
+  {
+  }
+};
+
+//*****************************************************************************
+// Creates ROUTERS / (MESSAGES / 2) routers of each type.
+//*****************************************************************************
+template <size_t ID>
+void CreateRouters(std::vector<etl::imessage_router*>& routers)
+{
+  CreateRouters<ID - 1>(routers);
+
+  for (size_t i = 0; i < (ROUTERS / (MESSAGES / 2)); ++i)
+  {
+    routers.push_back(new Router<ID - 1>(etl::message_router_id_t(routers.size())));
+  }
+}
+
+template <>
+void CreateRouters<0>(std::vector<etl::imessage_router*>&)
+{
+}
+
+template <size_t ID>
+void CreateMessages(std::vector<etl::imessage*>& messages)
+{
+  CreateMessages<ID - 1>(messages);
+  messages.push_back(new Message<ID - 1>());
+}
+
+template <>
+void CreateMessages<0>(std::vector<etl::imessage*>&)
+{
+}
+
+void Run(const char* name, etl::imessage_bus& bus, const std::vector<etl::imessage*>& messages, const std::vector<size_t>& sequence)
+{
+  etl::null_message_router& sender = etl::null_message_router::instance();
+
+  received = 0;
+
+  StartTimer();
+
+  for (size_t i = 0; i < sequence.size(); ++i)
+  {
+    bus.receive(sender, *messages[sequence[i]]);
+  }
+
+  uint64_t time = StopTimer();
+
+  std::cout << name << " Broadcast = " << time << "ms Received = " << received << "\n";
+}
+
+int main()
+{
+  std::mt19937 generator(1);
+
+  std::vector<etl::imessage_router*> routers;
+  CreateRouters<MESSAGES / 2>(routers);
+
+  std::vector<etl::imessage*> messages;
+  CreateMessages<MESSAGES>(messages);
+
+  std::vector<size_t> sequence(BROADCASTS);
+
+  for (size_t i = 0; i < BROADCASTS; ++i)
+  {
+    sequence[i] = generator() % MESSAGES;
+  }
+
+  static etl::message_bus<ROUTERS>                   bus;
+  static etl::indexed_message_bus<ROUTERS, MESSAGES> indexed_bus;
+
+  for (size_t i = 0; i < routers.size(); ++i)
+  {
+    bus.subscribe(*routers[i]);
+    indexed_bus.subscribe(*routers[i]);
+  }
+
+  Run("message_bus         ", bus, messages, sequence);
+  Run("indexed_message_bus ", indexed_bus, messages, sequence);
+
+  return 0;
+}
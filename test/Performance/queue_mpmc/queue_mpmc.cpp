@@ -0,0 +1,118 @@
+// queue_mpmc.cpp : Compares queue_mpmc_mutex and queue_mpmc_atomic under contention.
+//
+// Each run starts an equal number of producer and consumer threads that pass
+// a fixed total number of items through one queue.
+//
+// Build with the ETL include directories and the test profile, e.g.
+// g++ -O2 -std=c++11 -pthread -I../../../include -I../.. queue_mpmc.cpp
+
+#include <iostream>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <stdint.h>
+
+#include "etl/queue_mpmc_mutex.h"
+#include "etl/queue_mpmc_atomic.h"
+
+const size_t QUEUE_SIZE  = 64;
+const size_t TOTAL_ITEMS = 4 * 1024 * 1024;
+
+std::chrono::high_resolution_clock::time_point begin;
+
+void StartTimer()
+{
+  begin = std::chrono::high_resolution_clock::now();
+}
+
+uint64_t StopTimer()
+{
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  return std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count();
+}
+
+template <typename TQueue>
+void Run(const char* name, size_t n_threads)
+{
+  TQueue queue;
+
+  const size_t per_producer = TOTAL_ITEMS / n_threads;
+
+  std::atomic<bool>     start(false);
+  std::atomic<uint64_t> result(0);
+
+  std::vector<std::thread> threads;
+
+  for (size_t t = 0; t < n_threads; ++t)
+  {
+    threads.push_back(std::thread([&]()
+    {
+      while (!start.load());
+
+      for (size_t i = 0; i < per_producer; ++i)
+      {
+        while (!queue.push(uint32_t(i)))
+        {
+          std::this_thread::yield();
+        }
+      }
+    }));
+
+    threads.push_back(std::thread([&]()
+    {
+      uint64_t sum = 0;
+
+      while (!start.load());
+
+      for (size_t i = 0; i < per_producer; ++i)
+      {
+        uint32_t value;
+
+        while (!queue.pop(value))
+        {
+          std::this_thread::yield();
+        }
+
+        sum += value;
+      }
+
+      result += sum;
+    }));
+  }
+
+  StartTimer();
+  start.store(true);
+
+  for (size_t t = 0; t < threads.size(); ++t)
+  {
+    threads[t].join();
+  }
+
+  uint64_t time = StopTimer();
+
+  double mitems = double(per_producer * n_threads) / 1000000.0;
+
+  std::cout << name << " threads = " << n_threads << " + " << n_threads << " Time = " << time << "ms";
+
+  if (time != 0)
+  {
+    std::cout << " (" << (mitems * 1000.0) / double(time) << " M items/s)";
+  }
+
+  std::cout << " Result = " << result.load() << "\n";
+}
+
+int main()
+{
+  const size_t thread_counts[] = { 1, 2, 4, 8, 16 };
+
+  for (size_t i = 0; i < (sizeof(thread_counts) / sizeof(thread_counts[0])); ++i)
+  {
+    Run<etl::queue_mpmc_mutex<uint32_t, QUEUE_SIZE> >("queue_mpmc_mutex  ", thread_counts[i]);
+    Run<etl::queue_mpmc_atomic<uint32_t, QUEUE_SIZE> >("queue_mpmc_atomic ", thread_counts[i]);
+  }
+
+  return 0;
+}
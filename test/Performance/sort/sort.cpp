@@ -0,0 +1,107 @@
+// sort.cpp : Compares etl::sort and etl::radix_sort with std::sort.
+//
+// Each input pattern is sorted a number of times by both algorithms and the
+// total time for each is reported.
+//
+// Build with the ETL include directories and the test profile, e.g.
+// g++ -O2 -std=c++11 -I../../../include -I../.. sort.cpp
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <numeric>
+#include <chrono>
+#include <random>
+#include <stdint.h>
+
+#include "etl/algorithm.h"
+
+const size_t SIZE       = 1000000;
+const size_t ITERATIONS = 10;
+
+std::chrono::high_resolution_clock::time_point begin;
+
+void StartTimer()
+{
+  begin = std::chrono::high_resolution_clock::now();
+}
+
+uint64_t StopTimer()
+{
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  return std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count();
+}
+
+template <typename TSort>
+uint64_t Time(const std::vector<uint32_t>& input, TSort sort)
+{
+  uint64_t total = 0;
+  uint64_t check = 0;
+
+  for (size_t i = 0; i < ITERATIONS; ++i)
+  {
+    std::vector<uint32_t> data = input;
+
+    StartTimer();
+    sort(data);
+    total += StopTimer();
+
+    check += data[data.size() / 2];
+  }
+
+  // Stops the sort being optimised away.
+  if (check == 1)
+  {
+    std::cout << "";
+  }
+
+  return total;
+}
+
+void Run(const char* name, const std::vector<uint32_t>& input)
+{
+  uint64_t std_time = Time(input, [](std::vector<uint32_t>& data) { std::sort(data.begin(), data.end()); });
+  uint64_t etl_time = Time(input, [](std::vector<uint32_t>& data) { etl::sort(data.begin(), data.end()); });
+
+  uint64_t radix_time = Time(input, [](std::vector<uint32_t>& data)
+  {
+    static std::vector<uint32_t> buffer(SIZE);
+    etl::radix_sort(data.begin(), data.end(), buffer.begin(), buffer.end());
+  });
+
+  uint64_t radix11_time = Time(input, [](std::vector<uint32_t>& data)
+  {
+    static std::vector<uint32_t> buffer(SIZE);
+    etl::radix_sort<11>(data.begin(), data.end(), buffer.begin(), buffer.end());
+  });
+
+  std::cout << name << " std::sort = " << std_time << "ms etl::sort = " << etl_time << "ms"
+            << " etl::radix_sort<8> = " << radix_time << "ms etl::radix_sort<11> = " << radix11_time << "ms\n";
+}
+
+int main()
+{
+  std::mt19937 generator(1);
+
+  std::vector<uint32_t> sorted(SIZE);
+  std::iota(sorted.begin(), sorted.end(), 0);
+
+  std::vector<uint32_t> reversed(sorted.rbegin(), sorted.rend());
+
+  std::vector<uint32_t> random(SIZE);
+  std::vector<uint32_t> few_unique(SIZE);
+
+  for (size_t i = 0; i < SIZE; ++i)
+  {
+    random[i]     = generator();
+    few_unique[i] = generator() % 16;
+  }
+
+  Run("sorted     ", sorted);
+  Run("reversed   ", reversed);
+  Run("random     ", random);
+  Run("few unique ", few_unique);
+
+  return 0;
+}
@@ -34,6 +34,7 @@ SOFTWARE.
 #define ETL_THROW_EXCEPTIONS
 #define ETL_VERBOSE_ERRORS
 #define ETL_CHECK_PUSH_POP
+#define ETL_POOL_STATISTICS
 #define ETL_ISTRING_REPAIR_ENABLE
 #define ETL_IVECTOR_REPAIR_ENABLE
 #define ETL_IDEQUE_REPAIR_ENABLE
@@ -65,6 +66,8 @@ SOFTWARE.
 #define ETL_POLYMORPHIC_UNORDERED_MULTIMAP
 #define ETL_POLYMORPHIC_UNORDERED_SET
 #define ETL_POLYMORPHIC_UNORDERED_MULTISET
+#define ETL_POLYMORPHIC_UNORDERED_FLAT_MAP
+#define ETL_POLYMORPHIC_UNORDERED_FLAT_SET
 #define ETL_POLYMORPHIC_STRINGS
 #define ETL_POLYMORPHIC_POOL
 #define ETL_POLYMORPHIC_VECTOR
@@ -30,6 +30,7 @@ SOFTWARE.
 
 #include "etl/algorithm.h"
 #include "etl/container.h"
+#include "etl/cstring.h"
 
 #include <vector>
 #include <list>
@@ -909,5 +910,368 @@ namespace
         CHECK(is_same);
       }
     }
+
+    //=========================================================================
+    TEST(sort_patterns)
+    {
+      const size_t SIZES[] = { 0, 1, 2, 3, 10, 23, 24, 25, 100, 129, 1000, 5000 };
+
+      for (size_t s = 0; s < sizeof(SIZES) / sizeof(SIZES[0]); ++s)
+      {
+        const size_t size = SIZES[s];
+
+        std::vector<int> sorted(size);
+        std::iota(sorted.begin(), sorted.end(), 0);
+
+        std::vector<int> reversed(sorted.rbegin(), sorted.rend());
+
+        std::vector<int> random = sorted;
+        std::random_shuffle(random.begin(), random.end());
+
+        std::vector<int> few_unique(size);
+        for (size_t i = 0; i < size; ++i)
+        {
+          few_unique[i] = random[i] % 4;
+        }
+
+        std::vector<int> organ_pipe(size);
+        for (size_t i = 0; i < size; ++i)
+        {
+          organ_pipe[i] = int((i < (size / 2)) ? i : (size - i));
+        }
+
+        std::vector<int>* inputs[] = { &sorted, &reversed, &random, &few_unique, &organ_pipe };
+
+        for (size_t i = 0; i < sizeof(inputs) / sizeof(inputs[0]); ++i)
+        {
+          std::vector<int> data1 = *inputs[i];
+          std::vector<int> data2 = *inputs[i];
+
+          std::sort(data1.begin(), data1.end());
+          etl::sort(data2.begin(), data2.end());
+
+          CHECK(data1 == data2);
+        }
+      }
+    }
+
+    //=========================================================================
+    TEST(sort_list)
+    {
+      std::vector<int> data(100, 0);
+      std::iota(data.begin(), data.end(), 1);
+      std::random_shuffle(data.begin(), data.end());
+
+      std::list<int> data1(data.begin(), data.end());
+
+      std::sort(data.begin(), data.end());
+      etl::sort(data1.begin(), data1.end());
+
+      bool is_same = std::equal(data.begin(), data.end(), data1.begin());
+      CHECK(is_same);
+    }
+
+    //=========================================================================
+    TEST(stable_sort_default)
+    {
+      std::vector<StructData> data(500);
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        data[i].a = rand() % 10;
+        data[i].b = int(i);
+      }
+
+      std::vector<StructData> data1 = data;
+      std::vector<StructData> data2 = data;
+
+      std::stable_sort(data1.begin(), data1.end(), StructDataPredicate());
+      etl::stable_sort(data2.begin(), data2.end(), StructDataPredicate());
+
+      bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+      CHECK(is_same);
+    }
+
+    //=========================================================================
+    TEST(stable_sort_with_buffer)
+    {
+      std::vector<StructData> data(500);
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        data[i].a = rand() % 10;
+        data[i].b = int(i);
+      }
+
+      std::vector<StructData> data1 = data;
+      std::stable_sort(data1.begin(), data1.end(), StructDataPredicate());
+
+      const size_t BUFFER_SIZES[] = { 1, 10, 100, 250, 500 };
+
+      for (size_t i = 0; i < sizeof(BUFFER_SIZES) / sizeof(BUFFER_SIZES[0]); ++i)
+      {
+        std::vector<StructData> buffer(BUFFER_SIZES[i]);
+        std::vector<StructData> data2 = data;
+
+        etl::stable_sort(data2.begin(), data2.end(), buffer.begin(), buffer.end(), StructDataPredicate());
+
+        bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+        CHECK(is_same);
+      }
+    }
+
+    //=========================================================================
+    TEST(stable_sort_list)
+    {
+      std::list<StructData> data;
+
+      for (int i = 0; i < 100; ++i)
+      {
+        StructData item = { rand() % 5, i };
+        data.push_back(item);
+      }
+
+      std::vector<StructData> data1(data.begin(), data.end());
+
+      std::stable_sort(data1.begin(), data1.end(), StructDataPredicate());
+      etl::stable_sort(data.begin(), data.end(), StructDataPredicate());
+
+      bool is_same = std::equal(data1.begin(), data1.end(), data.begin());
+      CHECK(is_same);
+    }
+
+    //=========================================================================
+    TEST(partial_sort)
+    {
+      std::vector<int> data(100, 0);
+      std::iota(data.begin(), data.end(), 1);
+
+      const size_t MIDDLES[] = { 0, 1, 10, 50, 99, 100 };
+
+      for (size_t i = 0; i < sizeof(MIDDLES) / sizeof(MIDDLES[0]); ++i)
+      {
+        std::random_shuffle(data.begin(), data.end());
+
+        std::vector<int> data1 = data;
+        std::vector<int> data2 = data;
+
+        std::partial_sort(data1.begin(), data1.begin() + MIDDLES[i], data1.end(), std::greater<int>());
+        etl::partial_sort(data2.begin(), data2.begin() + MIDDLES[i], data2.end(), std::greater<int>());
+
+        bool is_same = std::equal(data1.begin(), data1.begin() + MIDDLES[i], data2.begin());
+        CHECK(is_same);
+      }
+    }
+
+    //=========================================================================
+    TEST(nth_element)
+    {
+      std::vector<int> data(1000, 0);
+      std::iota(data.begin(), data.end(), 0);
+
+      const size_t NTHS[] = { 0, 1, 10, 500, 998, 999 };
+
+      for (size_t i = 0; i < sizeof(NTHS) / sizeof(NTHS[0]); ++i)
+      {
+        std::random_shuffle(data.begin(), data.end());
+
+        std::vector<int> data1 = data;
+        std::vector<int>::iterator nth = data1.begin() + NTHS[i];
+
+        etl::nth_element(data1.begin(), nth, data1.end());
+
+        CHECK_EQUAL(int(NTHS[i]), *nth);
+        CHECK(*std::max_element(data1.begin(), nth + 1) == *nth);
+        CHECK(*std::min_element(nth, data1.end()) == *nth);
+      }
+
+      // Few unique values.
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        data[i] = rand() % 3;
+      }
+
+      std::vector<int> data2 = data;
+      std::sort(data2.begin(), data2.end());
+
+      etl::nth_element(data.begin(), data.begin() + 700, data.end());
+      CHECK_EQUAL(data2[700], data[700]);
+    }
+
+    //=========================================================================
+    TEST(radix_sort_unsigned)
+    {
+      std::vector<uint32_t> data(1000);
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        data[i] = (uint32_t(rand()) << 16) ^ uint32_t(rand());
+      }
+
+      std::vector<uint32_t> buffer(data.size());
+
+      std::vector<uint32_t> data1 = data;
+      std::vector<uint32_t> data2 = data;
+      std::vector<uint32_t> data3 = data;
+
+      std::sort(data1.begin(), data1.end());
+      etl::radix_sort(data2.begin(), data2.end(), buffer.begin(), buffer.end());
+      etl::radix_sort<11>(data3.begin(), data3.end(), buffer.begin(), buffer.end());
+
+      CHECK(data1 == data2);
+      CHECK(data1 == data3);
+    }
+
+    //=========================================================================
+    TEST(radix_sort_signed)
+    {
+      std::vector<int64_t> data(1000);
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        data[i] = (int64_t(rand()) - (RAND_MAX / 2)) * int64_t(rand());
+      }
+
+      data[0] = std::numeric_limits<int64_t>::min();
+      data[1] = std::numeric_limits<int64_t>::max();
+
+      int16_t data_small[] = { 5, -1, 32767, -32768, 0, 1, -2, 100, -100 };
+      int16_t buffer_small[9];
+
+      std::vector<int64_t> buffer(data.size());
+
+      std::vector<int64_t> data1 = data;
+      std::vector<int64_t> data2 = data;
+      std::vector<int64_t> data3 = data;
+
+      std::sort(data1.begin(), data1.end());
+      etl::radix_sort(data2.begin(), data2.end(), buffer.begin(), buffer.end());
+      etl::radix_sort<11>(data3.begin(), data3.end(), buffer.begin(), buffer.end());
+
+      CHECK(data1 == data2);
+      CHECK(data1 == data3);
+
+      etl::radix_sort(std::begin(data_small), std::end(data_small), std::begin(buffer_small), std::end(buffer_small));
+      CHECK(std::is_sorted(std::begin(data_small), std::end(data_small)));
+    }
+
+    //=========================================================================
+    TEST(radix_sort_float)
+    {
+      std::vector<float>  data_float(500);
+      std::vector<double> data_double(500);
+
+      for (size_t i = 0; i < data_float.size(); ++i)
+      {
+        data_float[i]  = float(rand() - (RAND_MAX / 2)) / 1000.0f;
+        data_double[i] = double(rand() - (RAND_MAX / 2)) * 1.0e10;
+      }
+
+      data_float[0] = -0.0f;
+      data_float[1] = 0.0f;
+
+      std::vector<float>  buffer_float(data_float.size());
+      std::vector<double> buffer_double(data_double.size());
+
+      std::vector<float>  data_float1  = data_float;
+      std::vector<double> data_double1 = data_double;
+
+      std::sort(data_float1.begin(), data_float1.end());
+      std::sort(data_double1.begin(), data_double1.end());
+
+      etl::radix_sort(data_float.begin(), data_float.end(), buffer_float.begin(), buffer_float.end());
+      etl::radix_sort<11>(data_double.begin(), data_double.end(), buffer_double.begin(), buffer_double.end());
+
+      CHECK(data_float1 == data_float);
+      CHECK(data_double1 == data_double);
+    }
+
+    //=========================================================================
+    TEST(radix_sort_key_is_stable)
+    {
+      std::vector<StructData> data(500);
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        data[i].a = (rand() % 20) - 10;
+        data[i].b = int(i);
+      }
+
+      struct Key
+      {
+        int operator ()(const StructData& item) const
+        {
+          return item.a;
+        }
+      };
+
+      std::vector<StructData> buffer(data.size());
+
+      std::vector<StructData> data1 = data;
+      std::vector<StructData> data2 = data;
+
+      std::stable_sort(data1.begin(), data1.end(), StructDataPredicate());
+      etl::radix_sort(data2.begin(), data2.end(), buffer.begin(), buffer.end(), Key());
+
+      bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+      CHECK(is_same);
+
+      // Buffer too small, so uses stable_sort.
+      data2 = data;
+      etl::radix_sort(data2.begin(), data2.end(), buffer.begin(), buffer.begin() + 10, Key());
+
+      is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+      CHECK(is_same);
+    }
+
+    //=========================================================================
+    TEST(radix_sort_string)
+    {
+      typedef etl::string<8> String;
+
+      const char* text[] = { "banana", "apple", "", "app", "b", "apples", "zebra", "a", "banana", "apple", "Zebra", "ab" };
+
+      std::vector<String> data;
+      std::vector<std::string> compare;
+
+      for (size_t i = 0; i < sizeof(text) / sizeof(text[0]); ++i)
+      {
+        data.push_back(String(text[i]));
+        compare.push_back(std::string(text[i]));
+      }
+
+      std::vector<String> buffer(data.size());
+
+      etl::radix_sort(data.begin(), data.end(), buffer.begin(), buffer.end());
+      std::sort(compare.begin(), compare.end());
+
+      for (size_t i = 0; i < compare.size(); ++i)
+      {
+        CHECK_EQUAL(compare[i], std::string(data[i].c_str()));
+      }
+    }
+
+    //*************************************************************************
+    TEST(radix_sort_wide_string)
+    {
+      // Characters that differ only in their upper bytes, and embedded zeros.
+      std::vector<std::u16string> data16 = { u"\u0201b", u"\u0102", u"\u0101", std::u16string(1, u'\0'), u"", u"\u0201a", u"\uFF01", u"\u0101\u0101", u"\u0001" };
+      std::vector<std::u32string> data32 = { U"\U00010001", U"\U00000101x", U"\U00020001", U"", U"\U00000101", U"\U00010000", std::u32string(2, U'\0'), U"\U00000001" };
+
+      std::vector<std::u16string> compare16 = data16;
+      std::vector<std::u32string> compare32 = data32;
+
+      std::vector<std::u16string> buffer16(data16.size());
+      std::vector<std::u32string> buffer32(data32.size());
+
+      etl::radix_sort(data16.begin(), data16.end(), buffer16.begin(), buffer16.end());
+      etl::radix_sort(data32.begin(), data32.end(), buffer32.begin(), buffer32.end());
+
+      std::sort(compare16.begin(), compare16.end());
+      std::sort(compare32.begin(), compare32.end());
+
+      CHECK(compare16 == data16);
+      CHECK(compare32 == data32);
+    }
   };
 }
@@ -1077,5 +1077,193 @@ namespace
       CHECK_EQUAL(object1, object1a);
       CHECK_EQUAL(object2, object2a);
     }
+
+    //*************************************************************************
+    TEST(writer_matches_bit_stream)
+    {
+      std::array<unsigned char, 1024> expected;
+      std::array<unsigned char, 1024> actual;
+      expected.fill(0xCC);
+      actual.fill(0xCC);
+
+      etl::bit_stream        bit_stream(expected.data(), expected.size());
+      etl::bit_stream_writer writer(actual.data(), actual.size());
+
+      uint32_t seed = 1U;
+
+      for (int i = 0; i < 200; ++i)
+      {
+        seed = (seed * 1103515245U) + 12345U;
+        const uint_least8_t width = uint_least8_t(1U + ((seed >> 16) % 32U));
+        const uint32_t      value = seed ^ (seed << 7);
+
+        CHECK_EQUAL(bit_stream.put(value, width), writer.put(value, width));
+      }
+
+      CHECK_EQUAL(bit_stream.put(true), writer.put(true));
+      CHECK_EQUAL(bit_stream.put(int64_t(-2), 37), writer.put(int64_t(-2), 37));
+      CHECK_EQUAL(bit_stream.put(uint64_t(0x0123456789ABCDEFULL)), writer.put(uint64_t(0x0123456789ABCDEFULL)));
+      CHECK_EQUAL(bit_stream.put(3.14159), writer.put(3.14159));
+      CHECK_EQUAL(bit_stream.put(2.5f), writer.put(2.5f));
+
+      writer.flush();
+
+      CHECK_EQUAL(bit_stream.bits(), writer.bits());
+      CHECK_EQUAL(bit_stream.size(), writer.size());
+      CHECK_ARRAY_EQUAL(expected.data(), actual.data(), bit_stream.size());
+    }
+
+    //*************************************************************************
+    TEST(reader_reads_bit_stream)
+    {
+      std::array<unsigned char, 1024> storage;
+      std::array<uint32_t, 200>      values;
+      std::array<uint_least8_t, 200> widths;
+
+      etl::bit_stream bit_stream(storage.data(), storage.size());
+
+      uint32_t seed = 2U;
+
+      for (size_t i = 0; i < values.size(); ++i)
+      {
+        seed = (seed * 1103515245U) + 12345U;
+        widths[i] = uint_least8_t(1U + ((seed >> 16) % 32U));
+        values[i] = (seed ^ (seed << 7)) & (0xFFFFFFFFU >> (32U - widths[i]));
+        bit_stream.put(values[i], widths[i]);
+      }
+
+      bit_stream.put(int16_t(-1234), 14);
+      bit_stream.put(3.14159);
+
+      etl::bit_stream_reader reader(storage.data(), bit_stream.size());
+
+      for (size_t i = 0; i < values.size(); ++i)
+      {
+        uint32_t value;
+        CHECK(reader.get(value, widths[i]));
+        CHECK_EQUAL(values[i], value);
+      }
+
+      int16_t i16;
+      CHECK(reader.get(i16, 14));
+      CHECK_EQUAL(-1234, i16);
+
+      double d;
+      CHECK(reader.get(d));
+      CHECK_EQUAL(3.14159, d);
+
+      // Only the padding of the last byte is left.
+      CHECK_EQUAL(bit_stream.size() * CHAR_BIT - bit_stream.bits(), reader.available());
+    }
+
+    //*************************************************************************
+    TEST(writer_reader_widths)
+    {
+      std::array<unsigned char, 64 * 65> storage;
+
+      etl::bit_stream_writer writer(storage.data(), storage.size());
+
+      for (uint_least8_t width = 1U; width <= 64U; ++width)
+      {
+        CHECK(writer.put(true));
+        CHECK(writer.put(uint64_t(0xA5A5A5A5A5A5A5A5ULL), width));
+        CHECK(writer.put(int64_t(-1), width));
+      }
+
+      writer.flush();
+
+      etl::bit_stream_reader reader(writer.begin(), writer.end());
+
+      for (uint_least8_t width = 1U; width <= 64U; ++width)
+      {
+        bool     b = false;
+        uint64_t u = 0U;
+        int64_t  i = 0;
+
+        CHECK(reader.get(b));
+        CHECK(b);
+        CHECK(reader.get(u, width));
+        CHECK_EQUAL(0xA5A5A5A5A5A5A5A5ULL & (~uint64_t(0) >> (64U - width)), u);
+        CHECK(reader.get(i, width));
+        CHECK_EQUAL(-1, i);
+      }
+    }
+
+    //*************************************************************************
+    TEST(writer_reader_arrays)
+    {
+      std::array<unsigned char, 40> storage;
+      std::array<int16_t, 24> put_data;
+      std::array<int16_t, 24> get_data;
+
+      for (size_t i = 0; i < put_data.size(); ++i)
+      {
+        put_data[i] = int16_t((int(i) * 397) % 2048 - 1024);
+      }
+
+      etl::bit_stream_writer writer(storage.data(), storage.size());
+
+      // 24 * 11 bits = 264 bits. 320 bits available.
+      CHECK(writer.put(put_data.data(), put_data.size(), 11));
+      CHECK(!writer.put(put_data.data(), 6, 11));
+      CHECK_EQUAL(264U, writer.bits());
+      CHECK(writer.put(put_data.data(), 5, 11));
+      CHECK_EQUAL(1U, writer.available());
+      CHECK(writer.put(true));
+      CHECK(writer.full());
+      CHECK(!writer.put(false));
+      writer.flush();
+
+      etl::bit_stream_reader reader(storage.data(), storage.size());
+
+      CHECK(reader.get(get_data.data(), get_data.size(), 11));
+      CHECK_ARRAY_EQUAL(put_data.data(), get_data.data(), put_data.size());
+
+      CHECK(reader.get(get_data.data(), 5, 11));
+      CHECK_ARRAY_EQUAL(put_data.data(), get_data.data(), 5);
+
+      CHECK(!reader.get(get_data.data(), 1, 11));
+
+      bool b;
+      CHECK(reader.get(b));
+      CHECK(b);
+      CHECK(reader.at_end());
+      CHECK(!reader.get(b));
+    }
+
+    //*************************************************************************
+    TEST(writer_reader_unchecked)
+    {
+      std::array<unsigned char, 16> storage;
+
+      etl::bit_stream_writer writer(storage.data(), storage.size());
+
+      writer.put_unchecked(uint8_t(5), 3);
+      writer.put_unchecked(int32_t(-100000), 20);
+      writer.put_unchecked(1.5f);
+      writer.flush();
+
+      // Flushing early does not prevent further writes.
+      writer.put_unchecked(uint16_t(0x1234), 13);
+      writer.flush();
+
+      etl::bit_stream_reader reader(storage.data(), storage.size());
+
+      uint8_t  u8;
+      int32_t  i32;
+      float    f;
+      uint16_t u16;
+
+      reader.get_unchecked(u8, 3);
+      reader.get_unchecked(i32, 20);
+      reader.get_unchecked(f);
+      reader.get_unchecked(u16, 13);
+
+      CHECK_EQUAL(5,       int(u8));
+      CHECK_EQUAL(-100000, i32);
+      CHECK_EQUAL(1.5f,    f);
+      CHECK_EQUAL(0x1234,  int(u16));
+      CHECK_EQUAL(68U,     reader.bits());
+    }
   };
 }
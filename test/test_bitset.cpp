@@ -789,5 +789,94 @@ namespace
       CHECK(data1 == compare2);
       CHECK(data2 == compare1);
     }
+
+    //*************************************************************************
+    template <typename TElement, size_t N>
+    void check_shifts()
+    {
+      std::bitset<N> compare;
+      etl::bitset<N, TElement> data;
+
+      // A pattern that differs in every element.
+      for (size_t i = 0; i < N; ++i)
+      {
+        bool value = ((i * 7) % 5) < 2;
+        compare.set(i, value);
+        data.set(i, value);
+      }
+
+      for (size_t shift = 0; shift <= N; ++shift)
+      {
+        std::bitset<N>           compare_left  = compare << shift;
+        std::bitset<N>           compare_right = compare >> shift;
+        etl::bitset<N, TElement> data_left     = data << shift;
+        etl::bitset<N, TElement> data_right    = data >> shift;
+
+        CHECK_EQUAL(compare_left.count(),  data_left.count());
+        CHECK_EQUAL(compare_right.count(), data_right.count());
+
+        for (size_t i = 0; i < N; ++i)
+        {
+          CHECK_EQUAL(compare_left.test(i),  data_left.test(i));
+          CHECK_EQUAL(compare_right.test(i), data_right.test(i));
+        }
+      }
+    }
+
+    TEST(test_shift_element_types)
+    {
+      check_shifts<uint8_t,  67>();
+      check_shifts<uint16_t, 67>();
+      check_shifts<uint32_t, 67>();
+      check_shifts<uint64_t, 67>();
+      check_shifts<uint64_t, 128>();
+      check_shifts<uint64_t, 5>();
+    }
+
+    //*************************************************************************
+    TEST(test_uint64_elements)
+    {
+      etl::bitset<130, uint64_t> data;
+
+      CHECK_EQUAL(64U, data.BITS_PER_ELEMENT);
+      CHECK_EQUAL(192U, data.ALLOCATED_BITS);
+
+      CHECK_EQUAL(etl::ibitset::npos, data.find_first(true));
+      CHECK_EQUAL(0U, data.find_first(false));
+
+      data.set(64);
+      data.set(129);
+      CHECK_EQUAL(2U, data.count());
+      CHECK_EQUAL(64U,  data.find_first(true));
+      CHECK_EQUAL(129U, data.find_next(true, 65));
+      CHECK_EQUAL(etl::ibitset::npos, data.find_next(true, 130));
+
+      data.set();
+      CHECK_EQUAL(130U, data.count());
+      CHECK(data.all());
+      CHECK_EQUAL(etl::ibitset::npos, data.find_first(false));
+
+      data.reset(127);
+      CHECK_EQUAL(127U, data.find_first(false));
+
+      // The unused bits of the last element stay clear.
+      etl::bitset<130, uint64_t> inverse = ~data;
+      CHECK_EQUAL(1U, inverse.count());
+      CHECK(inverse.test(127));
+    }
+
+    //*************************************************************************
+    TEST(test_large_bitset_find_first_false)
+    {
+      static etl::bitset<65536, uint64_t> data;
+
+      data.set();
+      data.reset(40000);
+      data.reset(65535);
+
+      CHECK_EQUAL(40000U, data.find_first(false));
+      CHECK_EQUAL(65535U, data.find_next(false, 40001));
+      CHECK_EQUAL(65534U, data.count());
+    }
   };
 }
@@ -0,0 +1,466 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+
+#include <map>
+#include <algorithm>
+#include <utility>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "etl/btree_map.h"
+
+namespace
+{
+  static const size_t SIZE = 1000;
+
+  typedef etl::btree_map<int, int, SIZE> Data;
+  typedef etl::ibtree_map<int, int>      IData;
+  typedef std::map<int, int>             Compare_Data;
+
+  typedef std::pair<int, int> ElementInt;
+
+  //*************************************************************************
+  template <typename T1, typename T2>
+  bool Check_Equal(T1 begin1, T1 end1, T2 begin2)
+  {
+    while (begin1 != end1)
+    {
+      if ((begin1->first != begin2->first) || (begin1->second != begin2->second))
+      {
+        return false;
+      }
+
+      ++begin1;
+      ++begin2;
+    }
+
+    return true;
+  }
+
+  //*************************************************************************
+  /// Checks the contents in both directions.
+  //*************************************************************************
+  template <typename TData, typename TCompare>
+  bool Check_Contents(const TData& data, const TCompare& compare)
+  {
+    return (data.size() == compare.size()) &&
+           (std::distance(data.begin(), data.end()) == std::distance(compare.begin(), compare.end())) &&
+           Check_Equal(data.begin(), data.end(), compare.begin()) &&
+           Check_Equal(data.rbegin(), data.rend(), compare.rbegin());
+  }
+
+  //*************************************************************************
+  /// A repeatable sequence of pseudo random numbers.
+  //*************************************************************************
+  struct Random
+  {
+    Random()
+      : value(12345)
+    {
+    }
+
+    int operator()(int range)
+    {
+      value = (value * 1103515245U) + 12345U;
+      return int((value >> 8) % unsigned(range));
+    }
+
+    unsigned value;
+  };
+
+  SUITE(test_btree_map)
+  {
+    //*************************************************************************
+    struct SetupFixture
+    {
+      std::vector<ElementInt> random_data;
+      Compare_Data            compare_data;
+
+      SetupFixture()
+      {
+        for (int i = 0; i < int(SIZE); ++i)
+        {
+          random_data.push_back(ElementInt(i * 2, i * 3));
+        }
+
+        Random random;
+
+        for (size_t i = random_data.size() - 1; i > 0; --i)
+        {
+          std::swap(random_data[i], random_data[random(int(i + 1))]);
+        }
+
+        compare_data.insert(random_data.begin(), random_data.end());
+      }
+    };
+
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Data data;
+
+      CHECK(data.empty());
+      CHECK(!data.full());
+      CHECK_EQUAL(0U, data.size());
+      CHECK_EQUAL(SIZE, data.max_size());
+      CHECK_EQUAL(SIZE, data.capacity());
+      CHECK_EQUAL(SIZE, data.available());
+      CHECK(data.begin() == data.end());
+      CHECK(data.find(1) == data.end());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_constructor_range)
+    {
+      Data data(random_data.begin(), random_data.end());
+
+      CHECK(data.full());
+      CHECK_EQUAL(0U, data.available());
+      CHECK(Check_Contents(data, compare_data));
+    }
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT) && !defined(ETL_NO_STL)
+    //*************************************************************************
+    TEST(test_constructor_initializer_list)
+    {
+      Data data = { ElementInt(3, 30), ElementInt(1, 10), ElementInt(2, 20), ElementInt(1, 99) };
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(10, data.at(1));
+      CHECK_EQUAL(20, data.at(2));
+      CHECK_EQUAL(30, data.at(3));
+    }
+#endif
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_value)
+    {
+      Data data;
+      Compare_Data compare;
+
+      for (size_t i = 0; i < random_data.size(); ++i)
+      {
+        std::pair<Data::iterator, bool> result = data.insert(random_data[i]);
+        compare.insert(random_data[i]);
+
+        CHECK(result.second);
+        CHECK_EQUAL(random_data[i].first, result.first->first);
+      }
+
+      CHECK(Check_Contents(data, compare));
+
+      // Duplicates are rejected.
+      std::pair<Data::iterator, bool> result = data.insert(ElementInt(10, 0));
+      CHECK(!result.second);
+      CHECK_EQUAL(15, result.first->second);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_ascending_and_descending)
+    {
+      Data ascending;
+      Data descending;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        ascending.insert(ElementInt(i, i));
+        descending.insert(ElementInt(int(SIZE) - 1 - i, int(SIZE) - 1 - i));
+      }
+
+      CHECK(ascending == descending);
+
+      int expected = 0;
+
+      for (Data::const_iterator itr = ascending.begin(); itr != ascending.end(); ++itr)
+      {
+        CHECK_EQUAL(expected, itr->first);
+        ++expected;
+      }
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_full)
+    {
+      Data data(random_data.begin(), random_data.end());
+
+      // An existing key does not need room.
+      CHECK(!data.insert(ElementInt(0, 0)).second);
+
+      CHECK_THROW(data.insert(ElementInt(1, 1)), etl::btree_map_full);
+      CHECK_THROW(data[1], etl::btree_map_full);
+    }
+
+    //*************************************************************************
+    TEST(test_index_operator)
+    {
+      Data data;
+
+      data[3] = 30;
+      data[1] = 10;
+      data[3] += 1;
+
+      CHECK_EQUAL(2U, data.size());
+      CHECK_EQUAL(10, data[1]);
+      CHECK_EQUAL(31, data[3]);
+      CHECK_EQUAL(0, data[2]);
+      CHECK_EQUAL(3U, data.size());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_at)
+    {
+      const Data data(random_data.begin(), random_data.end());
+
+      for (Compare_Data::const_iterator itr = compare_data.begin(); itr != compare_data.end(); ++itr)
+      {
+        CHECK_EQUAL(itr->second, data.at(itr->first));
+      }
+
+      CHECK_THROW(data.at(1), etl::btree_map_out_of_bounds);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_find_and_bounds)
+    {
+      Data data(random_data.begin(), random_data.end());
+
+      for (int key = -1; key <= int(SIZE * 2); ++key)
+      {
+        Data::iterator         found = data.find(key);
+        Compare_Data::iterator expected = compare_data.find(key);
+
+        CHECK_EQUAL(expected == compare_data.end(), found == data.end());
+        CHECK_EQUAL(compare_data.count(key), data.count(key));
+
+        Data::iterator         lower          = data.lower_bound(key);
+        Compare_Data::iterator expected_lower = compare_data.lower_bound(key);
+        CHECK_EQUAL(std::distance(compare_data.begin(), expected_lower), std::distance(data.begin(), lower));
+
+        Data::iterator         upper          = data.upper_bound(key);
+        Compare_Data::iterator expected_upper = compare_data.upper_bound(key);
+        CHECK_EQUAL(std::distance(compare_data.begin(), expected_upper), std::distance(data.begin(), upper));
+
+        std::pair<Data::iterator, Data::iterator> range = data.equal_range(key);
+        CHECK(range.first == lower);
+        CHECK(range.second == upper);
+      }
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_erase_key)
+    {
+      Data data(random_data.begin(), random_data.end());
+      Compare_Data compare = compare_data;
+
+      for (size_t i = 0; i < random_data.size(); ++i)
+      {
+        int key = random_data[i].first;
+
+        CHECK_EQUAL(1U, data.erase(key));
+        CHECK_EQUAL(0U, data.erase(key));
+        compare.erase(key);
+
+        if ((i % 97) == 0)
+        {
+          CHECK(Check_Contents(data, compare));
+        }
+      }
+
+      CHECK(data.empty());
+      CHECK(data.begin() == data.end());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_erase_iterator)
+    {
+      Data data(random_data.begin(), random_data.end());
+      Compare_Data compare = compare_data;
+
+      Random random;
+
+      while (!data.empty())
+      {
+        int offset = random(int(data.size()));
+
+        Data::iterator         itr          = data.begin();
+        Compare_Data::iterator compare_itr = compare.begin();
+        std::advance(itr, offset);
+        std::advance(compare_itr, offset);
+
+        itr         = data.erase(itr);
+        compare_itr = compare.erase(compare_itr);
+
+        CHECK_EQUAL(compare_itr == compare.end(), itr == data.end());
+
+        if (compare_itr != compare.end())
+        {
+          CHECK_EQUAL(compare_itr->first, itr->first);
+        }
+      }
+
+      CHECK(compare.empty());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_erase_range)
+    {
+      Data data(random_data.begin(), random_data.end());
+      Compare_Data compare = compare_data;
+
+      Data::iterator         first         = data.begin();
+      Compare_Data::iterator compare_first = compare.begin();
+      std::advance(first, 100);
+      std::advance(compare_first, 100);
+
+      Data::iterator         last         = first;
+      Compare_Data::iterator compare_last = compare_first;
+      std::advance(last, 500);
+      std::advance(compare_last, 500);
+
+      Data::iterator itr = data.erase(first, last);
+      compare.erase(compare_first, compare_last);
+
+      CHECK_EQUAL(compare_last->first, itr->first);
+      CHECK(Check_Contents(data, compare));
+
+      itr = data.erase(data.begin(), data.end());
+      CHECK(itr == data.end());
+      CHECK(data.empty());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_mixed_insert_and_erase)
+    {
+      Data data;
+      Compare_Data compare;
+
+      Random random;
+
+      for (int i = 0; i < 20000; ++i)
+      {
+        int key = random(int(SIZE + (SIZE / 2)));
+
+        if ((random(3) != 0) && !data.full())
+        {
+          data.insert(ElementInt(key, i));
+          compare.insert(ElementInt(key, i));
+        }
+        else
+        {
+          CHECK_EQUAL(compare.erase(key), data.erase(key));
+        }
+      }
+
+      CHECK(Check_Contents(data, compare));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_clear)
+    {
+      Data data(random_data.begin(), random_data.end());
+
+      data.clear();
+
+      CHECK(data.empty());
+      CHECK(data.begin() == data.end());
+
+      // The nodes are returned to the pools.
+      data.assign(random_data.begin(), random_data.end());
+      CHECK(Check_Contents(data, compare_data));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_copy_and_assignment)
+    {
+      Data data1(random_data.begin(), random_data.end());
+      Data data2(data1);
+
+      CHECK(data1 == data2);
+
+      Data data3;
+      data3[1] = 1;
+      data3 = data1;
+
+      CHECK(data1 == data3);
+
+      data3[0] = -1;
+      CHECK(data1 != data3);
+
+      IData& idata = data3;
+      CHECK_EQUAL(-1, idata.at(0));
+    }
+
+    //*************************************************************************
+    TEST(test_non_trivial_values)
+    {
+      etl::btree_map<std::string, std::string, 200> data;
+      std::map<std::string, std::string> compare;
+
+      Random random;
+
+      for (int i = 0; i < 2000; ++i)
+      {
+        std::string key(size_t(random(20) + 1), char('a' + random(4)));
+        key += char('a' + random(26));
+
+        if (random(2) == 0)
+        {
+          if (data.full() && (compare.find(key) == compare.end()))
+          {
+            continue;
+          }
+
+          data.insert(std::make_pair(key, key + key));
+          compare.insert(std::make_pair(key, key + key));
+        }
+        else
+        {
+          CHECK_EQUAL(compare.erase(key), data.erase(key));
+        }
+      }
+
+      CHECK(Check_Contents(data, compare));
+    }
+
+    //*************************************************************************
+    TEST(test_greater_compare)
+    {
+      ElementInt values[] = { ElementInt(3, 3), ElementInt(1, 1), ElementInt(2, 2) };
+
+      etl::btree_map<int, int, 10, std::greater<int> > data(std::begin(values), std::end(values));
+
+      CHECK_EQUAL(3, data.begin()->first);
+      CHECK_EQUAL(1, data.rbegin()->first);
+      CHECK_EQUAL(2, data.lower_bound(2)->first);
+      CHECK_EQUAL(1, data.upper_bound(2)->first);
+    }
+  };
+}
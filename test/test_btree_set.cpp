@@ -0,0 +1,198 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+
+#include <set>
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "etl/btree_set.h"
+
+namespace
+{
+  static const size_t SIZE = 1000;
+
+  typedef etl::btree_set<int, SIZE> Data;
+  typedef etl::ibtree_set<int>      IData;
+  typedef std::set<int>             Compare_Data;
+
+  //*************************************************************************
+  /// Checks the contents in both directions.
+  //*************************************************************************
+  template <typename TData, typename TCompare>
+  bool Check_Contents(const TData& data, const TCompare& compare)
+  {
+    return (data.size() == compare.size()) &&
+           (std::distance(data.begin(), data.end()) == std::distance(compare.begin(), compare.end())) &&
+           std::equal(data.begin(), data.end(), compare.begin()) &&
+           std::equal(data.rbegin(), data.rend(), compare.rbegin());
+  }
+
+  //*************************************************************************
+  /// A repeatable sequence of pseudo random numbers.
+  //*************************************************************************
+  struct Random
+  {
+    Random()
+      : value(54321)
+    {
+    }
+
+    int operator()(int range)
+    {
+      value = (value * 1103515245U) + 12345U;
+      return int((value >> 8) % unsigned(range));
+    }
+
+    unsigned value;
+  };
+
+  SUITE(test_btree_set)
+  {
+    //*************************************************************************
+    struct SetupFixture
+    {
+      std::vector<int> random_data;
+      Compare_Data     compare_data;
+
+      SetupFixture()
+      {
+        for (int i = 0; i < int(SIZE); ++i)
+        {
+          random_data.push_back(i * 2);
+        }
+
+        Random random;
+
+        for (size_t i = random_data.size() - 1; i > 0; --i)
+        {
+          std::swap(random_data[i], random_data[random(int(i + 1))]);
+        }
+
+        compare_data.insert(random_data.begin(), random_data.end());
+      }
+    };
+
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Data data;
+
+      CHECK(data.empty());
+      CHECK_EQUAL(0U, data.size());
+      CHECK_EQUAL(SIZE, data.max_size());
+      CHECK(data.begin() == data.end());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_and_find)
+    {
+      Data data(random_data.begin(), random_data.end());
+
+      CHECK(data.full());
+      CHECK(Check_Contents(data, compare_data));
+
+      for (int key = -1; key <= int(SIZE * 2); ++key)
+      {
+        CHECK_EQUAL(compare_data.count(key), data.count(key));
+        CHECK_EQUAL(std::distance(compare_data.begin(), compare_data.lower_bound(key)), std::distance(data.begin(), data.lower_bound(key)));
+        CHECK_EQUAL(std::distance(compare_data.begin(), compare_data.upper_bound(key)), std::distance(data.begin(), data.upper_bound(key)));
+      }
+
+      CHECK(!data.insert(0).second);
+      CHECK_THROW(data.insert(1), etl::btree_set_full);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_mixed_insert_and_erase)
+    {
+      Data data;
+      Compare_Data compare;
+
+      Random random;
+
+      for (int i = 0; i < 20000; ++i)
+      {
+        int key = random(int(SIZE + (SIZE / 2)));
+
+        if ((random(3) != 0) && !data.full())
+        {
+          CHECK_EQUAL(compare.insert(key).second, data.insert(key).second);
+        }
+        else
+        {
+          CHECK_EQUAL(compare.erase(key), data.erase(key));
+        }
+      }
+
+      CHECK(Check_Contents(data, compare));
+
+      while (!data.empty())
+      {
+        Data::iterator itr = data.begin();
+        std::advance(itr, random(int(data.size())));
+        compare.erase(*itr);
+        data.erase(itr);
+      }
+
+      CHECK(compare.empty());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_copy_and_compare)
+    {
+      Data data1(random_data.begin(), random_data.end());
+      Data data2(data1);
+
+      CHECK(data1 == data2);
+
+      data2.erase(data2.begin());
+      CHECK(data1 != data2);
+
+      IData& idata = data2;
+      idata.clear();
+      CHECK(data2.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_greater_compare)
+    {
+      int values[] = { 3, 1, 2 };
+
+      etl::btree_set<int, 10, std::greater<int> > data(std::begin(values), std::end(values));
+
+      CHECK_EQUAL(3, *data.begin());
+      CHECK_EQUAL(1, *data.rbegin());
+      CHECK_EQUAL(2, *data.lower_bound(2));
+      CHECK_EQUAL(1, *data.upper_bound(2));
+    }
+  };
+}
@@ -34,6 +34,9 @@ SOFTWARE.
 
 #include <iostream>
 #include <vector>
+#include <algorithm>
+#include <memory>
+#include <utility>
 #include <thread>
 #include <chrono>
 
@@ -107,6 +110,43 @@ namespace
     free_tick_list2.push_back(ticks);
   }
 
+  //***************************************************************************
+  // Callback that logs its timer id, for the timing wheel tests.
+  //***************************************************************************
+  typedef std::pair<uint64_t, etl::timer::wheel_id::type> Expiry;
+
+  class IdCallback : public etl::ifunction<void>
+  {
+  public:
+
+    IdCallback()
+      : id(etl::timer::wheel_id::NO_TIMER),
+        p_log(nullptr)
+    {
+    }
+
+    void operator ()() const override
+    {
+      p_log->push_back(Expiry(ticks, id));
+    }
+
+    etl::timer::wheel_id::type id;
+    std::vector<Expiry>*       p_log;
+  };
+
+  //***************************************************************************
+  // Simple deterministic pseudo random generator.
+  //***************************************************************************
+  uint32_t random_state = 1;
+
+  uint32_t next_random()
+  {
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+    return random_state;
+  }
+
   SUITE(test_callback_timer)
   {
     //=========================================================================
@@ -646,6 +686,365 @@ namespace
       CHECK_ARRAY_EQUAL(compare1.data(), free_tick_list1.data(), compare1.size());
     }
 
+    //=========================================================================
+    TEST(callback_timer_wheel_too_many_timers)
+    {
+      etl::callback_timer_wheel<2> timer_controller;
+
+      etl::timer::wheel_id::type id1 = timer_controller.register_timer(member_callback,        37, etl::timer::mode::SINGLE_SHOT);
+      etl::timer::wheel_id::type id2 = timer_controller.register_timer(free_function_callback, 23, etl::timer::mode::SINGLE_SHOT);
+      etl::timer::wheel_id::type id3 = timer_controller.register_timer(free_callback2,         11, etl::timer::mode::SINGLE_SHOT);
+
+      CHECK_EQUAL(0U, id1);
+      CHECK_EQUAL(1U, id2);
+      CHECK(id3 == etl::timer::wheel_id::NO_TIMER);
+
+      // The freed id is reused.
+      CHECK(timer_controller.unregister_timer(id1));
+      CHECK(!timer_controller.unregister_timer(id1));
+      id3 = timer_controller.register_timer(free_callback2, 11, etl::timer::mode::SINGLE_SHOT);
+      CHECK_EQUAL(id1, id3);
+
+      timer_controller.clear();
+      id3 = timer_controller.register_timer(free_callback2, 11, etl::timer::mode::SINGLE_SHOT);
+      CHECK_EQUAL(0U, id3);
+
+      CHECK(!timer_controller.start(etl::timer::wheel_id::NO_TIMER));
+      CHECK(!timer_controller.stop(etl::timer::wheel_id::NO_TIMER));
+      CHECK(!timer_controller.start(id2));
+    }
+
+    //=========================================================================
+    TEST(callback_timer_wheel_repeating)
+    {
+      etl::callback_timer_wheel<3> timer_controller;
+
+      etl::timer::wheel_id::type id1 = timer_controller.register_timer(member_callback,        37, etl::timer::mode::REPEATING);
+      etl::timer::wheel_id::type id2 = timer_controller.register_timer(free_function_callback, 23, etl::timer::mode::REPEATING);
+      etl::timer::wheel_id::type id3 = timer_controller.register_timer(free_callback2,         11, etl::timer::mode::SINGLE_SHOT);
+
+      test.tick_list.clear();
+      free_tick_list1.clear();
+      free_tick_list2.clear();
+
+      timer_controller.start(id1);
+      timer_controller.start(id3);
+      timer_controller.start(id2);
+
+      timer_controller.enable(true);
+
+      ticks = 0;
+
+      const uint32_t step = 1;
+
+      while (ticks <= 100U)
+      {
+        ticks += step;
+        timer_controller.tick(step);
+      }
+
+      std::vector<uint64_t> compare1 = { 37, 74 };
+      std::vector<uint64_t> compare2 = { 23, 46, 69, 92 };
+      std::vector<uint64_t> compare3 = { 11 };
+
+      CHECK_EQUAL(compare1.size(), test.tick_list.size());
+      CHECK_EQUAL(compare2.size(), free_tick_list1.size());
+      CHECK_EQUAL(compare3.size(), free_tick_list2.size());
+
+      CHECK_ARRAY_EQUAL(compare1.data(), test.tick_list.data(),  compare1.size());
+      CHECK_ARRAY_EQUAL(compare2.data(), free_tick_list1.data(), compare2.size());
+      CHECK_ARRAY_EQUAL(compare3.data(), free_tick_list2.data(), compare3.size());
+    }
+
+    //=========================================================================
+    TEST(callback_timer_wheel_delayed_immediate)
+    {
+      etl::callback_timer_wheel<3> timer_controller;
+
+      etl::timer::wheel_id::type id1 = timer_controller.register_timer(member_callback,        37, etl::timer::mode::REPEATING);
+      etl::timer::wheel_id::type id2 = timer_controller.register_timer(free_function_callback, 23, etl::timer::mode::REPEATING);
+      etl::timer::wheel_id::type id3 = timer_controller.register_timer(free_callback2,         11, etl::timer::mode::REPEATING);
+
+      test.tick_list.clear();
+      free_tick_list1.clear();
+      free_tick_list2.clear();
+
+      timer_controller.enable(true);
+
+      ticks = 5;
+      timer_controller.tick(uint32_t(ticks));
+
+      timer_controller.start(id1, etl::timer::start::IMMEDIATE);
+      timer_controller.start(id2, etl::timer::start::IMMEDIATE);
+      timer_controller.start(id3, etl::timer::start::DELAYED);
+
+      const uint32_t step = 1;
+
+      while (ticks <= 100U)
+      {
+        ticks += step;
+        timer_controller.tick(step);
+      }
+
+      std::vector<uint64_t> compare1 = { 6, 42, 79 };
+      std::vector<uint64_t> compare2 = { 6, 28, 51, 74, 97 };
+      std::vector<uint64_t> compare3 = { 16, 27, 38, 49, 60, 71, 82, 93 };
+
+      CHECK_EQUAL(compare1.size(), test.tick_list.size());
+      CHECK_EQUAL(compare2.size(), free_tick_list1.size());
+      CHECK_EQUAL(compare3.size(), free_tick_list2.size());
+
+      CHECK_ARRAY_EQUAL(compare1.data(), test.tick_list.data(),  compare1.size());
+      CHECK_ARRAY_EQUAL(compare2.data(), free_tick_list1.data(), compare2.size());
+      CHECK_ARRAY_EQUAL(compare3.data(), free_tick_list2.data(), compare3.size());
+    }
+
+    //=========================================================================
+    TEST(callback_timer_wheel_one_shot_big_step_short_delay_insert)
+    {
+      etl::callback_timer_wheel<3> timer_controller;
+
+      etl::timer::wheel_id::type id1 = timer_controller.register_timer(free_callback1, 15, etl::timer::mode::SINGLE_SHOT);
+      etl::timer::wheel_id::type id2 = timer_controller.register_timer(free_callback2, 5,  etl::timer::mode::REPEATING);
+
+      free_tick_list1.clear();
+      free_tick_list2.clear();
+
+      timer_controller.start(id1);
+      timer_controller.start(id2);
+
+      timer_controller.enable(true);
+
+      ticks = 0;
+
+      const uint32_t step = 11;
+
+      ticks += step;
+      timer_controller.tick(step);
+
+      ticks += step;
+      timer_controller.tick(step);
+
+      std::vector<uint64_t> compare1 = { 22 };
+      std::vector<uint64_t> compare2 = { 11, 11, 22, 22 };
+
+      CHECK_EQUAL(compare1.size(), free_tick_list1.size());
+      CHECK_EQUAL(compare2.size(), free_tick_list2.size());
+
+      CHECK_ARRAY_EQUAL(compare1.data(), free_tick_list1.data(), compare1.size());
+      CHECK_ARRAY_EQUAL(compare2.data(), free_tick_list2.data(), compare2.size());
+    }
+
+    //=========================================================================
+    TEST(callback_timer_wheel_long_delays)
+    {
+      etl::callback_timer_wheel<3> timer_controller;
+
+      etl::timer::wheel_id::type id1 = timer_controller.register_timer(free_callback1, 3000000000UL, etl::timer::mode::SINGLE_SHOT);
+      etl::timer::wheel_id::type id2 = timer_controller.register_timer(free_callback2, 0xFFFFFFFEUL, etl::timer::mode::SINGLE_SHOT);
+
+      free_tick_list1.clear();
+      free_tick_list2.clear();
+
+      timer_controller.enable(true);
+
+      // Start part way round the wheels.
+      ticks = 12345;
+      timer_controller.tick(uint32_t(ticks));
+
+      timer_controller.start(id1);
+      timer_controller.start(id2);
+
+      const uint32_t step = 0x00100000UL;
+
+      while (ticks < (12345ULL + 0xFFFFFFFFULL))
+      {
+        ticks += step;
+        timer_controller.tick(step);
+      }
+
+      std::vector<uint64_t> compare1 = { 12345ULL + 3000000000ULL + step - ((3000000000ULL) % step) };
+      std::vector<uint64_t> compare2 = { 12345ULL + 0xFFFFFFFEULL + step - ((0xFFFFFFFEULL) % step) };
+
+      CHECK_EQUAL(compare1.size(), free_tick_list1.size());
+      CHECK_EQUAL(compare2.size(), free_tick_list2.size());
+
+      CHECK_ARRAY_EQUAL(compare1.data(), free_tick_list1.data(), compare1.size());
+      CHECK_ARRAY_EQUAL(compare2.data(), free_tick_list2.data(), compare2.size());
+    }
+
+    //=========================================================================
+    TEST(callback_timer_wheel_matches_callback_timer)
+    {
+      const size_t SIZE = 200;
+
+      etl::callback_timer<SIZE>       list_controller;
+      etl::callback_timer_wheel<SIZE> wheel_controller;
+
+      std::vector<Expiry> list_log;
+      std::vector<Expiry> wheel_log;
+
+      std::vector<IdCallback> list_callbacks(SIZE);
+      std::vector<IdCallback> wheel_callbacks(SIZE);
+
+      random_state = 1;
+
+      for (size_t i = 0; i < SIZE; ++i)
+      {
+        // Periods spanning several levels of the wheel.
+        uint32_t period    = 1 + (next_random() % (1U << (4 + (i % 14))));
+        bool     repeating = (i % 3) != 0;
+
+        list_callbacks[i].p_log  = &list_log;
+        wheel_callbacks[i].p_log = &wheel_log;
+        list_callbacks[i].id     = list_controller.register_timer(list_callbacks[i], period, repeating);
+        wheel_callbacks[i].id    = wheel_controller.register_timer(wheel_callbacks[i], period, repeating);
+
+        CHECK_EQUAL(list_callbacks[i].id, wheel_callbacks[i].id);
+
+        list_controller.start(list_callbacks[i].id);
+        wheel_controller.start(wheel_callbacks[i].id);
+      }
+
+      list_controller.enable(true);
+      wheel_controller.enable(true);
+
+      ticks = 0;
+
+      while (ticks < 2000000U)
+      {
+        // Restart, stop or change some timers.
+        uint32_t action = next_random() % 16;
+        uint32_t index  = next_random() % SIZE;
+
+        switch (action)
+        {
+          case 0:
+          {
+            list_controller.stop(list_callbacks[index].id);
+            wheel_controller.stop(wheel_callbacks[index].id);
+            break;
+          }
+
+          case 1:
+          case 2:
+          {
+            bool immediate = (action == 2);
+            list_controller.start(list_callbacks[index].id, immediate);
+            wheel_controller.start(wheel_callbacks[index].id, immediate);
+            break;
+          }
+
+          case 3:
+          {
+            uint32_t period = 1 + (next_random() % 1000);
+            list_controller.set_period(list_callbacks[index].id, period);
+            wheel_controller.set_period(wheel_callbacks[index].id, period);
+            list_controller.start(list_callbacks[index].id);
+            wheel_controller.start(wheel_callbacks[index].id);
+            break;
+          }
+
+          default:
+          {
+            break;
+          }
+        }
+
+        uint32_t step = 1 + (next_random() % 700);
+        ticks += step;
+        list_controller.tick(step);
+        wheel_controller.tick(step);
+      }
+
+      // Timers expiring in the same tick may be called in a different order.
+      std::sort(list_log.begin(), list_log.end());
+      std::sort(wheel_log.begin(), wheel_log.end());
+
+      CHECK(list_log.size() > 1000U);
+      CHECK_EQUAL(list_log.size(), wheel_log.size());
+      CHECK(list_log == wheel_log);
+    }
+
+    //=========================================================================
+    TEST(callback_timer_wheel_ten_thousand_timers)
+    {
+      const size_t SIZE = 10000;
+
+      typedef etl::callback_timer_wheel<SIZE> Controller;
+      std::unique_ptr<Controller> timer_controller(new Controller);
+
+      std::vector<Expiry>     log;
+      std::vector<IdCallback> callbacks(SIZE);
+
+      for (size_t i = 0; i < SIZE; ++i)
+      {
+        uint32_t period    = 1 + ((i * 37) % 5000);
+        bool     repeating = (i % 2) == 0;
+
+        callbacks[i].p_log = &log;
+        callbacks[i].id    = timer_controller->register_timer(callbacks[i], period, repeating);
+        CHECK_EQUAL(i, callbacks[i].id);
+
+        timer_controller->start(callbacks[i].id);
+      }
+
+      CHECK(timer_controller->register_timer(free_callback1, 1, etl::timer::mode::SINGLE_SHOT) == etl::timer::wheel_id::NO_TIMER);
+
+      // Stop every third timer.
+      for (size_t i = 0; i < SIZE; i += 3)
+      {
+        CHECK(timer_controller->stop(callbacks[i].id));
+      }
+
+      timer_controller->enable(true);
+
+      ticks = 0;
+
+      const uint32_t step = 7;
+
+      while (ticks < 20000U)
+      {
+        ticks += step;
+        timer_controller->tick(step);
+      }
+
+      std::vector<size_t> counts(SIZE, 0U);
+
+      for (size_t i = 0; i < log.size(); ++i)
+      {
+        const Expiry& expiry = log[i];
+        const uint32_t period = 1 + ((expiry.second * 37) % 5000);
+
+        // Called in the first tick at or after the expiry time.
+        ++counts[expiry.second];
+        uint64_t expected = period * counts[expiry.second];
+        CHECK((expiry.first >= expected) && (expiry.first < (expected + step)));
+      }
+
+      for (size_t i = 0; i < SIZE; ++i)
+      {
+        const uint32_t period = 1 + ((i * 37) % 5000);
+
+        size_t expected;
+
+        if ((i % 3) == 0)
+        {
+          expected = 0;
+        }
+        else if ((i % 2) == 0)
+        {
+          expected = size_t(ticks / period);
+        }
+        else
+        {
+          expected = 1;
+        }
+
+        CHECK_EQUAL(expected, counts[i]);
+      }
+    }
+
     //=========================================================================
 #if REALTIME_TEST
 
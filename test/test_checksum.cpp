@@ -139,6 +139,54 @@ namespace
       uint32_t hash3 = etl::checksum<uint32_t>(data3.rbegin(), data3.rend());
       CHECK_EQUAL(int(hash1), int(hash3));
     }
+
+    //*************************************************************************
+    TEST(test_checksum_add_block_lane_folding)
+    {
+      // Every byte at its maximum, so the partial sums are folded many times.
+      std::vector<uint8_t> data(5003, 0xFF);
+
+      const uint8_t* pbegin = &data[0];
+      const uint8_t* pend   = pbegin + data.size();
+
+      CHECK_EQUAL(int(uint8_t(data.size() * 0xFF)), int(etl::checksum<uint8_t>(pbegin, pend)));
+      CHECK_EQUAL(uint16_t(data.size() * 0xFF), etl::checksum<uint16_t>(pbegin, pend).value());
+      CHECK_EQUAL(uint32_t(data.size() * 0xFF), etl::checksum<uint32_t>(pbegin, pend).value());
+      CHECK_EQUAL(uint64_t(data.size() * 0xFF), etl::checksum<uint64_t>(pbegin, pend).value());
+    }
+
+    //*************************************************************************
+    TEST(test_checksum_add_block_split_odd_length)
+    {
+      std::vector<uint8_t> data(137);
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        data[i] = uint8_t((i * 97) + 13);
+      }
+
+      etl::checksum<uint32_t> bytewise_calculator;
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        bytewise_calculator.add(data[i]);
+      }
+
+      uint32_t compare = bytewise_calculator;
+
+      const uint8_t* pbegin = &data[0];
+      const uint8_t* pend   = pbegin + data.size();
+
+      for (size_t split = 0; split <= data.size(); ++split)
+      {
+        etl::checksum<uint32_t> checksum_calculator;
+
+        checksum_calculator.add(pbegin, pbegin + split);
+        checksum_calculator.add(pbegin + split, pend);
+
+        CHECK_EQUAL(compare, checksum_calculator.value());
+      }
+    }
   };
 }
 
@@ -39,6 +39,7 @@ SOFTWARE.
 #include "etl/crc16_kermit.h"
 #include "etl/crc16_modbus.h"
 #include "etl/crc32.h"
+#include "etl/crc32_c.h"
 #include "etl/crc64_ecma.h"
 
 namespace
@@ -382,6 +383,135 @@ namespace
       CHECK_EQUAL(crc1, crc3);
     }
 
+    //*************************************************************************
+    TEST(test_crc32_slicing)
+    {
+      std::string data("123456789");
+      const char* pdata = data.data();
+
+      uint32_t crc4  = etl::crc32_slicing<4>(pdata, pdata + data.size());
+      uint32_t crc8  = etl::crc32_slicing<8>(pdata, pdata + data.size());
+      uint32_t crc16 = etl::crc32_slicing<16>(pdata, pdata + data.size());
+
+      CHECK_EQUAL(0xCBF43926, crc4);
+      CHECK_EQUAL(0xCBF43926, crc8);
+      CHECK_EQUAL(0xCBF43926, crc16);
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_slicing_add_values)
+    {
+      std::string data("123456789");
+
+      etl::crc32_slicing<8> crc_calculator;
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        crc_calculator.add(data[i]);
+      }
+
+      uint32_t crc = crc_calculator;
+
+      CHECK_EQUAL(0xCBF43926, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_slicing_add_range_compare_bytewise)
+    {
+      std::vector<uint8_t> data(100);
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        data[i] = uint8_t((i * 97) + 13);
+      }
+
+      // Check all lengths and alignments against the byte-wise implementation.
+      for (size_t offset = 0; offset < 4; ++offset)
+      {
+        for (size_t length = 0; length <= (data.size() - offset); ++length)
+        {
+          const uint8_t* pbegin = &data[0] + offset;
+          const uint8_t* pend   = pbegin + length;
+
+          uint32_t expected = etl::crc32(data.begin() + offset, data.begin() + offset + length);
+
+          CHECK_EQUAL(expected, uint32_t(etl::crc32_slicing<4>(pbegin, pend)));
+          CHECK_EQUAL(expected, uint32_t(etl::crc32_slicing<8>(pbegin, pend)));
+          CHECK_EQUAL(expected, uint32_t(etl::crc32_slicing<16>(pbegin, pend)));
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_slicing_add_mixed)
+    {
+      std::string data("123456789123456789123456789");
+      const char* pdata = data.data();
+
+      etl::crc32_slicing<8> crc_calculator;
+
+      crc_calculator.add(pdata, pdata + 5);
+      crc_calculator.add(pdata[5]);
+      crc_calculator.add(data.begin() + 6, data.begin() + 11);
+      crc_calculator.add(pdata + 11, pdata + data.size());
+
+      uint32_t crc = crc_calculator;
+
+      CHECK_EQUAL(uint32_t(etl::crc32(data.begin(), data.end())), crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_c)
+    {
+      std::string data("123456789");
+
+      uint32_t crc = etl::crc32_c(data.begin(), data.end());
+
+      CHECK_EQUAL(0xE3069283, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_c_slicing)
+    {
+      std::string data("123456789");
+      const char* pdata = data.data();
+
+      uint32_t crc4  = etl::crc32_c_slicing<4>(pdata, pdata + data.size());
+      uint32_t crc8  = etl::crc32_c_slicing<8>(pdata, pdata + data.size());
+      uint32_t crc16 = etl::crc32_c_slicing<16>(pdata, pdata + data.size());
+
+      CHECK_EQUAL(0xE3069283, crc4);
+      CHECK_EQUAL(0xE3069283, crc8);
+      CHECK_EQUAL(0xE3069283, crc16);
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_c_slicing_add_range_compare_bytewise)
+    {
+      std::vector<uint8_t> data(100);
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        data[i] = uint8_t((i * 97) + 13);
+      }
+
+      // Check all lengths and alignments against the byte-wise implementation.
+      for (size_t offset = 0; offset < 4; ++offset)
+      {
+        for (size_t length = 0; length <= (data.size() - offset); ++length)
+        {
+          const uint8_t* pbegin = &data[0] + offset;
+          const uint8_t* pend   = pbegin + length;
+
+          uint32_t expected = etl::crc32_c(data.begin() + offset, data.begin() + offset + length);
+
+          CHECK_EQUAL(expected, uint32_t(etl::crc32_c_slicing<4>(pbegin, pend)));
+          CHECK_EQUAL(expected, uint32_t(etl::crc32_c_slicing<8>(pbegin, pend)));
+          CHECK_EQUAL(expected, uint32_t(etl::crc32_c_slicing<16>(pbegin, pend)));
+        }
+      }
+    }
+
     //*************************************************************************
     TEST(test_crc64_ecma)
     {
@@ -741,6 +741,68 @@ namespace
       CHECK_THROW(data.insert(excess_data.begin(), excess_data.end()), etl::flat_map_full);
     }
 
+    //*************************************************************************
+    TEST(test_insert_range_merge)
+    {
+      std::map<int, int> compare_data;
+      DataInt data;
+
+      ElementInt initial[] = { ElementInt(1, 10), ElementInt(3, 30), ElementInt(5, 50) };
+      ElementInt batch[]   = { ElementInt(4, 40), ElementInt(3, 99), ElementInt(2, 20), ElementInt(4, 41), ElementInt(0, 0), ElementInt(9, 90) };
+
+      data.insert(std::begin(initial), std::end(initial));
+      compare_data.insert(std::begin(initial), std::end(initial));
+
+      data.insert(std::begin(batch), std::end(batch));
+      compare_data.insert(std::begin(batch), std::end(batch));
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+
+      bool isEqual = std::equal(data.begin(), data.end(), compare_data.begin());
+      CHECK(isEqual);
+    }
+
+    //*************************************************************************
+    TEST(test_insert_sorted)
+    {
+      std::map<int, int> compare_data;
+      DataInt data;
+
+      ElementInt initial[] = { ElementInt(2, 20), ElementInt(6, 60) };
+      ElementInt batch[]   = { ElementInt(0, 0), ElementInt(1, 10), ElementInt(2, 99), ElementInt(7, 70), ElementInt(8, 80) };
+
+      data.insert(std::begin(initial), std::end(initial));
+      compare_data.insert(std::begin(initial), std::end(initial));
+
+      data.insert_sorted(std::begin(batch), std::end(batch));
+      compare_data.insert(std::begin(batch), std::end(batch));
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+
+      bool isEqual = std::equal(data.begin(), data.end(), compare_data.begin());
+      CHECK(isEqual);
+    }
+
+    //*************************************************************************
+    TEST(test_insert_range_duplicates_fit)
+    {
+      DataInt data;
+
+      // More values than capacity, but only SIZE unique keys.
+      std::vector<ElementInt> batch;
+
+      for (int i = 0; i < int(SIZE * 2); ++i)
+      {
+        batch.push_back(ElementInt(i % SIZE, i));
+      }
+
+      data.insert(batch.begin(), batch.end());
+
+      CHECK_EQUAL(SIZE, data.size());
+      CHECK_EQUAL(0, data[0]);
+      CHECK_EQUAL(9, data[9]);
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_emplace_value1)
     {
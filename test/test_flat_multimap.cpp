@@ -550,6 +550,28 @@ namespace
       CHECK(std::is_sorted(data.begin(), data.end()));
     }
 
+    //*************************************************************************
+    TEST(test_insert_range_merge)
+    {
+      std::multimap<int, int> compare_data;
+      DataInt data;
+
+      ElementInt initial[] = { ElementInt(1, 10), ElementInt(3, 30), ElementInt(5, 50) };
+      ElementInt batch[]   = { ElementInt(4, 40), ElementInt(3, 31), ElementInt(2, 20), ElementInt(4, 41), ElementInt(3, 32), ElementInt(0, 0) };
+
+      data.insert(std::begin(initial), std::end(initial));
+      compare_data.insert(std::begin(initial), std::end(initial));
+
+      data.insert(std::begin(batch), std::end(batch));
+      compare_data.insert(std::begin(batch), std::end(batch));
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+
+      // Equal keys keep the existing value first, then the order of the range.
+      bool isEqual = std::equal(data.begin(), data.end(), compare_data.begin());
+      CHECK(isEqual);
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_emplace_value1)
     {
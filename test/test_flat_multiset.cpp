@@ -35,6 +35,7 @@ SOFTWARE.
 #include <iterator>
 #include <string>
 #include <vector>
+#include <sstream>
 
 #include "data.h"
 
@@ -513,6 +514,50 @@ namespace
       CHECK(std::is_sorted(data.begin(), data.end()));
     }
 
+    //*************************************************************************
+    TEST(test_insert_range_merge)
+    {
+      std::multiset<int> compare_data;
+      DataInt data;
+
+      int initial[] = { 8, 1, 5 };
+      int batch[]   = { 4, 5, 2, 4, 0, 1 };
+
+      data.insert(std::begin(initial), std::end(initial));
+      compare_data.insert(std::begin(initial), std::end(initial));
+
+      data.insert(std::begin(batch), std::end(batch));
+      compare_data.insert(std::begin(batch), std::end(batch));
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+
+      bool isEqual = std::equal(data.begin(), data.end(), compare_data.begin());
+      CHECK(isEqual);
+    }
+
+    //*************************************************************************
+    TEST(test_insert_range_input_iterator)
+    {
+      std::multiset<int> compare_data;
+      DataInt data;
+
+      int initial[] = { 8, 1, 5 };
+
+      data.insert(std::begin(initial), std::end(initial));
+      compare_data.insert(std::begin(initial), std::end(initial));
+
+      std::istringstream stream1("4 5 2 4 0 9 1");
+      std::istringstream stream2("4 5 2 4 0 9 1");
+
+      data.insert(std::istream_iterator<int>(stream1), std::istream_iterator<int>());
+      compare_data.insert(std::istream_iterator<int>(stream2), std::istream_iterator<int>());
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+
+      bool isEqual = std::equal(data.begin(), data.end(), compare_data.begin());
+      CHECK(isEqual);
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_emplace_value1)
     {
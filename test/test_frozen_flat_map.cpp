@@ -0,0 +1,299 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+
+#include <map>
+#include <algorithm>
+#include <utility>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "etl/frozen_flat_map.h"
+#include "etl/flat_map.h"
+#include "etl/cstring.h"
+
+namespace
+{
+  static const size_t SIZE = 1000;
+
+  typedef etl::frozen_flat_map<int, int, SIZE> Data;
+  typedef etl::ifrozen_flat_map<int, int>      IData;
+  typedef std::map<int, int>                   Compare_Data;
+
+  typedef std::pair<int, int> ElementInt;
+
+  //*************************************************************************
+  template <typename T1, typename T2>
+  bool Check_Equal(T1 begin1, T1 end1, T2 begin2)
+  {
+    while (begin1 != end1)
+    {
+      if ((begin1->first != begin2->first) || (begin1->second != begin2->second))
+      {
+        return false;
+      }
+
+      ++begin1;
+      ++begin2;
+    }
+
+    return true;
+  }
+
+  SUITE(test_frozen_flat_map)
+  {
+    //*************************************************************************
+    struct SetupFixture
+    {
+      std::vector<ElementInt> random_data;
+      Compare_Data            compare_data;
+
+      SetupFixture()
+      {
+        for (int i = 0; i < int(SIZE); ++i)
+        {
+          // Some keys repeat.
+          int key = (rand() % (2 * SIZE)) - int(SIZE);
+
+          random_data.push_back(ElementInt(key, i));
+          compare_data.insert(ElementInt(key, i));
+        }
+      }
+    };
+
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Data data;
+
+      CHECK(data.empty());
+      CHECK_EQUAL(0U, data.size());
+      CHECK_EQUAL(SIZE, data.capacity());
+      CHECK_EQUAL(SIZE, data.max_size());
+      CHECK(data.begin() == data.end());
+      CHECK(data.find(0) == data.end());
+      CHECK(data.lower_bound(0) == data.end());
+      CHECK(data.upper_bound(0) == data.end());
+      CHECK_EQUAL(0U, data.count(0));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_assign_unsorted_with_duplicates)
+    {
+      Data data(random_data.begin(), random_data.end());
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+
+      // The first of each duplicate key is kept, as for std::map::insert.
+      bool is_equal = Check_Equal(data.begin(), data.end(), compare_data.begin());
+      CHECK(is_equal);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_find)
+    {
+      Data data(random_data.begin(), random_data.end());
+      const IData& idata = data;
+
+      for (int key = -int(SIZE) - 2; key < int(SIZE) + 2; ++key)
+      {
+        Compare_Data::const_iterator i_compare = compare_data.find(key);
+        IData::const_iterator        i_data    = idata.find(key);
+
+        if (i_compare == compare_data.end())
+        {
+          CHECK(i_data == idata.end());
+          CHECK_EQUAL(0U, idata.count(key));
+        }
+        else
+        {
+          CHECK(i_data != idata.end());
+          CHECK_EQUAL(i_compare->first,  i_data->first);
+          CHECK_EQUAL(i_compare->second, i_data->second);
+          CHECK_EQUAL(i_compare->second, idata.at(key));
+          CHECK_EQUAL(1U, idata.count(key));
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_lower_upper_bound_equal_range)
+    {
+      Data data(random_data.begin(), random_data.end());
+
+      for (int key = -int(SIZE) - 2; key < int(SIZE) + 2; ++key)
+      {
+        ptrdiff_t lower_compare = std::distance(compare_data.begin(), compare_data.lower_bound(key));
+        ptrdiff_t upper_compare = std::distance(compare_data.begin(), compare_data.upper_bound(key));
+
+        CHECK_EQUAL(lower_compare, std::distance(data.begin(), data.lower_bound(key)));
+        CHECK_EQUAL(upper_compare, std::distance(data.begin(), data.upper_bound(key)));
+
+        std::pair<Data::const_iterator, Data::const_iterator> range = data.equal_range(key);
+        CHECK_EQUAL(lower_compare, std::distance(data.begin(), range.first));
+        CHECK_EQUAL(upper_compare, std::distance(data.begin(), range.second));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_all_sizes)
+    {
+      // Every tree shape from empty to a few levels deep.
+      for (int n = 0; n < 70; ++n)
+      {
+        std::vector<ElementInt> values;
+
+        for (int i = 0; i < n; ++i)
+        {
+          values.push_back(ElementInt(i * 2, i));
+        }
+
+        Data data(values.begin(), values.end());
+
+        CHECK_EQUAL(size_t(n), data.size());
+
+        for (int key = -1; key <= (2 * n); ++key)
+        {
+          ptrdiff_t expected = (key < 0) ? 0 : (key + 1) / 2;
+
+          CHECK_EQUAL(expected, std::distance(data.begin(), data.lower_bound(key)));
+          CHECK_EQUAL((key % 2) == 0 && (key < (2 * n)), data.find(key) != data.end());
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_assign_from_flat_map)
+    {
+      etl::flat_map<int, int, 10> flat;
+
+      for (int i = 0; i < 10; ++i)
+      {
+        flat.insert(std::make_pair(9 - i, i));
+      }
+
+      etl::frozen_flat_map<int, int, 10> data(flat.begin(), flat.end());
+
+      CHECK_EQUAL(flat.size(), data.size());
+      CHECK_EQUAL(flat.at(3), data.at(3));
+
+      // Rebuild with new contents.
+      flat.erase(3);
+      data.assign(flat.begin(), flat.end());
+
+      CHECK_EQUAL(flat.size(), data.size());
+      CHECK(data.find(3) == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_string_keys)
+    {
+      typedef etl::string<8> Key;
+
+      const char* text[] = { "delta", "alpha", "echo", "charlie", "bravo" };
+
+      std::vector<std::pair<Key, int> > values;
+
+      for (int i = 0; i < 5; ++i)
+      {
+        values.push_back(std::make_pair(Key(text[i]), i));
+      }
+
+      etl::frozen_flat_map<Key, int, 5> data(values.begin(), values.end());
+
+      CHECK_EQUAL(1, data.at(Key("alpha")));
+      CHECK_EQUAL(4, data.at(Key("bravo")));
+      CHECK_EQUAL(0, data.at(Key("delta")));
+      CHECK(data.find(Key("foxtrot")) == data.end());
+      CHECK(data.begin()->first == Key("alpha"));
+    }
+
+    //*************************************************************************
+    TEST(test_assign_excess)
+    {
+      std::vector<ElementInt> values;
+
+      for (int i = 0; i < 11; ++i)
+      {
+        values.push_back(ElementInt(i, i));
+      }
+
+      etl::frozen_flat_map<int, int, 10> data(values.begin() + 5, values.begin() + 8);
+
+      CHECK_THROW(data.assign(values.begin(), values.end()), etl::frozen_flat_map_full);
+
+      // Left empty, not with the old search order over the new values.
+      CHECK(data.empty());
+      CHECK(data.find(6) == data.end());
+      CHECK(data.lower_bound(6) == data.end());
+      CHECK(data.upper_bound(6) == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_at_out_of_bounds)
+    {
+      ElementInt values[] = { ElementInt(1, 1), ElementInt(2, 2) };
+
+      etl::frozen_flat_map<int, int, 10> data(std::begin(values), std::end(values));
+
+      CHECK_THROW(data.at(3), etl::frozen_flat_map_out_of_bounds);
+    }
+
+    //*************************************************************************
+    TEST(test_copy_and_equal)
+    {
+      ElementInt values[] = { ElementInt(3, 3), ElementInt(1, 1), ElementInt(2, 2) };
+
+      etl::frozen_flat_map<int, int, 10> data1(std::begin(values), std::end(values));
+      etl::frozen_flat_map<int, int, 10> data2(data1);
+      etl::frozen_flat_map<int, int, 10> data3;
+
+      CHECK(data1 == data2);
+      CHECK(data1 != data3);
+
+      data3 = data1;
+      CHECK(data1 == data3);
+      CHECK_EQUAL(2, data3.at(2));
+    }
+
+    //*************************************************************************
+    TEST(test_greater_compare)
+    {
+      ElementInt values[] = { ElementInt(3, 3), ElementInt(1, 1), ElementInt(2, 2) };
+
+      etl::frozen_flat_map<int, int, 10, std::greater<int> > data(std::begin(values), std::end(values));
+
+      CHECK_EQUAL(3, data.begin()->first);
+      CHECK_EQUAL(1, data.rbegin()->first);
+      CHECK_EQUAL(2, data.lower_bound(2)->first);
+      CHECK_EQUAL(1, data.upper_bound(2)->first);
+    }
+  };
+}
@@ -0,0 +1,141 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+
+#include <set>
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include "etl/frozen_flat_set.h"
+
+namespace
+{
+  static const size_t SIZE = 1000;
+
+  typedef etl::frozen_flat_set<int, SIZE> Data;
+  typedef etl::ifrozen_flat_set<int>      IData;
+  typedef std::set<int>                   Compare_Data;
+
+  SUITE(test_frozen_flat_set)
+  {
+    //*************************************************************************
+    struct SetupFixture
+    {
+      std::vector<int> random_data;
+      Compare_Data     compare_data;
+
+      SetupFixture()
+      {
+        for (size_t i = 0; i < SIZE; ++i)
+        {
+          int key = (rand() % (2 * SIZE)) - int(SIZE);
+
+          random_data.push_back(key);
+          compare_data.insert(key);
+        }
+      }
+    };
+
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Data data;
+
+      CHECK(data.empty());
+      CHECK_EQUAL(0U, data.size());
+      CHECK_EQUAL(SIZE, data.capacity());
+      CHECK(data.find(0) == data.end());
+      CHECK(data.lower_bound(0) == data.end());
+      CHECK(data.upper_bound(0) == data.end());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_assign_unsorted_with_duplicates)
+    {
+      Data data(random_data.begin(), random_data.end());
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+
+      bool is_equal = std::equal(data.begin(), data.end(), compare_data.begin());
+      CHECK(is_equal);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_find_lower_upper_bound)
+    {
+      Data data(random_data.begin(), random_data.end());
+      const IData& idata = data;
+
+      for (int key = -int(SIZE) - 2; key < int(SIZE) + 2; ++key)
+      {
+        bool exists = compare_data.find(key) != compare_data.end();
+
+        CHECK_EQUAL(exists, idata.find(key) != idata.end());
+        CHECK_EQUAL(exists ? 1U : 0U, idata.count(key));
+
+        CHECK_EQUAL(std::distance(compare_data.begin(), compare_data.lower_bound(key)), std::distance(idata.begin(), idata.lower_bound(key)));
+        CHECK_EQUAL(std::distance(compare_data.begin(), compare_data.upper_bound(key)), std::distance(idata.begin(), idata.upper_bound(key)));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_assign_excess)
+    {
+      int values[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+
+      etl::frozen_flat_set<int, 10> data(std::begin(values) + 5, std::begin(values) + 8);
+
+      CHECK_THROW(data.assign(std::begin(values), std::end(values)), etl::frozen_flat_set_full);
+
+      // Left empty, not with the old search order over the new values.
+      CHECK(data.empty());
+      CHECK(data.find(6) == data.end());
+      CHECK(data.lower_bound(6) == data.end());
+      CHECK(data.upper_bound(6) == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_copy_and_equal)
+    {
+      int values[] = { 3, 1, 2, 1 };
+
+      etl::frozen_flat_set<int, 10> data1(std::begin(values), std::end(values));
+      etl::frozen_flat_set<int, 10> data2(data1);
+      etl::frozen_flat_set<int, 10> data3;
+
+      CHECK_EQUAL(3U, data1.size());
+      CHECK(data1 == data2);
+      CHECK(data1 != data3);
+
+      data3 = data1;
+      CHECK(data1 == data3);
+    }
+  };
+}
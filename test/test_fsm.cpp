@@ -313,6 +313,57 @@ namespace
     }
   };
 
+#if ETL_CPP11_SUPPORTED && !defined(ETL_FSM_FORCE_CPP03)
+  //***************************************************************************
+  // A state that handles more than 16 events.
+  //***************************************************************************
+  template <etl::message_id_t ID>
+  class EventN : public etl::message<ID>
+  {
+  };
+
+  class ManyEventsControl : public etl::fsm
+  {
+  public:
+
+    ManyEventsControl()
+      : fsm(MOTOR_CONTROL),
+        eventCount(0),
+        lastEvent(0),
+        unknownCount(0)
+    {
+    }
+
+    int eventCount;
+    int lastEvent;
+    int unknownCount;
+  };
+
+  class ManyEvents : public etl::fsm_state<ManyEventsControl, ManyEvents, 0,
+                                           EventN<20>, EventN<21>, EventN<22>, EventN<23>, EventN<24>, EventN<25>,
+                                           EventN<26>, EventN<27>, EventN<28>, EventN<29>, EventN<30>, EventN<31>,
+                                           EventN<32>, EventN<33>, EventN<34>, EventN<35>, EventN<36>, EventN<37> >
+  {
+  public:
+
+    //***********************************
+    template <etl::message_id_t ID>
+    etl::fsm_state_id_t on_event(etl::imessage_router&, const EventN<ID>&)
+    {
+      ++get_fsm_context().eventCount;
+      get_fsm_context().lastEvent = ID;
+      return STATE_ID;
+    }
+
+    //***********************************
+    etl::fsm_state_id_t on_event_unknown(etl::imessage_router&, const etl::imessage&)
+    {
+      ++get_fsm_context().unknownCount;
+      return STATE_ID;
+    }
+  };
+#endif
+
   // The states.
   Idle        idle;
   Running     running;
@@ -566,5 +617,34 @@ namespace
       CHECK(motorControl.accepts(Stopped()));
       CHECK(motorControl.accepts(Unsupported()));
     }
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_FSM_FORCE_CPP03)
+    //*************************************************************************
+    TEST(test_fsm_more_than_16_events)
+    {
+      ManyEvents state;
+      etl::ifsm_state* states[] = { &state };
+
+      ManyEventsControl control;
+      control.set_states(states, 1);
+      control.start();
+
+      etl::null_message_router nmr;
+
+      control.receive(nmr, EventN<20>());
+      control.receive(nmr, EventN<30>());
+      control.receive(nmr, EventN<37>());
+
+      CHECK_EQUAL(3, control.eventCount);
+      CHECK_EQUAL(37, control.lastEvent);
+      CHECK_EQUAL(0, control.unknownCount);
+
+      control.receive(nmr, EventN<19>());
+      control.receive(nmr, EventN<38>());
+
+      CHECK_EQUAL(3, control.eventCount);
+      CHECK_EQUAL(2, control.unknownCount);
+    }
+#endif
   };
 }
@@ -622,6 +622,103 @@ namespace
       CHECK_THROW(data.insert(excess_data.begin(), excess_data.end()), etl::map_full);
     }
 
+    //*************************************************************************
+    TEST(test_insert_range_sorted_builds_balanced_tree)
+    {
+      typedef etl::map<int, int, 1000> Sorted_Data;
+      typedef std::map<int, int>       Sorted_Compare;
+
+      std::vector<std::pair<int, int> > values;
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        values.push_back(std::make_pair(i / 2 * 2, i));
+      }
+
+      for (size_t n = 0; n <= values.size(); n += 37)
+      {
+        Sorted_Data    data(values.begin(), values.begin() + n);
+        Sorted_Compare compare_data(values.begin(), values.begin() + n);
+
+        CHECK_EQUAL(compare_data.size(), data.size());
+        CHECK(Check_Equal(data.begin(), data.end(), compare_data.begin()));
+
+        // The balance of the built tree must survive later changes.
+        for (int key = 0; key < int(n); key += 3)
+        {
+          data.erase(key);
+          compare_data.erase(key);
+          data.insert(std::make_pair(key + 1, key));
+          compare_data.insert(std::make_pair(key + 1, key));
+        }
+
+        CHECK_EQUAL(compare_data.size(), data.size());
+        CHECK(Check_Equal(data.begin(), data.end(), compare_data.begin()));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_insert_range_sorted_then_unsorted)
+    {
+      typedef etl::map<int, int, 20> Sorted_Data;
+      typedef std::map<int, int>     Sorted_Compare;
+
+      std::pair<int, int> values[] = { std::make_pair(1, 1), std::make_pair(3, 3), std::make_pair(5, 5), std::make_pair(5, 6),
+                                       std::make_pair(2, 2), std::make_pair(9, 9), std::make_pair(0, 0), std::make_pair(3, 4) };
+
+      Sorted_Data    data(std::begin(values), std::end(values));
+      Sorted_Compare compare_data(std::begin(values), std::end(values));
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(Check_Equal(data.begin(), data.end(), compare_data.begin()));
+    }
+
+    //*************************************************************************
+    TEST(test_insert_range_sorted_excess)
+    {
+      etl::map<int, int, 4> data;
+
+      std::pair<int, int> values[] = { std::make_pair(1, 1), std::make_pair(2, 2), std::make_pair(3, 3), std::make_pair(4, 4), std::make_pair(5, 5) };
+
+      CHECK_THROW(data.insert(std::begin(values), std::end(values)), etl::map_full);
+      CHECK_EQUAL(4U, data.size());
+      CHECK_EQUAL(4, data.rbegin()->first);
+    }
+
+    //*************************************************************************
+    TEST(test_insert_hint_end_appends)
+    {
+      typedef etl::map<int, int, 1000> Sorted_Data;
+      typedef std::map<int, int>       Sorted_Compare;
+
+      Sorted_Data    data;
+      Sorted_Compare compare_data;
+
+      for (int i = 0; i < 500; ++i)
+      {
+        Sorted_Data::iterator itr = data.insert(data.end(), std::make_pair(i * 2, i));
+        compare_data.insert(compare_data.end(), std::make_pair(i * 2, i));
+
+        CHECK_EQUAL(i * 2, itr->first);
+      }
+
+      // A hint of end() for a key that does not follow the others is still inserted correctly.
+      data.insert(data.end(), std::make_pair(501, 0));
+      compare_data.insert(compare_data.end(), std::make_pair(501, 0));
+
+      Sorted_Data::iterator itr = data.insert(data.cend(), std::make_pair(10, 0));
+      CHECK_EQUAL(5, itr->second);
+
+      for (int key = 0; key < 1000; key += 3)
+      {
+        data.erase(key);
+        compare_data.erase(key);
+      }
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(Check_Equal(data.begin(), data.end(), compare_data.begin()));
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_equal_range)
     {
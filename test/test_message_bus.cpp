@@ -35,6 +35,8 @@ SOFTWARE.
 #include "etl/largest.h"
 #include "etl/packet.h"
 
+#include <vector>
+
 //***************************************************************************
 // The set of messages.
 //***************************************************************************
@@ -722,5 +724,220 @@ namespace
       CHECK_EQUAL(3, router4a.order);
       CHECK_EQUAL(4, router3.order);
     }
+
+    //=========================================================================
+    TEST(indexed_message_bus_broadcast)
+    {
+      etl::indexed_message_bus<2> bus1;
+
+      RouterA router1(ROUTER1);
+      RouterB router2(ROUTER2);
+      RouterA sender(ROUTER3);
+
+      bus1.subscribe(router1);
+      bus1.subscribe(router2);
+
+      bus1.receive(sender, message1);
+
+      CHECK_EQUAL(1, router1.message1_count);
+      CHECK_EQUAL(1, router2.message1_count);
+      CHECK_EQUAL(2, sender.message5_count);
+
+      // Only router1 accepts Message3.
+      bus1.receive(sender, message3);
+
+      CHECK_EQUAL(1, router1.message3_count);
+      CHECK_EQUAL(0, router1.message_unknown_count);
+      CHECK_EQUAL(0, router2.message_unknown_count);
+      CHECK_EQUAL(3, sender.message5_count);
+
+      etl::send_message(sender, bus1, message4);
+
+      CHECK_EQUAL(1, router1.message4_count);
+      CHECK_EQUAL(1, router2.message4_count);
+      CHECK_EQUAL(5, sender.message5_count);
+    }
+
+    //=========================================================================
+    TEST(indexed_message_bus_addressed)
+    {
+      etl::indexed_message_bus<3> bus1;
+
+      RouterA router1(ROUTER1);
+      RouterB router2(ROUTER1);
+      RouterB router3(ROUTER2);
+      RouterA sender(ROUTER3);
+
+      bus1.subscribe(router1);
+      bus1.subscribe(router2);
+      bus1.subscribe(router3);
+
+      bus1.receive(sender, ROUTER1, message1);
+
+      CHECK_EQUAL(1, router1.message1_count);
+      CHECK_EQUAL(1, router2.message1_count);
+      CHECK_EQUAL(0, router3.message1_count);
+      CHECK_EQUAL(2, sender.message5_count);
+
+      bus1.receive(sender, ROUTER1, message3);
+
+      CHECK_EQUAL(1, router1.message3_count);
+      CHECK_EQUAL(0, router2.message_unknown_count);
+      CHECK_EQUAL(3, sender.message5_count);
+
+      bus1.receive(sender, ROUTER2, message3);
+
+      CHECK_EQUAL(0, router3.message_unknown_count);
+      CHECK_EQUAL(3, sender.message5_count);
+    }
+
+    //=========================================================================
+    TEST(indexed_message_bus_broadcast_order)
+    {
+      etl::indexed_message_bus<4> bus1;
+      etl::message_bus<2>         bus2;
+      etl::indexed_message_bus<2> bus3;
+
+      RouterA router1(ROUTER1);
+      RouterA router2(ROUTER2);
+      RouterA router3(ROUTER3);
+      RouterA router4a(ROUTER4);
+      RouterA router4b(ROUTER4);
+
+      RouterA sender(ROUTER5);
+
+      bus1.subscribe(router1);
+      bus1.subscribe(bus3);
+      bus1.subscribe(bus2);
+      bus1.subscribe(router2);
+
+      bus2.subscribe(router3);
+      bus3.subscribe(router4b);
+      bus3.subscribe(router4a);
+
+      call_order = 0;
+
+      bus1.receive(sender, message1);
+
+      CHECK_EQUAL(0, router1.order);
+      CHECK_EQUAL(1, router2.order);
+      CHECK_EQUAL(2, router4b.order);
+      CHECK_EQUAL(3, router4a.order);
+      CHECK_EQUAL(4, router3.order);
+
+      // Addressed through the sub buses.
+      bus1.receive(sender, ROUTER3, message1);
+      CHECK_EQUAL(2, router3.message1_count);
+    }
+
+    //=========================================================================
+    TEST(indexed_message_bus_subscribe_unsubscribe)
+    {
+      static const size_t Size = 40U;
+
+      etl::indexed_message_bus<Size> indexed;
+      etl::message_bus<Size>         plain;
+
+      std::vector<RouterA*> routers_a;
+      std::vector<RouterB*> routers_b;
+
+      // Interleave the router types and ids across more than one index word.
+      for (size_t i = 0U; i < (Size / 2U); ++i)
+      {
+        routers_a.push_back(new RouterA(etl::message_router_id_t((i * 7U) % 13U)));
+        routers_b.push_back(new RouterB(etl::message_router_id_t((i * 5U) % 11U)));
+
+        CHECK(indexed.subscribe(*routers_a.back()));
+        CHECK(indexed.subscribe(*routers_b.back()));
+      }
+
+      CHECK_EQUAL(Size, indexed.size());
+
+      indexed.unsubscribe(*routers_a[3]);
+      indexed.unsubscribe(*routers_b[17]);
+      indexed.unsubscribe(etl::message_router_id_t(5));
+
+      // The same subscriptions on a plain bus.
+      for (size_t i = 0U; i < (Size / 2U); ++i)
+      {
+        plain.subscribe(*routers_a[i]);
+        plain.subscribe(*routers_b[i]);
+      }
+
+      plain.unsubscribe(*routers_a[3]);
+      plain.unsubscribe(*routers_b[17]);
+      plain.unsubscribe(etl::message_router_id_t(5));
+
+      CHECK_EQUAL(plain.size(), indexed.size());
+
+      RouterA sender(ROUTER1);
+
+      indexed.receive(sender, message3);
+      indexed.receive(sender, message2);
+      indexed.receive(sender, ROUTER3, message1);
+
+      std::vector<int> indexed_counts;
+
+      for (size_t i = 0U; i < (Size / 2U); ++i)
+      {
+        indexed_counts.push_back(routers_a[i]->message1_count);
+        indexed_counts.push_back(routers_a[i]->message2_count);
+        indexed_counts.push_back(routers_a[i]->message3_count);
+        indexed_counts.push_back(routers_b[i]->message1_count);
+        indexed_counts.push_back(routers_b[i]->message2_count);
+        routers_a[i]->message1_count = routers_a[i]->message2_count = routers_a[i]->message3_count = 0;
+        routers_b[i]->message1_count = routers_b[i]->message2_count = 0;
+      }
+
+      plain.receive(sender, message3);
+      plain.receive(sender, message2);
+      plain.receive(sender, ROUTER3, message1);
+
+      for (size_t i = 0U; i < (Size / 2U); ++i)
+      {
+        CHECK_EQUAL(indexed_counts[(i * 5U) + 0U], routers_a[i]->message1_count);
+        CHECK_EQUAL(indexed_counts[(i * 5U) + 1U], routers_a[i]->message2_count);
+        CHECK_EQUAL(indexed_counts[(i * 5U) + 2U], routers_a[i]->message3_count);
+        CHECK_EQUAL(indexed_counts[(i * 5U) + 3U], routers_b[i]->message1_count);
+        CHECK_EQUAL(indexed_counts[(i * 5U) + 4U], routers_b[i]->message2_count);
+      }
+
+      CHECK_EQUAL(0, routers_a[3]->message2_count);
+      CHECK_EQUAL(0, routers_b[17]->message2_count);
+
+      indexed.clear();
+      CHECK_EQUAL(0U, indexed.size());
+
+      indexed.receive(sender, message2);
+      CHECK_EQUAL(1, routers_a[0]->message2_count);
+
+      for (size_t i = 0U; i < (Size / 2U); ++i)
+      {
+        delete routers_a[i];
+        delete routers_b[i];
+      }
+    }
+
+    //=========================================================================
+    TEST(indexed_message_bus_unindexed_id)
+    {
+      // Only ids 0 to 2 are indexed.
+      etl::indexed_message_bus<2, MESSAGE3> bus1;
+
+      RouterA router1(ROUTER1);
+      RouterB router2(ROUTER2);
+      RouterA sender(ROUTER3);
+
+      bus1.subscribe(router1);
+      bus1.subscribe(router2);
+
+      bus1.receive(sender, message3);
+      bus1.receive(sender, message4);
+
+      CHECK_EQUAL(1, router1.message3_count);
+      CHECK_EQUAL(1, router1.message4_count);
+      CHECK_EQUAL(1, router2.message4_count);
+      CHECK_EQUAL(3, sender.message5_count);
+    }
   };
 }
@@ -197,6 +197,119 @@ namespace
   };
 
 
+  //***************************************************************************
+  // Router that handles runs of Message1 at once.
+  //***************************************************************************
+  class Router3 : public etl::message_router<Router3, Message1, Message2, Message3>
+  {
+  public:
+
+    Router3()
+      : message_router(ROUTER1),
+        message1_count(0),
+        message1_batch_count(0),
+        message2_count(0),
+        message3_count(0),
+        message_unknown_count(0),
+        order(0)
+    {
+    }
+
+    using message_router::on_receive_batch;
+
+    void on_receive_batch(etl::imessage_router&, const etl::message_batch<Message1>& batch)
+    {
+      ++message1_batch_count;
+      message1_count += int(batch.size());
+      order = (order * 10) + 1;
+    }
+
+    void on_receive(etl::imessage_router&, const Message1&)
+    {
+      // Only called through on_receive_batch.
+      ++message_unknown_count;
+    }
+
+    void on_receive(etl::imessage_router&, const Message2&)
+    {
+      ++message2_count;
+      order = (order * 10) + 2;
+    }
+
+    void on_receive(etl::imessage_router&, const Message3& msg)
+    {
+      ++message3_count;
+      order = (order * 10) + msg.value[0];
+    }
+
+    void on_receive_unknown(etl::imessage_router&, const etl::imessage&)
+    {
+      ++message_unknown_count;
+    }
+
+    int message1_count;
+    int message1_batch_count;
+    int message2_count;
+    int message3_count;
+    int message_unknown_count;
+    int order;
+  };
+
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_MESSAGE_ROUTER_FORCE_CPP03)
+  //***************************************************************************
+  // Router that handles more than 16 message types, with a gap in the ids.
+  //***************************************************************************
+  template <etl::message_id_t ID>
+  struct MessageN : public etl::message<ID>
+  {
+    MessageN()
+      : value(ID)
+    {
+    }
+
+    int value;
+  };
+
+  class RouterN : public etl::message_router<RouterN,
+                                            MessageN<10>, MessageN<11>, MessageN<12>, MessageN<13>, MessageN<14>,
+                                            MessageN<15>, MessageN<16>, MessageN<17>, MessageN<18>, MessageN<19>,
+                                            MessageN<20>, MessageN<21>, MessageN<22>, MessageN<23>, MessageN<24>,
+                                            MessageN<25>, MessageN<26>, MessageN<27>, MessageN<28>, MessageN<29>,
+                                            MessageN<40> >
+  {
+  public:
+
+    RouterN()
+      : message_router(ROUTER1),
+        message_unknown_count(0),
+        total(0)
+    {
+      for (size_t i = 0; i < 64; ++i)
+      {
+        counts[i] = 0;
+      }
+    }
+
+    template <etl::message_id_t ID>
+    void on_receive(etl::imessage_router&, const MessageN<ID>& msg)
+    {
+      ++counts[ID];
+      total += msg.value;
+    }
+
+    void on_receive_unknown(etl::imessage_router&, const etl::imessage&)
+    {
+      ++message_unknown_count;
+    }
+
+    int counts[64];
+    int message_unknown_count;
+    int total;
+  };
+#endif
+
+
   etl::imessage_router* p_router;
 
   SUITE(test_message_router)
@@ -474,5 +587,172 @@ namespace
       CHECK_EQUAL(0, r1.message4_count);
       CHECK_EQUAL(0, r1.message_unknown_count);
     }
+
+    //=========================================================================
+    TEST(message_router_receive_batch)
+    {
+      Router1 r1;
+      Router2 r2;
+
+      const etl::imessage* messages[] = { &message1, &message1, &message2, &message3, &message3, &message4, &message1 };
+      const size_t n = sizeof(messages) / sizeof(messages[0]);
+
+      p_router = &r1;
+      p_router->receive(r2, messages, n);
+
+      CHECK_EQUAL(3, r1.message1_count);
+      CHECK_EQUAL(1, r1.message2_count);
+      CHECK_EQUAL(2, r1.message3_count);
+      CHECK_EQUAL(1, r1.message4_count);
+      CHECK_EQUAL(0, r1.message_unknown_count);
+      CHECK_EQUAL(7, r2.callback_count);
+
+      // Router2 does not handle Message3.
+      etl::send_messages(r1, r2, messages, n);
+
+      CHECK_EQUAL(3, r2.message1_count);
+      CHECK_EQUAL(1, r2.message2_count);
+      CHECK_EQUAL(1, r2.message4_count);
+      CHECK_EQUAL(2, r2.message_unknown_count);
+      CHECK_EQUAL(7, r1.callback_count);
+
+      // An empty batch.
+      p_router->receive(r2, messages, 0);
+      CHECK_EQUAL(3, r1.message1_count);
+    }
+
+    //=========================================================================
+    TEST(message_router_receive_batch_runs)
+    {
+      Router3 r3;
+
+      Message3 m3a;
+      m3a.value[0] = 3;
+      Message3 m3b;
+      m3b.value[0] = 4;
+
+      const etl::imessage* messages[] = { &message1, &message1, &message1, &m3a, &m3b, &message1, &message2, &message1, &message1 };
+      const size_t n = sizeof(messages) / sizeof(messages[0]);
+
+      etl::send_messages(etl::null_message_router::instance(), r3, messages, n);
+
+      // The runs are handled in order.
+      CHECK_EQUAL(3, r3.message1_batch_count);
+      CHECK_EQUAL(6, r3.message1_count);
+      CHECK_EQUAL(1, r3.message2_count);
+      CHECK_EQUAL(2, r3.message3_count);
+      CHECK_EQUAL(0, r3.message_unknown_count);
+      CHECK_EQUAL(134121, r3.order);
+
+      // A single message still goes to on_receive.
+      r3.receive(message1);
+      CHECK_EQUAL(1, r3.message_unknown_count);
+    }
+
+    //=========================================================================
+    TEST(message_router_receive_batch_successor)
+    {
+      Router1 r1;
+      Router2 r2;
+      r2.set_successor(r1);
+
+      const etl::imessage* messages[] = { &message3, &message3, &message1, &message3 };
+      const size_t n = sizeof(messages) / sizeof(messages[0]);
+
+      etl::null_message_router& nmr = etl::null_message_router::instance();
+
+      r2.receive(nmr, messages, n);
+
+      CHECK_EQUAL(1, r2.message1_count);
+      CHECK_EQUAL(0, r2.message_unknown_count);
+      CHECK_EQUAL(3, r1.message3_count);
+
+      // The null router ignores a batch.
+      nmr.receive(nmr, messages, n);
+    }
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_MESSAGE_ROUTER_FORCE_CPP03)
+    //=========================================================================
+    TEST(message_router_more_than_16_types)
+    {
+      static_assert(RouterN::accepts_id(10), "Should accept 10");
+      static_assert(RouterN::accepts_id(29), "Should accept 29");
+      static_assert(RouterN::accepts_id(40), "Should accept 40");
+      static_assert(!RouterN::accepts_id(9), "Should not accept 9");
+      static_assert(!RouterN::accepts_id(30), "Should not accept 30");
+      static_assert(!RouterN::accepts_id(255), "Should not accept 255");
+
+      RouterN router;
+      p_router = &router;
+
+      CHECK(p_router->accepts(MessageN<10>()));
+      CHECK(p_router->accepts(MessageN<40>()));
+      CHECK(!p_router->accepts(MessageN<39>()));
+      CHECK(!p_router->accepts(message1));
+
+      p_router->receive(MessageN<10>());
+      p_router->receive(MessageN<17>());
+      p_router->receive(MessageN<29>());
+      p_router->receive(MessageN<40>());
+      p_router->receive(MessageN<40>());
+
+      CHECK_EQUAL(1, router.counts[10]);
+      CHECK_EQUAL(1, router.counts[17]);
+      CHECK_EQUAL(1, router.counts[29]);
+      CHECK_EQUAL(2, router.counts[40]);
+      CHECK_EQUAL(10 + 17 + 29 + 40 + 40, router.total);
+
+      p_router->receive(MessageN<30>());
+      p_router->receive(message1);
+      CHECK_EQUAL(2, router.message_unknown_count);
+
+      MessageN<28> m28;
+      MessageN<41> m41;
+      const etl::imessage* messages[] = { &m28, &m28, &m41, &m28 };
+      p_router->receive(router, messages, 4);
+
+      CHECK_EQUAL(3, router.counts[28]);
+      CHECK_EQUAL(3, router.message_unknown_count);
+    }
+
+    //=========================================================================
+    TEST(message_router_more_than_16_types_successor)
+    {
+      RouterN router;
+      Router1 r1;
+      Router2 r2;
+
+      router.set_successor(r1);
+
+      router.receive(r2, message3);
+      router.receive(r2, MessageN<11>());
+
+      CHECK_EQUAL(1, r1.message3_count);
+      CHECK_EQUAL(1, router.counts[11]);
+      CHECK_EQUAL(0, router.message_unknown_count);
+    }
+
+    //=========================================================================
+    TEST(message_router_more_than_16_types_packet)
+    {
+      MessageN<25> m25;
+      m25.value = 123;
+
+      RouterN::message_packet packet1(m25);
+      RouterN::message_packet packet2(static_cast<const etl::imessage&>(MessageN<40>()));
+
+      CHECK_EQUAL(25, packet1.get().message_id);
+      CHECK_EQUAL(123, static_cast<const MessageN<25>&>(packet1.get()).value);
+      CHECK_EQUAL(40, packet2.get().message_id);
+
+      RouterN::message_packet packet3(packet1);
+      CHECK_EQUAL(123, static_cast<const MessageN<25>&>(packet3.get()).value);
+
+      packet3 = packet2;
+      CHECK_EQUAL(40, packet3.get().message_id);
+
+      CHECK(size_t(RouterN::message_packet::SIZE) >= sizeof(MessageN<25>));
+    }
+#endif
   };
 }
@@ -35,6 +35,7 @@ SOFTWARE.
 
 #include <iostream>
 #include <vector>
+#include <memory>
 #include <thread>
 #include <chrono>
 
@@ -594,6 +595,168 @@ namespace
       CHECK_ARRAY_EQUAL(compare1.data(), router1.message1.data(), compare1.size());
     }
 
+    //=========================================================================
+    TEST(message_timer_wheel_too_many_timers)
+    {
+      etl::message_timer_wheel<2> timer_controller;
+
+      etl::timer::wheel_id::type id1 = timer_controller.register_timer(message1, router1, 37, etl::timer::mode::SINGLE_SHOT);
+      etl::timer::wheel_id::type id2 = timer_controller.register_timer(message2, router1, 23, etl::timer::mode::SINGLE_SHOT);
+      etl::timer::wheel_id::type id3 = timer_controller.register_timer(message3, router1, 11, etl::timer::mode::SINGLE_SHOT);
+
+      CHECK_EQUAL(0U, id1);
+      CHECK_EQUAL(1U, id2);
+      CHECK(id3 == etl::timer::wheel_id::NO_TIMER);
+
+      // The freed id is reused.
+      CHECK(timer_controller.unregister_timer(id2));
+      CHECK(timer_controller.register_timer(message3, etl::null_message_router::instance(), 11, etl::timer::mode::SINGLE_SHOT) == etl::timer::wheel_id::NO_TIMER);
+      id3 = timer_controller.register_timer(message3, router1, 11, etl::timer::mode::SINGLE_SHOT);
+      CHECK_EQUAL(id2, id3);
+
+      timer_controller.clear();
+      id3 = timer_controller.register_timer(message3, router1, 11, etl::timer::mode::SINGLE_SHOT);
+      CHECK_EQUAL(0U, id3);
+    }
+
+    //=========================================================================
+    TEST(message_timer_wheel_route_through_bus)
+    {
+      etl::message_timer_wheel<3> timer_controller;
+
+      etl::timer::wheel_id::type id1 = timer_controller.register_timer(message1, bus1, 37, etl::timer::mode::SINGLE_SHOT, ROUTER1);
+      etl::timer::wheel_id::type id2 = timer_controller.register_timer(message2, bus1, 23, etl::timer::mode::REPEATING,   ROUTER1);
+      etl::timer::wheel_id::type id3 = timer_controller.register_timer(message3, bus1, 11, etl::timer::mode::SINGLE_SHOT, etl::imessage_router::ALL_MESSAGE_ROUTERS);
+
+      bus1.unsubscribe(router1);
+      bus1.subscribe(router1);
+
+      router1.clear();
+
+      timer_controller.start(id1);
+      timer_controller.start(id3);
+      timer_controller.start(id2);
+
+      timer_controller.enable(true);
+
+      ticks = 0;
+
+      const uint32_t step = 1;
+
+      while (ticks <= 100U)
+      {
+        ticks += step;
+        timer_controller.tick(step);
+      }
+
+      std::vector<uint64_t> compare1 = { 37 };
+      std::vector<uint64_t> compare2 = { 23, 46, 69, 92 };
+      std::vector<uint64_t> compare3 = { 11 };
+
+      CHECK_EQUAL(compare1.size(), router1.message1.size());
+      CHECK_EQUAL(compare2.size(), router1.message2.size());
+      CHECK_EQUAL(compare3.size(), router1.message3.size());
+
+      CHECK_ARRAY_EQUAL(compare1.data(), router1.message1.data(), compare1.size());
+      CHECK_ARRAY_EQUAL(compare2.data(), router1.message2.data(), compare2.size());
+      CHECK_ARRAY_EQUAL(compare3.data(), router1.message3.data(), compare3.size());
+    }
+
+    //=========================================================================
+    TEST(message_timer_wheel_immediate_delayed)
+    {
+      etl::message_timer_wheel<3> timer_controller;
+
+      etl::timer::wheel_id::type id1 = timer_controller.register_timer(message1, router1, 37, etl::timer::mode::REPEATING);
+      etl::timer::wheel_id::type id2 = timer_controller.register_timer(message2, router1, 23, etl::timer::mode::REPEATING);
+      etl::timer::wheel_id::type id3 = timer_controller.register_timer(message3, router1, 11, etl::timer::mode::REPEATING);
+
+      router1.clear();
+
+      timer_controller.start(id1);
+      timer_controller.start(id3);
+      timer_controller.start(id2);
+
+      timer_controller.enable(true);
+
+      ticks = 5;
+      timer_controller.tick(uint32_t(ticks));
+
+      timer_controller.start(id1, etl::timer::start::IMMEDIATE);
+      timer_controller.start(id2, etl::timer::start::IMMEDIATE);
+      timer_controller.start(id3, etl::timer::start::DELAYED);
+
+      const uint32_t step = 1;
+
+      while (ticks <= 100U)
+      {
+        ticks += step;
+        timer_controller.tick(step);
+      }
+
+      std::vector<uint64_t> compare1 = { 6, 42, 79 };
+      std::vector<uint64_t> compare2 = { 6, 28, 51, 74, 97 };
+      std::vector<uint64_t> compare3 = { 16, 27, 38, 49, 60, 71, 82, 93 };
+
+      CHECK_EQUAL(compare1.size(), router1.message1.size());
+      CHECK_EQUAL(compare2.size(), router1.message2.size());
+      CHECK_EQUAL(compare3.size(), router1.message3.size());
+
+      CHECK_ARRAY_EQUAL(compare1.data(), router1.message1.data(), compare1.size());
+      CHECK_ARRAY_EQUAL(compare2.data(), router1.message2.data(), compare2.size());
+      CHECK_ARRAY_EQUAL(compare3.data(), router1.message3.data(), compare3.size());
+    }
+
+    //=========================================================================
+    TEST(message_timer_wheel_ten_thousand_retransmit_timers)
+    {
+      const size_t SIZE = 10000;
+
+      typedef etl::message_timer_wheel<SIZE> Controller;
+      std::unique_ptr<Controller> timer_controller(new Controller);
+
+      std::vector<etl::timer::wheel_id::type> ids;
+
+      // Every timer retransmits after 1000 ticks.
+      for (size_t i = 0; i < SIZE; ++i)
+      {
+        ids.push_back(timer_controller->register_timer(message1, router1, 1000, etl::timer::mode::SINGLE_SHOT));
+        CHECK(ids.back() != etl::timer::wheel_id::NO_TIMER);
+      }
+
+      router1.clear();
+      timer_controller->enable(true);
+
+      ticks = 0;
+
+      // Start the timers over the first 500 ticks, acknowledging (stopping) half of them.
+      for (size_t i = 0; i < SIZE; ++i)
+      {
+        timer_controller->start(ids[i]);
+
+        if ((i % 2) == 0)
+        {
+          timer_controller->stop(ids[i]);
+        }
+
+        if ((i % 20) == 19)
+        {
+          ++ticks;
+          timer_controller->tick(1);
+        }
+      }
+
+      while (ticks < 2000U)
+      {
+        ++ticks;
+        timer_controller->tick(1);
+      }
+
+      CHECK_EQUAL(SIZE / 2, router1.message1.size());
+      CHECK_EQUAL(1000U, router1.message1.front());
+      CHECK_EQUAL(1499U, router1.message1.back());
+    }
+
     //=========================================================================
 #if REALTIME_TEST
 
@@ -34,6 +34,7 @@ SOFTWARE.
 #include <set>
 #include <vector>
 #include <string>
+#include <algorithm>
 
 #include "etl/pool.h"
 #include "etl/largest.h"
@@ -413,6 +414,103 @@ namespace
       CHECK_NO_THROW(p3 = pool.allocate<double>());
       CHECK_NO_THROW(p4 = pool.allocate<Test_Data>());
     }
+
+    //*************************************************************************
+    TEST(test_allocate_n_release_n)
+    {
+      etl::pool<uint32_t, 8> pool;
+
+      uint32_t* items[10];
+
+      CHECK_EQUAL(3U, pool.allocate_n(items, 3));
+      CHECK_EQUAL(3U, pool.size());
+
+      // Release a run from the middle of the allocation order.
+      pool.release_n(items + 1, 2);
+      CHECK_EQUAL(1U, pool.size());
+
+      CHECK_EQUAL(7U, pool.allocate_n(items + 1, 9));
+      CHECK_EQUAL(8U, pool.size());
+      CHECK(pool.full());
+
+      std::set<uint32_t*> unique(items, items + 8);
+      CHECK_EQUAL(8U, unique.size());
+
+      for (size_t i = 0; i < 8; ++i)
+      {
+        CHECK(pool.is_in_pool(items[i]));
+        *items[i] = uint32_t(i);
+      }
+
+      for (size_t i = 0; i < 8; ++i)
+      {
+        CHECK_EQUAL(i, *items[i]);
+      }
+
+      CHECK_EQUAL(0U, pool.allocate_n(items, 1));
+
+      pool.release_n(items, 8);
+      CHECK(pool.empty());
+
+      // Single and batch allocations share the free list.
+      uint32_t* p = pool.allocate<uint32_t>();
+      CHECK_EQUAL(7U, pool.allocate_n(items, 8));
+      CHECK(std::find(items, items + 7, p) == items + 7);
+    }
+
+    //*************************************************************************
+    TEST(test_release_n_not_in_pool)
+    {
+      etl::pool<uint32_t, 4> pool;
+
+      uint32_t  not_in_pool;
+      uint32_t* items[2];
+
+      pool.allocate_n(items, 1);
+      items[1] = &not_in_pool;
+
+      CHECK_THROW(pool.release_n(items, 2), etl::pool_object_not_in_pool);
+      CHECK_EQUAL(1U, pool.size());
+    }
+
+#if defined(ETL_POOL_STATISTICS)
+    //*************************************************************************
+    TEST(test_statistics)
+    {
+      etl::pool<uint32_t, 4> pool;
+
+      CHECK_EQUAL(0U, pool.high_water_mark());
+      CHECK_EQUAL(0U, pool.allocation_failures());
+      CHECK_EQUAL(0U, pool.allocation_count());
+      CHECK_EQUAL(0U, pool.release_count());
+
+      uint32_t* items[4];
+
+      items[0] = pool.allocate<uint32_t>();
+      pool.allocate_n(items + 1, 2);
+      CHECK_EQUAL(3U, pool.high_water_mark());
+      CHECK_EQUAL(3U, pool.allocation_count());
+
+      pool.release(items[0]);
+      pool.release_n(items + 1, 2);
+      CHECK_EQUAL(3U, pool.high_water_mark());
+      CHECK_EQUAL(3U, pool.release_count());
+
+      CHECK_EQUAL(4U, pool.allocate_n(items, 6));
+      CHECK_EQUAL(1U, pool.allocation_failures());
+      CHECK_THROW(pool.allocate<uint32_t>(), etl::pool_no_allocation);
+      CHECK_EQUAL(2U, pool.allocation_failures());
+      CHECK_EQUAL(4U, pool.high_water_mark());
+      CHECK_EQUAL(7U, pool.allocation_count());
+
+      pool.release_n(items, 3);
+      pool.reset_statistics();
+      CHECK_EQUAL(1U, pool.high_water_mark());
+      CHECK_EQUAL(0U, pool.allocation_failures());
+      CHECK_EQUAL(0U, pool.allocation_count());
+      CHECK_EQUAL(0U, pool.release_count());
+    }
+#endif
   };
 
   //*************************************************************************
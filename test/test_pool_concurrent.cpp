@@ -0,0 +1,262 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "UnitTest++.h"
+
+#include <set>
+#include <vector>
+#include <string>
+#include <thread>
+
+#include "etl/pool_concurrent.h"
+
+namespace
+{
+  struct Item
+  {
+    Item(int a_, const std::string& b_)
+      : a(a_),
+        b(b_)
+    {
+    }
+
+    int         a;
+    std::string b;
+  };
+
+  SUITE(test_pool_concurrent)
+  {
+    //*************************************************************************
+    TEST(test_allocate_release)
+    {
+      etl::pool_concurrent<int, 4> pool;
+
+      CHECK_EQUAL(4U, pool.max_size());
+      CHECK_EQUAL(4U, pool.available());
+      CHECK(pool.empty());
+
+      std::set<int*> items;
+
+      for (int i = 0; i < 4; ++i)
+      {
+        int* p = pool.allocate<int>();
+        CHECK(pool.is_in_pool(p));
+        items.insert(p);
+      }
+
+      CHECK_EQUAL(4U, items.size());
+      CHECK_EQUAL(4U, pool.size());
+      CHECK(pool.full());
+
+      CHECK_THROW(pool.allocate<int>(), etl::pool_no_allocation);
+
+      for (std::set<int*>::iterator itr = items.begin(); itr != items.end(); ++itr)
+      {
+        pool.release(*itr);
+      }
+
+      CHECK_EQUAL(4U, pool.available());
+      CHECK(pool.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_release_not_in_pool)
+    {
+      etl::pool_concurrent<int, 4> pool;
+      int not_in_pool;
+
+      CHECK_THROW(pool.release(&not_in_pool), etl::pool_object_not_in_pool);
+    }
+
+    //*************************************************************************
+    TEST(test_create_destroy)
+    {
+      etl::pool_concurrent<Item, 4> pool;
+
+      Item* p = pool.create<Item>(1, std::string("one"));
+
+      CHECK_EQUAL(1, p->a);
+      CHECK_EQUAL(std::string("one"), p->b);
+      CHECK_EQUAL(1U, pool.size());
+
+      pool.destroy<Item>(p);
+      CHECK_EQUAL(0U, pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_allocate_n_release_n)
+    {
+      etl::pool_concurrent<int, 8> pool;
+
+      void* items[10];
+
+      CHECK_EQUAL(5U, pool.allocate_n(items, 5));
+      CHECK_EQUAL(3U, pool.available());
+      CHECK_EQUAL(3U, pool.allocate_n(items + 5, 5));
+      CHECK_EQUAL(0U, pool.allocate_n(items + 8, 2));
+
+      std::set<void*> unique(items, items + 8);
+      CHECK_EQUAL(8U, unique.size());
+
+      pool.release_n(items + 2, 6);
+      CHECK_EQUAL(6U, pool.available());
+
+      pool.release_n(items, 2);
+      CHECK_EQUAL(8U, pool.available());
+
+      // Everything can be allocated again.
+      CHECK_EQUAL(8U, pool.allocate_n(items, 10));
+    }
+
+    //*************************************************************************
+    TEST(test_magazine)
+    {
+      etl::pool_concurrent<int, 16> pool;
+
+      {
+        etl::pool_magazine<4> magazine(pool);
+
+        CHECK_EQUAL(4U, magazine.capacity());
+        CHECK_EQUAL(0U, magazine.size());
+
+        // Refills half the capacity from the pool.
+        int* p1 = magazine.allocate<int>();
+        CHECK_EQUAL(1U, magazine.size());
+        CHECK_EQUAL(14U, pool.available());
+
+        int* p2 = magazine.allocate<int>();
+        CHECK_EQUAL(0U, magazine.size());
+        CHECK(p1 != p2);
+
+        int* p3 = magazine.allocate<int>();
+        CHECK_EQUAL(12U, pool.available());
+
+        magazine.release(p1);
+        magazine.release(p2);
+        magazine.release(p3);
+        CHECK_EQUAL(4U, magazine.size());
+        CHECK_EQUAL(12U, pool.available());
+
+        // Returns half the capacity to the pool when full.
+        int* p4 = pool.allocate<int>();
+        magazine.release(p4);
+        CHECK_EQUAL(3U, magazine.size());
+        CHECK_EQUAL(13U, pool.available());
+      }
+
+      // The destructor flushes the magazine.
+      CHECK_EQUAL(16U, pool.available());
+    }
+
+    //*************************************************************************
+    TEST(test_magazine_create_destroy)
+    {
+      etl::pool_concurrent<Item, 4> pool;
+      etl::pool_magazine<2> magazine(pool);
+
+      Item* p = magazine.create<Item>(2, std::string("two"));
+      CHECK_EQUAL(2, p->a);
+      CHECK_EQUAL(std::string("two"), p->b);
+
+      magazine.destroy<Item>(p);
+      magazine.flush();
+      CHECK_EQUAL(4U, pool.available());
+
+      etl::pool_concurrent<char, 4> small_pool;
+      etl::pool_magazine<2> small_magazine(small_pool);
+
+      CHECK_THROW(small_magazine.allocate<int>(), etl::pool_element_size);
+    }
+
+    //*************************************************************************
+    TEST(test_threads)
+    {
+      static const size_t N_THREADS  = 4;
+      static const int    ITERATIONS = 20000;
+
+      typedef etl::pool_concurrent<int, 64> Pool;
+
+      Pool pool;
+      bool ok[N_THREADS];
+
+      struct Worker
+      {
+        static void run(Pool& pool, int id, bool& ok)
+        {
+          etl::pool_magazine<8> magazine(pool);
+
+          int* held[4];
+          ok = true;
+
+          for (int i = 0; i < ITERATIONS; ++i)
+          {
+            for (int j = 0; j < 4; ++j)
+            {
+              held[j] = magazine.allocate<int>();
+              *held[j] = (id * ITERATIONS) + i;
+            }
+
+            for (int j = 0; j < 4; ++j)
+            {
+              // Nobody else may have been given the same item.
+              ok = ok && (*held[j] == ((id * ITERATIONS) + i));
+
+              // Release half directly to the pool, half through the magazine.
+              if ((j & 1) == 0)
+              {
+                pool.release(held[j]);
+              }
+              else
+              {
+                magazine.release(held[j]);
+              }
+            }
+          }
+        }
+      };
+
+      std::vector<std::thread> threads;
+
+      for (size_t i = 0; i < N_THREADS; ++i)
+      {
+        threads.push_back(std::thread(Worker::run, std::ref(pool), int(i), std::ref(ok[i])));
+      }
+
+      for (size_t i = 0; i < N_THREADS; ++i)
+      {
+        threads[i].join();
+      }
+
+      for (size_t i = 0; i < N_THREADS; ++i)
+      {
+        CHECK(ok[i]);
+      }
+
+      CHECK_EQUAL(64U, pool.available());
+    }
+  };
+}
@@ -31,6 +31,7 @@ SOFTWARE.
 #include <thread>
 #include <chrono>
 #include <vector>
+#include <algorithm>
 
 #include "etl/queue_spsc_atomic.h"
 
@@ -299,6 +300,166 @@ namespace
       CHECK(queue.full());
     }
 
+    //*************************************************************************
+    TEST(test_size_after_wrap_around)
+    {
+      etl::queue_spsc_atomic<int, 4> queue;
+
+      queue.push(1);
+      queue.push(2);
+      queue.push(3);
+      queue.push(4);
+
+      int i;
+      queue.pop(i);
+      queue.pop(i);
+      queue.pop(i);
+
+      // The write index wraps to the start of the buffer.
+      queue.push(5);
+      queue.push(6);
+
+      CHECK_EQUAL(3U, queue.size());
+      CHECK_EQUAL(1U, queue.available());
+      CHECK(!queue.full());
+
+      queue.push(7);
+      CHECK_EQUAL(4U, queue.size());
+      CHECK(queue.full());
+      CHECK(!queue.push(8));
+
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(4, i);
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(5, i);
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(6, i);
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(7, i);
+      CHECK(!queue.pop(i));
+      CHECK_EQUAL(0U, queue.size());
+    }
+
+    //*************************************************************************
+    TEST(test_push_pop_batch)
+    {
+      etl::queue_spsc_atomic<int, 4> queue;
+
+      int input[6] = { 1, 2, 3, 4, 5, 6 };
+      int output[6] = { 0, 0, 0, 0, 0, 0 };
+
+      CHECK_EQUAL(4U, queue.push(input, 6));
+      CHECK_EQUAL(4U, queue.size());
+      CHECK_EQUAL(0U, queue.push(input, 1));
+
+      CHECK_EQUAL(3U, queue.pop(output, 3));
+      CHECK_EQUAL(1, output[0]);
+      CHECK_EQUAL(2, output[1]);
+      CHECK_EQUAL(3, output[2]);
+
+      // Wraps around the end of the buffer.
+      CHECK_EQUAL(2U, queue.push(input + 4, 2));
+      CHECK_EQUAL(3U, queue.size());
+
+      CHECK_EQUAL(3U, queue.pop(output, 6));
+      CHECK_EQUAL(4, output[0]);
+      CHECK_EQUAL(5, output[1]);
+      CHECK_EQUAL(6, output[2]);
+
+      CHECK_EQUAL(0U, queue.pop(output, 6));
+      CHECK(queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_write_reserve_commit_read_peek_release)
+    {
+      etl::queue_spsc_atomic<int, 4> queue;
+
+      etl::array_view<int> write_view = queue.write_reserve();
+      CHECK_EQUAL(4U, write_view.size());
+
+      write_view[0] = 1;
+      write_view[1] = 2;
+      write_view[2] = 3;
+      queue.write_commit(3);
+      CHECK_EQUAL(3U, queue.size());
+
+      etl::const_array_view<int> read_view = queue.read_peek();
+      CHECK_EQUAL(3U, read_view.size());
+      CHECK_EQUAL(1, read_view[0]);
+      CHECK_EQUAL(2, read_view[1]);
+      CHECK_EQUAL(3, read_view[2]);
+
+      queue.read_release(2);
+      CHECK_EQUAL(1U, queue.size());
+
+      write_view = queue.write_reserve();
+      CHECK(write_view.size() >= 1U);
+      write_view[0] = 4;
+      queue.write_commit(1);
+
+      read_view = queue.read_peek();
+      CHECK_EQUAL(2U, read_view.size());
+      CHECK_EQUAL(3, read_view[0]);
+      CHECK_EQUAL(4, read_view[1]);
+
+      queue.read_release(2);
+      CHECK(queue.empty());
+      CHECK_EQUAL(0U, queue.read_peek().size());
+    }
+
+    //*************************************************************************
+    TEST(test_read_peek_release_wrap_around)
+    {
+      etl::queue_spsc_atomic<int, 4> queue;
+
+      int input[4] = { 1, 2, 3, 4 };
+      int output[4];
+
+      queue.push(input, 3);
+      queue.pop(output, 3);
+
+      CHECK_EQUAL(4U, queue.push(input, 4));
+      CHECK(queue.full());
+      CHECK_EQUAL(0U, queue.write_reserve().size());
+
+      std::vector<int> values;
+
+      while (!queue.empty())
+      {
+        etl::const_array_view<int> view = queue.read_peek();
+        CHECK(view.size() != 0U);
+
+        values.insert(values.end(), view.begin(), view.end());
+        queue.read_release(view.size());
+      }
+
+      CHECK_EQUAL(4U, values.size());
+      CHECK(std::equal(values.begin(), values.end(), input));
+    }
+
+    //*************************************************************************
+    TEST(test_write_commit_read_release_more_than_the_view)
+    {
+      etl::queue_spsc_atomic<int, 4> queue;
+
+      etl::array_view<int> write_view = queue.write_reserve();
+      CHECK_EQUAL(4U, write_view.size());
+
+      write_view[0] = 1;
+      write_view[1] = 2;
+      queue.write_commit(2);
+      CHECK_THROW(queue.write_commit(3), etl::queue_spsc_full);
+      CHECK_EQUAL(2U, queue.size());
+
+      etl::const_array_view<int> read_view = queue.read_peek();
+      CHECK_EQUAL(2U, read_view.size());
+
+      queue.read_release(1);
+      CHECK_THROW(queue.read_release(2), etl::queue_spsc_empty);
+      CHECK_EQUAL(1U, queue.size());
+    }
+
     //=========================================================================
 #if REALTIME_TEST && defined(ETL_COMPILER_MICROSOFT)
     #if defined(ETL_TARGET_OS_WINDOWS) // Only Windows priority is currently supported
@@ -0,0 +1,568 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+
+#include <thread>
+#include <chrono>
+#include <vector>
+#include <algorithm>
+
+#include "etl/queue_spsc_atomic.h"
+
+#if defined(ETL_COMPILER_MICROSOFT)
+  #include <Windows.h>
+#endif
+
+#define REALTIME_TEST 0
+
+namespace
+{
+  struct Data
+  {
+    Data(int a_, int b_ = 2, int c_ = 3, int d_ = 4)
+      : a(a_),
+      b(b_),
+      c(c_),
+      d(d_)
+    {
+    }
+
+    Data()
+      : a(0),
+      b(0),
+      c(0),
+      d(0)
+    {
+    }
+
+    int a;
+    int b;
+    int c;
+    int d;
+  };
+
+  bool operator ==(const Data& lhs, const Data& rhs)
+  {
+    return (lhs.a == rhs.a) && (lhs.b == rhs.b) && (lhs.c == rhs.c) && (lhs.d == rhs.d);
+  }
+
+  SUITE(test_queue_atomic_padded)
+  {
+    //*************************************************************************
+    TEST(test_constructor)
+    {
+      etl::queue_spsc_atomic_padded<int, 4> queue;
+
+      CHECK_EQUAL(4U, queue.max_size());
+      CHECK_EQUAL(4U, queue.capacity());
+    }
+
+    //*************************************************************************
+    TEST(test_size_push_pop)
+    {
+      etl::queue_spsc_atomic_padded<int, 4> queue;
+
+      CHECK_EQUAL(0U, queue.size());
+
+      CHECK_EQUAL(4U, queue.available());
+      CHECK_EQUAL(0U, queue.size());
+
+      queue.push(1);
+      CHECK_EQUAL(1U, queue.size());
+      CHECK_EQUAL(3U, queue.available());
+
+      queue.push(2);
+      CHECK_EQUAL(2U, queue.size());
+      CHECK_EQUAL(2U, queue.available());
+
+      queue.push(3);
+      CHECK_EQUAL(3U, queue.size());
+      CHECK_EQUAL(1U, queue.available());
+
+      queue.push(4);
+      CHECK_EQUAL(4U, queue.size());
+      CHECK_EQUAL(0U, queue.available());
+
+      CHECK(!queue.push(5));
+      CHECK(!queue.push(5));
+
+      int i;
+
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(1, i);
+      CHECK_EQUAL(3U, queue.size());
+
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(2, i);
+      CHECK_EQUAL(2U, queue.size());
+
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(3, i);
+      CHECK_EQUAL(1U, queue.size());
+
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(4, i);
+      CHECK_EQUAL(0U, queue.size());
+
+      CHECK(!queue.pop(i));
+      CHECK(!queue.pop(i));
+    }
+
+    //*************************************************************************
+    TEST(test_size_push_pop_iqueue)
+    {
+      etl::queue_spsc_atomic_padded<int, 4> queue;
+
+      etl::iqueue_spsc_atomic_padded<int>& iqueue = queue;
+
+      CHECK_EQUAL(0U, iqueue.size());
+
+      iqueue.push(1);
+      CHECK_EQUAL(1U, iqueue.size());
+
+      iqueue.push(2);
+      CHECK_EQUAL(2U, iqueue.size());
+
+      iqueue.push(3);
+      CHECK_EQUAL(3U, iqueue.size());
+
+      iqueue.push(4);
+      CHECK_EQUAL(4U, iqueue.size());
+
+      CHECK(!iqueue.push(5));
+      CHECK(!iqueue.push(5));
+
+      int i;
+
+      CHECK(iqueue.pop(i));
+      CHECK_EQUAL(1, i);
+      CHECK_EQUAL(3U, iqueue.size());
+
+      CHECK(iqueue.pop(i));
+      CHECK_EQUAL(2, i);
+      CHECK_EQUAL(2U, iqueue.size());
+
+      CHECK(iqueue.pop(i));
+      CHECK_EQUAL(3, i);
+      CHECK_EQUAL(1U, iqueue.size());
+
+      CHECK(iqueue.pop(i));
+      CHECK_EQUAL(4, i);
+      CHECK_EQUAL(0U, iqueue.size());
+
+      CHECK(!iqueue.pop(i));
+      CHECK(!iqueue.pop(i));
+    }
+
+    //*************************************************************************
+    TEST(test_size_push_pop_void)
+    {
+      etl::queue_spsc_atomic_padded<int, 4> queue;
+
+      CHECK_EQUAL(0U, queue.size());
+
+      queue.push(1);
+      CHECK_EQUAL(1U, queue.size());
+
+      queue.push(2);
+      CHECK_EQUAL(2U, queue.size());
+
+      queue.push(3);
+      CHECK_EQUAL(3U, queue.size());
+
+      queue.push(4);
+      CHECK_EQUAL(4U, queue.size());
+
+      CHECK(!queue.push(5));
+      CHECK(!queue.push(5));
+
+      CHECK(queue.pop());
+      CHECK_EQUAL(3U, queue.size());
+
+      CHECK(queue.pop());
+      CHECK_EQUAL(2U, queue.size());
+
+      CHECK(queue.pop());
+      CHECK_EQUAL(1U, queue.size());
+
+      CHECK(queue.pop());
+      CHECK_EQUAL(0U, queue.size());
+
+      CHECK(!queue.pop());
+      CHECK(!queue.pop());
+    }
+
+    //*************************************************************************
+    TEST(test_multiple_emplace)
+    {
+      etl::queue_spsc_atomic_padded<Data, 4> queue;
+
+      queue.emplace(1);
+      queue.emplace(1, 2);
+      queue.emplace(1, 2, 3);
+      queue.emplace(1, 2, 3, 4);
+
+      CHECK_EQUAL(4U, queue.size());
+
+      Data popped;
+
+      queue.pop(popped);
+      CHECK(popped == Data(1, 2, 3, 4));
+      queue.pop(popped);
+      CHECK(popped == Data(1, 2, 3, 4));
+      queue.pop(popped);
+      CHECK(popped == Data(1, 2, 3, 4));
+      queue.pop(popped);
+      CHECK(popped == Data(1, 2, 3, 4));
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      etl::queue_spsc_atomic_padded<int, 4> queue;
+
+      CHECK_EQUAL(0U, queue.size());
+
+      queue.push(1);
+      queue.push(2);
+      queue.clear();
+      CHECK_EQUAL(0U, queue.size());
+
+      // Do it again to check that clear() didn't screw up the internals.
+      queue.push(1);
+      queue.push(2);
+      CHECK_EQUAL(2U, queue.size());
+      queue.clear();
+      CHECK_EQUAL(0U, queue.size());
+    }
+
+    //*************************************************************************
+    TEST(test_empty)
+    {
+      etl::queue_spsc_atomic_padded<int, 4> queue;
+      CHECK(queue.empty());
+
+      queue.push(1);
+      CHECK(!queue.empty());
+
+      queue.clear();
+      CHECK(queue.empty());
+
+      queue.push(1);
+      CHECK(!queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_full)
+    {
+      etl::queue_spsc_atomic_padded<int, 4> queue;
+      CHECK(!queue.full());
+
+      queue.push(1);
+      queue.push(2);
+      queue.push(3);
+      queue.push(4);
+      CHECK(queue.full());
+
+      queue.clear();
+      CHECK(!queue.full());
+
+      queue.push(1);
+      queue.push(2);
+      queue.push(3);
+      queue.push(4);
+      CHECK(queue.full());
+    }
+
+    //*************************************************************************
+    TEST(test_size_after_wrap_around)
+    {
+      etl::queue_spsc_atomic_padded<int, 4> queue;
+
+      queue.push(1);
+      queue.push(2);
+      queue.push(3);
+      queue.push(4);
+
+      int i;
+      queue.pop(i);
+      queue.pop(i);
+      queue.pop(i);
+
+      // The write index wraps to the start of the buffer.
+      queue.push(5);
+      queue.push(6);
+
+      CHECK_EQUAL(3U, queue.size());
+      CHECK_EQUAL(1U, queue.available());
+      CHECK(!queue.full());
+
+      queue.push(7);
+      CHECK_EQUAL(4U, queue.size());
+      CHECK(queue.full());
+      CHECK(!queue.push(8));
+
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(4, i);
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(5, i);
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(6, i);
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(7, i);
+      CHECK(!queue.pop(i));
+      CHECK_EQUAL(0U, queue.size());
+    }
+
+    //*************************************************************************
+    TEST(test_producer_consumer_threads)
+    {
+      static const int LENGTH = 200000;
+
+      etl::queue_spsc_atomic_padded<int, 16> queue;
+
+      std::thread producer([&queue]()
+      {
+        for (int i = 0; i < LENGTH; ++i)
+        {
+          while (!queue.push(i))
+          {
+            std::this_thread::yield();
+          }
+        }
+      });
+
+      int  expected = 0;
+      bool in_order = true;
+
+      while (expected < LENGTH)
+      {
+        int value;
+
+        if (queue.pop(value))
+        {
+          in_order = in_order && (value == expected);
+          ++expected;
+        }
+        else
+        {
+          std::this_thread::yield();
+        }
+      }
+
+      producer.join();
+
+      CHECK(in_order);
+      CHECK(queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_push_pop_batch)
+    {
+      etl::queue_spsc_atomic_padded<int, 4> queue;
+
+      int input[6] = { 1, 2, 3, 4, 5, 6 };
+      int output[6] = { 0, 0, 0, 0, 0, 0 };
+
+      CHECK_EQUAL(4U, queue.push(input, 6));
+      CHECK_EQUAL(4U, queue.size());
+      CHECK_EQUAL(0U, queue.push(input, 1));
+
+      CHECK_EQUAL(3U, queue.pop(output, 3));
+      CHECK_EQUAL(1, output[0]);
+      CHECK_EQUAL(2, output[1]);
+      CHECK_EQUAL(3, output[2]);
+
+      // Wraps around the end of the buffer.
+      CHECK_EQUAL(2U, queue.push(input + 4, 2));
+      CHECK_EQUAL(3U, queue.size());
+
+      CHECK_EQUAL(3U, queue.pop(output, 6));
+      CHECK_EQUAL(4, output[0]);
+      CHECK_EQUAL(5, output[1]);
+      CHECK_EQUAL(6, output[2]);
+
+      CHECK_EQUAL(0U, queue.pop(output, 6));
+      CHECK(queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_write_reserve_commit_read_peek_release)
+    {
+      etl::queue_spsc_atomic_padded<int, 4> queue;
+
+      etl::array_view<int> write_view = queue.write_reserve();
+      CHECK_EQUAL(4U, write_view.size());
+
+      write_view[0] = 1;
+      write_view[1] = 2;
+      write_view[2] = 3;
+      queue.write_commit(3);
+      CHECK_EQUAL(3U, queue.size());
+
+      etl::const_array_view<int> read_view = queue.read_peek();
+      CHECK_EQUAL(3U, read_view.size());
+      CHECK_EQUAL(1, read_view[0]);
+      CHECK_EQUAL(2, read_view[1]);
+      CHECK_EQUAL(3, read_view[2]);
+
+      queue.read_release(2);
+      CHECK_EQUAL(1U, queue.size());
+
+      write_view = queue.write_reserve();
+      CHECK(write_view.size() >= 1U);
+      write_view[0] = 4;
+      queue.write_commit(1);
+
+      read_view = queue.read_peek();
+      CHECK_EQUAL(2U, read_view.size());
+      CHECK_EQUAL(3, read_view[0]);
+      CHECK_EQUAL(4, read_view[1]);
+
+      queue.read_release(2);
+      CHECK(queue.empty());
+      CHECK_EQUAL(0U, queue.read_peek().size());
+    }
+
+    //*************************************************************************
+    TEST(test_read_peek_release_wrap_around)
+    {
+      etl::queue_spsc_atomic_padded<int, 4> queue;
+
+      int input[4] = { 1, 2, 3, 4 };
+      int output[4];
+
+      queue.push(input, 3);
+      queue.pop(output, 3);
+
+      CHECK_EQUAL(4U, queue.push(input, 4));
+      CHECK(queue.full());
+      CHECK_EQUAL(0U, queue.write_reserve().size());
+
+      std::vector<int> values;
+
+      while (!queue.empty())
+      {
+        etl::const_array_view<int> view = queue.read_peek();
+        CHECK(view.size() != 0U);
+
+        values.insert(values.end(), view.begin(), view.end());
+        queue.read_release(view.size());
+      }
+
+      CHECK_EQUAL(4U, values.size());
+      CHECK(std::equal(values.begin(), values.end(), input));
+    }
+
+    //*************************************************************************
+    TEST(test_write_commit_read_release_more_than_the_view)
+    {
+      etl::queue_spsc_atomic_padded<int, 4> queue;
+
+      etl::array_view<int> write_view = queue.write_reserve();
+      CHECK_EQUAL(4U, write_view.size());
+
+      write_view[0] = 1;
+      write_view[1] = 2;
+      queue.write_commit(2);
+      CHECK_THROW(queue.write_commit(3), etl::queue_spsc_full);
+      CHECK_EQUAL(2U, queue.size());
+
+      etl::const_array_view<int> read_view = queue.read_peek();
+      CHECK_EQUAL(2U, read_view.size());
+
+      queue.read_release(1);
+      CHECK_THROW(queue.read_release(2), etl::queue_spsc_empty);
+      CHECK_EQUAL(1U, queue.size());
+    }
+
+    //=========================================================================
+#if REALTIME_TEST && defined(ETL_COMPILER_MICROSOFT)
+    #if defined(ETL_TARGET_OS_WINDOWS) // Only Windows priority is currently supported
+      #define FIX_PROCESSOR_AFFINITY1 SetThreadAffinityMask(GetCurrentThread(), 1);
+      #define FIX_PROCESSOR_AFFINITY2 SetThreadAffinityMask(GetCurrentThread(), 2);
+    #else
+      #error No thread priority modifier defined
+    #endif
+
+    size_t ticks = 0;
+
+    etl::queue_spsc_atomic_padded<int, 10> queue;
+
+    const size_t LENGTH = 1000000;
+
+    void timer_event()
+    {
+      FIX_PROCESSOR_AFFINITY1;
+
+      const size_t TICK = 1;
+      size_t tick = TICK;
+      ticks = 1;
+
+      while (ticks <= LENGTH)
+      {
+        if (queue.push(ticks))
+        {
+          ++ticks;
+        }
+      }
+    }
+
+    TEST(queue_threads)
+    {
+      FIX_PROCESSOR_AFFINITY2;
+
+      std::vector<int> tick_list;
+      tick_list.reserve(LENGTH);
+
+      std::thread t1(timer_event);
+
+      while (tick_list.size() < LENGTH)
+      {
+        int i;
+
+        if (queue.pop(i))
+        {
+          tick_list.push_back(i);
+        }
+      }
+
+      // Join the thread with the main thread
+      t1.join();
+
+      CHECK_EQUAL(LENGTH, tick_list.size());
+
+      for (size_t i = 0; i < LENGTH; ++i)
+      {
+        CHECK_EQUAL(i + 1, tick_list[i]);
+      }
+    }
+#endif
+  };
+}
@@ -34,6 +34,7 @@ SOFTWARE.
 #include <thread>
 #include <mutex>
 #include <vector>
+#include <algorithm>
 
 #if defined(ETL_COMPILER_MICROSOFT)
 #include <Windows.h>
@@ -534,6 +535,157 @@ namespace
       CHECK(!access.called_unlock);
     }
 
+    //*************************************************************************
+    TEST(test_push_pop_batch)
+    {
+      etl::queue_spsc_locked<int, 4> queue(lock, unlock);
+
+      int input[6] = { 1, 2, 3, 4, 5, 6 };
+      int output[6] = { 0, 0, 0, 0, 0, 0 };
+
+      CHECK_EQUAL(4U, queue.push(input, 6));
+      CHECK_EQUAL(4U, queue.size());
+      CHECK_EQUAL(0U, queue.push(input, 1));
+
+      CHECK_EQUAL(3U, queue.pop(output, 3));
+      CHECK_EQUAL(1, output[0]);
+      CHECK_EQUAL(2, output[1]);
+      CHECK_EQUAL(3, output[2]);
+
+      // Wraps around the end of the buffer.
+      CHECK_EQUAL(2U, queue.push(input + 4, 2));
+      CHECK_EQUAL(3U, queue.size());
+
+      CHECK_EQUAL(3U, queue.pop(output, 6));
+      CHECK_EQUAL(4, output[0]);
+      CHECK_EQUAL(5, output[1]);
+      CHECK_EQUAL(6, output[2]);
+
+      CHECK_EQUAL(0U, queue.pop(output, 6));
+      CHECK(queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_write_reserve_commit_read_peek_release)
+    {
+      etl::queue_spsc_locked<int, 4> queue(lock, unlock);
+
+      etl::array_view<int> write_view = queue.write_reserve();
+      CHECK_EQUAL(4U, write_view.size());
+
+      write_view[0] = 1;
+      write_view[1] = 2;
+      write_view[2] = 3;
+      queue.write_commit(3);
+      CHECK_EQUAL(3U, queue.size());
+
+      etl::const_array_view<int> read_view = queue.read_peek();
+      CHECK_EQUAL(3U, read_view.size());
+      CHECK_EQUAL(1, read_view[0]);
+      CHECK_EQUAL(2, read_view[1]);
+      CHECK_EQUAL(3, read_view[2]);
+
+      queue.read_release(2);
+      CHECK_EQUAL(1U, queue.size());
+
+      write_view = queue.write_reserve();
+      CHECK(write_view.size() >= 1U);
+      write_view[0] = 4;
+      queue.write_commit(1);
+
+      read_view = queue.read_peek();
+      CHECK_EQUAL(2U, read_view.size());
+      CHECK_EQUAL(3, read_view[0]);
+      CHECK_EQUAL(4, read_view[1]);
+
+      queue.read_release(2);
+      CHECK(queue.empty());
+      CHECK_EQUAL(0U, queue.read_peek().size());
+    }
+
+    //*************************************************************************
+    TEST(test_read_peek_release_wrap_around)
+    {
+      etl::queue_spsc_locked<int, 4> queue(lock, unlock);
+
+      int input[4] = { 1, 2, 3, 4 };
+      int output[4];
+
+      queue.push(input, 3);
+      queue.pop(output, 3);
+
+      CHECK_EQUAL(4U, queue.push(input, 4));
+      CHECK(queue.full());
+      CHECK_EQUAL(0U, queue.write_reserve().size());
+
+      std::vector<int> values;
+
+      while (!queue.empty())
+      {
+        etl::const_array_view<int> view = queue.read_peek();
+        CHECK(view.size() != 0U);
+
+        values.insert(values.end(), view.begin(), view.end());
+        queue.read_release(view.size());
+      }
+
+      CHECK_EQUAL(4U, values.size());
+      CHECK(std::equal(values.begin(), values.end(), input));
+    }
+
+    //*************************************************************************
+    TEST(test_write_commit_read_release_more_than_the_view)
+    {
+      etl::queue_spsc_locked<int, 4> queue(lock, unlock);
+
+      etl::array_view<int> write_view = queue.write_reserve();
+      CHECK_EQUAL(4U, write_view.size());
+
+      write_view[0] = 1;
+      write_view[1] = 2;
+      queue.write_commit(2);
+      access.clear();
+      CHECK_THROW(queue.write_commit(3), etl::queue_spsc_full);
+      CHECK(!access.called_lock);
+      CHECK_EQUAL(2U, queue.size());
+
+      etl::const_array_view<int> read_view = queue.read_peek();
+      CHECK_EQUAL(2U, read_view.size());
+
+      queue.read_release(1);
+      access.clear();
+      CHECK_THROW(queue.read_release(2), etl::queue_spsc_empty);
+      CHECK(!access.called_lock);
+      CHECK_EQUAL(1U, queue.size());
+    }
+
+    //*************************************************************************
+    TEST(test_push_pop_batch_locking)
+    {
+      etl::queue_spsc_locked<int, 4> queue(lock, unlock);
+
+      int input[2] = { 1, 2 };
+      int output[2] = { 0, 0 };
+
+      access.clear();
+      CHECK_EQUAL(2U, queue.push_from_unlocked(input, 2));
+      CHECK(!access.called_lock);
+      CHECK(!access.called_unlock);
+
+      access.clear();
+      CHECK_EQUAL(1U, queue.pop(output, 1));
+      CHECK(access.called_lock);
+      CHECK(access.called_unlock);
+
+      access.clear();
+      CHECK_EQUAL(1U, queue.pop_from_unlocked(output + 1, 2));
+      CHECK(!access.called_lock);
+      CHECK(!access.called_unlock);
+
+      CHECK_EQUAL(1, output[0]);
+      CHECK_EQUAL(2, output[1]);
+    }
+
     //=========================================================================
 #if REALTIME_TEST && defined(ETL_COMPILER_MICROSOFT)
   #if defined(ETL_TARGET_OS_WINDOWS) // Only Windows priority is currently supported
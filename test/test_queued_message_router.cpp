@@ -0,0 +1,333 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+
+#include "etl/queued_message_router.h"
+#include "etl/message_bus.h"
+#include "etl/queue_spsc_atomic.h"
+
+#include <vector>
+#include <thread>
+#include <atomic>
+
+namespace
+{
+  enum
+  {
+    MESSAGE1,
+    MESSAGE2,
+    MESSAGE3
+  };
+
+  enum
+  {
+    ROUTER1 = 1,
+    ROUTER2,
+    SENDER
+  };
+
+  const size_t PRODUCERS = 3;
+
+  struct Message1 : public etl::message<MESSAGE1>
+  {
+    Message1(size_t producer_, int value_)
+      : producer(producer_),
+        value(value_)
+    {
+    }
+
+    size_t producer;
+    int    value;
+  };
+
+  struct Message2 : public etl::message<MESSAGE2>
+  {
+  };
+
+  struct Message3 : public etl::message<MESSAGE3>
+  {
+  };
+
+  //***************************************************************************
+  // Accepts Message1 and Message2 and replies to Message2.
+  //***************************************************************************
+  class Router : public etl::message_router<Router, Message1, Message2>
+  {
+  public:
+
+    Router(etl::message_router_id_t id)
+      : message_router(id),
+        message1_count(0),
+        message2_count(0),
+        unknown_count(0),
+        in_order(true)
+    {
+      for (size_t i = 0; i < PRODUCERS; ++i)
+      {
+        last_value[i] = -1;
+      }
+    }
+
+    void on_receive(etl::imessage_router&, const Message1& msg)
+    {
+      ++message1_count;
+      values.push_back(msg.value);
+
+      if (msg.value <= last_value[msg.producer])
+      {
+        in_order = false;
+      }
+
+      last_value[msg.producer] = msg.value;
+    }
+
+    void on_receive(etl::imessage_router& sender, const Message2&)
+    {
+      ++message2_count;
+      etl::send_message(*this, sender, Message3());
+    }
+
+    void on_receive_unknown(etl::imessage_router&, const etl::imessage&)
+    {
+      ++unknown_count;
+    }
+
+    int message1_count;
+    int message2_count;
+    int unknown_count;
+    bool in_order;
+    int last_value[PRODUCERS];
+    std::vector<int> values;
+  };
+
+  //***************************************************************************
+  // Counts the replies.
+  //***************************************************************************
+  class Sender : public etl::message_router<Sender, Message3>
+  {
+  public:
+
+    Sender()
+      : message_router(SENDER),
+        message3_count(0)
+    {
+    }
+
+    void on_receive(etl::imessage_router&, const Message3&)
+    {
+      ++message3_count;
+    }
+
+    void on_receive_unknown(etl::imessage_router&, const etl::imessage&)
+    {
+    }
+
+    int message3_count;
+  };
+
+  SUITE(test_queued_message_router)
+  {
+    //=========================================================================
+    TEST(test_receive_is_deferred)
+    {
+      Router router(ROUTER1);
+      etl::queued_message_router<Router, 4> queued_router(router);
+
+      CHECK_EQUAL(ROUTER1, queued_router.get_message_router_id());
+      CHECK(queued_router.accepts(MESSAGE1));
+      CHECK(queued_router.accepts(MESSAGE2));
+      CHECK(!queued_router.accepts(MESSAGE3));
+
+      Message1 message(0, 1);
+      queued_router.receive(message);
+      message.value = 2;
+      queued_router.receive(message);
+
+      // Nothing is handled until the queue is processed.
+      CHECK_EQUAL(0, router.message1_count);
+
+      CHECK_EQUAL(2U, queued_router.process_queue());
+      CHECK_EQUAL(2, router.message1_count);
+      CHECK_EQUAL(1, router.values[0]);
+      CHECK_EQUAL(2, router.values[1]);
+
+      CHECK_EQUAL(0U, queued_router.process_queue());
+      CHECK(!queued_router.process_one());
+    }
+
+    //=========================================================================
+    TEST(test_source_is_kept)
+    {
+      Router router(ROUTER1);
+      Sender sender;
+      etl::queued_message_router<Router, 4> queued_router(router);
+
+      etl::send_message(sender, queued_router, Message2());
+      etl::send_message(sender, queued_router, Message2());
+
+      CHECK_EQUAL(0, sender.message3_count);
+
+      CHECK(queued_router.process_one());
+      CHECK_EQUAL(1, router.message2_count);
+      CHECK_EQUAL(1, sender.message3_count);
+
+      CHECK(queued_router.process_one());
+      CHECK_EQUAL(2, sender.message3_count);
+    }
+
+    //=========================================================================
+    TEST(test_unaccepted_is_ignored)
+    {
+      Router router(ROUTER1);
+      etl::queued_message_router<Router, 4> queued_router(router);
+
+      CHECK(queued_router.post(etl::null_message_router::instance(), Message3()));
+
+      CHECK_EQUAL(0U, queued_router.process_queue());
+      CHECK_EQUAL(0, router.unknown_count);
+    }
+
+    //=========================================================================
+    TEST(test_full)
+    {
+      Router router(ROUTER1);
+      etl::queued_message_router<Router, 2, etl::queue_spsc_atomic> queued_router(router);
+
+      etl::imessage_router& source = etl::null_message_router::instance();
+
+      CHECK(queued_router.post(source, Message1(0, 1)));
+      CHECK(queued_router.post(source, Message1(0, 2)));
+      CHECK(!queued_router.post(source, Message1(0, 3)));
+
+      CHECK_EQUAL(2U, queued_router.process_queue());
+      CHECK(queued_router.post(source, Message1(0, 4)));
+
+      queued_router.clear();
+      CHECK_EQUAL(0U, queued_router.process_queue());
+
+      CHECK_EQUAL(2, router.message1_count);
+    }
+
+    //=========================================================================
+    TEST(test_message_bus)
+    {
+      Router router1(ROUTER1);
+      Router router2(ROUTER2);
+      etl::queued_message_router<Router, 8> queued_router1(router1);
+
+      etl::message_bus<2> bus;
+
+      bus.subscribe(queued_router1);
+      bus.subscribe(router2);
+
+      bus.receive(Message1(0, 1));
+      bus.receive(ROUTER1, Message1(0, 2));
+      bus.receive(ROUTER2, Message1(0, 3));
+
+      // router2 is called directly, router1 through its queue.
+      CHECK_EQUAL(0, router1.message1_count);
+      CHECK_EQUAL(2, router2.message1_count);
+
+      CHECK_EQUAL(2U, queued_router1.process_queue());
+      CHECK_EQUAL(2, router1.message1_count);
+      CHECK_EQUAL(1, router1.values[0]);
+      CHECK_EQUAL(2, router1.values[1]);
+    }
+
+    //=========================================================================
+    TEST(test_concurrent_producers)
+    {
+      const int COUNT = 10000;
+
+      Router router1(ROUTER1);
+      Router router2(ROUTER2);
+      etl::queued_message_router<Router, 64> queued_router1(router1);
+      etl::queued_message_router<Router, 64> queued_router2(router2);
+
+      std::atomic<size_t> producers_running(PRODUCERS);
+      std::vector<std::thread> threads;
+
+      // Producers.
+      for (size_t p = 0; p < PRODUCERS; ++p)
+      {
+        threads.push_back(std::thread([&, p]()
+        {
+          for (int i = 0; i < COUNT; ++i)
+          {
+            Message1 message(p, i);
+
+            while (!queued_router1.post(etl::null_message_router::instance(), message))
+            {
+              std::this_thread::yield();
+            }
+
+            while (!queued_router2.post(etl::null_message_router::instance(), message))
+            {
+              std::this_thread::yield();
+            }
+          }
+
+          --producers_running;
+        }));
+      }
+
+      // One worker per router.
+      etl::queued_message_router<Router, 64>* queued_routers[] = { &queued_router1, &queued_router2 };
+
+      for (size_t w = 0; w < 2; ++w)
+      {
+        etl::queued_message_router<Router, 64>* p_queued_router = queued_routers[w];
+
+        threads.push_back(std::thread([&producers_running, p_queued_router]()
+        {
+          bool done = false;
+
+          while (!done)
+          {
+            // Check before draining, so that the last messages are seen.
+            done = (producers_running == 0);
+
+            p_queued_router->process_queue();
+            std::this_thread::yield();
+          }
+        }));
+      }
+
+      for (size_t i = 0; i < threads.size(); ++i)
+      {
+        threads[i].join();
+      }
+
+      CHECK_EQUAL(int(PRODUCERS) * COUNT, router1.message1_count);
+      CHECK_EQUAL(int(PRODUCERS) * COUNT, router2.message1_count);
+      CHECK(router1.in_order);
+      CHECK(router2.in_order);
+    }
+  };
+}
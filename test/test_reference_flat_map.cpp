@@ -531,6 +531,32 @@ namespace
       CHECK_THROW(data.insert(excess_data.begin(), excess_data.end()), etl::flat_map_full);
     }
 
+    //*************************************************************************
+    TEST(test_insert_range_merge)
+    {
+      typedef std::pair<const int, int> Element;
+
+      std::map<int, int> compare_data;
+      etl::reference_flat_map<int, int, SIZE> data;
+
+      Element initial[] = { Element(1, 10), Element(3, 30), Element(5, 50) };
+      Element batch[]   = { Element(4, 40), Element(3, 99), Element(2, 20), Element(4, 41), Element(0, 0) };
+
+      data.insert(std::begin(initial), std::end(initial));
+      compare_data.insert(std::begin(initial), std::end(initial));
+
+      data.insert(std::begin(batch), std::end(batch));
+      compare_data.insert(std::begin(batch), std::end(batch));
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+
+      bool isEqual = std::equal(data.begin(), data.end(), compare_data.begin());
+      CHECK(isEqual);
+
+      // The first of the duplicates in the range is the one referenced.
+      CHECK_EQUAL(&batch[0], &*data.find(4));
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_erase_key)
     {
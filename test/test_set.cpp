@@ -479,6 +479,63 @@ namespace
       CHECK_THROW(data.insert(excess_data.begin(), excess_data.end()), etl::set_full);
     }
 
+    //*************************************************************************
+    TEST(test_insert_range_sorted_builds_balanced_tree)
+    {
+      std::vector<int> values;
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        values.push_back(i / 2 * 2);
+      }
+
+      values.push_back(7);
+      values.push_back(1);
+
+      etl::set<int, 1000> data(values.begin(), values.end());
+      std::set<int>       compare_data(values.begin(), values.end());
+
+      for (int key = 0; key < 1000; key += 3)
+      {
+        data.erase(key);
+        compare_data.erase(key);
+        data.insert(key + 1);
+        compare_data.insert(key + 1);
+      }
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+    }
+
+    //*************************************************************************
+    TEST(test_insert_hint_end_appends)
+    {
+      etl::set<int, 1000> data;
+      std::set<int>       compare_data;
+
+      for (int i = 0; i < 500; ++i)
+      {
+        int value = i * 2;
+        etl::set<int, 1000>::iterator itr = data.insert(data.end(), value);
+        compare_data.insert(compare_data.end(), value);
+
+        CHECK_EQUAL(value, *itr);
+      }
+
+      int value = 501;
+      data.insert(data.cend(), value);
+      compare_data.insert(value);
+
+      for (int key = 0; key < 1000; key += 3)
+      {
+        data.erase(key);
+        compare_data.erase(key);
+      }
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_emplace_value)
     {
@@ -3650,5 +3650,69 @@ namespace
       text.clear_truncated();
       CHECK(!text.truncated());
     }
+
+    //*************************************************************************
+    TEST(test_search_long_text)
+    {
+      // Long enough for the block compares, with many near misses.
+      Compare_Text compare_text;
+
+      for (size_t i = 0; i < 1000; ++i)
+      {
+        compare_text += value_t(STR('a') + ((i * 7) % 5));
+      }
+
+      compare_text += STR("abcdx");
+      compare_text += value_t(0x1F600);
+      compare_text += STR("ab");
+
+      etl::u32string<1100> text(compare_text.c_str(), compare_text.size());
+
+      const value_t* needles[] = { STR("abcdx"), STR("cd"), STR("e"), STR("aaaa"), STR("b"), STR("") };
+      const value_t* sets[]    = { STR("xyz"), STR("ed"), STR("abcde"), STR("q"), STR("") };
+      const size_t positions[] = { 0, 1, 500, 999, 1004, 1006, 1008, 2000, Compare_Text::npos };
+
+      const value_t high[] = { value_t(0x1F600), STR('b'), 0 };
+
+      for (size_t p = 0; p < (sizeof(positions) / sizeof(positions[0])); ++p)
+      {
+        const size_t position = positions[p];
+
+        for (size_t n = 0; n < (sizeof(needles) / sizeof(needles[0])); ++n)
+        {
+          CHECK_EQUAL(compare_text.find(needles[n], position), text.find(needles[n], position));
+        }
+
+        for (size_t s = 0; s < (sizeof(sets) / sizeof(sets[0])); ++s)
+        {
+          CHECK_EQUAL(compare_text.find_first_of(sets[s], position), text.find_first_of(sets[s], position));
+          CHECK_EQUAL(compare_text.find_last_of(sets[s], position), text.find_last_of(sets[s], position));
+          CHECK_EQUAL(compare_text.find_first_not_of(sets[s], position), text.find_first_not_of(sets[s], position));
+          CHECK_EQUAL(compare_text.find_last_not_of(sets[s], position), text.find_last_not_of(sets[s], position));
+        }
+
+        CHECK_EQUAL(compare_text.find(value_t(0x1F600), position), text.find(value_t(0x1F600), position));
+        CHECK_EQUAL(compare_text.find_first_of(high, position), text.find_first_of(high, position));
+        CHECK_EQUAL(compare_text.find_last_not_of(STR("ab"), position), text.find_last_not_of(STR("ab"), position));
+      }
+
+      for (size_t n = 0; n < (sizeof(needles) / sizeof(needles[0])); ++n)
+      {
+        CHECK_EQUAL(compare_text.rfind(needles[n]), text.rfind(needles[n]));
+      }
+
+      // Compare texts that differ at one position.
+      compare_text.resize(1000);
+      text.assign(compare_text.c_str(), compare_text.size());
+
+      Compare_Text compare_other(compare_text);
+      compare_other[700] = STR('z');
+      etl::u32string<1100> other(compare_other.c_str(), compare_other.size());
+
+      CHECK(compares_agree(compare_text.compare(compare_other), text.compare(other)));
+      CHECK(compares_agree(compare_other.compare(compare_text), other.compare(text)));
+      CHECK_EQUAL(0, text.compare(text));
+      CHECK(text.compare(0, 999, text) < 0);
+    }
   };
 }
@@ -633,6 +633,39 @@ namespace
 
       CHECK_EQUAL(1U, view.rfind(s3, 5, 2));
       CHECK_EQUAL(View::npos, view.rfind(s4, 0, 11));
+
+      CHECK_EQUAL(View::npos, view.rfind("xy", 5));
+      CHECK_EQUAL(View::npos, view.rfind('x', 5));
+    }
+
+    //*************************************************************************
+    TEST(test_search_long_text)
+    {
+      std::string text;
+
+      for (size_t i = 0; i < 1000; ++i)
+      {
+        text += char('a' + ((i * 7) % 5));
+      }
+
+      text += "abcdx";
+      text += char(0xE9);
+
+      View view(text.data(), text.size());
+
+      CHECK_EQUAL(text.find("abcdx"), view.find("abcdx"));
+      CHECK_EQUAL(text.find("abcdx", 1001), view.find("abcdx", 1001));
+      CHECK_EQUAL(text.find(char(0xE9)), view.find(char(0xE9)));
+      CHECK_EQUAL(text.find_first_of("xyz"), view.find_first_of("xyz"));
+      CHECK_EQUAL(text.find_first_not_of("abcde"), view.find_first_not_of("abcde"));
+      CHECK_EQUAL(text.find_last_of("ab", 999), view.find_last_of("ab", 999));
+      CHECK_EQUAL(text.find_last_not_of("abcde\xE9x"), view.find_last_not_of("abcde\xE9x"));
+
+      View other(view);
+      CHECK(view == other);
+      CHECK_EQUAL(0, view.compare(other));
+      CHECK(view.substr(0, 999) < view);
+      CHECK(view.compare(view.substr(0, 999)) > 0);
     }
 
     //*************************************************************************
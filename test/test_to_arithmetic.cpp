@@ -0,0 +1,359 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+
+#include <limits>
+#include <random>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "etl/to_arithmetic.h"
+#include "etl/to_string.h"
+#include "etl/cstring.h"
+#include "etl/wstring.h"
+#include "etl/u16string.h"
+#include "etl/u32string.h"
+#include "etl/string_view.h"
+#include "etl/format_spec.h"
+#include "etl/wformat_spec.h"
+
+namespace
+{
+  typedef etl::to_arithmetic_status Status;
+
+  //***********************************
+  template <typename T>
+  etl::to_arithmetic_result<T> parse(const char* text, uint32_t radix = 10U)
+  {
+    return etl::to_arithmetic<T>(etl::string_view(text), radix);
+  }
+
+  //***********************************
+  template <typename T>
+  T value_of(const char* text)
+  {
+    return etl::to_arithmetic<T>(etl::string_view(text)).value();
+  }
+
+  //***********************************
+  template <typename T>
+  bool same_bits(T lhs, T rhs)
+  {
+    return memcmp(&lhs, &rhs, sizeof(T)) == 0;
+  }
+
+  SUITE(test_to_arithmetic)
+  {
+    //*************************************************************************
+    TEST(test_decimal_integrals)
+    {
+      CHECK_EQUAL(0,                       value_of<int>("0"));
+      CHECK_EQUAL(123,                     value_of<int>("123"));
+      CHECK_EQUAL(-123,                    value_of<int>("-123"));
+      CHECK_EQUAL(123,                     value_of<int>("000000000000000123"));
+      CHECK_EQUAL(127,                     value_of<int8_t>("127"));
+      CHECK_EQUAL(-128,                    value_of<int8_t>("-128"));
+      CHECK_EQUAL(255U,                    value_of<uint8_t>("255"));
+      CHECK_EQUAL(32767,                   value_of<int16_t>("32767"));
+      CHECK_EQUAL(-32768,                  value_of<int16_t>("-32768"));
+      CHECK_EQUAL(65535U,                  value_of<uint16_t>("65535"));
+      CHECK_EQUAL(2147483647,              value_of<int32_t>("2147483647"));
+      CHECK_EQUAL(INT32_MIN,               value_of<int32_t>("-2147483648"));
+      CHECK_EQUAL(4294967295U,             value_of<uint32_t>("4294967295"));
+      CHECK_EQUAL(INT64_MAX,               value_of<int64_t>("9223372036854775807"));
+      CHECK_EQUAL(INT64_MIN,               value_of<int64_t>("-9223372036854775808"));
+      CHECK_EQUAL(UINT64_MAX,              value_of<uint64_t>("18446744073709551615"));
+      CHECK_EQUAL(12345678901234567890ULL, value_of<uint64_t>("12345678901234567890"));
+    }
+
+    //*************************************************************************
+    TEST(test_integral_overflow)
+    {
+      CHECK_EQUAL(Status::overflow, parse<int8_t>("128").status());
+      CHECK_EQUAL(Status::overflow, parse<int8_t>("-129").status());
+      CHECK_EQUAL(Status::overflow, parse<uint8_t>("256").status());
+      CHECK_EQUAL(Status::overflow, parse<int16_t>("32768").status());
+      CHECK_EQUAL(Status::overflow, parse<uint16_t>("65536").status());
+      CHECK_EQUAL(Status::overflow, parse<int32_t>("2147483648").status());
+      CHECK_EQUAL(Status::overflow, parse<int32_t>("-2147483649").status());
+      CHECK_EQUAL(Status::overflow, parse<uint32_t>("4294967296").status());
+      CHECK_EQUAL(Status::overflow, parse<int64_t>("9223372036854775808").status());
+      CHECK_EQUAL(Status::overflow, parse<int64_t>("-9223372036854775809").status());
+      CHECK_EQUAL(Status::overflow, parse<uint64_t>("18446744073709551616").status());
+      CHECK_EQUAL(Status::overflow, parse<uint64_t>("100000000000000000000").status());
+      CHECK_EQUAL(Status::overflow, parse<uint8_t>("100000000").status());
+      CHECK_EQUAL(Status::overflow, parse<uint8_t>("1FF", 16).status());
+    }
+
+    //*************************************************************************
+    TEST(test_integral_invalid)
+    {
+      CHECK_EQUAL(Status::invalid_format,     parse<int>("").status());
+      CHECK_EQUAL(Status::invalid_format,     parse<int>("-").status());
+      CHECK_EQUAL(Status::invalid_format,     parse<int>("+1").status());
+      CHECK_EQUAL(Status::invalid_format,     parse<int>(" 1").status());
+      CHECK_EQUAL(Status::invalid_format,     parse<int>("1 ").status());
+      CHECK_EQUAL(Status::invalid_format,     parse<int>("12a").status());
+      CHECK_EQUAL(Status::invalid_format,     parse<int>("1.5").status());
+      CHECK_EQUAL(Status::invalid_format,     parse<int>("0x10", 16).status());
+      CHECK_EQUAL(Status::invalid_format,     parse<int>("102", 2).status());
+      CHECK_EQUAL(Status::invalid_format,     parse<uint64_t>("1234567x12345678").status());
+      CHECK_EQUAL(Status::signed_to_unsigned, parse<unsigned>("-1").status());
+      CHECK_EQUAL(Status::invalid_radix,      parse<int>("1", 1).status());
+      CHECK_EQUAL(Status::invalid_radix,      parse<int>("1", 37).status());
+
+      CHECK(!parse<int>("x").has_value());
+      CHECK(parse<int>("1").has_value());
+    }
+
+    //*************************************************************************
+    TEST(test_radix)
+    {
+      CHECK_EQUAL(0x1E240,   parse<int>("1E240", 16).value());
+      CHECK_EQUAL(0x1E240,   parse<int>("1e240", 16).value());
+      CHECK_EQUAL(-0x80,     parse<int>("-80", 16).value());
+      CHECK_EQUAL(0361100,   parse<int>("361100", 8).value());
+      CHECK_EQUAL(123456,    parse<int>("11110001001000000", 2).value());
+      CHECK_EQUAL(35,        parse<int>("z", 36).value());
+      CHECK_EQUAL(UINT64_MAX, parse<uint64_t>("FFFFFFFFFFFFFFFF", 16).value());
+
+      etl::string_view view("1E240");
+      CHECK_EQUAL(0x1E240, etl::to_arithmetic<int>(view, etl::format_spec().hex()).value());
+      CHECK_EQUAL(Status::invalid_format, etl::to_arithmetic<int>(view, etl::format_spec().decimal()).status());
+    }
+
+    //*************************************************************************
+    TEST(test_integrals_round_trip)
+    {
+      std::mt19937_64 generator(3);
+      etl::string<70> str;
+
+      for (int i = 0; i < 20000; ++i)
+      {
+        const int64_t  value    = int64_t(generator()) >> (i % 64);
+        const uint32_t radixes[] = { 2, 8, 10, 16 };
+        const uint32_t radix    = radixes[i % 4];
+
+        etl::to_string(value, str, etl::format_spec().base(radix));
+        const int64_t expected = ((radix != 10) && (value < 0)) ? -value : value;
+
+        CHECK_EQUAL(expected, etl::to_arithmetic<int64_t>(str, radix).value());
+
+        etl::to_string(uint64_t(value), str, etl::format_spec().base(radix));
+        CHECK_EQUAL(uint64_t(value), etl::to_arithmetic<uint64_t>(str, radix).value());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_not_terminated)
+    {
+      const char text[] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+
+      CHECK_EQUAL(123,       etl::to_arithmetic<int>(etl::string_view(text, 3)).value());
+      CHECK_EQUAL(12345678,  etl::to_arithmetic<int>(text, 8).value());
+      CHECK_EQUAL(2.5,       etl::to_arithmetic<double>(etl::string_view("2.5e1", 3)).value());
+    }
+
+    //*************************************************************************
+    TEST(test_strings)
+    {
+      etl::string<20>    str("-1234567890");
+      etl::wstring<20>   wstr(L"-1234567890");
+      etl::u16string<20> u16str(u"-1234567890");
+      etl::u32string<20> u32str(U"-1234567890");
+
+      CHECK_EQUAL(-1234567890, etl::to_arithmetic<int32_t>(str).value());
+      CHECK_EQUAL(-1234567890, etl::to_arithmetic<int32_t>(wstr).value());
+      CHECK_EQUAL(-1234567890, etl::to_arithmetic<int32_t>(u16str).value());
+      CHECK_EQUAL(-1234567890, etl::to_arithmetic<int32_t>(u32str).value());
+      CHECK_EQUAL(-1234567890, etl::to_arithmetic<int32_t>(etl::u16string_view(u16str.data(), u16str.size())).value());
+
+      CHECK_EQUAL(0xABCD, etl::to_arithmetic<int>(etl::wstring<8>(L"abcd"), etl::wformat_spec().hex()).value());
+      CHECK_EQUAL(-0.25,  etl::to_arithmetic<double>(etl::u32string<8>(U"-25e-2")).value());
+
+      // A wide character that truncates to a digit.
+      const wchar_t wide[] = { L'1', wchar_t(0x0132), L'3', L'4', L'5', L'6', L'7', L'8', L'9' };
+      CHECK_EQUAL(Status::invalid_format, etl::to_arithmetic<int>(wide, 9).status());
+    }
+
+    //*************************************************************************
+    TEST(test_from_string)
+    {
+      int value = 42;
+
+      CHECK_EQUAL(Status::valid, etl::from_string(etl::string_view("-17"), value));
+      CHECK_EQUAL(-17, value);
+
+      CHECK_EQUAL(Status::invalid_format, etl::from_string(etl::string_view("17x"), value));
+      CHECK_EQUAL(-17, value);
+
+      CHECK_EQUAL(Status::valid, etl::from_string(etl::string<8>("ff"), value, etl::format_spec().hex()));
+      CHECK_EQUAL(255, value);
+
+      CHECK_EQUAL(Status::valid, etl::from_string(etl::string_view("11"), value, 2));
+      CHECK_EQUAL(3, value);
+
+      double d = 0.0;
+      CHECK_EQUAL(Status::valid, etl::from_string(etl::string<8>("1.5"), d));
+      CHECK_EQUAL(1.5, d);
+
+      CHECK_EQUAL(Status::invalid_radix, etl::from_string(etl::string<8>("1.5"), d, etl::format_spec().hex()));
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point)
+    {
+      CHECK(same_bits(0.0,     value_of<double>("0")));
+      CHECK(same_bits(-0.0,    value_of<double>("-0")));
+      CHECK(same_bits(-0.0,    value_of<double>("-0.000e10")));
+      CHECK_EQUAL(0.5,         value_of<double>(".5"));
+      CHECK_EQUAL(5.0,         value_of<double>("5."));
+      CHECK_EQUAL(1.5,         value_of<double>("1.5"));
+      CHECK_EQUAL(-1.5,        value_of<double>("-1.5"));
+      CHECK_EQUAL(0.1,         value_of<double>("0.1"));
+      CHECK_EQUAL(0.1f,        value_of<float>("0.1"));
+      CHECK_EQUAL(123456.789,  value_of<double>("123456.789"));
+      CHECK_EQUAL(1e20,        value_of<double>("1e20"));
+      CHECK_EQUAL(1e20,        value_of<double>("1E+20"));
+      CHECK_EQUAL(1.2e-5,      value_of<double>("1.2e-05"));
+      CHECK_EQUAL(1e23,        value_of<double>("1e23"));
+      CHECK_EQUAL(1.7976931348623157e308, value_of<double>("1.7976931348623157e308"));
+      CHECK_EQUAL(2.2250738585072014e-308, value_of<double>("2.2250738585072014e-308"));
+      CHECK_EQUAL(5e-324,      value_of<double>("5e-324"));
+      CHECK_EQUAL(3.4028235e38f, value_of<float>("3.4028235e38"));
+      CHECK_EQUAL(1e-45f,      value_of<float>("1e-45"));
+      CHECK_EQUAL(0.0,         value_of<double>("1e-400"));
+      CHECK_EQUAL(0.0,         value_of<double>("0e999999999"));
+      CHECK_EQUAL(0.5L,        value_of<long double>("0.5"));
+
+      CHECK(std::isinf(value_of<double>("inf")));
+      CHECK(std::isinf(value_of<double>("-Infinity")));
+      CHECK(value_of<double>("-inf") < 0.0);
+      CHECK(std::isnan(value_of<double>("nan")));
+      CHECK(std::isnan(value_of<float>("NaN")));
+
+      CHECK_EQUAL(Status::overflow,       parse<double>("1e309").status());
+      CHECK_EQUAL(Status::overflow,       parse<double>("-1.8e308").status());
+      CHECK_EQUAL(Status::overflow,       parse<float>("3.5e38").status());
+      CHECK_EQUAL(Status::invalid_format, parse<double>("").status());
+      CHECK_EQUAL(Status::invalid_format, parse<double>(".").status());
+      CHECK_EQUAL(Status::invalid_format, parse<double>("-").status());
+      CHECK_EQUAL(Status::invalid_format, parse<double>("1e").status());
+      CHECK_EQUAL(Status::invalid_format, parse<double>("1e+").status());
+      CHECK_EQUAL(Status::invalid_format, parse<double>("1.2.3").status());
+      CHECK_EQUAL(Status::invalid_format, parse<double>("1,5").status());
+      CHECK_EQUAL(Status::invalid_format, parse<double>("infinite").status());
+      CHECK_EQUAL(Status::invalid_radix,  parse<double>("1", 16).status());
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_hard_cases)
+    {
+      // Ties to even.
+      CHECK_EQUAL(9007199254740992.0, value_of<double>("9007199254740993"));
+      CHECK_EQUAL(9007199254740996.0, value_of<double>("9007199254740995"));
+      CHECK_EQUAL(9007199254740994.0, value_of<double>("9007199254740993.0000000000000000000001"));
+
+      // More digits than fit in 64 bits.
+      CHECK_EQUAL(0.1, value_of<double>("0.1000000000000000055511151231257827021181583404541015625"));
+      CHECK_EQUAL(1.0, value_of<double>("1.00000000000000011102230246251565404236316680908203125"));
+      CHECK_EQUAL(1.0000000000000002, value_of<double>("1.00000000000000011102230246251565404236316680908203125000001"));
+      CHECK_EQUAL(123456789012345678901234567890.0, value_of<double>("123456789012345678901234567890"));
+
+      // Half way between zero and the smallest subnormal.
+      CHECK_EQUAL(0.0,    value_of<double>("2.4703282292062327208828439643411068618252990130716238221279284125033775363510437593264991818081799618989828234772285886546332835517796989819938739800539093906315035659515570226392290858392449105184435931802849936536152500319370457678249219365623669863658480757001585769269903706311928279558551332927834338409351978015531246597263579574622766465272827220056374006485499977096599470454020828166226237857393450736339007967761930577506740176324673600968951340535537458516661134223766678604162159680461914467291840300530057530849048765391711386591646239524912623653881879636239373280423891018672348497668235089863388587925628302755995657524455507255189313690836254779186948667994968324049705821028513185451396213837722826145437693412532098591327667236328125e-324"));
+      CHECK_EQUAL(5e-324, value_of<double>("2.4703282292062327208828439643411068618252990130716238221279284125033775363510437593264991818081799618989828234772285886546332835517796989819938739800539093906315035659515570226392290858392449105184435931802849936536152500319370457678249219365623669863658480757001585769269903706311928279558551332927834338409351978015531246597263579574622766465272827220056374006485499977096599470454020828166226237857393450736339007967761930577506740176324673600968951340535537458516661134223766678604162159680461914467291840300530057530849048765391711386591646239524912623653881879636239373280423891018672348497668235089863388587925628302755995657524455507255189313690836254779186948667994968324049705821028513185451396213837722826145437693412532098591327667236328125001e-324"));
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_matches_strtod)
+    {
+      std::mt19937_64 generator(4);
+      char text[64];
+
+      for (int i = 0; i < 100000; ++i)
+      {
+        // Random digits, up to 25 significant, with a random exponent.
+        const int digits   = 1 + int(generator() % 25);
+        const int point    = int(generator() % (digits + 1));
+        const int exponent = int(generator() % 660) - 340;
+
+        int length = 0;
+
+        for (int d = 0; d < digits; ++d)
+        {
+          if (d == point)
+          {
+            text[length++] = '.';
+          }
+
+          text[length++] = char('0' + (generator() % 10));
+        }
+
+        length += snprintf(text + length, sizeof(text) - length, "e%d", exponent);
+
+        const double expected = strtod(text, nullptr);
+
+        if (std::isfinite(expected))
+        {
+          CHECK_EQUAL(expected, etl::to_arithmetic<double>(text, size_t(length)).value());
+        }
+
+        const float expected_f = strtof(text, nullptr);
+
+        if (std::isfinite(expected_f))
+        {
+          CHECK_EQUAL(expected_f, etl::to_arithmetic<float>(text, size_t(length)).value());
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_round_trip)
+    {
+      std::mt19937_64 generator(5);
+      etl::string<32> str;
+
+      for (int i = 0; i < 100000; ++i)
+      {
+        uint64_t bits = generator();
+        double value;
+        memcpy(&value, &bits, sizeof(value));
+
+        if (std::isfinite(value))
+        {
+          etl::to_string(value, str);
+          CHECK(same_bits(value, etl::to_arithmetic<double>(str).value()));
+        }
+      }
+    }
+  };
+}
@@ -29,6 +29,12 @@ SOFTWARE.
 #include "UnitTest++.h"
 
 #include <ostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
 
 #include "etl/to_string.h"
 #include "etl/cstring.h"
@@ -239,6 +245,23 @@ namespace
       CHECK_EQUAL(etl::string<16>(STR("8000000000000000")), etl::to_string(int64_t(-9223372036854775807ll - 1), str, Format().base(16).width(16).fill(STR('0'))));
     }
 
+    //*************************************************************************
+    TEST(test_other_bases_no_append)
+    {
+      etl::string<16> str;
+
+      CHECK_EQUAL(etl::string<16>(STR("123")),           etl::to_string(27, str, Format().base(4)));
+      CHECK_EQUAL(etl::string<16>(STR("3333")),          etl::to_string(uint8_t(255), str, Format().base(4)));
+
+      CHECK_EQUAL(etl::string<16>(STR("V8")),            etl::to_string(1000, str, Format().base(32)));
+      CHECK_EQUAL(etl::string<16>(STR("v8")),            etl::to_string(1000, str, Format().base(32).upper_case(false)));
+      CHECK_EQUAL(etl::string<16>(STR("3VVVVVV")),       etl::to_string(uint32_t(4294967295ul), str, Format().base(32)));
+
+      CHECK_EQUAL(etl::string<16>(STR("ZZ")),            etl::to_string(1295, str, Format().base(36)));
+      CHECK_EQUAL(etl::string<16>(STR("zz")),            etl::to_string(1295, str, Format().base(36).upper_case(false)));
+      CHECK_EQUAL(etl::string<16>(STR("3W5E11264SGSF")), etl::to_string(uint64_t(18446744073709551615ull), str, Format().base(36)));
+    }
+
     //*************************************************************************
     TEST(test_named_format_no_append)
     {
@@ -249,5 +272,83 @@ namespace
       CHECK_EQUAL(etl::string<17>(STR("123456")),             etl::to_string(123456, str, Format().decimal()));
       CHECK_EQUAL(etl::string<17>(STR("1E240")),              etl::to_string(123456, str, Format().hex()));
     }
+
+    //*************************************************************************
+    TEST(test_floating_point_no_append)
+    {
+      etl::string<30> str;
+
+      CHECK_EQUAL(etl::string<30>(STR("0")),                        etl::to_string(0.0, str));
+      CHECK_EQUAL(etl::string<30>(STR("-0")),                       etl::to_string(-0.0, str));
+      CHECK_EQUAL(etl::string<30>(STR("0.1")),                      etl::to_string(0.1, str));
+      CHECK_EQUAL(etl::string<30>(STR("0.1")),                      etl::to_string(0.1f, str));
+      CHECK_EQUAL(etl::string<30>(STR("-1.5")),                     etl::to_string(-1.5, str));
+      CHECK_EQUAL(etl::string<30>(STR("123456.789")),               etl::to_string(123456.789, str));
+      CHECK_EQUAL(etl::string<30>(STR("0.3333333333333333")),       etl::to_string(1.0 / 3.0, str));
+      CHECK_EQUAL(etl::string<30>(STR("0.0001")),                   etl::to_string(0.0001, str));
+      CHECK_EQUAL(etl::string<30>(STR("1.2e-05")),                  etl::to_string(0.000012, str));
+      CHECK_EQUAL(etl::string<30>(STR("9007199254740992")),         etl::to_string(9007199254740992.0, str));
+      CHECK_EQUAL(etl::string<30>(STR("1e+20")),                    etl::to_string(1e20, str));
+      CHECK_EQUAL(etl::string<30>(STR("1.7976931348623157e+308")),  etl::to_string(1.7976931348623157e308, str));
+      CHECK_EQUAL(etl::string<30>(STR("5e-324")),                   etl::to_string(5e-324, str));
+      CHECK_EQUAL(etl::string<30>(STR("3.4028235e+38")),            etl::to_string(3.4028235e38f, str));
+      CHECK_EQUAL(etl::string<30>(STR("inf")),                      etl::to_string(std::numeric_limits<double>::infinity(), str));
+      CHECK_EQUAL(etl::string<30>(STR("-inf")),                     etl::to_string(-std::numeric_limits<float>::infinity(), str));
+      CHECK_EQUAL(etl::string<30>(STR("nan")),                      etl::to_string(std::numeric_limits<double>::quiet_NaN(), str));
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_format_append)
+    {
+      etl::string<30> str(STR("Result "));
+
+      CHECK_EQUAL(etl::string<30>(STR("Result -2.5")),      etl::to_string(-2.5, str, true));
+      CHECK_EQUAL(etl::string<30>(STR("Result -2.5  0.25")), etl::to_string(0.25, str, Format().width(6), true));
+
+      CHECK_EQUAL(etl::string<30>(STR("1.5###")),           etl::to_string(1.5, str, Format().width(6).fill(STR('#')).left_justified(true)));
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_round_trip)
+    {
+      std::mt19937_64 generator(1);
+      etl::string<32> str;
+
+      for (int i = 0; i < 100000; ++i)
+      {
+        uint64_t bits = generator();
+        double value;
+        memcpy(&value, &bits, sizeof(value));
+
+        if (std::isfinite(value))
+        {
+          etl::to_string(value, str);
+          CHECK_EQUAL(value, strtod(str.c_str(), nullptr));
+
+          float f = float(value / 1e300);
+          etl::to_string(f, str);
+          CHECK_EQUAL(f, strtof(str.c_str(), nullptr));
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_integrals_match_std)
+    {
+      std::mt19937_64 generator(2);
+      etl::string<32> str;
+
+      for (int i = 0; i < 10000; ++i)
+      {
+        int64_t value = int64_t(generator()) >> (i % 64);
+
+        CHECK_EQUAL(etl::string<32>(std::to_string(value).c_str()),           etl::to_string(value, str));
+        CHECK_EQUAL(etl::string<32>(std::to_string(uint64_t(value)).c_str()), etl::to_string(uint64_t(value), str));
+        CHECK_EQUAL(etl::string<32>(std::to_string(int32_t(value)).c_str()),  etl::to_string(int32_t(value), str));
+      }
+
+      CHECK_EQUAL(etl::string<32>(std::to_string(INT64_MIN).c_str()), etl::to_string(int64_t(INT64_MIN), str));
+      CHECK_EQUAL(etl::string<32>(std::to_string(INT32_MIN).c_str()), etl::to_string(int32_t(INT32_MIN), str));
+    }
   };
 }
@@ -29,6 +29,7 @@ SOFTWARE.
 #include "UnitTest++.h"
 
 #include <ostream>
+#include <limits>
 
 #include "etl/to_u32string.h"
 #include "etl/u32string.h"
@@ -250,5 +251,40 @@ namespace
       CHECK_EQUAL(etl::u32string<17>(STR("123456")),            etl::to_u32string(123456, str, Format().decimal()));
       CHECK_EQUAL(etl::u32string<17>(STR("1E240")),             etl::to_u32string(123456, str, Format().hex()));
     }
+
+    //*************************************************************************
+    TEST(test_floating_point_no_append)
+    {
+      etl::u32string<30> str;
+
+      CHECK_EQUAL(etl::u32string<30>(STR("0")),                        etl::to_u32string(0.0, str));
+      CHECK_EQUAL(etl::u32string<30>(STR("-0")),                       etl::to_u32string(-0.0, str));
+      CHECK_EQUAL(etl::u32string<30>(STR("0.1")),                      etl::to_u32string(0.1, str));
+      CHECK_EQUAL(etl::u32string<30>(STR("0.1")),                      etl::to_u32string(0.1f, str));
+      CHECK_EQUAL(etl::u32string<30>(STR("-1.5")),                     etl::to_u32string(-1.5, str));
+      CHECK_EQUAL(etl::u32string<30>(STR("123456.789")),               etl::to_u32string(123456.789, str));
+      CHECK_EQUAL(etl::u32string<30>(STR("0.3333333333333333")),       etl::to_u32string(1.0 / 3.0, str));
+      CHECK_EQUAL(etl::u32string<30>(STR("0.0001")),                   etl::to_u32string(0.0001, str));
+      CHECK_EQUAL(etl::u32string<30>(STR("1.2e-05")),                  etl::to_u32string(0.000012, str));
+      CHECK_EQUAL(etl::u32string<30>(STR("9007199254740992")),         etl::to_u32string(9007199254740992.0, str));
+      CHECK_EQUAL(etl::u32string<30>(STR("1e+20")),                    etl::to_u32string(1e20, str));
+      CHECK_EQUAL(etl::u32string<30>(STR("1.7976931348623157e+308")),  etl::to_u32string(1.7976931348623157e308, str));
+      CHECK_EQUAL(etl::u32string<30>(STR("5e-324")),                   etl::to_u32string(5e-324, str));
+      CHECK_EQUAL(etl::u32string<30>(STR("3.4028235e+38")),            etl::to_u32string(3.4028235e38f, str));
+      CHECK_EQUAL(etl::u32string<30>(STR("inf")),                      etl::to_u32string(std::numeric_limits<double>::infinity(), str));
+      CHECK_EQUAL(etl::u32string<30>(STR("-inf")),                     etl::to_u32string(-std::numeric_limits<float>::infinity(), str));
+      CHECK_EQUAL(etl::u32string<30>(STR("nan")),                      etl::to_u32string(std::numeric_limits<double>::quiet_NaN(), str));
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_format_append)
+    {
+      etl::u32string<30> str(STR("Result "));
+
+      CHECK_EQUAL(etl::u32string<30>(STR("Result -2.5")),      etl::to_u32string(-2.5, str, true));
+      CHECK_EQUAL(etl::u32string<30>(STR("Result -2.5  0.25")), etl::to_u32string(0.25, str, Format().width(6), true));
+
+      CHECK_EQUAL(etl::u32string<30>(STR("1.5###")),           etl::to_u32string(1.5, str, Format().width(6).fill(STR('#')).left_justified(true)));
+    }
   };
 }
@@ -39,6 +39,8 @@ SOFTWARE.
 #include "data.h"
 
 #include "etl/unordered_set.h"
+#include "etl/cstring.h"
+#include "etl/string_view.h"
 #include "etl/checksum.h"
 
 namespace
@@ -483,5 +485,67 @@ namespace
       CHECK_EQUAL("set = 2", s[0]);
       CHECK_EQUAL("set = 3", s[1]);
     }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_lookup_with_precomputed_hash)
+    {
+      DataNDC data1(initial_data.begin(), initial_data.end());
+      DataNDC data2(initial_data.begin(), initial_data.begin() + 5);
+      const DataNDC& cdata1 = data1;
+
+      for (size_t i = 0; i < initial_data.size(); ++i)
+      {
+        // Hash once, search several containers.
+        size_t hash = data1.hash_function()(initial_data[i]);
+
+        CHECK(data1.find(initial_data[i], hash) == data1.find(initial_data[i]));
+        CHECK(cdata1.find(initial_data[i], hash) == cdata1.find(initial_data[i]));
+        CHECK(data2.find(initial_data[i], hash) == data2.find(initial_data[i]));
+        CHECK_EQUAL(data1.count(initial_data[i]), data1.count(initial_data[i], hash));
+        CHECK_EQUAL(data2.count(initial_data[i]), data2.count(initial_data[i], hash));
+        CHECK(data1.equal_range(initial_data[i], hash) == data1.equal_range(initial_data[i]));
+        CHECK(cdata1.equal_range(initial_data[i], hash) == cdata1.equal_range(initial_data[i]));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_transparent_lookup)
+    {
+      typedef etl::string<8> Key;
+      typedef etl::unordered_set<Key, 6, 3, etl::string_hash, etl::string_equal> Data;
+
+      Data data;
+      const Data& cdata = data;
+
+      data.insert(Key("one"));
+      data.insert(Key("two"));
+      data.insert(Key("three"));
+
+      // C string and string view keys are not converted to Key.
+      CHECK(*data.find("one") == Key("one"));
+      CHECK(cdata.find("one") == cdata.find(Key("one")));
+      CHECK(*data.find(etl::string_view("two")) == Key("two"));
+      CHECK(data.find("four") == data.end());
+      CHECK(data.find(etl::string_view("four")) == data.end());
+
+      CHECK_EQUAL(1U, data.count("three"));
+      CHECK_EQUAL(1U, cdata.count(etl::string_view("three")));
+      CHECK_EQUAL(0U, data.count("four"));
+
+      std::pair<Data::iterator, Data::iterator> range = data.equal_range("three");
+      CHECK_EQUAL(1, std::distance(range.first, range.second));
+
+      std::pair<Data::const_iterator, Data::const_iterator> crange = cdata.equal_range(etl::string_view("three"));
+      CHECK_EQUAL(1, std::distance(crange.first, crange.second));
+
+      // A precomputed hash of a string view.
+      etl::string_view view("two");
+      size_t hash = data.hash_function()(view);
+
+      CHECK(data.find(view, hash) == data.find(Key("two")));
+      CHECK(cdata.find(view, hash) == cdata.find(Key("two")));
+      CHECK_EQUAL(1U, data.count(view, hash));
+      CHECK(data.equal_range(view, hash) == data.equal_range(Key("two")));
+    }
   };
 }
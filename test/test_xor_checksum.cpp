@@ -144,6 +144,53 @@ namespace
       CHECK_EQUAL(hash1, hash2);
       CHECK_EQUAL(hash1, hash3);
     }
+
+    //*************************************************************************
+    TEST(test_checksum_add_block_split_odd_length)
+    {
+      std::vector<uint8_t> data(137);
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        data[i] = uint8_t((i * 97) + 13);
+      }
+
+      uint32_t compare = reference_checksum<uint32_t>(data.begin(), data.end());
+
+      const uint8_t* pbegin = &data[0];
+      const uint8_t* pend   = pbegin + data.size();
+
+      for (size_t split = 0; split <= data.size(); ++split)
+      {
+        etl::xor_checksum<uint32_t> checksum_calculator;
+
+        checksum_calculator.add(pbegin, pbegin + split);
+        checksum_calculator.add(pbegin + split, pend);
+
+        CHECK_EQUAL(compare, checksum_calculator.value());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_checksum_add_block_repeated_data_cancels)
+    {
+      // The data repeats every 61 bytes, so any 122 byte range cancels to zero,
+      // and any 121 byte range leaves just the byte that follows it.
+      std::vector<uint8_t> data(8 + 122);
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        data[i] = uint8_t(((i % 61) * 97) + 13);
+      }
+
+      for (size_t offset = 0; offset < 8; ++offset)
+      {
+        const uint8_t* pbegin = &data[0] + offset;
+
+        CHECK_EQUAL(0U, etl::xor_checksum<uint64_t>(pbegin, pbegin + 122).value());
+        CHECK_EQUAL(uint64_t(pbegin[121]), etl::xor_checksum<uint64_t>(pbegin, pbegin + 121).value());
+      }
+    }
   };
 }
 
@@ -52,6 +52,23 @@ namespace
     return checksum;
   }
 
+  //***************************************************************************
+  // Adds the data as two blocks, split at 'split'.
+  //***************************************************************************
+  template <typename TSum>
+  TSum add_split(const std::vector<uint8_t>& data, size_t split)
+  {
+    const uint8_t* pbegin = &data[0];
+    const uint8_t* pend   = pbegin + data.size();
+
+    etl::xor_rotate_checksum<TSum> checksum_calculator;
+
+    checksum_calculator.add(pbegin, pbegin + split);
+    checksum_calculator.add(pbegin + split, pend);
+
+    return checksum_calculator.value();
+  }
+
   SUITE(test_checksum)
   {
     //*************************************************************************
@@ -144,6 +161,48 @@ namespace
       CHECK_EQUAL(hash1, hash2);
       CHECK_EQUAL(hash1, hash3);
     }
+
+    //*************************************************************************
+    TEST(test_checksum_add_block_split)
+    {
+      // Longer than two groups for every width, with an odd length tail.
+      std::vector<uint8_t> data(133);
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        data[i] = uint8_t((i * 97) + 13);
+      }
+
+      // Each split starts the second block at a different rotation.
+      for (size_t split = 0; split <= data.size(); ++split)
+      {
+        CHECK_EQUAL(int(reference_checksum<uint8_t>(data.begin(), data.end())), int(add_split<uint8_t>(data, split)));
+        CHECK_EQUAL(reference_checksum<uint16_t>(data.begin(), data.end()), add_split<uint16_t>(data, split));
+        CHECK_EQUAL(reference_checksum<uint32_t>(data.begin(), data.end()), add_split<uint32_t>(data, split));
+        CHECK_EQUAL(reference_checksum<uint64_t>(data.begin(), data.end()), add_split<uint64_t>(data, split));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_checksum_add_block_rotation_by_position)
+    {
+      // A lone non-zero byte is rotated once for every byte after it.
+      std::vector<uint8_t> data(101, 0);
+
+      const uint8_t* pbegin = &data[0];
+      const uint8_t* pend   = pbegin + data.size();
+
+      for (size_t position = 0; position < data.size(); ++position)
+      {
+        data[position] = 0x81;
+
+        uint16_t compare = etl::rotate_left(uint16_t(0x81), (data.size() - 1 - position) % 16);
+
+        CHECK_EQUAL(compare, etl::xor_rotate_checksum<uint16_t>(pbegin, pend).value());
+
+        data[position] = 0;
+      }
+    }
   };
 }
 